@@ -18,10 +18,12 @@ namespace components::catalog {
 
     void catalog::create_namespace(const table_namespace_t& namespace_name) {
         namespaces_.create_namespace(namespace_name);
+        ++schema_version_;
     }
 
     void catalog::drop_namespace(const table_namespace_t& namespace_name) {
         namespaces_.drop_namespace(namespace_name);
+        ++schema_version_;
     }
 
     std::pmr::vector<table_id> catalog::list_tables(const table_namespace_t& namespace_name) const {
@@ -83,6 +85,7 @@ namespace components::catalog {
         }
 
         namespaces_.get_namespace_info(id.get_namespace()).tables.emplace(id.table_name(), std::move(meta));
+        ++schema_version_;
         return {};
     }
 
@@ -97,6 +100,7 @@ namespace components::catalog {
 
         namespaces_.get_namespace_info(id.get_namespace())
             .computing.emplace(id.table_name(), computed_schema(resource_));
+        ++schema_version_;
         return {};
     }
 
@@ -126,6 +130,7 @@ namespace components::catalog {
 
         auto& info = get_map_impl<type>(id.get_namespace());
         info.erase(id.table_name());
+        ++schema_version_;
     }
 
     template<catalog::schema_type type>
@@ -142,6 +147,7 @@ namespace components::catalog {
         auto node = info.extract(from.table_name());
         node.key() = to;
         info.insert(std::move(node));
+        ++schema_version_;
         return {};
     }
 
@@ -175,6 +181,8 @@ namespace components::catalog {
         }
 
         transactions_->add_transaction(id);
-        return {resource_, transactions_, id, &namespaces_};
+        return {resource_, transactions_, id, &namespaces_, &schema_version_};
     }
+
+    uint64_t catalog::schema_version() const noexcept { return schema_version_; }
 } // namespace components::catalog
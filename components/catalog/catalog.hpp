@@ -4,6 +4,8 @@
 #include "table_metadata.hpp"
 #include "transaction/transaction_scope.hpp"
 
+#include <atomic>
+
 namespace components::catalog {
     class catalog : public std::enable_shared_from_this<catalog> {
     public:
@@ -42,6 +44,9 @@ namespace components::catalog {
 
         transaction_scope begin_transaction(const table_id& id);
 
+        // changed by every namespace and table change, read by other threads to drop plans of an older schema
+        [[nodiscard]] uint64_t schema_version() const noexcept;
+
     private:
         enum class schema_type : uint8_t
         {
@@ -66,6 +71,7 @@ namespace components::catalog {
         mutable namespace_storage namespaces_;
         std::shared_ptr<transaction_list> transactions_; // the ONLY strong ref to list
         std::pmr::memory_resource* resource_;
+        std::atomic<uint64_t> schema_version_{0};
 
         friend class transaction_scope;
     };
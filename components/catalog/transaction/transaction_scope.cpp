@@ -4,12 +4,14 @@ namespace components::catalog {
     transaction_scope::transaction_scope(std::pmr::memory_resource* resource,
                                          std::weak_ptr<transaction_list> transactions,
                                          const table_id& id,
-                                         namespace_storage* ns_storage)
+                                         namespace_storage* ns_storage,
+                                         std::atomic<uint64_t>* schema_version)
 
         : id_(id)
         , error_()
         , transaction_list_(transactions)
-        , ns_storage_ptr_(ns_storage) {
+        , ns_storage_ptr_(ns_storage)
+        , schema_version_(schema_version) {
         transaction_ = std::unique_ptr<metadata_transaction>(new metadata_transaction(resource));
     }
 
@@ -17,7 +19,8 @@ namespace components::catalog {
         : id_(table_id(resource, table_namespace_t{}, ""))
         , error_(std::move(error))
         , transaction_list_()
-        , ns_storage_ptr_(nullptr) {
+        , ns_storage_ptr_(nullptr)
+        , schema_version_(nullptr) {
         transaction_ = std::unique_ptr<metadata_transaction>(new metadata_transaction(resource, error_));
     }
 
@@ -34,6 +37,7 @@ namespace components::catalog {
         , error_(std::move(other.error_))
         , transaction_list_(std::move(other.transaction_list_))
         , ns_storage_ptr_(other.ns_storage_ptr_)
+        , schema_version_(other.schema_version_)
         , transaction_(std::move(other.transaction_)) {
         other.is_aborted_ = true;
     }
@@ -50,6 +54,7 @@ namespace components::catalog {
             error_ = std::move(other.error_);
             transaction_list_ = std::move(other.transaction_list_);
             ns_storage_ptr_ = other.ns_storage_ptr_;
+            schema_version_ = other.schema_version_;
             transaction_ = std::move(other.transaction_);
 
             other.is_aborted_ = true;
@@ -87,6 +92,7 @@ namespace components::catalog {
             list->remove_transaction(id_);
 
             if (!error_) {
+                ++*schema_version_;
                 is_committed_ = true;
                 return;
             }
@@ -3,6 +3,7 @@
 #include "metadata_transaction.hpp"
 #include "transaction_list.hpp"
 
+#include <atomic>
 #include <memory>
 #include <optional>
 
@@ -14,7 +15,8 @@ namespace components::catalog {
         transaction_scope(std::pmr::memory_resource* resource,
                           std::weak_ptr<transaction_list> transactions,
                           const table_id& id,
-                          namespace_storage* ns_storage);
+                          namespace_storage* ns_storage,
+                          std::atomic<uint64_t>* schema_version);
 
         transaction_scope(std::pmr::memory_resource* resource, catalog_error error);
 
@@ -39,6 +41,8 @@ namespace components::catalog {
         catalog_error error_;
         std::weak_ptr<transaction_list> transaction_list_;
         namespace_storage* ns_storage_ptr_;
+        // schema version of the catalog, changed by a commit
+        std::atomic<uint64_t>* schema_version_;
         std::unique_ptr<metadata_transaction> transaction_;
     };
 } // namespace components::catalog
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <components/log/log.hpp>
+#include <algorithm>
 #include <filesystem>
 #include <mutex>
+#include <thread>
 
 namespace configuration {
 
@@ -14,10 +16,28 @@ namespace configuration {
             : path(path / "log") {}
     };
 
+    // how far a WAL write is pushed to the device before the write is acknowledged
+    enum class wal_durability : std::uint8_t
+    {
+        none,      // left in the OS page cache
+        data_sync, // fdatasync
+        full_sync  // fsync
+    };
+
     struct config_wal final {
         std::filesystem::path path{std::filesystem::current_path() / "wal"};
         bool on{true};
         bool sync_to_disk{true};
+        // records are collected and written (and synced) by a single call before sessions get their success,
+        // without it every record is written on arrival
+        bool group_commit{false};
+        // how long a group stays open while more records keep arriving, 0 takes only the records already queued
+        std::uint64_t group_commit_window_us{0};
+        // a group is written right away once it reaches this size
+        std::uint64_t group_commit_max_bytes{std::uint64_t(1) << 20};
+        wal_durability durability{wal_durability::none};
+        // a new segment file is started once the current one would grow past this size
+        std::uint64_t segment_size{std::uint64_t(64) << 20};
 
         explicit config_wal(const std::filesystem::path& path = std::filesystem::current_path())
             : path(path / "wal") {}
@@ -26,15 +46,38 @@ namespace configuration {
     struct config_disk final {
         std::filesystem::path path{std::filesystem::current_path() / "disk"};
         bool on{true};
+        // table collections are checkpointed after this many WAL records, 0 turns checkpoints off;
+        // WAL segments are only removed after a checkpoint, without one the WAL keeps every record
+        std::uint64_t checkpoint_wal_records{100000};
 
         explicit config_disk(const std::filesystem::path& path = std::filesystem::current_path())
             : path(path / "wal") {}
     };
 
+    struct config_executor final {
+        // threads a table scan or aggregation of a single query runs on, the executor thread included;
+        // 1 keeps the whole query on the executor thread
+        std::uint64_t scan_threads{std::max(1u, std::thread::hardware_concurrency())};
+        // executors the plans are spread over by hash of the collection name,
+        // plans of a collection always run on the same executor in the order they came
+        std::uint64_t executors{1};
+    };
+
+    struct config_scheduler final {
+        // worker threads of memory storage, executors, WAL and disk
+        std::uint64_t workers{1};
+        // worker threads of the dispatcher
+        std::uint64_t dispatcher_workers{1};
+        // messages an actor handles before its worker thread takes another actor
+        std::uint64_t max_throughput{1000};
+    };
+
     struct config final {
         config_log log;
         config_wal wal;
         config_disk disk;
+        config_executor executor;
+        config_scheduler scheduler;
         std::filesystem::path main_path; // mainly used for checking, because log, wal and disk could be missing
 
         config(const std::filesystem::path& path = std::filesystem::current_path());
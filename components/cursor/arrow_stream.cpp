@@ -0,0 +1,112 @@
+#include "arrow_stream.hpp"
+
+#include <components/vector/arrow/arrow_converter.hpp>
+
+#include <cerrno>
+#include <string>
+
+namespace components::cursor {
+
+    namespace {
+
+        struct stream_holder_t {
+            cursor_t_ptr cursor;
+            std::pmr::vector<types::complex_logical_type> types;
+            bool started = false;
+            std::string error;
+        };
+
+        stream_holder_t* holder(ArrowArrayStream* stream) {
+            return static_cast<stream_holder_t*>(stream->private_data);
+        }
+
+        // exceptions must not leave the C callbacks
+        template<typename Func>
+        int guarded(ArrowArrayStream* stream, Func&& func) {
+            try {
+                return func(*holder(stream));
+            } catch (const std::exception& e) {
+                holder(stream)->error = e.what();
+                return EIO;
+            }
+        }
+
+        int check_cursor(stream_holder_t& state) {
+            if (state.cursor->is_error()) {
+                state.error = state.cursor->get_error().what;
+                return EIO;
+            }
+            if (!state.cursor->uses_table_data()) {
+                state.error = "arrow stream: cursor does not hold table data";
+                return EINVAL;
+            }
+            return 0;
+        }
+
+        int get_schema(ArrowArrayStream* stream, ArrowSchema* out) {
+            return guarded(stream, [out](stream_holder_t& state) {
+                if (auto error = check_cursor(state); error != 0) {
+                    return error;
+                }
+                vector::arrow::to_arrow_schema(out, state.types);
+                return 0;
+            });
+        }
+
+        int get_next(ArrowArrayStream* stream, ArrowArray* out) {
+            return guarded(stream, [out](stream_holder_t& state) {
+                if (auto error = check_cursor(state); error != 0) {
+                    return error;
+                }
+                bool has_batch;
+                if (state.started) {
+                    has_batch = state.cursor->next_chunk();
+                    if (!has_batch && state.cursor->is_error()) {
+                        return check_cursor(state);
+                    }
+                } else {
+                    state.started = true;
+                    has_batch = state.cursor->chunk_data().size() != 0 || state.cursor->has_next_chunk();
+                }
+                if (!has_batch) {
+                    // end of the stream
+                    out->release = nullptr;
+                    return 0;
+                }
+                vector::arrow::to_arrow_array(state.cursor->chunk_data(), out);
+                return 0;
+            });
+        }
+
+        const char* get_last_error(ArrowArrayStream* stream) {
+            const auto& error = holder(stream)->error;
+            return error.empty() ? nullptr : error.c_str();
+        }
+
+        void release(ArrowArrayStream* stream) {
+            if (!stream || !stream->release) {
+                return;
+            }
+            stream->release = nullptr;
+            delete holder(stream);
+        }
+
+    } // namespace
+
+    void to_arrow_stream(cursor_t_ptr cursor, ArrowArrayStream* out_stream) {
+        auto state = std::make_unique<stream_holder_t>();
+        // batches of a streamed result have the types of the first one
+        if (cursor->chunk_data().column_count() != 0) {
+            state->types = cursor->chunk_data().types();
+        } else {
+            state->types = cursor->type_data();
+        }
+        state->cursor = std::move(cursor);
+        out_stream->get_schema = get_schema;
+        out_stream->get_next = get_next;
+        out_stream->get_last_error = get_last_error;
+        out_stream->release = release;
+        out_stream->private_data = state.release();
+    }
+
+} // namespace components::cursor
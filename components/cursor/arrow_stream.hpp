@@ -0,0 +1,14 @@
+#pragma once
+
+#include "cursor.hpp"
+
+#include <components/vector/arrow/arrow.hpp>
+
+namespace components::cursor {
+
+    // exports table rows of the cursor as an arrow stream with an array per batch of the cursor
+    // the stream holds the cursor and pulls the following batches with cursor_t::next_chunk,
+    // fixed width columns of the batches are shared with the arrays instead of being copied
+    void to_arrow_stream(cursor_t_ptr cursor, ArrowArrayStream* out_stream);
+
+} // namespace components::cursor
@@ -59,6 +59,12 @@ namespace components::cursor {
         , success_(true)
         , uses_table_data_(true) {}
 
+    cursor_t::~cursor_t() {
+        if (has_next_chunk_ && chunk_source_) {
+            chunk_source_->close();
+        }
+    }
+
     bool cursor_t::uses_table_data() const { return uses_table_data_; }
     std::pmr::vector<document::document_ptr>& cursor_t::document_data() { return document_data_; }
     const std::pmr::vector<document::document_ptr>& cursor_t::document_data() const { return document_data_; }
@@ -69,6 +75,71 @@ namespace components::cursor {
 
     std::size_t cursor_t::size() const { return size_; }
     bool cursor_t::has_next() const { return static_cast<std::size_t>(current_index_ + 1) < size_; }
+
+    bool cursor_t::has_next_chunk() const noexcept { return has_next_chunk_; }
+
+    void cursor_t::set_has_next_chunk(bool has_next_chunk) noexcept { has_next_chunk_ = has_next_chunk; }
+
+    void cursor_t::set_chunk_source(std::unique_ptr<chunk_source_t> source) { chunk_source_ = std::move(source); }
+
+    bool cursor_t::next_chunk() {
+        if (!has_next_chunk_ || !chunk_source_) {
+            return false;
+        }
+        auto next = chunk_source_->fetch();
+        has_next_chunk_ = false;
+        if (!next || next->is_error()) {
+            set_stream_error(next.get());
+            return false;
+        }
+        has_next_chunk_ = next->has_next_chunk_;
+        batch_offset_ += size_;
+        table_data_ = std::move(next->table_data_);
+        size_ = table_data_.size();
+        current_index_ = start_index;
+        return true;
+    }
+
+    bool cursor_t::fetch_all() {
+        if (!has_next_chunk_ || !chunk_source_) {
+            return success_;
+        }
+        table_data_.flatten();
+        while (has_next_chunk_) {
+            auto next = chunk_source_->fetch();
+            has_next_chunk_ = false;
+            if (!next || next->is_error()) {
+                set_stream_error(next.get());
+                return false;
+            }
+            has_next_chunk_ = next->has_next_chunk_;
+            table_data_.append(next->table_data_, true);
+        }
+        size_ = table_data_.size();
+        return true;
+    }
+
+    void cursor_t::set_stream_error(const cursor_t* next) {
+        error_ = next ? next->error_ : error_t(error_code_t::other_error, "stream is closed");
+        success_ = false;
+        size_ = 0;
+        table_data_.reset();
+    }
+
+    std::size_t cursor_t::batch_offset() const noexcept { return batch_offset_; }
+
+    bool cursor_t::seek_batch(std::size_t index) {
+        if (index < batch_offset_) {
+            return false;
+        }
+        while (index >= batch_offset_ + size_) {
+            if (!next_chunk()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     document::document_ptr cursor_t::next_document() {
         return get_document(static_cast<std::size_t>(++current_index_));
     }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include <components/base/collection_full_name.hpp>
@@ -45,6 +46,18 @@ namespace components::cursor {
         explicit error_t(error_code_t type, const std::string& what);
     };
 
+    class cursor_t;
+
+    // pulls further batches of a streamed table result from the storage
+    class chunk_source_t {
+    public:
+        virtual ~chunk_source_t() = default;
+        // returns the next batch, the returned cursor tells if there are more of them
+        virtual boost::intrusive_ptr<cursor_t> fetch() = 0;
+        // releases the stream on the storage side before it is exhausted
+        virtual void close() = 0;
+    };
+
     class cursor_t : public boost::intrusive_ref_counter<cursor_t> {
     public:
         explicit cursor_t(std::pmr::memory_resource* resource);
@@ -54,6 +67,8 @@ namespace components::cursor {
         explicit cursor_t(std::pmr::memory_resource* resource, vector::data_chunk_t&& chunk);
         explicit cursor_t(std::pmr::memory_resource* resource,
                           std::pmr::vector<components::types::complex_logical_type>&& types);
+        cursor_t(cursor_t&&) = default;
+        ~cursor_t();
 
         bool uses_table_data() const;
 
@@ -69,6 +84,22 @@ namespace components::cursor {
         // std::pmr::vector<std::unique_ptr<sub_cursor_t>>::iterator end();
 
         bool has_next() const;
+
+        // table results are streamed: chunk_data() holds the current batch of at most
+        // DEFAULT_VECTOR_CAPACITY rows and size() is the size of that batch
+        bool has_next_chunk() const noexcept;
+        void set_has_next_chunk(bool has_next_chunk) noexcept;
+        void set_chunk_source(std::unique_ptr<chunk_source_t> source);
+        // replaces the current batch with the next one, false if the stream is over or failed
+        bool next_chunk();
+        // appends the remaining batches to the current one, size() is then the size of the whole result;
+        // false if a batch failed
+        bool fetch_all();
+        // index of the first row of the current batch in the whole result
+        std::size_t batch_offset() const noexcept;
+        // pulls batches until the current one holds the row `index` of the whole result,
+        // false if the result ends before it or the row was in a batch already replaced
+        bool seek_batch(std::size_t index);
         document::document_ptr next_document();
         document::document_ptr get_document() const;
         document::document_ptr get_document(std::size_t index) const;
@@ -85,7 +116,10 @@ namespace components::cursor {
         //void sort(std::function<bool(types::logical_value_t, types::logical_value_t)> sorter);
 
     private:
+        void set_stream_error(const cursor_t* next);
+
         std::size_t size_{};
+        std::size_t batch_offset_{0};
         index_t current_index_{start_index};
         std::pmr::vector<document::document_ptr> document_data_;
         vector::data_chunk_t table_data_;
@@ -93,6 +127,8 @@ namespace components::cursor {
         error_t error_;
         bool success_{true};
         bool uses_table_data_{true};
+        bool has_next_chunk_{false};
+        std::unique_ptr<chunk_source_t> chunk_source_;
     };
 
     using cursor_t_ptr = boost::intrusive_ptr<cursor_t>;
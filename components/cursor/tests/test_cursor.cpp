@@ -1,4 +1,5 @@
 #include <catch2/catch.hpp>
+#include <components/cursor/arrow_stream.hpp>
 #include <components/cursor/cursor.hpp>
 #include <components/tests/generaty.hpp>
 #include <core/pmr.hpp>
@@ -57,3 +58,174 @@ TEST_CASE("cursor::sort") {
     REQUIRE(cursor.get_document(0)->get_long("count") == 1);
     REQUIRE(cursor.get_document(99)->get_long("count") == 100);
 }
+
+TEST_CASE("cursor::next_chunk") {
+    using namespace components::types;
+    using namespace components::vector;
+    using components::cursor::cursor_t_ptr;
+
+    auto resource = std::pmr::synchronized_pool_resource();
+
+    // serves `batches` chunks of `rows` rows following the first batch of the cursor
+    struct fake_source_t final : components::cursor::chunk_source_t {
+        std::pmr::memory_resource* resource;
+        size_t batches;
+        size_t rows;
+        size_t fetched = 0;
+        bool* closed;
+
+        fake_source_t(std::pmr::memory_resource* resource, size_t batches, size_t rows, bool* closed)
+            : resource(resource)
+            , batches(batches)
+            , rows(rows)
+            , closed(closed) {}
+
+        cursor_t_ptr fetch() override {
+            if (fetched == batches) {
+                return components::cursor::make_cursor(resource,
+                                                       components::cursor::error_code_t::other_error,
+                                                       "stream is over");
+            }
+            data_chunk_t chunk(resource, {complex_logical_type(logical_type::BIGINT)});
+            chunk.set_cardinality(rows);
+            for (size_t i = 0; i < rows; i++) {
+                chunk.set_value(0, i, logical_value_t{int64_t((fetched + 1) * rows + i)});
+            }
+            auto cursor = components::cursor::make_cursor(resource, std::move(chunk));
+            cursor->set_has_next_chunk(++fetched < batches);
+            return cursor;
+        }
+
+        void close() override { *closed = true; }
+    };
+
+    auto first_batch = [&](size_t rows) {
+        data_chunk_t chunk(&resource, {complex_logical_type(logical_type::BIGINT)});
+        chunk.set_cardinality(rows);
+        for (size_t i = 0; i < rows; i++) {
+            chunk.set_value(0, i, logical_value_t{int64_t(i)});
+        }
+        auto cursor = components::cursor::make_cursor(&resource, std::move(chunk));
+        cursor->set_has_next_chunk(true);
+        return cursor;
+    };
+
+    INFO("all batches are fetched") {
+        bool closed = false;
+        auto cursor = first_batch(10);
+        cursor->set_chunk_source(std::make_unique<fake_source_t>(&resource, 3, 10, &closed));
+        int64_t expected = 0;
+        size_t batches = 0;
+        do {
+            ++batches;
+            REQUIRE(cursor->size() == 10);
+            for (size_t i = 0; i < cursor->size(); i++) {
+                REQUIRE(cursor->chunk_data().value(0, i).value<int64_t>() == expected);
+                ++expected;
+            }
+        } while (cursor->next_chunk());
+        REQUIRE(batches == 4);
+        REQUIRE(expected == 40);
+        REQUIRE(cursor->is_success());
+        REQUIRE_FALSE(cursor->has_next_chunk());
+        cursor.reset();
+        REQUIRE_FALSE(closed);
+    }
+
+    INFO("unfinished stream is closed") {
+        bool closed = false;
+        auto cursor = first_batch(5);
+        cursor->set_chunk_source(std::make_unique<fake_source_t>(&resource, 3, 5, &closed));
+        REQUIRE(cursor->next_chunk());
+        REQUIRE(cursor->has_next_chunk());
+        cursor.reset();
+        REQUIRE(closed);
+    }
+
+    INFO("all batches are appended") {
+        bool closed = false;
+        auto cursor = first_batch(10);
+        cursor->set_chunk_source(std::make_unique<fake_source_t>(&resource, 3, 10, &closed));
+        REQUIRE(cursor->fetch_all());
+        REQUIRE(cursor->size() == 40);
+        REQUIRE_FALSE(cursor->has_next_chunk());
+        for (size_t i = 0; i < cursor->size(); i++) {
+            REQUIRE(cursor->chunk_data().value(0, i).value<int64_t>() == int64_t(i));
+        }
+        REQUIRE(cursor->fetch_all());
+        REQUIRE(cursor->size() == 40);
+        cursor.reset();
+        REQUIRE_FALSE(closed);
+    }
+
+    INFO("batches are pulled up to the row") {
+        bool closed = false;
+        auto cursor = first_batch(10);
+        cursor->set_chunk_source(std::make_unique<fake_source_t>(&resource, 3, 10, &closed));
+        REQUIRE(cursor->seek_batch(5));
+        REQUIRE(cursor->batch_offset() == 0);
+        REQUIRE(cursor->seek_batch(25));
+        REQUIRE(cursor->batch_offset() == 20);
+        REQUIRE(cursor->chunk_data().value(0, 25 - cursor->batch_offset()).value<int64_t>() == 25);
+        REQUIRE_FALSE(cursor->seek_batch(5));
+        REQUIRE(cursor->batch_offset() == 20);
+        REQUIRE(cursor->seek_batch(39));
+        REQUIRE_FALSE(cursor->has_next_chunk());
+        REQUIRE_FALSE(cursor->seek_batch(40));
+        REQUIRE(cursor->is_success());
+    }
+
+    INFO("failed fetch") {
+        bool closed = false;
+        auto cursor = first_batch(5);
+        cursor->set_chunk_source(std::make_unique<fake_source_t>(&resource, 0, 5, &closed));
+        REQUIRE_FALSE(cursor->next_chunk());
+        REQUIRE(cursor->is_error());
+        REQUIRE(cursor->size() == 0);
+        REQUIRE_FALSE(cursor->has_next_chunk());
+    }
+
+    INFO("cursor without stream") {
+        auto cursor = first_batch(5);
+        cursor->set_has_next_chunk(false);
+        REQUIRE_FALSE(cursor->next_chunk());
+        REQUIRE(cursor->is_success());
+        REQUIRE(cursor->size() == 5);
+    }
+
+    INFO("arrow stream") {
+        bool closed = false;
+        auto cursor = first_batch(10);
+        cursor->set_chunk_source(std::make_unique<fake_source_t>(&resource, 2, 10, &closed));
+        ArrowArrayStream stream;
+        components::cursor::to_arrow_stream(cursor, &stream);
+        cursor.reset();
+
+        ArrowSchema schema;
+        REQUIRE(stream.get_schema(&stream, &schema) == 0);
+        REQUIRE(schema.n_children == 1);
+        schema.release(&schema);
+
+        int64_t expected = 0;
+        size_t batches = 0;
+        while (true) {
+            ArrowArray array;
+            REQUIRE(stream.get_next(&stream, &array) == 0);
+            if (!array.release) {
+                break;
+            }
+            ++batches;
+            REQUIRE(array.length == 10);
+            const auto* values = static_cast<const int64_t*>(array.children[0]->buffers[1]);
+            for (int64_t i = 0; i < array.length; i++) {
+                REQUIRE(values[i] == expected);
+                ++expected;
+            }
+            array.release(&array);
+        }
+        REQUIRE(batches == 3);
+        REQUIRE(expected == 30);
+        stream.release(&stream);
+        REQUIRE_FALSE(closed);
+    }
+}
@@ -58,6 +58,14 @@ namespace components::document::json {
         return res->second.get();
     }
 
+    const json_trie_node* json_object::get(std::string_view key, size_t hash) const {
+        auto res = map_.find(key, hash);
+        if (res == map_.end()) {
+            return nullptr;
+        }
+        return res->second.get();
+    }
+
     void json_object::set(json_trie_node* key, json_trie_node* value) {
         map_.emplace(boost::intrusive_ptr<json_trie_node>(key), boost::intrusive_ptr<json_trie_node>(value));
     }
@@ -50,6 +50,8 @@ namespace components::document::json {
         json_object& operator=(const json_object&) = delete;
 
         const json_trie_node* get(std::string_view key) const;
+        // lookup with the hash of the key computed beforehand by json_trie_node_hash
+        const json_trie_node* get(std::string_view key, size_t hash) const;
 
         iterator begin();
         iterator end();
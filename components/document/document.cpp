@@ -34,7 +34,14 @@ namespace components::document {
     }
 
     types::logical_type document_t::type_by_key(std::string_view json_pointer) {
-        const auto value_ptr = find_node_const(json_pointer).first;
+        return node_type_(find_node_const(json_pointer).first);
+    }
+
+    types::logical_type document_t::type_by_key(const document_path_t& path) const {
+        return node_type_(find_node_const(path).first);
+    }
+
+    types::logical_type document_t::node_type_(const json_trie_node_element* value_ptr) {
         if (value_ptr == nullptr) {
             return types::logical_type::INVALID;
         } else if (value_ptr->is_object()) {
@@ -66,6 +73,8 @@ namespace components::document {
         return find_node_const(json_pointer).first != nullptr;
     }
 
+    bool document_t::is_exists(const document_path_t& path) const { return find_node_const(path).first != nullptr; }
+
     bool document_t::is_null(std::string_view json_pointer) const {
         const auto node_ptr = find_node_const(json_pointer).first;
         if (node_ptr == nullptr) {
@@ -78,6 +87,11 @@ namespace components::document {
         ;
     }
 
+    bool document_t::is_null(const document_path_t& path) const {
+        const auto node_ptr = find_node_const(path).first;
+        return node_ptr != nullptr && node_ptr->is_mut() && node_ptr->get_mut()->is_null();
+    }
+
     bool document_t::is_bool(std::string_view json_pointer) const { return is_as<bool>(json_pointer); }
 
     bool document_t::is_utinyint(std::string_view json_pointer) const { return is_as<uint16_t>(json_pointer); }
@@ -144,6 +158,10 @@ namespace components::document {
         return std::pmr::string(get_as<std::string_view>(json_pointer), element_ind_->get_allocator());
     }
 
+    std::pmr::string document_t::get_string(const document_path_t& path) const {
+        return std::pmr::string(get_as<std::string_view>(path), element_ind_->get_allocator());
+    }
+
     document_t::ptr document_t::get_array(std::string_view json_pointer) {
         const auto node_ptr = find_node(json_pointer).first;
         if (node_ptr == nullptr || !node_ptr->is_array()) {
@@ -165,14 +183,33 @@ namespace components::document {
     compare_t document_t::compare(std::string_view json_pointer,
                                   const document_ptr& other,
                                   std::string_view other_json_pointer) const {
+        return compare_paths_(json_pointer, other, other_json_pointer);
+    }
+
+    compare_t document_t::compare(const document_path_t& path,
+                                  const document_ptr& other,
+                                  const document_path_t& other_path) const {
+        return compare_paths_(path, other, other_path);
+    }
+
+    compare_t document_t::compare(std::string_view json_pointer, value_t value) const {
+        return compare_value_(json_pointer, value);
+    }
+
+    compare_t document_t::compare(const document_path_t& path, value_t value) const {
+        return compare_value_(path, value);
+    }
+
+    template<class Path>
+    compare_t document_t::compare_paths_(const Path& path, const document_ptr& other, const Path& other_path) const {
         if (is_valid() && !other->is_valid())
             return compare_t::less;
         if (!is_valid() && other->is_valid())
             return compare_t::more;
         if (!is_valid() && !other->is_valid())
             return compare_t::equals;
-        auto node = find_node_const(json_pointer).first;
-        auto other_node = other->find_node_const(other_json_pointer).first;
+        auto node = find_node_const(path).first;
+        auto other_node = other->find_node_const(other_path).first;
         auto exists = node != nullptr;
         auto other_exists = other_node != nullptr;
         if (exists && !other_exists)
@@ -189,7 +226,8 @@ namespace components::document {
         }
     }
 
-    compare_t document_t::compare(std::string_view json_pointer, value_t value) const {
+    template<class Path>
+    compare_t document_t::compare_value_(const Path& path, value_t value) const {
         if (is_valid() && !value) {
             return compare_t::less;
         }
@@ -199,7 +237,7 @@ namespace components::document {
         if (!is_valid() && !value) {
             return compare_t::equals;
         }
-        auto node = find_node_const(json_pointer).first;
+        auto node = find_node_const(path).first;
         bool exists = node != nullptr;
         if (exists && !value) {
             return compare_t::less;
@@ -412,6 +450,27 @@ namespace components::document {
         return {current, impl::error_code_t::SUCCESS};
     }
 
+    std::pair<const document_t::json_trie_node_element*, impl::error_code_t>
+    document_t::find_node_const(const document_path_t& path) const {
+        const auto* current = element_ind_.get();
+        for (const auto& segment : path.segments_) {
+            if (current->is_object()) {
+                if (segment.is_invalid_key) {
+                    return {nullptr, impl::error_code_t::INVALID_JSON_POINTER};
+                }
+                current = current->get_object()->get(segment.key, segment.hash);
+            } else if (current->is_array()) {
+                current = current->get_array()->get(segment.index);
+            } else {
+                return {nullptr, impl::error_code_t::NO_SUCH_ELEMENT};
+            }
+            if (current == nullptr) {
+                return {nullptr, impl::error_code_t::NO_SUCH_ELEMENT};
+            }
+        }
+        return {current, impl::error_code_t::SUCCESS};
+    }
+
     impl::error_code_t document_t::find_container_key(std::string_view json_pointer,
                                                       json_trie_node_element*& container,
                                                       bool& is_view_key,
@@ -679,6 +738,14 @@ namespace components::document {
         return value_t{};
     }
 
+    value_t document_t::get_value(const document_path_t& path) const {
+        const auto node = find_node_const(path).first;
+        if (node == nullptr || !node->is_mut()) {
+            return value_t{};
+        }
+        return value_t{*node->get_mut()};
+    }
+
     bool document_t::update(const ptr& update) {
         bool result = false;
         auto dict = update->json_trie()->as_object();
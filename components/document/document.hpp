@@ -4,6 +4,7 @@
 #include <boost/json/value.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 #include <components/document/document_id.hpp>
+#include <components/document/document_path.hpp>
 #include <components/document/impl/allocator_intrusive_ref_counter.hpp>
 #include <components/document/impl/document.hpp>
 #include <components/document/impl/element.hpp>
@@ -52,6 +53,8 @@ namespace components::document {
 
         types::logical_type type_by_key(std::string_view json_pointer);
 
+        types::logical_type type_by_key(const document_path_t& path) const;
+
         template<class T>
         impl::error_code_t set(std::string_view json_pointer, T value);
 
@@ -77,8 +80,12 @@ namespace components::document {
 
         bool is_exists(std::string_view json_pointer = "") const;
 
+        bool is_exists(const document_path_t& path) const;
+
         bool is_null(std::string_view json_pointer) const;
 
+        bool is_null(const document_path_t& path) const;
+
         bool is_bool(std::string_view json_pointer) const;
 
         bool is_utinyint(std::string_view json_pointer) const;
@@ -135,40 +142,42 @@ namespace components::document {
 
         std::pmr::string get_string(std::string_view json_pointer) const;
 
+        std::pmr::string get_string(const document_path_t& path) const;
+
         ptr get_array(std::string_view json_pointer);
 
         ptr get_dict(std::string_view json_pointer);
 
         template<class T>
         bool is_as(std::string_view json_pointer) const {
-            const auto node_ptr = find_node_const(json_pointer).first;
-            if (node_ptr == nullptr) {
-                return false;
-            }
-            if (node_ptr->is_mut()) {
-                return node_ptr->get_mut()->is<T>();
-            }
-            return false;
+            return node_is_<T>(find_node_const(json_pointer).first);
+        }
+
+        template<class T>
+        bool is_as(const document_path_t& path) const {
+            return node_is_<T>(find_node_const(path).first);
         }
 
         template<class T>
         T get_as(std::string_view json_pointer) const {
-            const auto node_ptr = find_node_const(json_pointer).first;
-            if (node_ptr == nullptr) {
-                return T();
-            }
-            if (node_ptr->is_mut()) {
-                auto res = node_ptr->get_mut()->get<T>();
-                return res.error() == impl::error_code::SUCCESS ? res.value() : T();
-            }
-            return T();
+            return node_as_<T>(find_node_const(json_pointer).first);
+        }
+
+        template<class T>
+        T get_as(const document_path_t& path) const {
+            return node_as_<T>(find_node_const(path).first);
         }
 
         types::compare_t
         compare(std::string_view json_pointer, const ptr& other, std::string_view other_json_pointer) const;
 
+        types::compare_t
+        compare(const document_path_t& path, const ptr& other, const document_path_t& other_path) const;
+
         types::compare_t compare(std::string_view json_pointer, value_t value) const;
 
+        types::compare_t compare(const document_path_t& path, value_t value) const;
+
         std::pmr::string to_json() const;
 
         boost::intrusive_ptr<json::json_trie_node> json_trie() const;
@@ -177,6 +186,8 @@ namespace components::document {
 
         value_t get_value(std::string_view json_pointer);
 
+        value_t get_value(const document_path_t& path) const;
+
         bool update(const ptr& update);
         bool update(std::string_view json_pointer, const value_t& update);
 
@@ -209,6 +220,40 @@ namespace components::document {
         std::pair<const json_trie_node_element*, impl::error_code_t>
         find_node_const(std::string_view json_pointer) const;
 
+        std::pair<const json_trie_node_element*, impl::error_code_t> find_node_const(const document_path_t& path) const;
+
+        template<class T>
+        static bool node_is_(const json_trie_node_element* node_ptr) {
+            if (node_ptr == nullptr) {
+                return false;
+            }
+            if (node_ptr->is_mut()) {
+                return node_ptr->get_mut()->is<T>();
+            }
+            return false;
+        }
+
+        template<class T>
+        static T node_as_(const json_trie_node_element* node_ptr) {
+            if (node_ptr == nullptr) {
+                return T();
+            }
+            if (node_ptr->is_mut()) {
+                auto res = node_ptr->get_mut()->get<T>();
+                return res.error() == impl::error_code::SUCCESS ? res.value() : T();
+            }
+            return T();
+        }
+
+        static types::logical_type node_type_(const json_trie_node_element* node_ptr);
+
+        // shared by the overloads taking a json pointer and a document_path_t
+        template<class Path>
+        types::compare_t compare_paths_(const Path& path, const ptr& other, const Path& other_path) const;
+
+        template<class Path>
+        types::compare_t compare_value_(const Path& path, value_t value) const;
+
         impl::error_code_t find_container_key(std::string_view json_pointer,
                                               json_trie_node_element*& container,
                                               bool& is_view_key,
@@ -0,0 +1,34 @@
+#include "document_path.hpp"
+#include <components/document/container/json_object.hpp>
+#include <components/document/document.hpp>
+#include <components/document/string_splitter.hpp>
+#include <cstdlib>
+
+namespace components::document {
+
+    document_path_t::document_path_t(std::string_view json_pointer)
+        : json_pointer_(json_pointer) {
+        // the same segments as document_t::find_node_const walks through
+        if (json_pointer.empty()) {
+            return;
+        }
+        if (json_pointer[0] == '/') {
+            json_pointer.remove_prefix(1);
+        }
+        for (auto key : string_splitter(json_pointer, '/')) {
+            segment_t segment{std::string(key), 0, 0, false};
+            segment.index = static_cast<std::size_t>(std::atol(segment.key.c_str()));
+            std::pmr::string unescaped_key;
+            bool is_unescaped;
+            if (unescape_key_(key, is_unescaped, unescaped_key, std::pmr::get_default_resource()) !=
+                impl::error_code_t::SUCCESS) {
+                segment.is_invalid_key = true;
+            } else if (is_unescaped) {
+                segment.key = std::string(unescaped_key);
+            }
+            segment.hash = json::json_trie_node_hash{}(std::string_view(segment.key));
+            segments_.push_back(std::move(segment));
+        }
+    }
+
+} // namespace components::document
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace components::document {
+
+    // json pointer parsed once and looked up in many documents
+    // keys are unescaped and hashed when the path is built, array indices are converted to numbers
+    class document_path_t final {
+    public:
+        document_path_t() = default;
+        explicit document_path_t(std::string_view json_pointer);
+
+        const std::string& json_pointer() const noexcept { return json_pointer_; }
+
+        std::size_t size() const noexcept { return segments_.size(); }
+
+    private:
+        struct segment_t {
+            std::string key;
+            std::size_t hash;
+            std::size_t index;
+            // the key has an invalid escape sequence and can not be found in an object
+            bool is_invalid_key;
+        };
+
+        std::string json_pointer_;
+        std::vector<segment_t> segments_;
+
+        friend class document_t;
+    };
+
+} // namespace components::document
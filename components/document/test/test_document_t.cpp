@@ -903,3 +903,42 @@ TEST_CASE("document_t:: json pointer read") {
     REQUIRE(doc->is_long("/m~0n"));
     REQUIRE(doc->get_long("/m~0n") == 8);
 }
+
+TEST_CASE("document_t::document_path") {
+    using components::document::document_path_t;
+    auto allocator = std::pmr::synchronized_pool_resource();
+    auto doc1 = gen_doc(1, &allocator);
+    auto doc2 = gen_doc(2, &allocator);
+
+    const std::vector<std::string> pointers = {"",
+                                               "/count",
+                                               "count",
+                                               "/countStr",
+                                               "/countArray",
+                                               "/countArray/1",
+                                               "/countArray/10",
+                                               "/countDict/even",
+                                               "/countDict/other",
+                                               "/null",
+                                               "/other",
+                                               "/count/other",
+                                               "/m~2n"};
+    for (const auto& pointer : pointers) {
+        INFO(pointer);
+        const document_path_t path(pointer);
+        REQUIRE(path.json_pointer() == pointer);
+        REQUIRE(doc1->is_exists(path) == doc1->is_exists(pointer));
+        REQUIRE(doc1->is_null(path) == doc1->is_null(pointer));
+        REQUIRE(doc1->type_by_key(path) == doc1->type_by_key(pointer));
+        REQUIRE(doc1->get_as<int64_t>(path) == doc1->get_long(pointer));
+        REQUIRE(doc1->get_string(path) == doc1->get_string(pointer));
+        REQUIRE(doc1->compare(path, doc2, path) == doc1->compare(pointer, doc2, pointer));
+        REQUIRE(doc1->compare(path, doc2->get_value(path)) == doc1->compare(pointer, doc2->get_value(path)));
+    }
+
+    auto doc = make_document(&allocator);
+    REQUIRE(doc->set("/m~1n", int64_t(1)) == error_code_t::SUCCESS);
+    REQUIRE(doc->set("/m~0n", int64_t(2)) == error_code_t::SUCCESS);
+    REQUIRE(doc->get_as<int64_t>(document_path_t("/m~1n")) == 1);
+    REQUIRE(doc->get_as<int64_t>(document_path_t("/m~0n")) == 2);
+}
@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include <components/index/hash_index.hpp>
+#include <components/index/single_field_index.hpp>
+#include <memory_resource>
+#include <random>
+
+using namespace components;
+
+namespace {
+
+    // first argument is the row count, second is the count of distinct keys
+    template<typename Index>
+    void fill_index(Index& index, int64_t rows, int64_t distinct) {
+        for (int64_t i = 0; i < rows; i++) {
+            index.insert(types::logical_value_t{i % distinct}, i);
+        }
+    }
+
+    template<typename Index>
+    void run_insert(benchmark::State& state) {
+        auto resource = std::pmr::synchronized_pool_resource();
+        for (auto _ : state) {
+            Index index(&resource, "bench", {expressions::key_t{"key"}});
+            fill_index(index, state.range(0), state.range(1));
+            benchmark::DoNotOptimize(index.cbegin());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template<typename Index>
+    void run_point_lookup(benchmark::State& state) {
+        auto resource = std::pmr::synchronized_pool_resource();
+        Index index(&resource, "bench", {expressions::key_t{"key"}});
+        fill_index(index, state.range(0), state.range(1));
+
+        std::vector<types::logical_value_t> keys;
+        std::default_random_engine engine{0};
+        std::uniform_int_distribution<int64_t> distribution(0, state.range(1) - 1);
+        for (int i = 0; i < 1024; i++) {
+            keys.emplace_back(distribution(engine));
+        }
+
+        size_t i = 0;
+        for (auto _ : state) {
+            auto range = index.find(keys[i++ % keys.size()]);
+            int64_t sum = 0;
+            for (auto it = range.first; it != range.second; ++it) {
+                sum += it->row_index;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+} // namespace
+
+static void btree_insert(benchmark::State& state) { run_insert<index::single_field_index_t>(state); }
+BENCHMARK(btree_insert)->Args({100000, 100000})->Args({100000, 1000});
+
+static void hash_insert(benchmark::State& state) { run_insert<index::hash_index_t>(state); }
+BENCHMARK(hash_insert)->Args({100000, 100000})->Args({100000, 1000});
+
+static void btree_point_lookup(benchmark::State& state) { run_point_lookup<index::single_field_index_t>(state); }
+BENCHMARK(btree_point_lookup)->Args({100000, 100000})->Args({1000000, 1000000})->Args({100000, 1000});
+
+static void hash_point_lookup(benchmark::State& state) { run_point_lookup<index::hash_index_t>(state); }
+BENCHMARK(hash_point_lookup)->Args({100000, 100000})->Args({1000000, 1000000})->Args({100000, 1000});
+
+BENCHMARK_MAIN();
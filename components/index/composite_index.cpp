@@ -0,0 +1,298 @@
+#include "composite_index.hpp"
+
+#include <algorithm>
+
+namespace components::index {
+
+    namespace {
+
+        int type_rank(types::logical_type type) {
+            if (type == types::logical_type::NA) {
+                return 0;
+            }
+            if (types::is_numeric(type)) {
+                return 1;
+            }
+            if (types::is_duration(type)) {
+                return 2;
+            }
+            if (type == types::logical_type::STRING_LITERAL) {
+                return 3;
+            }
+            return 4;
+        }
+
+        int compare_prefix(const value_t* lhs, std::size_t lhs_size, const value_t* rhs, std::size_t rhs_size) {
+            auto size = std::min(lhs_size, rhs_size);
+            for (std::size_t i = 0; i < size; ++i) {
+                auto result = composite_index_t::compare(lhs[i], rhs[i]);
+                if (result != 0) {
+                    return result;
+                }
+            }
+            if (lhs_size == rhs_size) {
+                return 0;
+            }
+            return lhs_size < rhs_size ? -1 : 1;
+        }
+
+        bool is_list(const value_t& value) {
+            auto type = value.type().type();
+            return type == types::logical_type::LIST || type == types::logical_type::ARRAY;
+        }
+
+        std::vector<value_t> key_values(const value_t& key) {
+            if (key.type().type() == types::logical_type::STRUCT) {
+                return key.children();
+            }
+            return {key};
+        }
+
+        // array elements are the same entry for multikey index
+        void unique_values(std::vector<value_t>& values) {
+            auto less = [](const value_t& lhs, const value_t& rhs) { return composite_index_t::compare(lhs, rhs) < 0; };
+            auto equal = [](const value_t& lhs, const value_t& rhs) {
+                return composite_index_t::compare(lhs, rhs) == 0;
+            };
+            std::sort(values.begin(), values.end(), less);
+            values.erase(std::unique(values.begin(), values.end(), equal), values.end());
+        }
+
+    } // namespace
+
+    int composite_index_t::compare(const value_t& lhs, const value_t& rhs) {
+        auto lhs_rank = type_rank(lhs.type().type());
+        auto rhs_rank = type_rank(rhs.type().type());
+        if (lhs_rank != rhs_rank) {
+            return lhs_rank < rhs_rank ? -1 : 1;
+        }
+        if (lhs_rank == 0) {
+            return 0;
+        }
+        if (lhs_rank == 4) {
+            // nested values are not ordered, entries of the same type are kept together
+            auto lhs_type = lhs.type().type();
+            auto rhs_type = rhs.type().type();
+            if (lhs_type == rhs_type) {
+                return 0;
+            }
+            return lhs_type < rhs_type ? -1 : 1;
+        }
+        return static_cast<int>(lhs.compare(rhs));
+    }
+
+    bool composite_index_t::comparator_t::operator()(const key_values_t& lhs, const key_values_t& rhs) const {
+        return compare_prefix(lhs.data(), lhs.size(), rhs.data(), rhs.size()) < 0;
+    }
+
+    bool composite_index_t::comparator_t::operator()(const key_values_t& lhs, const bound_t& rhs) const {
+        auto result = compare_prefix(lhs.data(), std::min(lhs.size(), rhs.size), rhs.values, rhs.size);
+        return result < 0 || (result == 0 && rhs.after);
+    }
+
+    bool composite_index_t::comparator_t::operator()(const bound_t& lhs, const key_values_t& rhs) const {
+        auto result = compare_prefix(lhs.values, lhs.size, rhs.data(), std::min(rhs.size(), lhs.size));
+        return result < 0 || (result == 0 && !lhs.after);
+    }
+
+    composite_index_t::composite_index_t(std::pmr::memory_resource* resource,
+                                         std::string name,
+                                         const keys_base_storage_t& keys,
+                                         index_type type)
+        : index_t(resource, type, std::move(name), keys)
+        , storage_(resource) {
+        assert(type == index_type::composite || type == index_type::multikey);
+    }
+
+    composite_index_t::~composite_index_t() = default;
+
+    composite_index_t::impl_t::impl_t(const_iterator iterator)
+        : iterator_(iterator) {}
+
+    index_t::iterator::reference composite_index_t::impl_t::value_ref() const { return iterator_->second; }
+
+    index_t::iterator_t::iterator_impl_t* composite_index_t::impl_t::next() {
+        ++iterator_;
+        return this;
+    }
+
+    bool composite_index_t::impl_t::equals(const iterator_impl_t* other) const {
+        return iterator_ == static_cast<const impl_t*>(other)->iterator_;
+    }
+
+    bool composite_index_t::impl_t::not_equals(const iterator_impl_t* other) const { return !equals(other); }
+
+    index_t::iterator::iterator_impl_t* composite_index_t::impl_t::copy() const { return new impl_t(*this); }
+
+    index_t::range composite_index_t::search(const std::vector<value_t>& prefix,
+                                             const value_t* lower,
+                                             bool lower_inclusive,
+                                             const value_t* upper,
+                                             bool upper_inclusive) const {
+        auto bound = prefix;
+        bound.emplace_back();
+        const_iterator first;
+        if (lower) {
+            bound.back() = *lower;
+            first = position(bound, !lower_inclusive);
+        } else if (upper) {
+            // nulls are first, they do not match any bound
+            first = position(bound, true);
+        } else {
+            first = position(prefix, false);
+        }
+        const_iterator last;
+        if (upper) {
+            bound.back() = *upper;
+            last = position(bound, upper_inclusive);
+        } else {
+            last = position(prefix, true);
+        }
+        if (lower && upper && compare(*lower, *upper) > 0) {
+            last = first;
+        }
+        return std::make_pair(iterator(new impl_t(first)), iterator(new impl_t(last)));
+    }
+
+    void composite_index_t::remove_document(const document::document_ptr& doc) {
+        auto id = document::get_document_id(doc);
+        for (const auto& key : expand(doc)) {
+            auto range = storage_.equal_range(key);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second.id == id) {
+                    storage_.erase(it);
+                    break;
+                }
+            }
+        }
+    }
+
+    void composite_index_t::remove_row(const value_t& key, int64_t row_index) {
+        for (const auto& values : expand(key)) {
+            auto range = storage_.equal_range(values);
+            auto it = range.first;
+            while (it != range.second && it->second.row_index != row_index) {
+                ++it;
+            }
+            // same as index_t::remove if the row is unknown
+            if (it == range.second) {
+                it = range.first;
+            }
+            if (it != range.second) {
+                storage_.erase(it);
+            }
+        }
+    }
+
+    std::vector<composite_index_t::key_values_t> composite_index_t::expand(const value_t& key) const {
+        auto values = key_values(key);
+        std::vector<std::vector<value_t>> columns;
+        columns.reserve(values.size());
+        for (auto& value : values) {
+            if (type() == index_type::multikey && is_list(value)) {
+                auto elements = value.children();
+                if (elements.empty()) {
+                    elements.emplace_back();
+                }
+                unique_values(elements);
+                columns.emplace_back(std::move(elements));
+            } else {
+                columns.push_back({std::move(value)});
+            }
+        }
+        return expand(std::move(columns));
+    }
+
+    std::vector<composite_index_t::key_values_t>
+    composite_index_t::expand(const document::document_ptr& doc) {
+        std::vector<std::vector<value_t>> columns;
+        auto keys = this->keys();
+        for (auto key = keys.first; key != keys.second; ++key) {
+            const auto& path = key->as_string();
+            std::vector<value_t> values;
+            if (type() == index_type::multikey && doc->is_array(path)) {
+                auto count = doc->count(path);
+                values.reserve(count);
+                for (std::size_t i = 0; i < count; ++i) {
+                    values.emplace_back(doc->get_value(path + "/" + std::to_string(i)).as_logical_value());
+                }
+                if (values.empty()) {
+                    values.emplace_back();
+                }
+                unique_values(values);
+            } else {
+                values.emplace_back(doc->get_value(path).as_logical_value());
+            }
+            columns.emplace_back(std::move(values));
+        }
+        return expand(std::move(columns));
+    }
+
+    std::vector<composite_index_t::key_values_t>
+    composite_index_t::expand(std::vector<std::vector<value_t>>&& columns) const {
+        std::vector<key_values_t> result;
+        result.emplace_back(resource());
+        for (auto& column : columns) {
+            std::vector<key_values_t> next;
+            next.reserve(result.size() * column.size());
+            for (const auto& prefix : result) {
+                for (const auto& value : column) {
+                    auto& key = next.emplace_back(prefix, resource());
+                    key.push_back(value);
+                }
+            }
+            result = std::move(next);
+        }
+        return result;
+    }
+
+    composite_index_t::const_iterator composite_index_t::position(const std::vector<value_t>& prefix,
+                                                                  bool after) const {
+        return storage_.lower_bound(bound_t{prefix.data(), prefix.size(), after});
+    }
+
+    auto composite_index_t::insert_impl(value_t key, index_value_t value) -> void {
+        for (auto& values : expand(key)) {
+            storage_.emplace(std::move(values), value);
+        }
+    }
+
+    auto composite_index_t::insert_impl(document::document_ptr doc) -> void {
+        auto id = document::get_document_id(doc);
+        for (auto& values : expand(doc)) {
+            storage_.emplace(std::move(values), index_value_t{id, doc});
+        }
+    }
+
+    auto composite_index_t::remove_impl(value_t key) -> void {
+        for (const auto& values : expand(key)) {
+            auto it = storage_.find(values);
+            if (it != storage_.end()) {
+                storage_.erase(it);
+            }
+        }
+    }
+
+    index_t::range composite_index_t::find_impl(const value_t& value) const {
+        auto prefix = key_values(value);
+        return std::make_pair(iterator(new impl_t(position(prefix, false))),
+                              iterator(new impl_t(position(prefix, true))));
+    }
+
+    index_t::range composite_index_t::lower_bound_impl(const value_t& value) const {
+        return std::make_pair(cbegin(), iterator(new impl_t(position(key_values(value), false))));
+    }
+
+    index_t::range composite_index_t::upper_bound_impl(const value_t& value) const {
+        return std::make_pair(iterator(new impl_t(position(key_values(value), true))), cend());
+    }
+
+    index_t::iterator composite_index_t::cbegin_impl() const {
+        return index_t::iterator(new impl_t(storage_.cbegin()));
+    }
+
+    index_t::iterator composite_index_t::cend_impl() const { return index_t::iterator(new impl_t(storage_.cend())); }
+
+    void composite_index_t::clean_memory_to_new_elements_impl(std::size_t) { storage_.clear(); }
+
+} // namespace components::index
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <memory>
+
+#include <core/btree/btree.hpp>
+
+#include "forward.hpp"
+#include "index.hpp"
+
+namespace components::index {
+
+    // ordered index over several keys, entries are sorted by the first key, then by the second and so on
+    // key is passed to index_t api as STRUCT value with a field per index key, a scalar is a prefix of one key
+    // multikey index adds an entry per element of every array value (cartesian product for several arrays)
+    class composite_index_t final : public index_t {
+    public:
+        using key_values_t = std::pmr::vector<value_t>;
+
+        // position before (or after) all keys starting with the prefix
+        struct bound_t {
+            const value_t* values;
+            std::size_t size;
+            bool after;
+        };
+
+        // total order: nulls first, then numeric, duration, string values; other types are grouped by type
+        struct comparator_t {
+            using is_transparent = void;
+            bool operator()(const key_values_t& lhs, const key_values_t& rhs) const;
+            bool operator()(const key_values_t& lhs, const bound_t& rhs) const;
+            bool operator()(const bound_t& lhs, const key_values_t& rhs) const;
+        };
+
+        using storage_t = core::pmr::btree::multi_btree_t<key_values_t, index_value_t, comparator_t>;
+        using const_iterator = storage_t::const_iterator;
+
+        composite_index_t(std::pmr::memory_resource*,
+                          std::string name,
+                          const keys_base_storage_t&,
+                          index_type type = index_type::composite);
+        ~composite_index_t() override;
+
+        static int compare(const value_t& lhs, const value_t& rhs);
+
+        // entries equal to the prefix with the next key in the bounds, missing bound is not checked
+        range search(const std::vector<value_t>& prefix,
+                     const value_t* lower,
+                     bool lower_inclusive,
+                     const value_t* upper,
+                     bool upper_inclusive) const;
+
+        // remove entries of the document (row) only, index_t::remove drops any entry with the key
+        void remove_document(const document::document_ptr& doc);
+        void remove_row(const value_t& key, int64_t row_index);
+
+    private:
+        class impl_t final : public index_t::iterator::iterator_impl_t {
+        public:
+            explicit impl_t(const_iterator iterator);
+            index_t::iterator::reference value_ref() const final;
+            iterator_impl_t* next() final;
+            bool equals(const iterator_impl_t* other) const final;
+            bool not_equals(const iterator_impl_t* other) const final;
+            iterator_impl_t* copy() const final;
+
+        private:
+            const_iterator iterator_;
+        };
+
+        std::vector<key_values_t> expand(const value_t& key) const;
+        std::vector<key_values_t> expand(const document::document_ptr& doc);
+        std::vector<key_values_t> expand(std::vector<std::vector<value_t>>&& columns) const;
+        const_iterator position(const std::vector<value_t>& prefix, bool after) const;
+
+        auto insert_impl(value_t, index_value_t value) -> void final;
+        auto insert_impl(document::document_ptr doc) -> void final;
+        auto remove_impl(value_t key) -> void final;
+        range find_impl(const value_t& value) const final;
+        range lower_bound_impl(const value_t& value) const final;
+        range upper_bound_impl(const value_t& value) const final;
+        iterator cbegin_impl() const final;
+        iterator cend_impl() const final;
+
+        void clean_memory_to_new_elements_impl(std::size_t count) final;
+
+    private:
+        storage_t storage_;
+    };
+
+} // namespace components::index
@@ -15,7 +15,8 @@ namespace services::index {
         success,
         success_create,
         success_find,
-        error
+        error,
+        flush
     };
 
     constexpr auto handler_id(route type) { return handler_id(group_id_t::index, type); }
@@ -1 +1,179 @@
 #include "hash_index.hpp"
+
+#include <absl/hash/hash.h>
+#include <cmath>
+#include <limits>
+
+namespace components::index {
+
+    namespace {
+
+        std::size_t hash_signed(int64_t value) { return absl::Hash<int64_t>{}(value); }
+
+        std::size_t hash_unsigned(uint64_t value) {
+            if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+                return hash_signed(static_cast<int64_t>(value));
+            }
+            return absl::Hash<uint64_t>{}(value);
+        }
+
+        std::size_t hash_floating(double value) {
+            // integral values are compared equal to integers, so they have to share the hash
+            if (std::trunc(value) == value && value >= static_cast<double>(std::numeric_limits<int64_t>::min()) &&
+                value < static_cast<double>(std::numeric_limits<int64_t>::max())) {
+                return hash_signed(static_cast<int64_t>(value));
+            }
+            return absl::Hash<double>{}(value);
+        }
+
+    } // namespace
+
+    std::size_t hash_index_t::hash_t::operator()(const value_t& value) const {
+        using types::logical_type;
+        switch (value.type().type()) {
+            case logical_type::BOOLEAN:
+                return hash_signed(value.value<bool>());
+            case logical_type::TINYINT:
+                return hash_signed(value.value<int8_t>());
+            case logical_type::SMALLINT:
+                return hash_signed(value.value<int16_t>());
+            case logical_type::INTEGER:
+                return hash_signed(value.value<int32_t>());
+            case logical_type::BIGINT:
+                return hash_signed(value.value<int64_t>());
+            case logical_type::UTINYINT:
+                return hash_unsigned(value.value<uint8_t>());
+            case logical_type::USMALLINT:
+                return hash_unsigned(value.value<uint16_t>());
+            case logical_type::UINTEGER:
+                return hash_unsigned(value.value<uint32_t>());
+            case logical_type::UBIGINT:
+                return hash_unsigned(value.value<uint64_t>());
+            case logical_type::HUGEINT: {
+                auto huge = value.value<types::int128_t>();
+                if (huge >= std::numeric_limits<int64_t>::min() && huge <= std::numeric_limits<int64_t>::max()) {
+                    return hash_signed(static_cast<int64_t>(huge));
+                }
+                return absl::Hash<uint64_t>{}(static_cast<uint64_t>(huge >> 64)) ^
+                       absl::Hash<uint64_t>{}(static_cast<uint64_t>(huge));
+            }
+            case logical_type::UHUGEINT: {
+                auto huge = value.value<types::uint128_t>();
+                if (huge <= std::numeric_limits<uint64_t>::max()) {
+                    return hash_unsigned(static_cast<uint64_t>(huge));
+                }
+                return absl::Hash<uint64_t>{}(static_cast<uint64_t>(huge >> 64)) ^
+                       absl::Hash<uint64_t>{}(static_cast<uint64_t>(huge));
+            }
+            case logical_type::FLOAT:
+                return hash_floating(value.value<float>());
+            case logical_type::DOUBLE:
+                return hash_floating(value.value<double>());
+            case logical_type::TIMESTAMP_SEC:
+            case logical_type::TIMESTAMP_MS:
+            case logical_type::TIMESTAMP_US:
+            case logical_type::TIMESTAMP_NS:
+                return hash_signed(value.value<std::chrono::nanoseconds>().count());
+            case logical_type::STRING_LITERAL:
+                return absl::Hash<std::string_view>{}(value.value<std::string_view>());
+            default:
+                // nested and rare types share a bucket per type, lookups fall back to equal_t
+                return absl::Hash<uint8_t>{}(static_cast<uint8_t>(value.type().type()));
+        }
+    }
+
+    bool hash_index_t::equal_t::operator()(const value_t& lhs, const value_t& rhs) const {
+        auto lhs_type = lhs.type().type();
+        auto rhs_type = rhs.type().type();
+        if (lhs_type != rhs_type && !(types::is_numeric(lhs_type) && types::is_numeric(rhs_type)) &&
+            !(types::is_duration(lhs_type) && types::is_duration(rhs_type))) {
+            return false;
+        }
+        return lhs == rhs;
+    }
+
+    hash_index_t::hash_index_t(std::pmr::memory_resource* resource,
+                               std::string name,
+                               const keys_base_storage_t& keys)
+        : index_t(resource, logical_plan::index_type::hashed, std::move(name), keys)
+        , storage_(resource) {}
+
+    hash_index_t::~hash_index_t() = default;
+
+    hash_index_t::impl_t::impl_t(const_iterator bucket, std::size_t position)
+        : bucket_(bucket)
+        , position_(position) {}
+
+    index_t::iterator::reference hash_index_t::impl_t::value_ref() const { return bucket_->second[position_]; }
+
+    index_t::iterator_t::iterator_impl_t* hash_index_t::impl_t::next() {
+        // buckets are never empty, so the next bucket always starts with a value or is the end
+        if (++position_ == bucket_->second.size()) {
+            ++bucket_;
+            position_ = 0;
+        }
+        return this;
+    }
+
+    bool hash_index_t::impl_t::equals(const iterator_impl_t* other) const {
+        auto* rhs = static_cast<const impl_t*>(other);
+        return bucket_ == rhs->bucket_ && position_ == rhs->position_;
+    }
+
+    bool hash_index_t::impl_t::not_equals(const iterator_impl_t* other) const { return !equals(other); }
+
+    index_t::iterator::iterator_impl_t* hash_index_t::impl_t::copy() const { return new impl_t(*this); }
+
+    auto hash_index_t::insert_impl(value_t key, index_value_t value) -> void {
+        auto it = storage_.find(key);
+        if (it == storage_.end()) {
+            it = storage_.emplace(std::move(key), values_t(storage_.get_allocator().resource())).first;
+        }
+        it->second.push_back(std::move(value));
+    }
+
+    auto hash_index_t::insert_impl(document::document_ptr doc) -> void {
+        auto id = document::get_document_id(doc);
+        auto value = doc->get_value(keys().first->as_string()).as_logical_value();
+        insert_impl(value, {id, std::move(doc)});
+    }
+
+    auto hash_index_t::remove_impl(value_t key) -> void {
+        auto it = storage_.find(key);
+        if (it == storage_.end()) {
+            return;
+        }
+        it->second.pop_back();
+        if (it->second.empty()) {
+            storage_.erase(it);
+        }
+    }
+
+    index_t::range hash_index_t::find_impl(const value_t& value) const {
+        auto it = storage_.find(value);
+        if (it == storage_.end()) {
+            return std::make_pair(cend(), cend());
+        }
+        return std::make_pair(iterator(new impl_t(it, 0)), iterator(new impl_t(std::next(it), 0)));
+    }
+
+    index_t::range hash_index_t::lower_bound_impl(const value_t&) const {
+        assert(false && "hash_index_t: ordered search is not supported");
+        return std::make_pair(cend(), cend());
+    }
+
+    index_t::range hash_index_t::upper_bound_impl(const value_t&) const {
+        assert(false && "hash_index_t: ordered search is not supported");
+        return std::make_pair(cend(), cend());
+    }
+
+    index_t::iterator hash_index_t::cbegin_impl() const { return index_t::iterator(new impl_t(storage_.cbegin(), 0)); }
+
+    index_t::iterator hash_index_t::cend_impl() const { return index_t::iterator(new impl_t(storage_.cend(), 0)); }
+
+    void hash_index_t::clean_memory_to_new_elements_impl(std::size_t count) {
+        storage_.clear();
+        storage_.reserve(count);
+    }
+
+} // namespace components::index
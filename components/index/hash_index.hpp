@@ -1,5 +1,61 @@
 #pragma once
 
-#include <unordered_map>
+#include <memory>
+
+#include <core/hash_map/hash_map.hpp>
 
 #include "forward.hpp"
+#include "index.hpp"
+
+namespace components::index {
+
+    // equality only index: lower_bound and upper_bound are not supported
+    class hash_index_t final : public index_t {
+    public:
+        // values equal by logical_value_t::operator== (e.g. INTEGER 42 and BIGINT 42) have the same hash
+        struct hash_t {
+            std::size_t operator()(const value_t& value) const;
+        };
+        // values of incomparable types are not equal
+        struct equal_t {
+            bool operator()(const value_t& lhs, const value_t& rhs) const;
+        };
+
+        using values_t = std::pmr::vector<index_value_t>;
+        using storage_t = core::pmr::hash_map::flat_hash_map<value_t, values_t, hash_t, equal_t>;
+        using const_iterator = storage_t::const_iterator;
+
+        hash_index_t(std::pmr::memory_resource*, std::string name, const keys_base_storage_t&);
+        ~hash_index_t() override;
+
+    private:
+        class impl_t final : public index_t::iterator::iterator_impl_t {
+        public:
+            impl_t(const_iterator bucket, std::size_t position);
+            index_t::iterator::reference value_ref() const final;
+            iterator_impl_t* next() final;
+            bool equals(const iterator_impl_t* other) const final;
+            bool not_equals(const iterator_impl_t* other) const final;
+            iterator_impl_t* copy() const final;
+
+        private:
+            const_iterator bucket_;
+            std::size_t position_;
+        };
+
+        auto insert_impl(value_t, index_value_t value) -> void final;
+        auto insert_impl(document::document_ptr doc) -> void final;
+        auto remove_impl(value_t key) -> void final;
+        range find_impl(const value_t& value) const final;
+        range lower_bound_impl(const value_t& value) const final;
+        range upper_bound_impl(const value_t& value) const final;
+        iterator cbegin_impl() const final;
+        iterator cend_impl() const final;
+
+        void clean_memory_to_new_elements_impl(std::size_t count) final;
+
+    private:
+        storage_t storage_;
+    };
+
+} // namespace components::index
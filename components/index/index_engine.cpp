@@ -3,6 +3,7 @@
 #include <iostream>
 #include <utility>
 
+#include "composite_index.hpp"
 #include "core/pmr.hpp"
 #include "vector/data_chunk.hpp"
 
@@ -20,11 +21,80 @@ namespace components::index {
         /// index->find(id,set);
     }
 
+    namespace {
+
+        bool is_composite(const index_t* index) {
+            return index->type() == index_type::composite || index->type() == index_type::multikey;
+        }
+
+        // disk indexes store document ids, a row of a table is kept in the low bytes of one (big endian)
+        document::document_id_t row_id(size_t row) {
+            oid::byte_t data[document::document_id_t::size] = {};
+            for (size_t i = 0; i < sizeof(uint64_t); i++) {
+                data[document::document_id_t::size - 1 - i] = static_cast<oid::byte_t>(uint64_t(row) >> (8 * i));
+            }
+            return document::document_id_t(data);
+        }
+
+    } // namespace
+
     void drop_index(const index_engine_ptr& ptr, index_t::pointer index) { ptr->drop_index(index); }
 
+    auto search_range(index_t::pointer index, expressions::compare_type compare, const value_t& value)
+        -> std::vector<index_t::range> {
+        using expressions::compare_type;
+        switch (compare) {
+            case compare_type::eq:
+                return {index->find(value)};
+            case compare_type::ne:
+                return {index->lower_bound(value), index->upper_bound(value)};
+            case compare_type::gt:
+                return {index->upper_bound(value)};
+            case compare_type::lt:
+                return {index->lower_bound(value)};
+            case compare_type::gte:
+                return {index->find(value), index->upper_bound(value)};
+            case compare_type::lte:
+                return {index->lower_bound(value), index->find(value)};
+            default:
+                //todo: error
+                return {{index->cend(), index->cend()}, {index->cend(), index->cend()}};
+        }
+    }
+
+    auto search_range(const index_match_t& match, const logical_plan::storage_parameters* parameters)
+        -> index_t::range {
+        using expressions::compare_type;
+        using logical_plan::get_parameter;
+        assert(match.index && is_composite(match.index));
+        std::vector<value_t> prefix;
+        prefix.reserve(match.equals.size());
+        for (const auto& term : match.equals) {
+            prefix.emplace_back(get_parameter(parameters, term->value()).as_logical_value());
+        }
+        value_t lower;
+        value_t upper;
+        if (match.lower) {
+            lower = get_parameter(parameters, match.lower->value()).as_logical_value();
+        }
+        if (match.upper) {
+            upper = get_parameter(parameters, match.upper->value()).as_logical_value();
+        }
+        return static_cast<composite_index_t*>(match.index)
+            ->search(prefix,
+                     match.lower ? &lower : nullptr,
+                     match.lower && match.lower->type() == compare_type::gte,
+                     match.upper ? &upper : nullptr,
+                     match.upper && match.upper->type() == compare_type::lte);
+    }
+
     void insert(const index_engine_ptr& ptr, id_index id, std::pmr::vector<document_ptr>& docs) {
         auto* index = search_index(ptr, id);
         for (const auto& i : docs) {
+            if (is_composite(index)) {
+                index->insert(i);
+                continue;
+            }
             auto range = index->keys();
             for (auto j = range.first; j != range.second; ++j) {
                 const auto& key_tmp = *j;
@@ -42,6 +112,10 @@ namespace components::index {
                 core::pmr::btree::btree_t<document::document_id_t, document_ptr>& docs) {
         auto* index = search_index(ptr, id);
         for (auto& doc : docs) {
+            if (is_composite(index)) {
+                index->insert(doc.second);
+                continue;
+            }
             auto range = index->keys();
             for (auto j = range.first; j != range.second; ++j) {
                 const auto& key_tmp = *j;
@@ -56,6 +130,10 @@ namespace components::index {
 
     void insert_one(const index_engine_ptr& ptr, id_index id, document_ptr doc) {
         auto* index = search_index(ptr, id);
+        if (is_composite(index)) {
+            index->insert(doc);
+            return;
+        }
         auto range = index->keys();
         for (auto j = range.first; j != range.second; ++j) {
             if (j->which() == key_t::type::string) {
@@ -75,6 +153,12 @@ namespace components::index {
         return ptr->matching(query);
     }
 
+    auto search_index(const index_engine_ptr& ptr,
+                      const keys_base_storage_t& query,
+                      expressions::compare_type compare) -> index_t::pointer {
+        return ptr->matching(query, compare);
+    }
+
     auto search_index(const index_engine_ptr& ptr, const actor_zeta::address_t& address) -> index_t::pointer {
         return ptr->matching(address);
     }
@@ -83,6 +167,11 @@ namespace components::index {
         return ptr->matching(name);
     }
 
+    auto search_index(const index_engine_ptr& ptr, const expressions::compare_expression_ptr& conjunction)
+        -> index_match_t {
+        return ptr->matching(conjunction);
+    }
+
     auto make_index_engine(std::pmr::memory_resource* resource) -> index_engine_ptr {
         auto size = sizeof(index_engine_t);
         auto align = alignof(index_engine_t);
@@ -134,20 +223,30 @@ namespace components::index {
         return value_t{};
     }
 
+    value_t get_value_by_key(const key_t& key, const vector::data_chunk_t& chunk, size_t row) {
+        if (key.is_string()) {
+            for (const auto& column : chunk.data) {
+                if (column.type().alias() == key.as_string()) {
+                    return column.value(row);
+                }
+            }
+            return types::logical_value_t{};
+        }
+        size_t column_index = key.is_int() ? key.as_int() : key.as_uint();
+        return chunk.data.at(column_index).value(row);
+    }
+
     value_t get_value_by_index(const index_ptr& index, const vector::data_chunk_t& chunk, size_t row) {
         auto keys = index->keys();
-        if (keys.first != keys.second) {
-            //todo: multi values index
-            if (keys.first->is_string()) {
-                for (const auto& column : chunk.data) {
-                    if (column.type().alias() == keys.first->as_string()) {
-                        return column.value(row);
-                    }
-                }
-            } else {
-                size_t column_index = keys.first->is_int() ? keys.first->as_int() : keys.first->as_uint();
-                return chunk.data.at(column_index).value(row);
+        if (is_composite(index.get())) {
+            std::vector<value_t> values;
+            for (auto key = keys.first; key != keys.second; ++key) {
+                values.emplace_back(get_value_by_key(*key, chunk, row));
             }
+            return value_t::create_struct(values);
+        }
+        if (keys.first != keys.second) {
+            return get_value_by_key(*keys.first, chunk, row);
         }
         return types::logical_value_t{};
     }
@@ -155,6 +254,7 @@ namespace components::index {
     index_engine_t::index_engine_t(std::pmr::memory_resource* resource)
         : resource_(resource)
         , mapper_(resource)
+        , hashed_mapper_(resource)
         , index_to_mapper_(resource)
         , index_to_address_(resource)
         , index_to_name_(resource)
@@ -163,7 +263,8 @@ namespace components::index {
     auto index_engine_t::add_index(const keys_base_storage_t& keys, index_ptr index) -> uint32_t {
         auto end = storage_.cend();
         auto d = storage_.insert(end, std::move(index));
-        mapper_.emplace(keys, d->get());
+        auto& mapper = d->get()->type() == index_type::hashed ? hashed_mapper_ : mapper_;
+        mapper.emplace(keys, d->get());
         auto new_id = index_to_mapper_.size();
         index_to_mapper_.emplace(new_id, d->get());
         index_to_name_.emplace(d->get()->name(), d->get());
@@ -181,7 +282,11 @@ namespace components::index {
         }
         index_to_name_.erase(index->name());
         //index_to_mapper_.erase(index.id); //todo
-        mapper_.erase(index->keys_);
+        auto& mapper = index->type() == index_type::hashed ? hashed_mapper_ : mapper_;
+        auto it = mapper.find(index->keys_);
+        if (it != mapper.end() && it->second == index) {
+            mapper.erase(it);
+        }
         storage_.erase(std::remove_if(storage_.begin(), storage_.end(), equal), storage_.end());
     }
 
@@ -189,16 +294,116 @@ namespace components::index {
 
     auto index_engine_t::matching(id_index id) -> index_t::pointer { return index_to_mapper_.find(id)->second; }
 
-    auto index_engine_t::size() const -> std::size_t { return mapper_.size(); }
+    auto index_engine_t::size() const -> std::size_t { return mapper_.size() + hashed_mapper_.size(); }
 
     auto index_engine_t::matching(const keys_base_storage_t& query) -> index_t::pointer {
         auto it = mapper_.find(query);
         if (it != mapper_.end()) {
             return it->second;
         }
+        it = hashed_mapper_.find(query);
+        if (it != hashed_mapper_.end()) {
+            return it->second;
+        }
+        return nullptr;
+    }
+
+    auto index_engine_t::matching(const keys_base_storage_t& query, expressions::compare_type compare)
+        -> index_t::pointer {
+        if (compare == expressions::compare_type::eq) {
+            auto it = hashed_mapper_.find(query);
+            if (it != hashed_mapper_.end()) {
+                return it->second;
+            }
+        }
+        auto it = mapper_.find(query);
+        if (it != mapper_.end()) {
+            // multikey index has an entry per array element, a range would return a document several times
+            if (it->second->type() == index_type::multikey && compare != expressions::compare_type::eq) {
+                return nullptr;
+            }
+            return it->second;
+        }
         return nullptr;
     }
 
+    auto index_engine_t::matching(const expressions::compare_expression_ptr& conjunction) -> index_match_t {
+        using expressions::compare_type;
+        index_match_t result;
+        if (conjunction->type() != compare_type::union_and) {
+            return result;
+        }
+        std::vector<expressions::compare_expression_ptr> terms;
+        for (const auto& child : conjunction->children()) {
+            const auto& term = reinterpret_cast<const expressions::compare_expression_ptr&>(child);
+            switch (term->type()) {
+                case compare_type::eq:
+                case compare_type::gt:
+                case compare_type::gte:
+                case compare_type::lt:
+                case compare_type::lte:
+                    if (term->key_right().is_null()) {
+                        terms.push_back(term);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+        auto find_term = [&terms](const key_t& key, auto predicate) -> expressions::compare_expression_ptr {
+            for (const auto& term : terms) {
+                if (term->key_left() == key && predicate(term->type())) {
+                    return term;
+                }
+            }
+            return nullptr;
+        };
+        auto score = [](const index_match_t& match) {
+            return match.equals.size() * 2 + (match.lower || match.upper ? 1 : 0);
+        };
+
+        for (const auto& index : storage_) {
+            // composite indexes are memory only
+            if (!is_composite(index.get()) || index->is_disk()) {
+                continue;
+            }
+            index_match_t match;
+            match.index = index.get();
+            auto keys = index->keys();
+            auto key = keys.first;
+            for (; key != keys.second; ++key) {
+                auto term = find_term(*key, [](compare_type type) { return type == compare_type::eq; });
+                if (!term) {
+                    break;
+                }
+                match.equals.push_back(std::move(term));
+            }
+            if (index->type() == index_type::multikey) {
+                // array elements are separate entries, only a full key finds a document once
+                if (key != keys.second) {
+                    continue;
+                }
+            } else if (key != keys.second) {
+                match.lower = find_term(*key, [](compare_type type) {
+                    return type == compare_type::gt || type == compare_type::gte;
+                });
+                match.upper = find_term(*key, [](compare_type type) {
+                    return type == compare_type::lt || type == compare_type::lte;
+                });
+            }
+            auto used = match.equals.size() + (match.lower ? 1 : 0) + (match.upper ? 1 : 0);
+            if (used == 0) {
+                continue;
+            }
+            match.is_exact = used == conjunction->children().size();
+            if (!result.index || score(match) > score(result) ||
+                (score(match) == score(result) && match.is_exact && !result.is_exact)) {
+                result = std::move(match);
+            }
+        }
+        return result;
+    }
+
     auto index_engine_t::matching(const actor_zeta::address_t& address) -> index_t::pointer {
         auto it = index_to_address_.find(address);
         if (it != index_to_address_.end()) {
@@ -219,6 +424,11 @@ namespace components::index {
 
     void index_engine_t::insert_document(const document_ptr& document, pipeline::context_t* pipeline_context) {
         for (auto& index : storage_) {
+            if (is_composite(index.get())) {
+                // missing keys are stored as nulls
+                index->insert(document);
+                continue;
+            }
             if (is_match_document(index, document)) {
                 auto key = get_value_by_index(index, document);
                 index->insert(key, document);
@@ -234,6 +444,10 @@ namespace components::index {
 
     void index_engine_t::delete_document(const document_ptr& document, pipeline::context_t* pipeline_context) {
         for (auto& index : storage_) {
+            if (is_composite(index.get())) {
+                static_cast<composite_index_t*>(index.get())->remove_document(document);
+                continue;
+            }
             if (is_match_document(index, document)) {
                 auto key = get_value_by_index(index, document);
                 index->remove(key); //todo: bug
@@ -247,33 +461,69 @@ namespace components::index {
         }
     }
 
-    void
-    index_engine_t::insert_row(const vector::data_chunk_t& chunk, size_t row, pipeline::context_t* pipeline_context) {
+    void index_engine_t::insert_row(const vector::data_chunk_t& chunk,
+                                    size_t row,
+                                    int64_t id,
+                                    pipeline::context_t* pipeline_context) {
+        // the offset wraps around for an id below the position, the sum is the id again
+        insert_rows_(chunk, row, row + 1, static_cast<size_t>(id) - row, pipeline_context);
+    }
+
+    void index_engine_t::insert_rows(const vector::data_chunk_t& chunk,
+                                     size_t row_start,
+                                     pipeline::context_t* pipeline_context) {
+        insert_rows_(chunk, 0, chunk.size(), row_start, pipeline_context);
+    }
+
+    void index_engine_t::insert_rows_(const vector::data_chunk_t& chunk,
+                                      size_t begin,
+                                      size_t end,
+                                      size_t row_offset,
+                                      pipeline::context_t* pipeline_context) {
         for (auto& index : storage_) {
-            if (is_match_column(index, chunk)) {
-                auto key = get_value_by_index(index, chunk, row);
+            // the columns are matched once per chunk instead of once per row
+            if (!is_match_column(index, chunk)) {
+                continue;
+            }
+            const bool to_disk = index->is_disk() && pipeline_context;
+            std::vector<std::pair<value_t, document::document_id_t>> disk_values;
+            if (to_disk) {
+                disk_values.reserve(end - begin);
+            }
+            for (size_t i = begin; i < end; i++) {
+                auto key = get_value_by_index(index, chunk, i);
+                auto row = row_offset + i;
                 index->insert(key, row);
-                if (index->is_disk() && pipeline_context) {
-                    pipeline_context->send(index->disk_agent(),
-                                           services::index::handler_id(services::index::route::insert),
-                                           key,
-                                           row);
+                if (to_disk) {
+                    disk_values.emplace_back(std::move(key), row_id(row));
                 }
             }
+            // one message per disk index and chunk, the agent applies it as a single batch
+            if (to_disk && !disk_values.empty()) {
+                pipeline_context->send(index->disk_agent(),
+                                       services::index::handler_id(services::index::route::insert_many),
+                                       std::move(disk_values));
+            }
         }
     }
 
-    void
-    index_engine_t::delete_row(const vector::data_chunk_t& chunk, size_t row, pipeline::context_t* pipeline_context) {
+    void index_engine_t::delete_row(const vector::data_chunk_t& chunk,
+                                    size_t row,
+                                    int64_t id,
+                                    pipeline::context_t* pipeline_context) {
         for (auto& index : storage_) {
             if (is_match_column(index, chunk)) {
                 auto key = get_value_by_index(index, chunk, row);
+                if (is_composite(index.get())) {
+                    static_cast<composite_index_t*>(index.get())->remove_row(key, id);
+                    continue;
+                }
                 index->remove(key);
                 if (index->is_disk() && pipeline_context) {
                     pipeline_context->send(index->disk_agent(),
                                            services::index::handler_id(services::index::route::remove),
                                            key,
-                                           row);
+                                           row_id(static_cast<size_t>(id)));
                 }
             }
         }
@@ -12,6 +12,7 @@
 #include "forward.hpp"
 #include "index.hpp"
 #include <components/context/context.hpp>
+#include <components/logical_plan/param_storage.hpp>
 #include <core/btree/btree.hpp>
 
 namespace components::vector {
@@ -21,11 +22,25 @@ namespace components::index {
 
     constexpr uint32_t INDEX_ID_UNDEFINED = std::numeric_limits<uint32_t>::max();
 
+    // ordered index answering a conjunction: equality on a prefix of index keys and bounds on the next key
+    struct index_match_t {
+        index_t::pointer index{nullptr};
+        std::vector<expressions::compare_expression_ptr> equals;
+        expressions::compare_expression_ptr lower; // gt or gte
+        expressions::compare_expression_ptr upper; // lt or lte
+        // every term of the conjunction is answered by the index
+        bool is_exact{false};
+    };
+
     struct index_engine_t final {
     public:
         explicit index_engine_t(std::pmr::memory_resource* resource);
         auto matching(id_index id) -> index_t::pointer;
         auto matching(const keys_base_storage_t& query) -> index_t::pointer;
+        // index able to answer the predicate, hashed index is preferred for equality
+        auto matching(const keys_base_storage_t& query, expressions::compare_type compare) -> index_t::pointer;
+        // longest match of $and terms among composite and multikey indexes
+        auto matching(const expressions::compare_expression_ptr& conjunction) -> index_match_t;
         auto matching(const actor_zeta::address_t& address) -> index_t::pointer;
         auto matching(const std::string& name) -> index_t::pointer;
         auto has_index(const std::string& name)
@@ -38,8 +53,17 @@ namespace components::index {
 
         void insert_document(const document_ptr& document, pipeline::context_t* pipeline_context);
         void delete_document(const document_ptr& document, pipeline::context_t* pipeline_context);
-        void insert_row(const vector::data_chunk_t& chunk, size_t row, pipeline::context_t* pipeline_context);
-        void delete_row(const vector::data_chunk_t& chunk, size_t row, pipeline::context_t* pipeline_context);
+        // row is the position in the chunk, id the table row it is stored as
+        void insert_row(const vector::data_chunk_t& chunk,
+                        size_t row,
+                        int64_t id,
+                        pipeline::context_t* pipeline_context);
+        // all rows of the chunk, the i-th of them is stored as the row row_start + i
+        void insert_rows(const vector::data_chunk_t& chunk, size_t row_start, pipeline::context_t* pipeline_context);
+        void delete_row(const vector::data_chunk_t& chunk,
+                        size_t row,
+                        int64_t id,
+                        pipeline::context_t* pipeline_context);
 
         auto indexes() -> std::vector<std::string>;
 
@@ -54,10 +78,18 @@ namespace components::index {
 
         std::pmr::memory_resource* resource_;
         keys_to_doc_t mapper_;
+        keys_to_doc_t hashed_mapper_;
         index_to_doc_t index_to_mapper_;
         index_to_address_t index_to_address_;
         index_to_name_t index_to_name_;
         base_storage storage_;
+
+        // rows [begin, end) of the chunk, the i-th of them is stored as the row row_offset + i
+        void insert_rows_(const vector::data_chunk_t& chunk,
+                          size_t begin,
+                          size_t end,
+                          size_t row_offset,
+                          pipeline::context_t* pipeline_context);
     };
 
     using index_engine_ptr = core::pmr::unique_ptr<index_engine_t>;
@@ -65,7 +97,12 @@ namespace components::index {
     auto make_index_engine(std::pmr::memory_resource* resource) -> index_engine_ptr;
     auto search_index(const index_engine_ptr& ptr, id_index id) -> index_t::pointer;
     auto search_index(const index_engine_ptr& ptr, const keys_base_storage_t& query) -> index_t::pointer;
+    auto search_index(const index_engine_ptr& ptr,
+                      const keys_base_storage_t& query,
+                      expressions::compare_type compare) -> index_t::pointer;
     auto search_index(const index_engine_ptr& ptr, const actor_zeta::address_t& address) -> index_t::pointer;
+    auto search_index(const index_engine_ptr& ptr, const expressions::compare_expression_ptr& conjunction)
+        -> index_match_t;
     auto search_index(const index_engine_ptr& ptr, const std::string& name) -> index_t::pointer;
 
     template<class Target, class... Args>
@@ -83,6 +120,14 @@ namespace components::index {
 
     void drop_index(const index_engine_ptr& ptr, index_t::pointer index);
 
+    // entries of a single field index satisfying "key <compare> value"
+    auto search_range(index_t::pointer index, expressions::compare_type compare, const value_t& value)
+        -> std::vector<index_t::range>;
+
+    // entries of match.index satisfying the matched terms, values are taken from the query parameters
+    auto search_range(const index_match_t& match, const logical_plan::storage_parameters* parameters)
+        -> index_t::range;
+
     void insert(const index_engine_ptr& ptr, id_index id, std::pmr::vector<document_ptr>& docs);
     void insert(const index_engine_ptr& ptr,
                 id_index id,
@@ -0,0 +1,119 @@
+#include <catch2/catch.hpp>
+
+#include "components/index/composite_index.hpp"
+#include "components/index/index_engine.hpp"
+#include "components/tests/generaty.hpp"
+
+using namespace components::index;
+using key = components::expressions::key_t;
+using components::types::logical_value_t;
+
+namespace {
+    logical_value_t make_key(bool flag, int64_t count) {
+        return logical_value_t::create_struct({logical_value_t(flag), logical_value_t(count)});
+    }
+} // namespace
+
+TEST_CASE("composite_index:base") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    composite_index_t index(&resource, "bool_count", {key("countBool"), key("count")});
+    std::vector<document_ptr> docs;
+    for (int i = 1; i <= 100; ++i) {
+        docs.push_back(gen_doc(i, &resource));
+        index.insert(docs.back());
+    }
+    REQUIRE(std::distance(index.cbegin(), index.cend()) == 100);
+    {
+        auto find_range = index.find(make_key(true, 11));
+        REQUIRE(std::distance(find_range.first, find_range.second) == 1);
+        REQUIRE(find_range.first->doc->get_long("count") == 11);
+        REQUIRE(index.find(make_key(false, 11)).first == index.find(make_key(false, 11)).second);
+    }
+    {
+        // prefix of keys
+        auto find_range = index.find(logical_value_t(true));
+        REQUIRE(std::distance(find_range.first, find_range.second) == 50);
+        auto it = find_range.first;
+        for (int i = 1; i < 100; i += 2, ++it) {
+            REQUIRE(it->doc->get_long("count") == i);
+        }
+    }
+    {
+        logical_value_t lower(int64_t(10));
+        logical_value_t upper(int32_t(20));
+        auto range = index.search({logical_value_t(false)}, &lower, true, &upper, false);
+        REQUIRE(std::distance(range.first, range.second) == 5);
+        REQUIRE(range.first->doc->get_long("count") == 10);
+        range = index.search({logical_value_t(false)}, &lower, false, &upper, true);
+        REQUIRE(std::distance(range.first, range.second) == 5);
+        REQUIRE(range.first->doc->get_long("count") == 12);
+        range = index.search({logical_value_t(false)}, &lower, true, nullptr, false);
+        REQUIRE(std::distance(range.first, range.second) == 46);
+        range = index.search({logical_value_t(false)}, nullptr, false, &upper, false);
+        REQUIRE(std::distance(range.first, range.second) == 9);
+        range = index.search({logical_value_t(false)}, &upper, true, &lower, true);
+        REQUIRE(range.first == range.second);
+    }
+    {
+        index.remove_document(docs[10]);
+        REQUIRE(std::distance(index.cbegin(), index.cend()) == 99);
+        REQUIRE(index.find(make_key(true, 11)).first == index.find(make_key(true, 11)).second);
+    }
+}
+
+TEST_CASE("composite_index:multikey") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    composite_index_t index(&resource, "array", {key("countArray")}, index_type::multikey);
+    for (int i = 0; i < 10; ++i) {
+        index.insert(gen_doc(i, &resource));
+    }
+    // an entry per array element: countArray of a document is [i, i + 5)
+    REQUIRE(std::distance(index.cbegin(), index.cend()) == 50);
+    auto find_range = index.find(logical_value_t(int64_t(7)));
+    REQUIRE(std::distance(find_range.first, find_range.second) == 5);
+    find_range = index.find(logical_value_t(int64_t(0)));
+    REQUIRE(std::distance(find_range.first, find_range.second) == 1);
+    REQUIRE(find_range.first->doc->get_long("count") == 0);
+}
+
+TEST_CASE("composite_index:engine") {
+    using namespace components::expressions;
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto index_engine = make_index_engine(&resource);
+    auto parameters = components::logical_plan::make_parameter_node(&resource);
+
+    auto single_id = make_index<composite_index_t>(index_engine, "bool", {key("countBool")});
+    auto composite_id = make_index<composite_index_t>(index_engine, "bool_count", {key("countBool"), key("count")});
+    for (int i = 1; i <= 100; ++i) {
+        insert_one(index_engine, single_id, gen_doc(i, &resource));
+        insert_one(index_engine, composite_id, gen_doc(i, &resource));
+    }
+
+    auto conjunction = make_compare_union_expression(&resource, compare_type::union_and);
+    conjunction->append_child(
+        make_compare_expression(&resource, compare_type::gte, key("count"), parameters->add_parameter(int64_t(10))));
+    conjunction->append_child(
+        make_compare_expression(&resource, compare_type::eq, key("countBool"), parameters->add_parameter(true)));
+    conjunction->append_child(
+        make_compare_expression(&resource, compare_type::lt, key("count"), parameters->add_parameter(int64_t(20))));
+    auto match = search_index(index_engine, conjunction);
+    REQUIRE(match.index == search_index(index_engine, composite_id));
+    REQUIRE(match.equals.size() == 1);
+    REQUIRE(match.lower);
+    REQUIRE(match.upper);
+    REQUIRE(match.is_exact);
+    auto range = search_range(match, &parameters->parameters());
+    REQUIRE(std::distance(range.first, range.second) == 5);
+    REQUIRE(range.first->doc->get_long("count") == 11);
+
+    conjunction->append_child(
+        make_compare_expression(&resource, compare_type::ne, key("countStr"), parameters->add_parameter(int64_t(1))));
+    match = search_index(index_engine, conjunction);
+    REQUIRE(match.index == search_index(index_engine, composite_id));
+    REQUIRE_FALSE(match.is_exact);
+
+    auto other = make_compare_union_expression(&resource, compare_type::union_and);
+    other->append_child(
+        make_compare_expression(&resource, compare_type::eq, key("count"), parameters->add_parameter(int64_t(10))));
+    REQUIRE(search_index(index_engine, other).index == nullptr);
+}
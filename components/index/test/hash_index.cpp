@@ -0,0 +1,89 @@
+#include <catch2/catch.hpp>
+
+#include "components/index/hash_index.hpp"
+#include "components/index/index_engine.hpp"
+#include "components/index/single_field_index.hpp"
+#include "components/tests/generaty.hpp"
+
+using namespace components::index;
+using key = components::expressions::key_t;
+
+TEST_CASE("hash_index:base") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    hash_index_t index(&resource, "hash_count", {key("count")});
+    for (int i : {0, 1, 10, 5, 6, 2, 8, 13}) {
+        auto doc = gen_doc(i, &resource);
+        auto value = doc->get_value(std::string_view("count")).as_logical_value();
+        index.insert(value, std::move(doc));
+    }
+    REQUIRE(std::distance(index.cbegin(), index.cend()) == 8);
+    {
+        components::types::logical_value_t value(10);
+        auto find_range = index.find(value);
+        REQUIRE(find_range.first != find_range.second);
+        REQUIRE(find_range.first->doc->get_long("count") == 10);
+        REQUIRE(find_range.first->doc->get_string("countStr") == "10");
+        REQUIRE(++find_range.first == find_range.second);
+    }
+    {
+        components::types::logical_value_t value(11);
+        auto find_range = index.find(value);
+        REQUIRE(find_range.first == find_range.second);
+    }
+    {
+        // numeric values of different types are equal
+        components::types::logical_value_t value(int32_t(13));
+        auto find_range = index.find(value);
+        REQUIRE(std::distance(find_range.first, find_range.second) == 1);
+        components::types::logical_value_t value_double(13.0);
+        find_range = index.find(value_double);
+        REQUIRE(std::distance(find_range.first, find_range.second) == 1);
+        components::types::logical_value_t value_string(std::string("13"));
+        find_range = index.find(value_string);
+        REQUIRE(find_range.first == find_range.second);
+    }
+    {
+        for (int i : {0, 1, 10, 5, 6, 2, 8, 13}) {
+            auto doc = gen_doc(i, &resource);
+            index.insert(doc->get_value(std::string_view("count")).as_logical_value(), doc);
+        }
+        REQUIRE(std::distance(index.cbegin(), index.cend()) == 16);
+        components::types::logical_value_t value(10);
+        auto find_range = index.find(value);
+        REQUIRE(std::distance(find_range.first, find_range.second) == 2);
+        REQUIRE(find_range.first->doc->get_long("count") == 10);
+        ++find_range.first;
+        REQUIRE(find_range.first->doc->get_long("count") == 10);
+        REQUIRE(++find_range.first == find_range.second);
+    }
+    {
+        components::types::logical_value_t value(5);
+        index.remove(value);
+        REQUIRE(std::distance(index.find(value).first, index.find(value).second) == 1);
+        index.remove(value);
+        REQUIRE(index.find(value).first == index.find(value).second);
+        REQUIRE(std::distance(index.cbegin(), index.cend()) == 14);
+        index.remove(value);
+        REQUIRE(std::distance(index.cbegin(), index.cend()) == 14);
+    }
+}
+
+TEST_CASE("hash_index:engine") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto index_engine = make_index_engine(&resource);
+    using components::expressions::compare_type;
+
+    auto hash_id = make_index<hash_index_t>(index_engine, "hash_count", {key("count")});
+    REQUIRE(search_index(index_engine, {key("count")}, compare_type::eq) == search_index(index_engine, hash_id));
+    REQUIRE(search_index(index_engine, {key("count")}, compare_type::gt) == nullptr);
+    REQUIRE(search_index(index_engine, {key("count")}) == search_index(index_engine, hash_id));
+
+    auto single_id = make_index<single_field_index_t>(index_engine, "single_count", {key("count")});
+    REQUIRE(index_engine->size() == 2);
+    REQUIRE(search_index(index_engine, {key("count")}, compare_type::eq) == search_index(index_engine, hash_id));
+    REQUIRE(search_index(index_engine, {key("count")}, compare_type::gt) == search_index(index_engine, single_id));
+
+    drop_index(index_engine, search_index(index_engine, hash_id));
+    REQUIRE(index_engine->size() == 1);
+    REQUIRE(search_index(index_engine, {key("count")}, compare_type::eq) == search_index(index_engine, single_id));
+}
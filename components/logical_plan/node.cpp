@@ -41,6 +41,7 @@ namespace components::logical_plan {
     std::pmr::vector<node_ptr>& node_t::children() { return children_; }
 
     const std::pmr::vector<expression_ptr>& node_t::expressions() const { return expressions_; }
+    std::pmr::vector<expression_ptr>& node_t::expressions() { return expressions_; }
 
     void node_t::reserve_child(std::size_t count) { children_.reserve(count); }
 
@@ -83,6 +84,17 @@ namespace components::logical_plan {
         return hash_;
     }
 
+    node_ptr node_t::copy() const {
+        auto result = copy_impl();
+        result->children_.clear();
+        result->children_.reserve(children_.size());
+        for (const auto& child : children_) {
+            result->children_.emplace_back(child ? child->copy() : child);
+        }
+        result->expressions_ = expressions_;
+        return result;
+    }
+
     void node_t::serialize(serializer::base_serializer_t* serializer) const { return serialize_impl(serializer); }
 
     node_ptr node_t::deserialize(serializer::base_deserializer_t* deserializer) {
@@ -33,6 +33,7 @@ namespace components::logical_plan {
         const std::pmr::vector<node_ptr>& children() const;
         std::pmr::vector<node_ptr>& children();
         const std::pmr::vector<expression_ptr>& expressions() const;
+        std::pmr::vector<expression_ptr>& expressions();
 
         void reserve_child(std::size_t count);
         void append_child(const node_ptr& child);
@@ -42,6 +43,10 @@ namespace components::logical_plan {
 
         std::unordered_set<collection_full_name_t, collection_name_hash> collection_dependencies();
 
+        // copy of the node tree for another execution, the planner rewrites the nodes of a plan in place
+        // expressions are shared: they are replaced rather than changed once the plan is transformed
+        node_ptr copy() const;
+
         bool operator==(const node_t& rhs) const;
         bool operator!=(const node_t& rhs) const;
 
@@ -63,6 +68,7 @@ namespace components::logical_plan {
         collection_dependencies_(std::unordered_set<collection_full_name_t, collection_name_hash>& upper_dependencies);
 
     private:
+        virtual node_ptr copy_impl() const = 0;
         virtual hash_t hash_impl() const = 0;
         virtual std::string to_string_impl() const = 0;
         virtual void serialize_impl(serializer::base_serializer_t*) const = 0;
@@ -25,6 +25,10 @@ namespace components::logical_plan {
         return res;
     }
 
+    node_ptr node_aggregate_t::copy_impl() const {
+        return {new node_aggregate_t(resource(), collection_)};
+    }
+
     hash_t node_aggregate_t::hash_impl() const { return 0; }
 
     std::string node_aggregate_t::to_string_impl() const {
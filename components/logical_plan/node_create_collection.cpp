@@ -20,6 +20,12 @@ namespace components::logical_plan {
 
     const std::pmr::vector<types::complex_logical_type>& node_create_collection_t::schema() const { return schema_; }
 
+    node_ptr node_create_collection_t::copy_impl() const {
+        return {new node_create_collection_t(resource(),
+                                             collection_,
+                                             std::pmr::vector<types::complex_logical_type>(schema_, resource()))};
+    }
+
     hash_t node_create_collection_t::hash_impl() const { return 0; }
 
     std::string node_create_collection_t::to_string_impl() const {
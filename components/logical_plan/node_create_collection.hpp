@@ -17,6 +17,7 @@ namespace components::logical_plan {
         const std::pmr::vector<types::complex_logical_type>& schema() const;
 
     private:
+        node_ptr copy_impl() const final;
         hash_t hash_impl() const final;
         std::string to_string_impl() const final;
         void serialize_impl(serializer::base_serializer_t* serializer) const final;
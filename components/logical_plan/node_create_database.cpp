@@ -16,6 +16,10 @@ namespace components::logical_plan {
         return make_node_create_database(deserializer->resource(), deserializer->deserialize_collection(1));
     }
 
+    node_ptr node_create_database_t::copy_impl() const {
+        return {new node_create_database_t(resource(), collection_)};
+    }
+
     hash_t node_create_database_t::hash_impl() const { return 0; }
 
     std::string node_create_database_t::to_string_impl() const {
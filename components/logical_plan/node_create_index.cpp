@@ -32,6 +32,12 @@ namespace components::logical_plan {
         return res;
     }
 
+    node_ptr node_create_index_t::copy_impl() const {
+        auto result = new node_create_index_t(resource(), collection_, name_, index_type_);
+        result->keys_ = keys_;
+        return {result};
+    }
+
     hash_t node_create_index_t::hash_impl() const { return 0; }
 
     inline std::string name_index_type(index_type type) {
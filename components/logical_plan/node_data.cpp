@@ -53,10 +53,20 @@ namespace components::logical_plan {
     }
 
     node_ptr node_data_t::deserialize(serializer::base_deserializer_t* deserializer) {
-        // TODO: deserializer data chunk
+        // a data chunk follows the empty documents
+        if (deserializer->current_array_size() > 2) {
+            return make_node_raw_data(deserializer->resource(), deserializer->deserialize_data_chunk(2));
+        }
         return make_node_raw_data(deserializer->resource(), deserializer->deserialize_documents(1));
     }
 
+    node_ptr node_data_t::copy_impl() const {
+        if (uses_data_chunk()) {
+            return {new node_data_t(resource(), data_chunk())};
+        }
+        return {new node_data_t(resource(), documents())};
+    }
+
     hash_t node_data_t::hash_impl() const { return 0; }
 
     std::string node_data_t::to_string_impl() const {
@@ -69,7 +79,14 @@ namespace components::logical_plan {
     }
 
     void node_data_t::serialize_impl(serializer::base_serializer_t* serializer) const {
-        // TODO: serializer data chunk
+        if (uses_data_chunk()) {
+            serializer->start_array(3);
+            serializer->append("type", serializer::serialization_type::logical_node_data);
+            serializer->append("documents", std::pmr::vector<components::document::document_ptr>(resource()));
+            serializer->append("chunk", data_chunk());
+            serializer->end_array();
+            return;
+        }
         serializer->start_array(2);
         serializer->append("type", serializer::serialization_type::logical_node_data);
         serializer->append("documents", documents());
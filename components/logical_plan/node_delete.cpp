@@ -40,6 +40,10 @@ namespace components::logical_plan {
                                 reinterpret_cast<const node_limit_ptr&>(limit));
     }
 
+    node_ptr node_delete_t::copy_impl() const {
+        return {new node_delete_t(resource(), collection_, collection_from_, nullptr, nullptr)};
+    }
+
     hash_t node_delete_t::hash_impl() const { return 0; }
 
     std::string node_delete_t::to_string_impl() const {
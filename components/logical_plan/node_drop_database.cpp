@@ -16,6 +16,10 @@ namespace components::logical_plan {
         return make_node_drop_database(deserializer->resource(), deserializer->deserialize_collection(1));
     }
 
+    node_ptr node_drop_database_t::copy_impl() const {
+        return {new node_drop_database_t(resource(), collection_)};
+    }
+
     hash_t node_drop_database_t::hash_impl() const { return 0; }
 
     std::string node_drop_database_t::to_string_impl() const {
@@ -22,6 +22,10 @@ namespace components::logical_plan {
         return make_node_drop_index(deserializer->resource(), collection, name);
     }
 
+    node_ptr node_drop_index_t::copy_impl() const {
+        return {new node_drop_index_t(resource(), collection_, name_)};
+    }
+
     hash_t node_drop_index_t::hash_impl() const { return 0; }
 
     std::string node_drop_index_t::to_string_impl() const {
@@ -30,6 +30,12 @@ namespace components::logical_plan {
 
     void add_argument(core::parameter_id_t arg);
 
+    node_ptr node_function_t::copy_impl() const {
+        return {new node_function_t(resource(),
+                                   std::string(name_),
+                                   std::pmr::vector<core::parameter_id_t>(args_, resource()))};
+    }
+
     hash_t node_function_t::hash_impl() const { return 0; }
 
     std::string node_function_t::to_string_impl() const {
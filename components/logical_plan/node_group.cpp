@@ -17,6 +17,10 @@ namespace components::logical_plan {
         return make_node_group(deserializer->resource(), collection, exprs);
     }
 
+    node_ptr node_group_t::copy_impl() const {
+        return {new node_group_t(resource(), collection_)};
+    }
+
     hash_t node_group_t::hash_impl() const { return 0; }
 
     std::string node_group_t::to_string_impl() const {
@@ -11,6 +11,7 @@ namespace components::logical_plan {
         static node_ptr deserialize(serializer::base_deserializer_t* deserializer);
 
     private:
+        node_ptr copy_impl() const final;
         hash_t hash_impl() const final;
         std::string to_string_impl() const final;
         void serialize_impl(serializer::base_serializer_t* serializer) const final;
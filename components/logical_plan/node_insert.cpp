@@ -45,6 +45,12 @@ namespace components::logical_plan {
         return res;
     }
 
+    node_ptr node_insert_t::copy_impl() const {
+        auto result = new node_insert_t(resource(), collection_);
+        result->key_translation_ = key_translation_;
+        return {result};
+    }
+
     hash_t node_insert_t::hash_impl() const { return 0; }
 
     std::string node_insert_t::to_string_impl() const {
@@ -31,6 +31,10 @@ namespace components::logical_plan {
         return res;
     }
 
+    node_ptr node_join_t::copy_impl() const {
+        return {new node_join_t(resource(), collection_, type_)};
+    }
+
     hash_t node_join_t::hash_impl() const { return 0; }
 
     std::string node_join_t::to_string_impl() const {
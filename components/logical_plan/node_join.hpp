@@ -26,6 +26,7 @@ namespace components::logical_plan {
     private:
         join_type type_;
 
+        node_ptr copy_impl() const final;
         hash_t hash_impl() const final;
         std::string to_string_impl() const final;
         void serialize_impl(serializer::base_serializer_t* serializer) const final;
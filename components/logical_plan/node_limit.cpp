@@ -33,6 +33,10 @@ namespace components::logical_plan {
         return make_node_limit(deserializer->resource(), collection, limit);
     }
 
+    node_ptr node_limit_t::copy_impl() const {
+        return {new node_limit_t(resource(), collection_, limit_)};
+    }
+
     hash_t node_limit_t::hash_impl() const { return 0; }
 
     std::string node_limit_t::to_string_impl() const {
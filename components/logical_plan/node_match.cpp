@@ -16,6 +16,10 @@ namespace components::logical_plan {
         return make_node_match(deserializer->resource(), collection, expr);
     }
 
+    node_ptr node_match_t::copy_impl() const {
+        return {new node_match_t(resource(), collection_)};
+    }
+
     hash_t node_match_t::hash_impl() const { return 0; }
 
     std::string node_match_t::to_string_impl() const {
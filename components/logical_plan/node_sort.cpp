@@ -16,6 +16,10 @@ namespace components::logical_plan {
         return make_node_sort(deserializer->resource(), collection, exprs);
     }
 
+    node_ptr node_sort_t::copy_impl() const {
+        return {new node_sort_t(resource(), collection_)};
+    }
+
     hash_t node_sort_t::hash_impl() const { return 0; }
 
     std::string node_sort_t::to_string_impl() const {
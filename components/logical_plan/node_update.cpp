@@ -61,6 +61,16 @@ namespace components::logical_plan {
                                 upsert);
     }
 
+    node_ptr node_update_t::copy_impl() const {
+        return {new node_update_t(resource(),
+                                 collection_,
+                                 collection_from_,
+                                 nullptr,
+                                 nullptr,
+                                 update_expressions_,
+                                 upsert_)};
+    }
+
     hash_t node_update_t::hash_impl() const { return 0; }
 
     std::string node_update_t::to_string_impl() const {
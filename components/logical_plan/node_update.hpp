@@ -29,6 +29,7 @@ namespace components::logical_plan {
         std::pmr::vector<expressions::update_expr_ptr> update_expressions_;
         bool upsert_;
 
+        node_ptr copy_impl() const final;
         hash_t hash_impl() const final;
         std::string to_string_impl() const final;
         void serialize_impl(serializer::base_serializer_t* serializer) const final;
@@ -8,6 +8,38 @@
 
 namespace components::logical_plan {
 
+    namespace {
+
+        expr_value_t copy_value(document::impl::base_document* tape, const expr_value_t& value) {
+            switch (value.physical_type()) {
+                case types::physical_type::BOOL:
+                    return expr_value_t(tape, value.as_bool());
+                case types::physical_type::UINT8:
+                case types::physical_type::UINT16:
+                case types::physical_type::UINT32:
+                case types::physical_type::UINT64:
+                    return expr_value_t(tape, value.as_unsigned());
+                case types::physical_type::INT8:
+                case types::physical_type::INT16:
+                case types::physical_type::INT32:
+                case types::physical_type::INT64:
+                    return expr_value_t(tape, value.as_int());
+                case types::physical_type::UINT128:
+                case types::physical_type::INT128:
+                    return expr_value_t(tape, value.as_int128());
+                case types::physical_type::FLOAT:
+                    return expr_value_t(tape, value.as_float());
+                case types::physical_type::DOUBLE:
+                    return expr_value_t(tape, value.as_double());
+                case types::physical_type::STRING:
+                    return expr_value_t(tape, std::string(value.as_string()));
+                default:
+                    return expr_value_t(tape, nullptr);
+            }
+        }
+
+    } // namespace
+
     const expr_value_t& get_parameter(const storage_parameters* storage, core::parameter_id_t id) {
         auto it = storage->parameters.find(id);
         if (it != storage->parameters.end()) {
@@ -33,6 +65,26 @@ namespace components::logical_plan {
         return get_parameter(&values_, id);
     }
 
+    auto parameter_node_t::add_placeholder(uint16_t number) -> core::parameter_id_t {
+        auto id = add_parameter(nullptr);
+        placeholders_.emplace_back(number, id);
+        return id;
+    }
+
+    auto parameter_node_t::placeholders() const -> const std::pmr::vector<std::pair<uint16_t, core::parameter_id_t>>& {
+        return placeholders_;
+    }
+
+    auto parameter_node_t::copy(std::pmr::memory_resource* resource) const -> boost::intrusive_ptr<parameter_node_t> {
+        auto result = make_parameter_node(resource);
+        result->counter_ = counter_;
+        result->placeholders_.assign(placeholders_.begin(), placeholders_.end());
+        for (const auto& [id, value] : values_.parameters) {
+            result->values_.parameters.emplace(id, copy_value(result->values_.tape(), value));
+        }
+        return result;
+    }
+
     void parameter_node_t::serialize(serializer::base_serializer_t* serializer) const {
         serializer->start_array(2);
         serializer->append("type", serializer::serialization_type::parameters);
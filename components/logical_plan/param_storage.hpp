@@ -56,7 +56,8 @@ namespace components::logical_plan {
     class parameter_node_t : public boost::intrusive_ref_counter<parameter_node_t> {
     public:
         parameter_node_t(std::pmr::memory_resource* resource)
-            : values_(resource) {}
+            : values_(resource)
+            , placeholders_(resource) {}
 
         auto parameters() const -> const storage_parameters&;
         auto take_parameters() -> storage_parameters;
@@ -78,12 +79,31 @@ namespace components::logical_plan {
 
         auto parameter(core::parameter_id_t id) const -> const expr_value_t&;
 
+        // `$number` placeholder of a prepared statement, its parameter is null until a value is bound
+        auto add_placeholder(uint16_t number) -> core::parameter_id_t;
+        auto placeholders() const -> const std::pmr::vector<std::pair<uint16_t, core::parameter_id_t>>&;
+
+        // sets the value of every parameter of the `$number` placeholder
+        template<class Value>
+        void bind(uint16_t number, Value value) {
+            for (const auto& [placeholder, id] : placeholders_) {
+                if (placeholder == number) {
+                    values_.parameters.insert_or_assign(id, expr_value_t(values_.tape(), value));
+                }
+            }
+        }
+
+        // copy for another execution of the same plan: values are copied into a tape of its own, so the copy
+        // can be bound while this node is shared
+        auto copy(std::pmr::memory_resource* resource) const -> boost::intrusive_ptr<parameter_node_t>;
+
         void serialize(serializer::base_serializer_t* serializer) const;
         static boost::intrusive_ptr<parameter_node_t> deserialize(serializer::base_deserializer_t* deserilizer);
 
     private:
         uint16_t counter_{0};
         storage_parameters values_;
+        std::pmr::vector<std::pair<uint16_t, core::parameter_id_t>> placeholders_;
     };
 
     using parameter_node_ptr = boost::intrusive_ptr<parameter_node_t>;
@@ -43,6 +43,18 @@ namespace components::base::operators {
 
     void operator_t::set_as_root() noexcept { root = true; }
 
+    void operator_t::set_streaming() noexcept { streaming_ = true; }
+
+    bool operator_t::is_streaming() const noexcept { return streaming_; }
+
+    bool operator_t::has_next_chunk() const { return streaming_ && is_executed() && has_next_chunk_impl(); }
+
+    void operator_t::next_chunk(pipeline::context_t* pipeline_context) {
+        if (has_next_chunk()) {
+            on_next_chunk_impl(pipeline_context);
+        }
+    }
+
     const collection_full_name_t& operator_t::collection_name() const noexcept { return context_->name(); }
 
     services::collection::context_collection_t* operator_t::context() noexcept { return context_; }
@@ -79,6 +91,10 @@ namespace components::base::operators {
 
     void operator_t::on_prepare_impl() {}
 
+    bool operator_t::has_next_chunk_impl() const { return false; }
+
+    void operator_t::on_next_chunk_impl(pipeline::context_t*) {}
+
     read_only_operator_t::read_only_operator_t(services::collection::context_collection_t* collection,
                                                operator_type type)
         : operator_t(collection, type) {}
@@ -62,6 +62,13 @@ namespace components::base::operators {
         bool is_root() const noexcept;
         void set_as_root() noexcept;
 
+        // streaming operators emit their output by batches: on_execute produces the first one,
+        // next_chunk replaces output() with the next batch while has_next_chunk() is true
+        void set_streaming() noexcept;
+        bool is_streaming() const noexcept;
+        bool has_next_chunk() const;
+        void next_chunk(pipeline::context_t* pipeline_context);
+
         const collection_full_name_t& collection_name() const noexcept;
         services::collection::context_collection_t* context() noexcept;
 
@@ -88,10 +95,13 @@ namespace components::base::operators {
         virtual void on_execute_impl(pipeline::context_t* pipeline_context) = 0;
         virtual void on_resume_impl(pipeline::context_t* pipeline_context);
         virtual void on_prepare_impl();
+        virtual bool has_next_chunk_impl() const;
+        virtual void on_next_chunk_impl(pipeline::context_t* pipeline_context);
 
         const operator_type type_;
         operator_state state_{operator_state::created};
         bool root{false};
+        bool streaming_{false};
     };
 
     class read_only_operator_t : public operator_t {
@@ -1,6 +1,8 @@
 #include "operator_add_index.hpp"
 #include <components/cursor/cursor.hpp>
+#include <components/index/composite_index.hpp>
 #include <components/index/disk/route.hpp>
+#include <components/index/hash_index.hpp>
 #include <components/index/single_field_index.hpp>
 #include <components/logical_plan/node_create_index.hpp>
 #include <core/pmr.hpp>
@@ -16,19 +18,38 @@ namespace components::base::operators {
         : read_write_operator_t(context, operator_type::add_index)
         , index_node_{std::move(node)} {}
 
+    uint32_t operator_add_index::make_index_() {
+        auto& engine = context_->index_engine();
+        switch (index_node_->type()) {
+            case logical_plan::index_type::hashed:
+                return index::make_index<index::hash_index_t>(engine, index_node_->name(), index_node_->keys());
+            case logical_plan::index_type::composite:
+            case logical_plan::index_type::multikey:
+                // kept in memory only, disk receives the definition to restore the index on load
+                return index::make_index<index::composite_index_t>(engine,
+                                                                   index_node_->name(),
+                                                                   index_node_->keys(),
+                                                                   index_node_->type());
+            default:
+                return index::make_index<index::single_field_index_t>(engine, index_node_->name(), index_node_->keys());
+        }
+    }
+
     void operator_add_index::on_execute_impl(pipeline::context_t* pipeline_context) {
         trace(context_->log(),
               "operator_add_index::on_execute_impl session: {}, index: {}",
               pipeline_context->session.data(),
               index_node_->name());
         switch (index_node_->type()) {
-            case logical_plan::index_type::single: {
+            case logical_plan::index_type::single:
+            case logical_plan::index_type::composite:
+            case logical_plan::index_type::multikey:
+            case logical_plan::index_type::hashed: {
                 const bool index_exist = context_->index_engine()->has_index(index_node_->name());
-                const auto id_index = index_exist
-                                          ? index::INDEX_ID_UNDEFINED
-                                          : index::make_index<index::single_field_index_t>(context_->index_engine(),
-                                                                                           index_node_->name(),
-                                                                                           index_node_->keys());
+                auto id_index = index::INDEX_ID_UNDEFINED;
+                if (!index_exist) {
+                    id_index = make_index_();
+                }
 
                 services::collection::sessions::make_session(
                     context_->sessions(),
@@ -41,9 +62,6 @@ namespace components::base::operators {
                                        context_);
                 break;
             }
-            case logical_plan::index_type::composite:
-            case logical_plan::index_type::multikey:
-            case logical_plan::index_type::hashed:
             case logical_plan::index_type::wildcard: {
                 trace(context_->log(), "index_type not implemented");
                 assert(false && "index_type not implemented");
@@ -13,6 +13,7 @@ namespace components::base::operators {
 
     private:
         void on_execute_impl(pipeline::context_t* pipeline_context) final;
+        uint32_t make_index_();
 
         logical_plan::node_create_index_ptr index_node_;
     };
@@ -37,7 +37,9 @@ namespace components::base::operators {
             return;
         }
 
-        if (index_ptr->is_disk()) {
+        // composite indexes have no disk agent, but their definitions are stored on disk as well
+        if (index_ptr->is_disk() || index_ptr->type() == index_type::composite ||
+            index_ptr->type() == index_type::multikey) {
             pipeline_context->send(context_->disk(),
                                    services::index::handler_id(services::index::route::drop),
                                    node_->name(),
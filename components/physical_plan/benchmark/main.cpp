@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+#include <components/physical_plan/base/operators/operator_raw_data.hpp>
+#include <components/physical_plan/table/operators/aggregate/operator_count.hpp>
+#include <components/physical_plan/table/operators/aggregate/operator_sum.hpp>
+#include <components/physical_plan/table/operators/get/simple_value.hpp>
+#include <components/physical_plan/table/operators/operator_group.hpp>
+#include <components/physical_plan/table/operators/operator_hash_aggregate.hpp>
+#include <components/physical_plan/table/operators/operator_hash_join.hpp>
+#include <components/physical_plan/table/operators/operator_join.hpp>
+#include <components/physical_plan/table/operators/operator_sort.hpp>
+#include <memory_resource>
+
+using namespace components;
+
+namespace {
+
+    vector::data_chunk_t gen_join_chunk(std::pmr::memory_resource* resource, const std::string& prefix, int64_t size) {
+        std::pmr::vector<types::complex_logical_type> types(resource);
+        types.emplace_back(types::logical_type::BIGINT, prefix + "_key");
+        types.emplace_back(types::logical_type::BIGINT, prefix + "_value");
+        vector::data_chunk_t chunk(resource, types, static_cast<uint64_t>(size));
+        chunk.set_cardinality(static_cast<uint64_t>(size));
+        for (int64_t i = 0; i < size; i++) {
+            // reversed order on one side so that matches are not aligned by position
+            auto key = prefix == "left" ? i : size - i - 1;
+            chunk.set_value(0, static_cast<uint64_t>(i), types::logical_value_t{key});
+            chunk.set_value(1, static_cast<uint64_t>(i), types::logical_value_t{i * 10});
+        }
+        return chunk;
+    }
+
+    template<typename Join>
+    void run_join(benchmark::State& state) {
+        auto resource = std::pmr::synchronized_pool_resource();
+        auto expr = expressions::make_compare_expression(&resource,
+                                                         expressions::compare_type::eq,
+                                                         expressions::key_t{"left_key"},
+                                                         expressions::key_t{"right_key"});
+        auto left = gen_join_chunk(&resource, "left", state.range(0));
+        auto right = gen_join_chunk(&resource, "right", state.range(0));
+        pipeline::context_t context(logical_plan::storage_parameters{&resource});
+
+        for (auto _ : state) {
+            base::operators::operator_ptr join(new Join(nullptr, logical_plan::join_type::inner, expr));
+            join->set_children(boost::intrusive_ptr(new base::operators::operator_raw_data_t(left)),
+                               boost::intrusive_ptr(new base::operators::operator_raw_data_t(right)));
+            join->on_execute(&context);
+            benchmark::DoNotOptimize(join->output()->size());
+        }
+    }
+
+} // namespace
+
+// operator_join_t writes into an output chunk of DEFAULT_VECTOR_CAPACITY rows, so keep results under it
+static void nested_loop_join(benchmark::State& state) { run_join<table::operators::operator_join_t>(state); }
+BENCHMARK(nested_loop_join)->Arg(100)->Arg(1000);
+
+static void hash_join(benchmark::State& state) { run_join<table::operators::operator_hash_join_t>(state); }
+BENCHMARK(hash_join)->Arg(100)->Arg(1000)->Arg(100000)->Arg(1000000);
+
+static void row_group(benchmark::State& state) {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto chunk = gen_join_chunk(&resource, "left", 1000);
+    for (int64_t i = 0; i < 1000; i++) {
+        chunk.set_value(0, static_cast<uint64_t>(i), types::logical_value_t{i % state.range(0)});
+    }
+    pipeline::context_t context(logical_plan::storage_parameters{&resource});
+
+    for (auto _ : state) {
+        boost::intrusive_ptr<table::operators::operator_group_t> group(
+            new table::operators::operator_group_t(&resource));
+        group->set_children(boost::intrusive_ptr(new base::operators::operator_raw_data_t(chunk)));
+        group->add_key("left_key", table::operators::get::simple_value_t::create(expressions::key_t{"left_key"}));
+        group->add_value("count", boost::intrusive_ptr(new table::operators::aggregate::operator_count_t(nullptr)));
+        group->add_value("sum",
+                         boost::intrusive_ptr(new table::operators::aggregate::operator_sum_t(
+                             nullptr,
+                             expressions::key_t{"left_value"})));
+        group->on_execute(&context);
+        benchmark::DoNotOptimize(group->output()->size());
+    }
+}
+BENCHMARK(row_group)->Arg(10)->Arg(100)->Arg(1000);
+
+static void hash_aggregate(benchmark::State& state) {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto chunk = gen_join_chunk(&resource, "left", 1000);
+    for (int64_t i = 0; i < 1000; i++) {
+        chunk.set_value(0, static_cast<uint64_t>(i), types::logical_value_t{i % state.range(0)});
+    }
+    pipeline::context_t context(logical_plan::storage_parameters{&resource});
+
+    for (auto _ : state) {
+        boost::intrusive_ptr<table::operators::operator_hash_aggregate_t> group(
+            new table::operators::operator_hash_aggregate_t(&resource));
+        group->set_children(boost::intrusive_ptr(new base::operators::operator_raw_data_t(chunk)));
+        group->add_key("left_key", expressions::key_t{"left_key"});
+        group->add_value("count", expressions::aggregate_type::count, {});
+        group->add_value("sum", expressions::aggregate_type::sum, expressions::key_t{"left_value"});
+        group->on_execute(&context);
+        benchmark::DoNotOptimize(group->output()->size());
+    }
+}
+BENCHMARK(hash_aggregate)->Arg(10)->Arg(100)->Arg(1000);
+
+static void sort_two_columns(benchmark::State& state) {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto chunk = gen_join_chunk(&resource, "left", state.range(0));
+    for (int64_t i = 0; i < state.range(0); i++) {
+        chunk.set_value(0, static_cast<uint64_t>(i), types::logical_value_t{(i * 7919) % 100});
+    }
+    pipeline::context_t context(logical_plan::storage_parameters{&resource});
+
+    for (auto _ : state) {
+        boost::intrusive_ptr<table::operators::operator_sort_t> sort(
+            new table::operators::operator_sort_t(nullptr, logical_plan::limit_t(static_cast<int>(state.range(1)))));
+        sort->set_children(boost::intrusive_ptr(new base::operators::operator_raw_data_t(chunk)));
+        sort->add("left_key");
+        sort->add("left_value", table::operators::operator_sort_t::order::descending);
+        sort->on_execute(&context);
+        benchmark::DoNotOptimize(sort->output()->size());
+    }
+}
+// second argument is the limit, -1 sorts everything
+BENCHMARK(sort_two_columns)->Args({1000, -1})->Args({100000, -1})->Args({100000, 10});
+
+BENCHMARK_MAIN();
@@ -14,11 +14,11 @@ namespace components::collection::operators::aggregate {
         auto doc = document::make_document(resource);
         if (left_ && left_->output()) {
             const auto& documents = left_->output()->documents();
+            const document::document_path_t path(key_.as_string());
             auto max = std::max_element(documents.cbegin(),
                                         documents.cend(),
                                         [&](const document_ptr& doc1, const document_ptr& doc2) {
-                                            return doc1->compare(key_.as_string(), doc2, key_.as_string()) ==
-                                                   types::compare_t::less;
+                                            return doc1->compare(path, doc2, path) == types::compare_t::less;
                                         });
             if (max != documents.cend()) {
                 doc->set(key_result_, *max, key_.as_string());
@@ -16,8 +16,9 @@ namespace components::collection::operators::aggregate {
             const auto& documents = left_->output()->documents();
             auto tape = std::make_unique<document::impl::base_document>(resource);
             document::value_t sum_{};
+            const document::document_path_t path(key_.as_string());
             std::for_each(documents.cbegin(), documents.cend(), [&](const document_ptr& doc) {
-                sum_ = sum(sum_, doc->get_value(key_.as_string()), tape.get());
+                sum_ = sum(sum_, doc->get_value(path), tape.get());
             });
             result->set(key_result_, sum_);
         } else {
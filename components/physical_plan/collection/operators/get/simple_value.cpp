@@ -8,10 +8,11 @@ namespace components::collection::operators::get {
 
     simple_value_t::simple_value_t(const expressions::key_t& key)
         : operator_get_t()
-        , key_(key) {}
+        , key_(key)
+        , path_(key.as_string()) {}
 
     document::value_t simple_value_t::get_value_impl(const document_ptr& document) {
-        return document->get_value(key_.as_string());
+        return document->get_value(path_);
     }
 
 } // namespace components::collection::operators::get
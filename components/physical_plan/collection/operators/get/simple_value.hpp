@@ -12,6 +12,7 @@ namespace components::collection::operators::get {
 
     private:
         const expressions::key_t key_;
+        const document::document_path_t path_;
 
         explicit simple_value_t(const expressions::key_t& key);
 
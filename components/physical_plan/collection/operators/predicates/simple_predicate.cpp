@@ -1,7 +1,7 @@
 #include "simple_predicate.hpp"
 #include <components/physical_plan/base/operators/operator.hpp>
-#include <fmt/format.h>
-#include <regex>
+#include <core/string_matcher/string_matcher.hpp>
+#include <memory>
 
 namespace components::collection::operators::predicates {
 
@@ -40,6 +40,39 @@ namespace components::collection::operators::predicates {
         return func_(document_left, document_right, parameters);
     }
 
+    namespace {
+
+        // json pointers of the expression parsed once, when the predicate is created
+        struct expr_paths_t {
+            explicit expr_paths_t(const expressions::compare_expression_ptr& expr)
+                : left(expr->key_left().as_string())
+                , right(expr->key_right().is_null() ? document::document_path_t()
+                                                    : document::document_path_t(expr->key_right().as_string())) {}
+
+            document::document_path_t left;
+            document::document_path_t right;
+        };
+
+        template<typename Check>
+        predicate_ptr make_compare_predicate(const expressions::compare_expression_ptr& expr, Check check) {
+            return {new simple_predicate([&expr, check, paths = expr_paths_t(expr)](
+                                             const document::document_ptr& document_left,
+                                             const document::document_ptr& document_right,
+                                             const logical_plan::storage_parameters* parameters) {
+                if (expr->key_right().is_null()) {
+                    auto it = parameters->parameters.find(expr->value());
+                    if (it == parameters->parameters.end()) {
+                        return false;
+                    }
+                    return check(document_left->compare(paths.left, it->second));
+                }
+                auto value = (document_right ? document_right : document_left)->get_value(paths.right);
+                return check(document_left->compare(paths.left, value));
+            })};
+        }
+
+    } // namespace
+
     predicate_ptr create_simple_predicate(const expressions::compare_expression_ptr& expr) {
         using expressions::compare_type;
 
@@ -56,169 +89,51 @@ namespace components::collection::operators::predicates {
                 return {new simple_predicate(std::move(nested), expr->type())};
             }
             case compare_type::eq:
-                return {new simple_predicate([&expr](const document::document_ptr& document_left,
-                                                     const document::document_ptr& document_right,
-                                                     const logical_plan::storage_parameters* parameters) {
-                    if (expr->key_right().is_null()) {
-                        auto it = parameters->parameters.find(expr->value());
-                        if (it == parameters->parameters.end()) {
-                            return false;
-                        } else {
-                            return document_left->compare(expr->key_left().as_string(), it->second) ==
-                                   types::compare_t::equals;
-                        }
-                    } else {
-                        auto comp =
-                            document_right
-                                ? document_left->compare(expr->key_left().as_string(),
-                                                         document_right->get_value(expr->key_right().as_string()))
-                                : document_left->compare(expr->key_left().as_string(),
-                                                         document_left->get_value(expr->key_right().as_string()));
-                        return comp == types::compare_t::equals;
-                    }
-                })};
+                return make_compare_predicate(expr, [](types::compare_t comp) {
+                    return comp == types::compare_t::equals;
+                });
             case compare_type::ne:
-                return {new simple_predicate([&expr](const document::document_ptr& document_left,
-                                                     const document::document_ptr& document_right,
-                                                     const logical_plan::storage_parameters* parameters) {
-                    if (expr->key_right().is_null()) {
-                        auto it = parameters->parameters.find(expr->value());
-                        if (it == parameters->parameters.end()) {
-                            return false;
-                        } else {
-                            return document_left->compare(expr->key_left().as_string(), it->second) !=
-                                   types::compare_t::equals;
-                        }
-                    } else {
-                        auto comp =
-                            document_right
-                                ? document_left->compare(expr->key_left().as_string(),
-                                                         document_right->get_value(expr->key_right().as_string()))
-                                : document_left->compare(expr->key_left().as_string(),
-                                                         document_left->get_value(expr->key_right().as_string()));
-                        return comp != types::compare_t::equals;
-                    }
-                })};
+                return make_compare_predicate(expr, [](types::compare_t comp) {
+                    return comp != types::compare_t::equals;
+                });
             case compare_type::gt:
-                return {new simple_predicate([&expr](const document::document_ptr& document_left,
-                                                     const document::document_ptr& document_right,
-                                                     const logical_plan::storage_parameters* parameters) {
-                    if (expr->key_right().is_null()) {
-                        auto it = parameters->parameters.find(expr->value());
-                        if (it == parameters->parameters.end()) {
-                            return false;
-                        } else {
-                            return document_left->compare(expr->key_left().as_string(), it->second) ==
-                                   types::compare_t::more;
-                        }
-                    } else {
-                        auto comp =
-                            document_right
-                                ? document_left->compare(expr->key_left().as_string(),
-                                                         document_right->get_value(expr->key_right().as_string()))
-                                : document_left->compare(expr->key_left().as_string(),
-                                                         document_left->get_value(expr->key_right().as_string()));
-                        return comp == types::compare_t::more;
-                    }
-                })};
+                return make_compare_predicate(expr, [](types::compare_t comp) {
+                    return comp == types::compare_t::more;
+                });
             case compare_type::gte:
-                return {new simple_predicate([&expr](const document::document_ptr& document_left,
-                                                     const document::document_ptr& document_right,
-                                                     const logical_plan::storage_parameters* parameters) {
-                    if (expr->key_right().is_null()) {
-                        auto it = parameters->parameters.find(expr->value());
-                        if (it == parameters->parameters.end()) {
-                            return false;
-                        } else {
-                            auto comp = document_left->compare(expr->key_left().as_string(), it->second);
-                            return comp == types::compare_t::equals || comp == types::compare_t::more;
-                        }
-                    } else {
-                        auto comp =
-                            document_right
-                                ? document_left->compare(expr->key_left().as_string(),
-                                                         document_right->get_value(expr->key_right().as_string()))
-                                : document_left->compare(expr->key_left().as_string(),
-                                                         document_left->get_value(expr->key_right().as_string()));
-                        return comp == types::compare_t::equals || comp == types::compare_t::more;
-                    }
-                })};
+                return make_compare_predicate(expr, [](types::compare_t comp) {
+                    return comp == types::compare_t::equals || comp == types::compare_t::more;
+                });
             case compare_type::lt:
-                return {new simple_predicate([&expr](const document::document_ptr& document_left,
-                                                     const document::document_ptr& document_right,
-                                                     const logical_plan::storage_parameters* parameters) {
-                    if (expr->key_right().is_null()) {
-                        auto it = parameters->parameters.find(expr->value());
-                        if (it == parameters->parameters.end()) {
-                            return false;
-                        } else {
-                            return document_left->compare(expr->key_left().as_string(), it->second) ==
-                                   types::compare_t::less;
-                        }
-                    } else {
-                        auto comp =
-                            document_right
-                                ? document_left->compare(expr->key_left().as_string(),
-                                                         document_right->get_value(expr->key_right().as_string()))
-                                : document_left->compare(expr->key_left().as_string(),
-                                                         document_left->get_value(expr->key_right().as_string()));
-                        return comp == types::compare_t::less;
-                    }
-                })};
+                return make_compare_predicate(expr, [](types::compare_t comp) {
+                    return comp == types::compare_t::less;
+                });
             case compare_type::lte:
-                return {new simple_predicate([&expr](const document::document_ptr& document_left,
-                                                     const document::document_ptr& document_right,
-                                                     const logical_plan::storage_parameters* parameters) {
-                    if (expr->key_right().is_null()) {
-                        auto it = parameters->parameters.find(expr->value());
-                        if (it == parameters->parameters.end()) {
-                            return false;
-                        } else {
-                            auto comp = document_left->compare(expr->key_left().as_string(), it->second);
-                            return comp == types::compare_t::equals || comp == types::compare_t::less;
-                        }
-                    } else {
-                        auto comp =
-                            document_right
-                                ? document_left->compare(expr->key_left().as_string(),
-                                                         document_right->get_value(expr->key_right().as_string()))
-                                : document_left->compare(expr->key_left().as_string(),
-                                                         document_left->get_value(expr->key_right().as_string()));
-                        return comp == types::compare_t::equals || comp == types::compare_t::less;
-                    }
-                })};
+                return make_compare_predicate(expr, [](types::compare_t comp) {
+                    return comp == types::compare_t::equals || comp == types::compare_t::less;
+                });
             case compare_type::regex:
-                return {new simple_predicate([&expr](const document::document_ptr& document_left,
-                                                     const document::document_ptr& document_right,
-                                                     const logical_plan::storage_parameters* parameters) {
+                // the pattern is compiled once and reused while it stays the same
+                return {new simple_predicate([&expr,
+                                              paths = expr_paths_t(expr),
+                                              cache = std::make_shared<core::string_matcher_cache_t>()](
+                                                 const document::document_ptr& document_left,
+                                                 const document::document_ptr& document_right,
+                                                 const logical_plan::storage_parameters* parameters) {
+                    if (document_left->type_by_key(paths.left) != types::logical_type::STRING_LITERAL) {
+                        return false;
+                    }
                     if (expr->key_right().is_null()) {
                         auto it = parameters->parameters.find(expr->value());
                         if (it == parameters->parameters.end()) {
                             return false;
-                        } else {
-                            return document_left->type_by_key(expr->key_left().as_string()) ==
-                                       types::logical_type::STRING_LITERAL &&
-                                   std::regex_match(document_left->get_string(expr->key_left().as_string()).data(),
-                                                    std::regex(fmt::format(".*{}.*", it->second.as_string())));
                         }
-                    } else {
-                        return document_right
-                                   ? document_left->type_by_key(expr->key_left().as_string()) ==
-                                             types::logical_type::STRING_LITERAL &&
-                                         std::regex_match(
-                                             document_left->get_string(expr->key_left().as_string()).data(),
-                                             std::regex(fmt::format(
-                                                 ".*{}.*",
-                                                 document_left->get_value(expr->key_right().as_string()).as_string())))
-                                   : document_left->type_by_key(expr->key_left().as_string()) ==
-                                             types::logical_type::STRING_LITERAL &&
-                                         std::regex_match(
-                                             document_left->get_string(expr->key_left().as_string()).data(),
-                                             std::regex(
-                                                 fmt::format(".*{}.*",
-                                                             document_right->get_value(expr->key_right().as_string())
-                                                                 .as_string())));
+                        return cache->get(it->second.as_string()).match(document_left->get_string(paths.left));
                     }
+                    const auto pattern = (document_right ? document_right : document_left)
+                                             ->get_value(paths.right)
+                                             .as_string();
+                    return cache->get(pattern).match(document_left->get_string(paths.left));
                 })};
             case compare_type::all_true:
                 return {new simple_predicate([](const document::document_ptr&,
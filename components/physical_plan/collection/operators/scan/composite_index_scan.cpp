@@ -0,0 +1,39 @@
+#include "composite_index_scan.hpp"
+#include <services/collection/collection.hpp>
+
+namespace components::collection::operators {
+
+    composite_index_scan::composite_index_scan(services::collection::context_collection_t* context,
+                                               index::index_match_t match,
+                                               logical_plan::limit_t limit)
+        : read_only_operator_t(context, operator_type::match)
+        , index_name_(match.index->name())
+        , match_(std::move(match))
+        , limit_(limit) {
+        // index is searched by name on execute, it could be dropped after planning
+        match_.index = nullptr;
+    }
+
+    void composite_index_scan::on_execute_impl(pipeline::context_t* pipeline_context) {
+        trace(context_->log(), "composite_index_scan by index \"{}\"", index_name_);
+        if (!limit_.check(0)) {
+            return; //limit = 0
+        }
+        output_ = base::operators::make_operator_data(context_->resource());
+        auto match = match_;
+        match.index = index::search_index(context_->index_engine(), index_name_);
+        if (!match.index) {
+            return;
+        }
+        auto range = index::search_range(match, &pipeline_context->parameters);
+        int count = 0;
+        for (auto it = range.first; it != range.second; ++it) {
+            if (!limit_.check(count)) {
+                return;
+            }
+            output_->append(it->doc);
+            ++count;
+        }
+    }
+
+} // namespace components::collection::operators
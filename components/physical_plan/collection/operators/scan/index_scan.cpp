@@ -9,26 +9,8 @@ namespace components::collection::operators {
     std::vector<range> search_range_by_index(index::index_t* index,
                                              const expressions::compare_expression_ptr& expr,
                                              const logical_plan::storage_parameters* parameters) {
-        using expressions::compare_type;
-        using logical_plan::get_parameter;
-        auto value = get_parameter(parameters, expr->value()).as_logical_value();
-        switch (expr->type()) {
-            case compare_type::eq:
-                return {index->find(value)};
-            case compare_type::ne:
-                return {index->lower_bound(value), index->upper_bound(value)};
-            case compare_type::gt:
-                return {index->upper_bound(value)};
-            case compare_type::lt:
-                return {index->lower_bound(value)};
-            case compare_type::gte:
-                return {index->find(value), index->upper_bound(value)};
-            case compare_type::lte:
-                return {index->lower_bound(value), index->find(value)};
-            default:
-                //todo: error
-                return {{index->cend(), index->cend()}, {index->cend(), index->cend()}};
-        }
+        auto value = logical_plan::get_parameter(parameters, expr->value()).as_logical_value();
+        return index::search_range(index, expr->type(), value);
     }
 
     void search_by_index(index::index_t* index,
@@ -58,7 +40,7 @@ namespace components::collection::operators {
 
     void index_scan::on_execute_impl(pipeline::context_t* pipeline_context) {
         trace(context_->log(), "index_scan by field \"{}\"", expr_->key_left().as_string());
-        auto* index = index::search_index(context_->index_engine(), {expr_->key_left()});
+        auto* index = index::search_index(context_->index_engine(), {expr_->key_left()}, expr_->type());
         if (index && index->is_disk()) {
             trace(context_->log(), "index_scan: send query into disk");
             auto value = logical_plan::get_parameter(&pipeline_context->parameters, expr_->value()).as_logical_value();
@@ -81,7 +63,7 @@ namespace components::collection::operators {
 
     void index_scan::on_resume_impl(pipeline::context_t* pipeline_context) {
         trace(context_->log(), "resume index_scan by field \"{}\"", expr_->key_left().as_string());
-        auto* index = index::search_index(context_->index_engine(), {expr_->key_left()});
+        auto* index = index::search_index(context_->index_engine(), {expr_->key_left()}, expr_->type());
         trace(context_->log(), "index_scan: prepare result");
         if (!limit_.check(0)) {
             return; //limit = 0
@@ -7,7 +7,35 @@ namespace components::collection::operators {
     primary_key_scan::primary_key_scan(services::collection::context_collection_t* context)
         : read_only_operator_t(context, operator_type::match) {}
 
-    void primary_key_scan::on_execute_impl(pipeline::context_t*) {
+    primary_key_scan::primary_key_scan(services::collection::context_collection_t* context,
+                                       expressions::compare_expression_ptr expr,
+                                       logical_plan::limit_t limit)
+        : read_only_operator_t(context, operator_type::match)
+        , expr_(std::move(expr))
+        , limit_(limit) {}
+
+    void primary_key_scan::on_execute_impl(pipeline::context_t* pipeline_context) {
+        if (expr_) {
+            trace(context_->log(), "primary_key_scan");
+            if (!limit_.check(0)) {
+                return; //limit = 0
+            }
+            output_ = base::operators::make_operator_data(context_->resource());
+            if (!pipeline_context) {
+                return;
+            }
+            auto value = pipeline_context->parameters.parameters.find(expr_->value());
+            if (value == pipeline_context->parameters.parameters.end() || !value->second.is_string()) {
+                return;
+            }
+            // ids which are not valid oids are all mapped to the zero oid, so the found one is verified
+            auto it = context_->document_storage().find(document::document_id_t{value->second.as_string()});
+            if (it != context_->document_storage().end() &&
+                it->second->compare(expr_->key_left().as_string(), value->second) == types::compare_t::equals) {
+                output_->append(it->second);
+            }
+            return;
+        }
         if (left_ && left_->output()) {
             output_ = base::operators::make_operator_data(context_->resource());
             for (const auto& doc : left_->output()->documents()) {
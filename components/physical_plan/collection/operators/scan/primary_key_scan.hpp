@@ -1,6 +1,8 @@
 #pragma once
 
 #include <components/document/document_id.hpp>
+#include <components/expressions/compare_expression.hpp>
+#include <components/logical_plan/node_limit.hpp>
 #include <components/physical_plan/base/operators/operator.hpp>
 
 namespace components::collection::operators {
@@ -8,9 +10,16 @@ namespace components::collection::operators {
     class primary_key_scan final : public read_only_operator_t {
     public:
         explicit primary_key_scan(services::collection::context_collection_t* context);
+        // finds the document by "_id" equal to the parameter of expr
+        primary_key_scan(services::collection::context_collection_t* context,
+                         expressions::compare_expression_ptr expr,
+                         logical_plan::limit_t limit);
 
     private:
         void on_execute_impl(pipeline::context_t* pipeline_context) final;
+
+        const expressions::compare_expression_ptr expr_;
+        const logical_plan::limit_t limit_{logical_plan::limit_t::unlimit()};
     };
 
-} // namespace components::collection::operators
\ No newline at end of file
+} // namespace components::collection::operators
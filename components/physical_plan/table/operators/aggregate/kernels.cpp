@@ -0,0 +1,117 @@
+#include "kernels.hpp"
+
+namespace components::table::operators::aggregate {
+
+    namespace {
+
+        using types::logical_type;
+        using types::logical_value_t;
+
+        template<typename T>
+        struct sum_kernel_t {
+            static logical_value_t apply(vector::vector_t& input, uint64_t count) {
+                sum_t<T> sum{0};
+                uint64_t valid = 0;
+                sum_vector<T>(input, count, sum, valid);
+                if (valid == 0) {
+                    // zero of the result type like the sum of values
+                    return logical_value_t(types::complex_logical_type(sum_result_type(input.type().type())));
+                }
+                return logical_value_t(static_cast<sum_result_t<T>>(sum));
+            }
+        };
+
+        template<typename T>
+        struct avg_kernel_t {
+            static logical_value_t apply(vector::vector_t& input, uint64_t count) {
+                sum_t<T> sum{0};
+                uint64_t valid = 0;
+                sum_vector<T>(input, count, sum, valid);
+                if (valid == 0) {
+                    return logical_value_t(nullptr);
+                }
+                return logical_value_t(static_cast<double>(sum) / static_cast<double>(valid));
+            }
+        };
+
+        // only numeric types are summed by kernels, their physical type is the logical one
+        template<template<typename> class Kernel>
+        std::optional<logical_value_t> numeric_switch(vector::vector_t& input, uint64_t count) {
+            switch (input.type().type()) {
+                case logical_type::TINYINT:
+                    return Kernel<int8_t>::apply(input, count);
+                case logical_type::SMALLINT:
+                    return Kernel<int16_t>::apply(input, count);
+                case logical_type::INTEGER:
+                    return Kernel<int32_t>::apply(input, count);
+                case logical_type::BIGINT:
+                    return Kernel<int64_t>::apply(input, count);
+                case logical_type::UTINYINT:
+                    return Kernel<uint8_t>::apply(input, count);
+                case logical_type::USMALLINT:
+                    return Kernel<uint16_t>::apply(input, count);
+                case logical_type::UINTEGER:
+                    return Kernel<uint32_t>::apply(input, count);
+                case logical_type::UBIGINT:
+                    return Kernel<uint64_t>::apply(input, count);
+                case logical_type::FLOAT:
+                    return Kernel<float>::apply(input, count);
+                case logical_type::DOUBLE:
+                    return Kernel<double>::apply(input, count);
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        // min/max select a row, so any type with an ordered physical value has a kernel
+        std::optional<uint64_t> select_switch(vector::vector_t& input, uint64_t count, bool is_min) {
+            switch (input.type().to_physical_type()) {
+                case types::physical_type::INT8:
+                    return select_vector<int8_t>(input, count, is_min);
+                case types::physical_type::INT16:
+                    return select_vector<int16_t>(input, count, is_min);
+                case types::physical_type::INT32:
+                    return select_vector<int32_t>(input, count, is_min);
+                case types::physical_type::INT64:
+                    return select_vector<int64_t>(input, count, is_min);
+                case types::physical_type::UINT8:
+                    return select_vector<uint8_t>(input, count, is_min);
+                case types::physical_type::UINT16:
+                    return select_vector<uint16_t>(input, count, is_min);
+                case types::physical_type::UINT32:
+                    return select_vector<uint32_t>(input, count, is_min);
+                case types::physical_type::UINT64:
+                    return select_vector<uint64_t>(input, count, is_min);
+                case types::physical_type::FLOAT:
+                    return select_vector<float>(input, count, is_min);
+                case types::physical_type::DOUBLE:
+                    return select_vector<double>(input, count, is_min);
+                case types::physical_type::STRING:
+                    return select_vector<std::string_view>(input, count, is_min);
+                default:
+                    return std::nullopt;
+            }
+        }
+
+    } // namespace
+
+    std::optional<types::logical_value_t> sum_column(vector::vector_t& input, uint64_t count) {
+        return numeric_switch<sum_kernel_t>(input, count);
+    }
+
+    std::optional<types::logical_value_t> avg_column(vector::vector_t& input, uint64_t count) {
+        return numeric_switch<avg_kernel_t>(input, count);
+    }
+
+    std::optional<types::logical_value_t> min_max_column(vector::vector_t& input, uint64_t count, bool is_min) {
+        auto row = select_switch(input, count, is_min);
+        if (!row.has_value()) {
+            return std::nullopt;
+        }
+        if (*row == vector::INVALID_ID) {
+            return types::logical_value_t(nullptr);
+        }
+        return input.value(*row);
+    }
+
+} // namespace components::table::operators::aggregate
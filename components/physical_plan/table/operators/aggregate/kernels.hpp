@@ -0,0 +1,250 @@
+#pragma once
+
+#include <components/types/logical_value.hpp>
+#include <components/vector/vector.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+namespace components::table::operators::aggregate {
+
+    // integer sums are accumulated in a wider type
+    template<typename T>
+    struct sum_type {
+        using type = T;
+    };
+    template<>
+    struct sum_type<float> {
+        using type = double;
+    };
+    template<>
+    struct sum_type<int8_t> {
+        using type = int64_t;
+    };
+    template<>
+    struct sum_type<int16_t> {
+        using type = int64_t;
+    };
+    template<>
+    struct sum_type<int32_t> {
+        using type = int64_t;
+    };
+    template<>
+    struct sum_type<int64_t> {
+        using type = types::int128_t;
+    };
+    template<>
+    struct sum_type<uint8_t> {
+        using type = uint64_t;
+    };
+    template<>
+    struct sum_type<uint16_t> {
+        using type = uint64_t;
+    };
+    template<>
+    struct sum_type<uint32_t> {
+        using type = uint64_t;
+    };
+    template<>
+    struct sum_type<uint64_t> {
+        using type = types::uint128_t;
+    };
+
+    template<typename T>
+    using sum_t = typename sum_type<T>::type;
+
+    // integer sums keep the widened type (BIGINT up to 32 bits, HUGEINT for 64 bits) and can not overflow,
+    // floating point sums are stored in the column type
+    template<typename T>
+    using sum_result_t = std::conditional_t<std::is_integral_v<T>, sum_t<T>, T>;
+
+    inline types::logical_type sum_result_type(types::logical_type type) {
+        switch (type) {
+            case types::logical_type::TINYINT:
+            case types::logical_type::SMALLINT:
+            case types::logical_type::INTEGER:
+                return types::logical_type::BIGINT;
+            case types::logical_type::BIGINT:
+                return types::logical_type::HUGEINT;
+            case types::logical_type::UTINYINT:
+            case types::logical_type::USMALLINT:
+            case types::logical_type::UINTEGER:
+                return types::logical_type::UBIGINT;
+            case types::logical_type::UBIGINT:
+                return types::logical_type::UHUGEINT;
+            default:
+                return type;
+        }
+    }
+
+    // groups of rows for the row kernels: every row is in the group 0 ...
+    struct single_group_t {
+        constexpr uint64_t operator[](uint64_t) const noexcept { return 0; }
+    };
+
+    // ... or the group of every row is given, vector::INVALID_ID for rows out of any group
+    using row_groups_t = const uint64_t*;
+
+    // row kernels read values through the indexing of the unified format,
+    // so they work for every vector type and are shared by the plain aggregates and GROUP BY
+    template<typename T, typename Groups>
+    void sum_rows(const vector::unified_vector_format& input,
+                  const Groups& groups,
+                  uint64_t begin,
+                  uint64_t end,
+                  sum_t<T>* sums,
+                  uint64_t* counts) {
+        auto data = input.get_data<T>();
+        for (uint64_t row = begin; row < end; row++) {
+            const auto group = groups[row];
+            const auto idx = input.referenced_indexing->get_index(row);
+            if (group == vector::INVALID_ID || !input.validity.row_is_valid(idx)) {
+                continue;
+            }
+            sums[group] += static_cast<sum_t<T>>(data[idx]);
+            ++counts[group];
+        }
+    }
+
+    // keeps the row holding the current min/max of every group, ties keep the first row
+    template<typename T, typename Groups>
+    void select_rows(const vector::unified_vector_format& input,
+                     const Groups& groups,
+                     uint64_t begin,
+                     uint64_t end,
+                     uint64_t* selected,
+                     bool is_min) {
+        auto data = input.get_data<T>();
+        for (uint64_t row = begin; row < end; row++) {
+            const auto group = groups[row];
+            const auto idx = input.referenced_indexing->get_index(row);
+            if (group == vector::INVALID_ID || !input.validity.row_is_valid(idx)) {
+                continue;
+            }
+            auto& current = selected[group];
+            if (current == vector::INVALID_ID) {
+                current = row;
+                continue;
+            }
+            const auto& value = data[input.referenced_indexing->get_index(current)];
+            if (is_min ? data[idx] < value : value < data[idx]) {
+                current = row;
+            }
+        }
+    }
+
+    // kernels of a flat vector: blocks without nulls are summed by a plain loop the compiler vectorizes
+    template<typename T>
+    sum_t<T> sum_block(const T* data, uint64_t count) {
+        if constexpr (std::is_floating_point_v<T>) {
+            // independent partial sums, a single floating point accumulator is a dependency chain
+            constexpr uint64_t lanes = 4;
+            sum_t<T> partial[lanes] = {};
+            uint64_t i = 0;
+            for (; i + lanes <= count; i += lanes) {
+                for (uint64_t lane = 0; lane < lanes; lane++) {
+                    partial[lane] += static_cast<sum_t<T>>(data[i + lane]);
+                }
+            }
+            for (; i < count; i++) {
+                partial[0] += static_cast<sum_t<T>>(data[i]);
+            }
+            return (partial[0] + partial[1]) + (partial[2] + partial[3]);
+        } else {
+            sum_t<T> sum = 0;
+            for (uint64_t i = 0; i < count; i++) {
+                sum += static_cast<sum_t<T>>(data[i]);
+            }
+            return sum;
+        }
+    }
+
+    template<typename T>
+    void
+    sum_flat(const T* data, const vector::validity_mask_t& validity, uint64_t count, sum_t<T>& sum, uint64_t& valid) {
+        if (validity.all_valid()) {
+            sum += sum_block(data, count);
+            valid += count;
+            return;
+        }
+        constexpr auto bits = vector::validity_mask_t::BITS_PER_VALUE;
+        for (uint64_t entry = 0, begin = 0; begin < count; entry++, begin += bits) {
+            const auto end = std::min(begin + bits, count);
+            const auto mask = validity.get_validity_entry(entry);
+            if (mask == ~uint64_t(0)) {
+                sum += sum_block(data + begin, end - begin);
+                valid += end - begin;
+            } else if (mask != 0) {
+                for (auto row = begin; row < end; row++) {
+                    if (mask & (uint64_t(1) << (row - begin))) {
+                        sum += static_cast<sum_t<T>>(data[row]);
+                        ++valid;
+                    }
+                }
+            }
+        }
+    }
+
+    // sum of the valid values of any vector, the constant vector is not expanded
+    template<typename T>
+    void sum_vector(vector::vector_t& input, uint64_t count, sum_t<T>& sum, uint64_t& valid) {
+        switch (input.get_vector_type()) {
+            case vector::vector_type::CONSTANT:
+                if (count > 0 && !input.is_null()) {
+                    sum += static_cast<sum_t<T>>(input.data<T>()[0]) * static_cast<sum_t<T>>(count);
+                    valid += count;
+                }
+                break;
+            case vector::vector_type::FLAT:
+                sum_flat(input.data<T>(), input.validity(), count, sum, valid);
+                break;
+            default: {
+                vector::unified_vector_format format(input.resource(), count);
+                input.to_unified_format(count, format);
+                sum_rows<T>(format, single_group_t{}, 0, count, &sum, &valid);
+                break;
+            }
+        }
+    }
+
+    // row of the min/max of any vector, vector::INVALID_ID if every value is null
+    template<typename T>
+    uint64_t select_vector(vector::vector_t& input, uint64_t count, bool is_min) {
+        if (count == 0) {
+            return vector::INVALID_ID;
+        }
+        if (input.get_vector_type() == vector::vector_type::CONSTANT) {
+            return input.is_null() ? vector::INVALID_ID : 0;
+        }
+        if (input.get_vector_type() == vector::vector_type::FLAT && input.validity().all_valid()) {
+            const auto* data = input.data<T>();
+            if constexpr (std::is_integral_v<T>) {
+                // the reduction over values vectorizes, the row of the first occurrence is found afterwards
+                auto extreme = data[0];
+                for (uint64_t i = 1; i < count; i++) {
+                    extreme = is_min ? std::min(extreme, data[i]) : std::max(extreme, data[i]);
+                }
+                return static_cast<uint64_t>(std::find(data, data + count, extreme) - data);
+            } else {
+                const auto* found =
+                    is_min ? std::min_element(data, data + count) : std::max_element(data, data + count);
+                return static_cast<uint64_t>(found - data);
+            }
+        }
+        vector::unified_vector_format format(input.resource(), count);
+        input.to_unified_format(count, format);
+        uint64_t selected = vector::INVALID_ID;
+        select_rows<T>(format, single_group_t{}, 0, count, &selected, is_min);
+        return selected;
+    }
+
+    // plain aggregates of a column, std::nullopt for types without a kernel
+    // sum has the sum_result_type of the column and is zero without valid values, avg is a double,
+    // avg, min and max are null without valid values
+    std::optional<types::logical_value_t> sum_column(vector::vector_t& input, uint64_t count);
+    std::optional<types::logical_value_t> avg_column(vector::vector_t& input, uint64_t count);
+    std::optional<types::logical_value_t> min_max_column(vector::vector_t& input, uint64_t count, bool is_min);
+
+} // namespace components::table::operators::aggregate
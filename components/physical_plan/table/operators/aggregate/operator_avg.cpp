@@ -1,4 +1,5 @@
 #include "operator_avg.hpp"
+#include "kernels.hpp"
 #include <services/collection/collection.hpp>
 
 namespace components::table::operators::aggregate {
@@ -11,12 +12,16 @@ namespace components::table::operators::aggregate {
 
     types::logical_value_t operator_avg_t::aggregate_impl() {
         if (left_ && left_->output()) {
-            const auto& chunk = left_->output()->data_chunk();
+            auto& chunk = left_->output()->data_chunk();
             auto it = std::find_if(chunk.data.begin(), chunk.data.end(), [&](const vector::vector_t& v) {
                 return v.type().alias() == key_.as_string();
             });
             if (it != chunk.data.end()) {
-                // TODO: sum physical values from vector insted of creating values
+                if (auto result = avg_column(*it, chunk.size())) {
+                    result->set_alias(key_result_);
+                    return *result;
+                }
+                // types without a kernel are summed as values
                 types::logical_value_t sum_(it->type());
                 sum_.set_alias(key_result_);
                 for (size_t i = 0; i < chunk.size(); i++) {
@@ -1,4 +1,5 @@
 #include "operator_min.hpp"
+#include "kernels.hpp"
 #include <services/collection/collection.hpp>
 
 namespace components::table::operators::aggregate {
@@ -11,7 +12,7 @@ namespace components::table::operators::aggregate {
 
     types::logical_value_t operator_min_t::aggregate_impl() {
         if (left_ && left_->output()) {
-            const auto& chunk = left_->output()->data_chunk();
+            auto& chunk = left_->output()->data_chunk();
             auto it = std::find_if(chunk.data.begin(), chunk.data.end(), [&](const vector::vector_t& v) {
                 return v.type().alias() == key_.as_string();
             });
@@ -20,9 +21,13 @@ namespace components::table::operators::aggregate {
                 if (chunk.size() == 0) {
                     min_.set_alias(key_result_);
                     return min_;
-                } else {
-                    min_ = it->value(0);
                 }
+                if (auto result = min_max_column(*it, chunk.size(), true)) {
+                    result->set_alias(key_result_);
+                    return *result;
+                }
+                // types without a kernel are compared as values
+                min_ = it->value(0);
                 for (size_t i = 1; i < chunk.size(); i++) {
                     auto val = it->value(i);
                     if (min_ > val) {
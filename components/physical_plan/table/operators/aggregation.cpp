@@ -15,6 +15,13 @@ namespace components::table::operators {
 
     void aggregation::on_execute_impl(pipeline::context_t*) { take_output(left_); }
 
+    bool aggregation::has_next_chunk_impl() const { return left_ && left_->has_next_chunk(); }
+
+    void aggregation::on_next_chunk_impl(pipeline::context_t* pipeline_context) {
+        left_->next_chunk(pipeline_context);
+        take_output(left_);
+    }
+
     void aggregation::on_prepare_impl() {
         operator_ptr executor = nullptr;
         if (left_) {
@@ -28,6 +35,10 @@ namespace components::table::operators {
                               : static_cast<operator_ptr>(boost::intrusive_ptr(
                                     new transfer_scan(context_, logical_plan::limit_t::unlimit())));
         }
+        // group and sort need the whole input, only a plain scan is streamed by batches
+        if (is_streaming() && !group_ && !sort_) {
+            executor->set_streaming();
+        }
         if (group_) {
             group_->set_children(std::move(executor));
             executor = std::move(group_);
@@ -19,6 +19,8 @@ namespace components::table::operators {
 
         void on_execute_impl(pipeline::context_t* pipeline_context) final;
         void on_prepare_impl() final;
+        bool has_next_chunk_impl() const final;
+        void on_next_chunk_impl(pipeline::context_t* pipeline_context) final;
     };
 
 } // namespace components::table::operators
@@ -1,7 +1,51 @@
 #include "check_expr.hpp"
 
+#include <core/string_matcher/string_matcher.hpp>
+
 namespace components::table::operators {
 
+    namespace {
+
+        // the pattern of a query is the same for every row, so it is compiled once per thread
+        bool match_regex(const types::logical_value_t& value, std::string_view pattern) {
+            thread_local core::string_matcher_cache_t cache;
+            if (value.is_null() || value.type().to_physical_type() != types::physical_type::STRING) {
+                return false;
+            }
+            return cache.get(pattern).match(value.value<std::string_view>());
+        }
+
+        bool check_regex(const expressions::compare_expression_ptr& expr,
+                         const logical_plan::storage_parameters* parameters,
+                         const vector::data_chunk_t& chunk_left,
+                         const vector::data_chunk_t& chunk_right,
+                         const std::unordered_map<std::string, size_t>& str_index_map_left,
+                         const std::unordered_map<std::string, size_t>& str_index_map_right,
+                         size_t row_left,
+                         size_t row_right) {
+            auto val_left = chunk_left.data.at(str_index_map_left.at(expr->key_left().as_string())).value(row_left);
+            if (expr->key_right().is_null()) {
+                return match_regex(val_left, parameters->parameters.at(expr->value()).as_string());
+            }
+            auto val_right =
+                chunk_right.data.at(str_index_map_right.at(expr->key_right().as_string())).value(row_right);
+            if (val_right.is_null() || val_right.type().to_physical_type() != types::physical_type::STRING) {
+                return false;
+            }
+            return match_regex(val_left, val_right.value<std::string_view>());
+        }
+
+        bool check_regex(const expressions::compare_expression_ptr& expr,
+                         const logical_plan::storage_parameters* parameters,
+                         const vector::data_chunk_t& chunk,
+                         const std::unordered_map<std::string, size_t>& str_index_map,
+                         size_t row) {
+            auto val = chunk.data.at(str_index_map.at(expr->key_left().as_string())).value(row);
+            return match_regex(val, parameters->parameters.at(expr->value()).as_string());
+        }
+
+    } // namespace
+
     template<typename COMP>
     bool check_expr(const expressions::compare_expression_ptr& expr,
                     const logical_plan::storage_parameters* parameters,
@@ -200,6 +244,15 @@ namespace components::table::operators {
                                                      str_index_map_right,
                                                      row_left,
                                                      row_right);
+            case expressions::compare_type::regex:
+                return check_regex(expr,
+                                   parameters,
+                                   chunk_left,
+                                   chunk_right,
+                                   str_index_map_left,
+                                   str_index_map_right,
+                                   row_left,
+                                   row_right);
             case expressions::compare_type::any:
             case expressions::compare_type::all:
             case expressions::compare_type::all_true:
@@ -264,6 +317,8 @@ namespace components::table::operators {
                 return check_expr<std::greater_equal<>>(expr, parameters, chunk, str_index_map, row);
             case expressions::compare_type::lte:
                 return check_expr<std::less_equal<>>(expr, parameters, chunk, str_index_map, row);
+            case expressions::compare_type::regex:
+                return check_regex(expr, parameters, chunk, str_index_map, row);
             case expressions::compare_type::any:
             case expressions::compare_type::all:
             case expressions::compare_type::all_true:
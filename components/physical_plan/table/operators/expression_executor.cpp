@@ -0,0 +1,686 @@
+#include "expression_executor.hpp"
+
+#include <components/vector/vector_operations.hpp>
+
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace components::table::operators {
+
+    namespace {
+
+        using expressions::update_expr_type;
+        using types::complex_logical_type;
+        using types::logical_type;
+        using types::logical_value_t;
+        using node_t = update_executor_t::node_t;
+
+        bool is_integral(logical_type type) {
+            switch (type) {
+                case logical_type::TINYINT:
+                case logical_type::SMALLINT:
+                case logical_type::INTEGER:
+                case logical_type::BIGINT:
+                case logical_type::UTINYINT:
+                case logical_type::USMALLINT:
+                case logical_type::UINTEGER:
+                case logical_type::UBIGINT:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        bool is_floating(logical_type type) { return type == logical_type::FLOAT || type == logical_type::DOUBLE; }
+
+        bool is_arithmetic(logical_type type) { return is_integral(type) || is_floating(type); }
+
+        // only numeric types have kernels, their physical type is the logical one
+        template<typename Func>
+        decltype(auto) numeric_switch(logical_type type, Func&& func) {
+            switch (type) {
+                case logical_type::TINYINT:
+                    return func(int8_t{});
+                case logical_type::SMALLINT:
+                    return func(int16_t{});
+                case logical_type::INTEGER:
+                    return func(int32_t{});
+                case logical_type::BIGINT:
+                    return func(int64_t{});
+                case logical_type::UTINYINT:
+                    return func(uint8_t{});
+                case logical_type::USMALLINT:
+                    return func(uint16_t{});
+                case logical_type::UINTEGER:
+                    return func(uint32_t{});
+                case logical_type::UBIGINT:
+                    return func(uint64_t{});
+                case logical_type::FLOAT:
+                    return func(float{});
+                case logical_type::DOUBLE:
+                    return func(double{});
+                default:
+                    throw std::logic_error("update_executor_t: not a numeric type");
+            }
+        }
+
+        size_t type_size(logical_type type) {
+            return numeric_switch(type, [](auto value) { return sizeof(value); });
+        }
+
+        bool is_unary(update_expr_type type) {
+            return type == update_expr_type::sqr_root || type == update_expr_type::cube_root ||
+                   type == update_expr_type::abs || type == update_expr_type::NOT;
+        }
+
+        // type the operands are converted to and the result is computed in, NA if they are not supported
+        logical_type operation_type(update_expr_type op, logical_type left, logical_type right) {
+            switch (op) {
+                case update_expr_type::sqr_root:
+                case update_expr_type::cube_root:
+                    return left == logical_type::FLOAT ? logical_type::FLOAT : logical_type::DOUBLE;
+                case update_expr_type::abs:
+                    return left;
+                case update_expr_type::exp:
+                    return logical_type::DOUBLE;
+                case update_expr_type::NOT:
+                case update_expr_type::shift_left:
+                case update_expr_type::shift_right:
+                    return is_integral(left) && is_integral(right) ? left : logical_type::NA;
+                case update_expr_type::AND:
+                case update_expr_type::OR:
+                case update_expr_type::XOR:
+                    if (!is_integral(left) || !is_integral(right)) {
+                        return logical_type::NA;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            if (is_floating(left) || is_floating(right)) {
+                return left == logical_type::FLOAT && right == logical_type::FLOAT ? logical_type::FLOAT
+                                                                                   : logical_type::DOUBLE;
+            }
+            return type_size(right) > type_size(left) ? right : left;
+        }
+
+        // operations return false when the result is null
+        struct add_op {
+            template<typename T>
+            static bool operation(T left, T right, T& result) {
+                result = T(left + right);
+                return true;
+            }
+        };
+
+        struct sub_op {
+            template<typename T>
+            static bool operation(T left, T right, T& result) {
+                result = T(left - right);
+                return true;
+            }
+        };
+
+        struct mult_op {
+            template<typename T>
+            static bool operation(T left, T right, T& result) {
+                result = T(left * right);
+                return true;
+            }
+        };
+
+        struct div_op {
+            template<typename T>
+            static bool operation(T left, T right, T& result) {
+                if constexpr (std::is_integral_v<T>) {
+                    if (right == T(0)) {
+                        return false;
+                    }
+                    if constexpr (std::is_signed_v<T>) {
+                        // min / -1 overflows
+                        if (right == T(-1)) {
+                            using U = std::make_unsigned_t<T>;
+                            result = T(U(0) - U(left));
+                            return true;
+                        }
+                    }
+                }
+                result = T(left / right);
+                return true;
+            }
+        };
+
+        struct mod_op {
+            template<typename T>
+            static bool operation(T left, T right, T& result) {
+                if constexpr (std::is_integral_v<T>) {
+                    if (right == T(0)) {
+                        return false;
+                    }
+                    if constexpr (std::is_signed_v<T>) {
+                        if (right == T(-1)) {
+                            result = T(0);
+                            return true;
+                        }
+                    }
+                    result = T(left % right);
+                } else {
+                    result = std::fmod(left, right);
+                }
+                return true;
+            }
+        };
+
+        struct exp_op {
+            template<typename T>
+            static bool operation(T left, T right, T& result) {
+                result = T(std::pow(left, right));
+                return true;
+            }
+        };
+
+        struct and_op {
+            template<typename T>
+            static bool operation(T left, T right, T& result) {
+                if constexpr (std::is_integral_v<T>) {
+                    result = T(left & right);
+                    return true;
+                }
+                return false;
+            }
+        };
+
+        struct or_op {
+            template<typename T>
+            static bool operation(T left, T right, T& result) {
+                if constexpr (std::is_integral_v<T>) {
+                    result = T(left | right);
+                    return true;
+                }
+                return false;
+            }
+        };
+
+        struct xor_op {
+            template<typename T>
+            static bool operation(T left, T right, T& result) {
+                if constexpr (std::is_integral_v<T>) {
+                    result = T(left ^ right);
+                    return true;
+                }
+                return false;
+            }
+        };
+
+        template<bool LEFT>
+        struct shift_op {
+            template<typename T>
+            static bool operation(T left, T right, T& result) {
+                if constexpr (std::is_integral_v<T>) {
+                    using U = std::make_unsigned_t<T>;
+                    // shifting by a negative value or by the width of the type is undefined
+                    if (U(right) >= sizeof(T) * 8) {
+                        return false;
+                    }
+                    if constexpr (LEFT) {
+                        result = T(U(left) << right);
+                    } else {
+                        result = T(left >> right);
+                    }
+                    return true;
+                }
+                return false;
+            }
+        };
+
+        struct sqrt_op {
+            template<typename T>
+            static bool operation(T value, T& result) {
+                result = T(std::sqrt(value));
+                return true;
+            }
+        };
+
+        struct cbrt_op {
+            template<typename T>
+            static bool operation(T value, T& result) {
+                result = T(std::cbrt(value));
+                return true;
+            }
+        };
+
+        struct abs_op {
+            template<typename T>
+            static bool operation(T value, T& result) {
+                if constexpr (std::is_floating_point_v<T>) {
+                    result = std::abs(value);
+                } else if constexpr (std::is_signed_v<T>) {
+                    using U = std::make_unsigned_t<T>;
+                    result = value < T(0) ? T(U(0) - U(value)) : value;
+                } else {
+                    result = value;
+                }
+                return true;
+            }
+        };
+
+        struct not_op {
+            template<typename T>
+            static bool operation(T value, T& result) {
+                if constexpr (std::is_integral_v<T>) {
+                    result = T(~value);
+                    return true;
+                }
+                return false;
+            }
+        };
+
+        // value of a node for the evaluated rows, a constant is not expanded into a vector
+        struct operand_t {
+            std::optional<vector::vector_t> vector;
+            logical_value_t constant;
+        };
+
+        bool is_constant(const node_t& node) { return node.type == update_expr_type::get_value_params; }
+
+        bool is_null_constant(const node_t& node) { return is_constant(node) && node.constant.is_null(); }
+
+        template<typename T, typename OP, bool LEFT_CONSTANT, bool RIGHT_CONSTANT>
+        void binary_loop(const T* ldata, const T* rdata, T* result, vector::validity_mask_t& validity, uint64_t count) {
+            for (uint64_t i = 0; i < count; i++) {
+                if (!OP::operation(ldata[LEFT_CONSTANT ? 0 : i], rdata[RIGHT_CONSTANT ? 0 : i], result[i])) {
+                    validity.set_invalid(i);
+                }
+            }
+        }
+
+        template<typename OP>
+        operand_t binary(std::pmr::memory_resource* resource,
+                         const operand_t& left,
+                         const operand_t& right,
+                         const complex_logical_type& type,
+                         uint64_t count) {
+            return numeric_switch(type.type(), [&](auto tag) -> operand_t {
+                using T = decltype(tag);
+                if (!left.vector && !right.vector) {
+                    T result;
+                    if (OP::operation(left.constant.value<T>(), right.constant.value<T>(), result)) {
+                        return {std::nullopt, logical_value_t(result)};
+                    }
+                    return {std::nullopt, logical_value_t(nullptr)};
+                }
+                vector::vector_t result(resource, type, count);
+                auto& validity = result.validity();
+                T lconstant{};
+                T rconstant{};
+                const T* ldata = &lconstant;
+                const T* rdata = &rconstant;
+                if (left.vector) {
+                    ldata = left.vector->data<T>();
+                    validity.combine(left.vector->validity(), count);
+                } else {
+                    lconstant = left.constant.value<T>();
+                }
+                if (right.vector) {
+                    rdata = right.vector->data<T>();
+                    validity.combine(right.vector->validity(), count);
+                } else {
+                    rconstant = right.constant.value<T>();
+                }
+                // null rows are computed as well, it is cheaper than branching on the validity mask
+                if (!left.vector) {
+                    binary_loop<T, OP, true, false>(ldata, rdata, result.data<T>(), validity, count);
+                } else if (!right.vector) {
+                    binary_loop<T, OP, false, true>(ldata, rdata, result.data<T>(), validity, count);
+                } else {
+                    binary_loop<T, OP, false, false>(ldata, rdata, result.data<T>(), validity, count);
+                }
+                return {std::move(result), logical_value_t()};
+            });
+        }
+
+        template<typename OP>
+        operand_t unary(std::pmr::memory_resource* resource,
+                        const operand_t& input,
+                        const complex_logical_type& type,
+                        uint64_t count) {
+            return numeric_switch(type.type(), [&](auto tag) -> operand_t {
+                using T = decltype(tag);
+                if (!input.vector) {
+                    T result;
+                    if (OP::operation(input.constant.value<T>(), result)) {
+                        return {std::nullopt, logical_value_t(result)};
+                    }
+                    return {std::nullopt, logical_value_t(nullptr)};
+                }
+                vector::vector_t result(resource, type, count);
+                auto& validity = result.validity();
+                validity.combine(input.vector->validity(), count);
+                const auto* data = input.vector->data<T>();
+                auto* result_data = result.data<T>();
+                for (uint64_t i = 0; i < count; i++) {
+                    if (!OP::operation(data[i], result_data[i])) {
+                        validity.set_invalid(i);
+                    }
+                }
+                return {std::move(result), logical_value_t()};
+            });
+        }
+
+        operand_t convert(std::pmr::memory_resource* resource,
+                          operand_t operand,
+                          const complex_logical_type& type,
+                          uint64_t count) {
+            if (!operand.vector) {
+                if (!operand.constant.is_null() && operand.constant.type().type() != type.type()) {
+                    operand.constant = operand.constant.cast_as(type);
+                }
+                return operand;
+            }
+            if (operand.vector->type().type() == type.type()) {
+                return operand;
+            }
+            vector::vector_t result(resource, type, count);
+            numeric_switch(operand.vector->type().type(), [&](auto source_tag) {
+                using S = decltype(source_tag);
+                numeric_switch(type.type(), [&](auto target_tag) {
+                    using T = decltype(target_tag);
+                    const auto* from = operand.vector->data<S>();
+                    auto* to = result.data<T>();
+                    for (uint64_t i = 0; i < count; i++) {
+                        to[i] = static_cast<T>(from[i]);
+                    }
+                });
+            });
+            result.validity() = operand.vector->validity();
+            return {std::move(result), logical_value_t()};
+        }
+
+        operand_t apply(std::pmr::memory_resource* resource,
+                        const node_t& node,
+                        operand_t left,
+                        operand_t right,
+                        uint64_t count) {
+            const auto& type = node.result_type;
+            left = convert(resource, std::move(left), type, count);
+            if (!is_unary(node.type)) {
+                right = convert(resource, std::move(right), type, count);
+            }
+            switch (node.type) {
+                case update_expr_type::add:
+                    return binary<add_op>(resource, left, right, type, count);
+                case update_expr_type::sub:
+                    return binary<sub_op>(resource, left, right, type, count);
+                case update_expr_type::mult:
+                    return binary<mult_op>(resource, left, right, type, count);
+                case update_expr_type::div:
+                    return binary<div_op>(resource, left, right, type, count);
+                case update_expr_type::mod:
+                    return binary<mod_op>(resource, left, right, type, count);
+                case update_expr_type::exp:
+                    return binary<exp_op>(resource, left, right, type, count);
+                case update_expr_type::AND:
+                    return binary<and_op>(resource, left, right, type, count);
+                case update_expr_type::OR:
+                    return binary<or_op>(resource, left, right, type, count);
+                case update_expr_type::XOR:
+                    return binary<xor_op>(resource, left, right, type, count);
+                case update_expr_type::shift_left:
+                    return binary<shift_op<true>>(resource, left, right, type, count);
+                case update_expr_type::shift_right:
+                    return binary<shift_op<false>>(resource, left, right, type, count);
+                case update_expr_type::sqr_root:
+                    return unary<sqrt_op>(resource, left, type, count);
+                case update_expr_type::cube_root:
+                    return unary<cbrt_op>(resource, left, type, count);
+                case update_expr_type::abs:
+                    return unary<abs_op>(resource, left, type, count);
+                case update_expr_type::NOT:
+                    return unary<not_op>(resource, left, type, count);
+                default:
+                    throw std::logic_error("update_executor_t: not an operation");
+            }
+        }
+
+        operand_t evaluate(std::pmr::memory_resource* resource,
+                           const node_t& node,
+                           const vector::data_chunk_t& chunk,
+                           const vector::indexing_vector_t& indexing,
+                           uint64_t count) {
+            if (is_constant(node)) {
+                return {std::nullopt, node.constant};
+            }
+            if (node.type == update_expr_type::get_value_doc) {
+                vector::vector_t result(resource, chunk.data[node.column].type(), count);
+                vector::vector_ops::copy(chunk.data[node.column], result, indexing, count, 0, 0);
+                return {std::move(result), logical_value_t()};
+            }
+            auto left = evaluate(resource, *node.left, chunk, indexing, count);
+            operand_t right;
+            if (node.right) {
+                right = evaluate(resource, *node.right, chunk, indexing, count);
+            }
+            return apply(resource, node, std::move(left), std::move(right), count);
+        }
+
+        std::optional<size_t> column_index(const vector::data_chunk_t& chunk, const expressions::key_t& key) {
+            size_t index = chunk.column_count();
+            switch (key.which()) {
+                case expressions::key_t::type::string:
+                    for (size_t i = 0; i < chunk.column_count(); i++) {
+                        if (chunk.data[i].type().alias() == key.as_string()) {
+                            index = i;
+                            break;
+                        }
+                    }
+                    break;
+                case expressions::key_t::type::int32:
+                    index = static_cast<size_t>(key.as_int());
+                    break;
+                case expressions::key_t::type::uint32:
+                    index = key.as_uint();
+                    break;
+                default:
+                    break;
+            }
+            if (index >= chunk.column_count()) {
+                return std::nullopt;
+            }
+            return index;
+        }
+
+        std::unique_ptr<node_t> compile_node(std::pmr::memory_resource* resource,
+                                             const expressions::update_expr_ptr& expr,
+                                             const vector::data_chunk_t& chunk,
+                                             const logical_plan::storage_parameters* parameters) {
+            if (!expr) {
+                return nullptr;
+            }
+            auto node = std::make_unique<node_t>();
+            node->type = expr->type();
+            switch (expr->type()) {
+                case update_expr_type::get_value_doc: {
+                    const auto* get = static_cast<const expressions::update_expr_get_value_t*>(expr.get());
+                    if (get->side() == expressions::update_expr_get_value_t::side_t::undefined) {
+                        return nullptr;
+                    }
+                    auto column = column_index(chunk, get->key());
+                    if (!column) {
+                        return nullptr;
+                    }
+                    node->column = *column;
+                    node->result_type = chunk.data[*column].type();
+                    return node;
+                }
+                case update_expr_type::get_value_params: {
+                    const auto* param = static_cast<const expressions::update_expr_get_const_value_t*>(expr.get());
+                    node->constant = parameters->parameters.at(param->id()).as_logical_value();
+                    node->result_type = node->constant.type();
+                    return node;
+                }
+                case update_expr_type::set:
+                case update_expr_type::factorial:
+                    return nullptr;
+                default:
+                    break;
+            }
+
+            node->left = compile_node(resource, expr->left(), chunk, parameters);
+            if (!node->left) {
+                return nullptr;
+            }
+            if (!is_unary(node->type)) {
+                node->right = compile_node(resource, expr->right(), chunk, parameters);
+                if (!node->right) {
+                    return nullptr;
+                }
+            }
+            if (is_null_constant(*node->left) || (node->right && is_null_constant(*node->right))) {
+                node->type = update_expr_type::get_value_params;
+                node->constant = logical_value_t(nullptr);
+                node->result_type = node->constant.type();
+                node->left.reset();
+                node->right.reset();
+                return node;
+            }
+            auto left_type = node->left->result_type.type();
+            auto right_type = node->right ? node->right->result_type.type() : left_type;
+            if (!is_arithmetic(left_type) || !is_arithmetic(right_type)) {
+                return nullptr;
+            }
+            auto type = operation_type(node->type, left_type, right_type);
+            if (type == logical_type::NA) {
+                return nullptr;
+            }
+            node->result_type = complex_logical_type(type);
+
+            if (is_constant(*node->left) && (!node->right || is_constant(*node->right))) {
+                operand_t right;
+                if (node->right) {
+                    right.constant = node->right->constant;
+                }
+                auto folded = apply(resource, *node, {std::nullopt, node->left->constant}, std::move(right), 1);
+                node->type = update_expr_type::get_value_params;
+                node->constant = std::move(folded.constant);
+                if (!node->constant.is_null()) {
+                    node->result_type = node->constant.type();
+                }
+                node->left.reset();
+                node->right.reset();
+            }
+            return node;
+        }
+
+        // numeric values are written straight into the column data, the column keeps its type
+        template<typename T>
+        void write_numeric(vector::vector_t& column,
+                           const operand_t& value,
+                           const vector::indexing_vector_t& indexing,
+                           uint64_t count,
+                           std::vector<bool>& modified) {
+            vector::vector_t* target = &column;
+            const vector::indexing_vector_t* positions = nullptr;
+            if (column.get_vector_type() == vector::vector_type::DICTIONARY) {
+                positions = &column.indexing();
+                target = &column.child();
+            }
+            auto* data = target->data<T>();
+            auto& validity = target->validity();
+            const T* values = value.vector ? value.vector->data<T>() : nullptr;
+            const bool constant_is_valid = value.vector || !value.constant.is_null();
+            const T constant = value.vector || !constant_is_valid ? T() : value.constant.value<T>();
+            for (uint64_t i = 0; i < count; i++) {
+                auto row = indexing.get_index(i);
+                if (positions) {
+                    row = positions->get_index(row);
+                }
+                const bool is_valid = value.vector ? value.vector->validity().row_is_valid(i) : constant_is_valid;
+                const bool was_valid = validity.row_is_valid(row);
+                if (is_valid) {
+                    const T new_value = values ? values[i] : constant;
+                    if (!was_valid || data[row] != new_value) {
+                        modified[i] = true;
+                        data[row] = new_value;
+                        validity.set_valid(row);
+                    }
+                } else if (was_valid) {
+                    modified[i] = true;
+                    validity.set_invalid(row);
+                }
+            }
+        }
+
+        bool is_writable(const vector::vector_t& column) {
+            if (column.get_vector_type() == vector::vector_type::FLAT) {
+                return true;
+            }
+            return column.get_vector_type() == vector::vector_type::DICTIONARY &&
+                   column.child().get_vector_type() == vector::vector_type::FLAT;
+        }
+
+    } // namespace
+
+    update_executor_t::update_executor_t(std::pmr::memory_resource* resource)
+        : resource_(resource) {}
+
+    std::unique_ptr<update_executor_t>
+    update_executor_t::compile(std::pmr::memory_resource* resource,
+                               const std::pmr::vector<expressions::update_expr_ptr>& updates,
+                               const vector::data_chunk_t& chunk,
+                               const logical_plan::storage_parameters* parameters) {
+        std::unique_ptr<update_executor_t> executor(new update_executor_t(resource));
+        for (const auto& update : updates) {
+            if (!update || update->type() != update_expr_type::set) {
+                return nullptr;
+            }
+            const auto* set = static_cast<const expressions::update_expr_set_t*>(update.get());
+            if (!set->left()) {
+                // does nothing in the interpreter either
+                continue;
+            }
+            auto column = column_index(chunk, set->key());
+            auto value = compile_node(resource, set->left(), chunk, parameters);
+            if (!column || !value) {
+                return nullptr;
+            }
+            executor->assignments_.push_back({*column, std::move(value)});
+        }
+        return executor;
+    }
+
+    void update_executor_t::execute(vector::data_chunk_t& chunk,
+                                    const vector::indexing_vector_t& indexing,
+                                    uint64_t count,
+                                    std::vector<bool>& modified) const {
+        modified.assign(count, false);
+        // assignments are applied one after another, so a later one sees the values written by the previous
+        for (const auto& assignment : assignments_) {
+            auto& column = chunk.data[assignment.column];
+            auto value = evaluate(resource_, *assignment.value, chunk, indexing, count);
+            const auto column_type = column.type().type();
+            const bool is_null = !value.vector && value.constant.is_null();
+            const auto value_type = value.vector ? value.vector->type().type() : value.constant.type().type();
+            if (is_arithmetic(column_type) && (is_null || is_arithmetic(value_type)) && is_writable(column)) {
+                if (!is_null) {
+                    value = convert(resource_, std::move(value), column.type(), count);
+                }
+                numeric_switch(column_type, [&](auto tag) {
+                    write_numeric<decltype(tag)>(column, value, indexing, count, modified);
+                });
+                continue;
+            }
+            // strings and other types are copied value by value
+            for (uint64_t i = 0; i < count; i++) {
+                auto row = indexing.get_index(i);
+                auto new_value = value.vector ? value.vector->value(i) : value.constant;
+                if (column.value(row) != new_value) {
+                    column.set_value(row, new_value);
+                    modified[i] = true;
+                }
+            }
+        }
+    }
+
+} // namespace components::table::operators
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <components/expressions/update_expression.hpp>
+#include <components/logical_plan/param_storage.hpp>
+#include <components/vector/data_chunk.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace components::table::operators {
+
+    // update expressions of a single chunk evaluated a vector at a time instead of row by row
+    // parameters are resolved and constant subtrees are folded when the expressions are compiled,
+    // a null operand makes the result null, integer division by zero gives null as well
+    class update_executor_t {
+    public:
+        // nullptr if any of the expressions can not be vectorized, they are executed row by row then
+        static std::unique_ptr<update_executor_t> compile(std::pmr::memory_resource* resource,
+                                                          const std::pmr::vector<expressions::update_expr_ptr>& updates,
+                                                          const vector::data_chunk_t& chunk,
+                                                          const logical_plan::storage_parameters* parameters);
+
+        // updates the first count rows listed in indexing, modified[i] tells if the i-th of them was changed
+        void execute(vector::data_chunk_t& chunk,
+                     const vector::indexing_vector_t& indexing,
+                     uint64_t count,
+                     std::vector<bool>& modified) const;
+
+        struct node_t {
+            // get_value_doc reads a column, get_value_params is a constant, others are operations
+            expressions::update_expr_type type;
+            types::complex_logical_type result_type;
+            size_t column = 0;
+            types::logical_value_t constant;
+            std::unique_ptr<node_t> left;
+            std::unique_ptr<node_t> right;
+        };
+
+    private:
+        struct assignment_t {
+            size_t column;
+            std::unique_ptr<node_t> value;
+        };
+
+        explicit update_executor_t(std::pmr::memory_resource* resource);
+
+        std::pmr::memory_resource* resource_;
+        std::vector<assignment_t> assignments_;
+    };
+
+} // namespace components::table::operators
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <components/vector/data_chunk.hpp>
+
+#include <string>
+
+namespace components::table::operators {
+
+    // vector_ops::hash uses std::hash, which is the identity for integers, so mix bits before masking
+    inline uint64_t bucket_hash(uint64_t hash) {
+        hash ^= hash >> 33;
+        hash *= UINT64_C(0xff51afd7ed558ccd);
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    // physical types the hash join and the hash aggregate compare keys of
+    inline bool is_hashable_key(types::physical_type type) {
+        switch (type) {
+            case types::physical_type::BOOL:
+            case types::physical_type::INT8:
+            case types::physical_type::INT16:
+            case types::physical_type::INT32:
+            case types::physical_type::INT64:
+            case types::physical_type::UINT8:
+            case types::physical_type::UINT16:
+            case types::physical_type::UINT32:
+            case types::physical_type::UINT64:
+            case types::physical_type::FLOAT:
+            case types::physical_type::DOUBLE:
+            case types::physical_type::STRING:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    inline size_t find_column(const std::pmr::vector<types::complex_logical_type>& types, const std::string& name) {
+        for (size_t i = 0; i < types.size(); i++) {
+            if (types[i].alias() == name) {
+                return i;
+            }
+        }
+        return vector::INVALID_ID;
+    }
+
+    inline size_t find_column(const vector::data_chunk_t& chunk, const std::string& name) {
+        for (size_t i = 0; i < chunk.column_count(); i++) {
+            if (chunk.data[i].type().alias() == name) {
+                return i;
+            }
+        }
+        return vector::INVALID_ID;
+    }
+
+} // namespace components::table::operators
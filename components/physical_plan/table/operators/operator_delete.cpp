@@ -51,7 +51,7 @@ namespace components::table::operators {
             for (size_t i = 0; i < index; i++) {
                 size_t id = ids.data<int64_t>()[i];
                 modified_->append(id);
-                context_->index_engine()->delete_row(chunk_left, id, pipeline_context);
+                context_->index_engine()->delete_row(chunk_left, id, static_cast<int64_t>(id), pipeline_context);
             }
         } else if (left_ && left_->output()) {
             modified_ = base::operators::make_operator_write_data<size_t>(context_->resource());
@@ -63,6 +63,8 @@ namespace components::table::operators {
             }
 
             vector::vector_t ids(left_->output()->resource(), logical_type::BIGINT, chunk.size());
+            // positions of the deleted rows in the chunk, their keys are removed from the indexes
+            vector::indexing_vector_t rows(context_->resource(), chunk.size());
 
             size_t index = 0;
             for (size_t i = 0; i < chunk.size(); i++) {
@@ -74,6 +76,7 @@ namespace components::table::operators {
                     } else {
                         ids.set_value(index++, chunk.row_ids.value(i));
                     }
+                    rows.set_index(index - 1, i);
                 }
             }
             ids.resize(chunk.size(), index);
@@ -82,7 +85,10 @@ namespace components::table::operators {
             for (size_t i = 0; i < index; i++) {
                 size_t id = ids.data<int64_t>()[i];
                 modified_->append(id);
-                context_->index_engine()->delete_row(chunk, i, pipeline_context);
+                context_->index_engine()->delete_row(chunk,
+                                                     rows.get_index(i),
+                                                     static_cast<int64_t>(id),
+                                                     pipeline_context);
             }
         }
     }
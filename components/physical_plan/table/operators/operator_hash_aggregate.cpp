@@ -0,0 +1,646 @@
+#include "operator_hash_aggregate.hpp"
+
+#include "aggregate/kernels.hpp"
+#include "aggregate/operator_avg.hpp"
+#include "aggregate/operator_count.hpp"
+#include "aggregate/operator_max.hpp"
+#include "aggregate/operator_min.hpp"
+#include "aggregate/operator_sum.hpp"
+#include "get/simple_value.hpp"
+#include "hash_utils.hpp"
+#include "operator_group.hpp"
+
+#include <components/vector/vector_operations.hpp>
+#include <services/collection/collection.hpp>
+
+#include <algorithm>
+
+namespace components::table::operators {
+
+    namespace {
+
+        using expressions::aggregate_type;
+        using vector::INVALID_ID;
+
+        // smaller inputs are grouped and aggregated on the executor thread only
+        constexpr uint64_t MIN_PARTITION_ROWS = 8 * vector::DEFAULT_VECTOR_CAPACITY;
+
+        inline uint64_t partition_start(uint64_t rows, uint64_t partitions, uint64_t partition) {
+            return rows * partition / partitions;
+        }
+
+        template<typename T>
+        bool key_equal(const vector::unified_vector_format& key, uint64_t lhs, uint64_t rhs) {
+            auto data = key.get_data<T>();
+            return data[key.referenced_indexing->get_index(lhs)] == data[key.referenced_indexing->get_index(rhs)];
+        }
+
+        bool key_equal_switch(types::physical_type type,
+                              const vector::unified_vector_format& key,
+                              uint64_t lhs,
+                              uint64_t rhs) {
+            switch (type) {
+                case types::physical_type::BOOL:
+                case types::physical_type::INT8:
+                    return key_equal<int8_t>(key, lhs, rhs);
+                case types::physical_type::INT16:
+                    return key_equal<int16_t>(key, lhs, rhs);
+                case types::physical_type::INT32:
+                    return key_equal<int32_t>(key, lhs, rhs);
+                case types::physical_type::INT64:
+                    return key_equal<int64_t>(key, lhs, rhs);
+                case types::physical_type::UINT8:
+                    return key_equal<uint8_t>(key, lhs, rhs);
+                case types::physical_type::UINT16:
+                    return key_equal<uint16_t>(key, lhs, rhs);
+                case types::physical_type::UINT32:
+                    return key_equal<uint32_t>(key, lhs, rhs);
+                case types::physical_type::UINT64:
+                    return key_equal<uint64_t>(key, lhs, rhs);
+                case types::physical_type::FLOAT:
+                    return key_equal<float>(key, lhs, rhs);
+                case types::physical_type::DOUBLE:
+                    return key_equal<double>(key, lhs, rhs);
+                case types::physical_type::STRING:
+                    return key_equal<std::string_view>(key, lhs, rhs);
+                default:
+                    throw std::runtime_error("invalid group key type in table::operator_hash_aggregate");
+            }
+        }
+
+        // open addressing over group ids, hashes of groups are kept to skip most key comparisons
+        template<typename KeysEqual>
+        uint64_t find_or_add_group(std::pmr::vector<uint64_t>& slots,
+                                   uint64_t hash,
+                                   uint64_t row,
+                                   std::pmr::vector<uint64_t>& group_rows,
+                                   std::pmr::vector<uint64_t>& group_hashes,
+                                   const KeysEqual& keys_equal) {
+            const uint64_t slot_mask = slots.size() - 1;
+            auto slot = bucket_hash(hash) & slot_mask;
+            while (true) {
+                auto group = slots[slot];
+                if (group == INVALID_ID) {
+                    group = group_rows.size();
+                    slots[slot] = group;
+                    group_rows.push_back(row);
+                    group_hashes.push_back(hash);
+                    return group;
+                }
+                if (group_hashes[group] == hash && keys_equal(row, group_rows[group])) {
+                    return group;
+                }
+                slot = (slot + 1) & slot_mask;
+            }
+        }
+
+        // every partition sums its rows into a state of its own in the widened type of the kernels,
+        // states are merged in partition order and written to the result once
+        template<typename T>
+        void sum_groups(const vector::unified_vector_format& input,
+                        const std::pmr::vector<uint64_t>& row_groups,
+                        uint64_t count,
+                        uint64_t partitions,
+                        const std::function<void(uint64_t, const std::function<void(uint64_t)>&)>& run_partitions,
+                        vector::vector_t& result,
+                        uint64_t group_count,
+                        bool is_avg) {
+            using sum_type = aggregate::sum_t<T>;
+            std::vector<std::vector<sum_type>> sums(partitions, std::vector<sum_type>(group_count, sum_type(0)));
+            std::vector<std::vector<uint64_t>> counts(partitions, std::vector<uint64_t>(group_count, 0));
+            run_partitions(partitions, [&](uint64_t partition) {
+                aggregate::sum_rows<T>(input,
+                                       row_groups.data(),
+                                       partition_start(count, partitions, partition),
+                                       partition_start(count, partitions, partition + 1),
+                                       sums[partition].data(),
+                                       counts[partition].data());
+            });
+            for (uint64_t partition = 1; partition < partitions; partition++) {
+                for (uint64_t group = 0; group < group_count; group++) {
+                    sums[0][group] += sums[partition][group];
+                    counts[0][group] += counts[partition][group];
+                }
+            }
+            for (uint64_t group = 0; group < group_count; group++) {
+                if (counts[0][group] == 0) {
+                    result.validity().set_invalid(group);
+                } else if (is_avg) {
+                    result.data<double>()[group] =
+                        static_cast<double>(sums[0][group]) / static_cast<double>(counts[0][group]);
+                } else {
+                    result.data<aggregate::sum_result_t<T>>()[group] =
+                        static_cast<aggregate::sum_result_t<T>>(sums[0][group]);
+                }
+            }
+        }
+
+        // sum has the widened type of aggregate::sum_result_type, avg is a double
+        void sum_switch(types::physical_type type,
+                        const vector::unified_vector_format& input,
+                        const std::pmr::vector<uint64_t>& row_groups,
+                        uint64_t count,
+                        uint64_t partitions,
+                        const std::function<void(uint64_t, const std::function<void(uint64_t)>&)>& run_partitions,
+                        vector::vector_t& result,
+                        uint64_t group_count,
+                        bool is_avg) {
+            auto sum = [&](auto tag) {
+                sum_groups<decltype(tag)>(input,
+                                          row_groups,
+                                          count,
+                                          partitions,
+                                          run_partitions,
+                                          result,
+                                          group_count,
+                                          is_avg);
+            };
+            switch (type) {
+                case types::physical_type::INT8:
+                    return sum(int8_t{});
+                case types::physical_type::INT16:
+                    return sum(int16_t{});
+                case types::physical_type::INT32:
+                    return sum(int32_t{});
+                case types::physical_type::INT64:
+                    return sum(int64_t{});
+                case types::physical_type::UINT8:
+                    return sum(uint8_t{});
+                case types::physical_type::UINT16:
+                    return sum(uint16_t{});
+                case types::physical_type::UINT32:
+                    return sum(uint32_t{});
+                case types::physical_type::UINT64:
+                    return sum(uint64_t{});
+                case types::physical_type::FLOAT:
+                    return sum(float{});
+                case types::physical_type::DOUBLE:
+                    return sum(double{});
+                default:
+                    throw std::runtime_error("invalid sum type in table::operator_hash_aggregate");
+            }
+        }
+
+        void select_rows_switch(types::physical_type type,
+                                const vector::unified_vector_format& input,
+                                const std::pmr::vector<uint64_t>& row_groups,
+                                uint64_t begin,
+                                uint64_t end,
+                                std::pmr::vector<uint64_t>& selected,
+                                bool is_min) {
+            auto select = [&](auto tag) {
+                aggregate::select_rows<decltype(tag)>(input, row_groups.data(), begin, end, selected.data(), is_min);
+            };
+            switch (type) {
+                case types::physical_type::BOOL:
+                case types::physical_type::INT8:
+                    return select(int8_t{});
+                case types::physical_type::INT16:
+                    return select(int16_t{});
+                case types::physical_type::INT32:
+                    return select(int32_t{});
+                case types::physical_type::INT64:
+                    return select(int64_t{});
+                case types::physical_type::UINT8:
+                    return select(uint8_t{});
+                case types::physical_type::UINT16:
+                    return select(uint16_t{});
+                case types::physical_type::UINT32:
+                    return select(uint32_t{});
+                case types::physical_type::UINT64:
+                    return select(uint64_t{});
+                case types::physical_type::FLOAT:
+                    return select(float{});
+                case types::physical_type::DOUBLE:
+                    return select(double{});
+                case types::physical_type::STRING:
+                    return select(std::string_view{});
+                default:
+                    throw std::runtime_error("invalid min/max type in table::operator_hash_aggregate");
+            }
+        }
+
+        // rows selected by a later partition replace the current ones only if they are strictly better,
+        // so the first row of a tie is kept like in a single pass
+        template<typename T>
+        void merge_rows(const vector::unified_vector_format& input,
+                        const std::pmr::vector<uint64_t>& partial,
+                        std::pmr::vector<uint64_t>& selected,
+                        bool is_min) {
+            auto data = input.get_data<T>();
+            for (uint64_t group = 0; group < selected.size(); group++) {
+                const auto row = partial[group];
+                if (row == INVALID_ID) {
+                    continue;
+                }
+                auto& current = selected[group];
+                if (current == INVALID_ID) {
+                    current = row;
+                    continue;
+                }
+                const auto& value = data[input.referenced_indexing->get_index(current)];
+                const auto& candidate = data[input.referenced_indexing->get_index(row)];
+                if (is_min ? candidate < value : value < candidate) {
+                    current = row;
+                }
+            }
+        }
+
+        void merge_rows_switch(types::physical_type type,
+                               const vector::unified_vector_format& input,
+                               const std::pmr::vector<uint64_t>& partial,
+                               std::pmr::vector<uint64_t>& selected,
+                               bool is_min) {
+            switch (type) {
+                case types::physical_type::BOOL:
+                case types::physical_type::INT8:
+                    return merge_rows<int8_t>(input, partial, selected, is_min);
+                case types::physical_type::INT16:
+                    return merge_rows<int16_t>(input, partial, selected, is_min);
+                case types::physical_type::INT32:
+                    return merge_rows<int32_t>(input, partial, selected, is_min);
+                case types::physical_type::INT64:
+                    return merge_rows<int64_t>(input, partial, selected, is_min);
+                case types::physical_type::UINT8:
+                    return merge_rows<uint8_t>(input, partial, selected, is_min);
+                case types::physical_type::UINT16:
+                    return merge_rows<uint16_t>(input, partial, selected, is_min);
+                case types::physical_type::UINT32:
+                    return merge_rows<uint32_t>(input, partial, selected, is_min);
+                case types::physical_type::UINT64:
+                    return merge_rows<uint64_t>(input, partial, selected, is_min);
+                case types::physical_type::FLOAT:
+                    return merge_rows<float>(input, partial, selected, is_min);
+                case types::physical_type::DOUBLE:
+                    return merge_rows<double>(input, partial, selected, is_min);
+                case types::physical_type::STRING:
+                    return merge_rows<std::string_view>(input, partial, selected, is_min);
+                default:
+                    throw std::runtime_error("invalid min/max type in table::operator_hash_aggregate");
+            }
+        }
+
+        void gather_rows(const vector::vector_t& source,
+                         vector::vector_t& target,
+                         const std::pmr::vector<uint64_t>& rows) {
+            const auto count = static_cast<uint64_t>(rows.size());
+            if (count == 0) {
+                return;
+            }
+            vector::indexing_vector_t indexing(source.resource(), count);
+            for (uint64_t i = 0; i < count; i++) {
+                indexing.set_index(i, rows[i] == INVALID_ID ? 0 : rows[i]);
+            }
+            vector::vector_ops::copy(source, target, indexing, count, 0, 0);
+            for (uint64_t i = 0; i < count; i++) {
+                if (rows[i] == INVALID_ID) {
+                    target.validity().set_invalid(i);
+                }
+            }
+        }
+
+    } // namespace
+
+    operator_hash_aggregate_t::operator_hash_aggregate_t(services::collection::context_collection_t* context)
+        : read_write_operator_t(context, operator_type::aggregate)
+        , keys_(context_->resource())
+        , values_(context_->resource())
+        , row_groups_(context_->resource())
+        , group_rows_(context_->resource()) {}
+
+    operator_hash_aggregate_t::operator_hash_aggregate_t(std::pmr::memory_resource* resource)
+        : read_write_operator_t(nullptr, operator_type::aggregate)
+        , keys_(resource)
+        , values_(resource)
+        , row_groups_(resource)
+        , group_rows_(resource) {}
+
+    void operator_hash_aggregate_t::add_key(const std::string& name, const expressions::key_t& field) {
+        keys_.push_back({name, field});
+    }
+
+    void operator_hash_aggregate_t::add_value(const std::string& name,
+                                              expressions::aggregate_type type,
+                                              const expressions::key_t& field) {
+        values_.push_back({name, type, field});
+    }
+
+    bool operator_hash_aggregate_t::can_hash(const std::pmr::vector<types::complex_logical_type>& types) const {
+        return std::all_of(keys_.begin(), keys_.end(), [&types](const group_column_t& key) {
+            auto column = find_column(types, key.field.as_string());
+            return column == INVALID_ID || is_hashable_key(types[column].to_physical_type());
+        });
+    }
+
+    operator_ptr operator_hash_aggregate_t::make_group_operator() const {
+        boost::intrusive_ptr<operator_group_t> group;
+        if (context_) {
+            group = new operator_group_t(context_);
+        } else {
+            group = new operator_group_t(keys_.get_allocator().resource());
+        }
+        for (const auto& key : keys_) {
+            group->add_key(key.name, get::simple_value_t::create(key.field));
+        }
+        for (const auto& value : values_) {
+            switch (value.type) {
+                case aggregate_type::count:
+                    group->add_value(value.name, boost::intrusive_ptr(new aggregate::operator_count_t(context_)));
+                    break;
+                case aggregate_type::sum:
+                    group->add_value(value.name,
+                                     boost::intrusive_ptr(new aggregate::operator_sum_t(context_, value.field)));
+                    break;
+                case aggregate_type::avg:
+                    group->add_value(value.name,
+                                     boost::intrusive_ptr(new aggregate::operator_avg_t(context_, value.field)));
+                    break;
+                case aggregate_type::min:
+                    group->add_value(value.name,
+                                     boost::intrusive_ptr(new aggregate::operator_min_t(context_, value.field)));
+                    break;
+                case aggregate_type::max:
+                    group->add_value(value.name,
+                                     boost::intrusive_ptr(new aggregate::operator_max_t(context_, value.field)));
+                    break;
+                default:
+                    throw std::runtime_error("invalid aggregate type in table::operator_hash_aggregate");
+            }
+        }
+        return group;
+    }
+
+    void operator_hash_aggregate_t::on_execute_impl(pipeline::context_t* pipeline_context) {
+        if (!left_ || !left_->output()) {
+            return;
+        }
+        auto* resource = left_->output()->resource();
+        auto& chunk = left_->output()->data_chunk();
+
+        std::vector<uint64_t> key_columns;
+        std::pmr::vector<types::complex_logical_type> result_types(resource);
+        for (const auto& key : keys_) {
+            auto column = find_column(chunk, key.field.as_string());
+            if (column == INVALID_ID) {
+                // rows without a key do not belong to any group
+                output_ = base::operators::make_operator_data(resource, chunk.types());
+                return;
+            }
+            if (!is_hashable_key(chunk.data[column].type().to_physical_type())) {
+                // the planner checks the key types if it knows the input columns, e.g. not for a join
+                auto group = make_group_operator();
+                group->set_children(left_);
+                group->on_execute(pipeline_context);
+                take_output(group);
+                return;
+            }
+            key_columns.push_back(column);
+            result_types.push_back(chunk.data[column].type());
+            result_types.back().set_alias(key.name);
+        }
+
+        std::vector<uint64_t> value_columns;
+        for (const auto& value : values_) {
+            auto column = INVALID_ID;
+            if (value.type != aggregate_type::count) {
+                column = find_column(chunk, value.field.as_string());
+                if (column == INVALID_ID) {
+                    throw std::runtime_error("invalid aggregate field in table::operator_hash_aggregate");
+                }
+            }
+            value_columns.push_back(column);
+            switch (value.type) {
+                case aggregate_type::count:
+                    result_types.emplace_back(types::logical_type::UBIGINT);
+                    break;
+                case aggregate_type::avg:
+                    result_types.emplace_back(types::logical_type::DOUBLE);
+                    break;
+                case aggregate_type::sum:
+                    result_types.emplace_back(aggregate::sum_result_type(chunk.data[column].type().type()));
+                    break;
+                default:
+                    result_types.push_back(chunk.data[column].type());
+                    break;
+            }
+            result_types.back().set_alias(value.name);
+        }
+
+        const auto partitions = partition_count_(chunk.size());
+        find_groups_(chunk, key_columns, partitions);
+        const auto group_count = static_cast<uint64_t>(group_rows_.size());
+        if (context_) {
+            trace(context_->log(), "operator_hash_aggregate::groups: {}", group_count);
+        }
+
+        output_ = base::operators::make_operator_data(resource,
+                                                      result_types,
+                                                      std::max(group_count, vector::DEFAULT_VECTOR_CAPACITY));
+        auto& result = output_->data_chunk();
+        for (size_t i = 0; i < key_columns.size(); i++) {
+            gather_rows(chunk.data[key_columns[i]], result.data[i], group_rows_);
+        }
+        for (size_t i = 0; i < values_.size(); i++) {
+            aggregate_(chunk, values_[i], value_columns[i], result.data[key_columns.size() + i], partitions);
+        }
+        result.set_cardinality(group_count);
+    }
+
+    uint64_t operator_hash_aggregate_t::partition_count_(uint64_t rows) const {
+        auto* pool = context_ ? context_->scan_pool() : nullptr;
+        if (!pool) {
+            return 1;
+        }
+        return std::max<uint64_t>(1, std::min(pool->concurrency(), rows / MIN_PARTITION_ROWS));
+    }
+
+    void operator_hash_aggregate_t::run_partitions_(uint64_t partitions,
+                                                    const std::function<void(uint64_t)>& task) const {
+        if (partitions > 1) {
+            context_->scan_pool()->parallel_for(partitions, task);
+        } else {
+            task(0);
+        }
+    }
+
+    void operator_hash_aggregate_t::find_groups_(vector::data_chunk_t& chunk,
+                                                 std::vector<uint64_t>& key_columns,
+                                                 uint64_t partitions) {
+        auto* resource = chunk.resource();
+        const auto count = chunk.size();
+        row_groups_.assign(count, INVALID_ID);
+        group_rows_.clear();
+        if (count == 0) {
+            return;
+        }
+
+        std::vector<vector::unified_vector_format> keys;
+        std::vector<types::physical_type> key_types;
+        keys.reserve(key_columns.size());
+        for (auto column : key_columns) {
+            keys.emplace_back(resource, count);
+            chunk.data[column].to_unified_format(count, keys.back());
+            key_types.push_back(chunk.data[column].type().to_physical_type());
+        }
+
+        vector::vector_t hashes(resource, types::logical_type::UBIGINT, count);
+        if (key_columns.empty()) {
+            // no keys: every row belongs to the single group
+            std::fill_n(hashes.data<uint64_t>(), count, 0);
+        } else {
+            chunk.hash(key_columns, hashes);
+            hashes.flatten(count);
+        }
+        const auto* hash_data = hashes.data<uint64_t>();
+
+        auto keys_equal = [&](uint64_t lhs, uint64_t rhs) {
+            for (size_t k = 0; k < keys.size(); k++) {
+                if (!key_equal_switch(key_types[k], keys[k], lhs, rhs)) {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        // every partition groups its own rows first (workers allocate from the default resource),
+        // local groups are merged in partition order, so groups keep the order of their first rows
+        auto* local_resource = std::pmr::get_default_resource();
+        std::vector<std::pmr::vector<uint64_t>> local_rows(partitions, std::pmr::vector<uint64_t>(local_resource));
+        std::vector<std::pmr::vector<uint64_t>> local_hashes(partitions, std::pmr::vector<uint64_t>(local_resource));
+        run_partitions_(partitions, [&](uint64_t partition) {
+            const auto begin = partition_start(count, partitions, partition);
+            const auto end = partition_start(count, partitions, partition + 1);
+            std::pmr::vector<uint64_t> slots(vector::next_power_of_two((end - begin) * 2), INVALID_ID, local_resource);
+            for (uint64_t row = begin; row < end; row++) {
+                bool has_null = false;
+                for (const auto& key : keys) {
+                    if (!key.validity.row_is_valid(key.referenced_indexing->get_index(row))) {
+                        has_null = true;
+                        break;
+                    }
+                }
+                if (has_null) {
+                    continue;
+                }
+                row_groups_[row] = find_or_add_group(slots,
+                                                     hash_data[row],
+                                                     row,
+                                                     local_rows[partition],
+                                                     local_hashes[partition],
+                                                     keys_equal);
+            }
+        });
+
+        if (partitions == 1) {
+            group_rows_.assign(local_rows.front().begin(), local_rows.front().end());
+            return;
+        }
+
+        uint64_t local_groups = 0;
+        for (const auto& rows : local_rows) {
+            local_groups += rows.size();
+        }
+        std::pmr::vector<uint64_t> slots(vector::next_power_of_two(local_groups * 2), INVALID_ID, resource);
+        std::pmr::vector<uint64_t> group_hashes(resource);
+        std::vector<std::vector<uint64_t>> global_groups(partitions);
+        for (uint64_t partition = 0; partition < partitions; partition++) {
+            const auto& rows = local_rows[partition];
+            global_groups[partition].reserve(rows.size());
+            for (uint64_t group = 0; group < rows.size(); group++) {
+                global_groups[partition].push_back(find_or_add_group(slots,
+                                                                     local_hashes[partition][group],
+                                                                     rows[group],
+                                                                     group_rows_,
+                                                                     group_hashes,
+                                                                     keys_equal));
+            }
+        }
+        run_partitions_(partitions, [&](uint64_t partition) {
+            const auto end = partition_start(count, partitions, partition + 1);
+            for (uint64_t row = partition_start(count, partitions, partition); row < end; row++) {
+                if (row_groups_[row] != INVALID_ID) {
+                    row_groups_[row] = global_groups[partition][row_groups_[row]];
+                }
+            }
+        });
+    }
+
+    // the first partition aggregates into the result, the others into partial states merged in partition order
+    void operator_hash_aggregate_t::aggregate_(vector::data_chunk_t& chunk,
+                                               const aggregate_column_t& value,
+                                               uint64_t value_column,
+                                               vector::vector_t& result,
+                                               uint64_t partitions) {
+        auto* resource = chunk.resource();
+        auto* local_resource = std::pmr::get_default_resource();
+        const auto count = chunk.size();
+        const auto group_count = static_cast<uint64_t>(group_rows_.size());
+
+        if (value.type == aggregate_type::count) {
+            auto* counts = result.data<uint64_t>();
+            std::fill(counts, counts + group_count, 0);
+            std::vector<std::vector<uint64_t>> partial_counts(partitions - 1, std::vector<uint64_t>(group_count, 0));
+            run_partitions_(partitions, [&](uint64_t partition) {
+                auto* target = partition == 0 ? counts : partial_counts[partition - 1].data();
+                const auto end = partition_start(count, partitions, partition + 1);
+                for (uint64_t row = partition_start(count, partitions, partition); row < end; row++) {
+                    if (row_groups_[row] != INVALID_ID) {
+                        ++target[row_groups_[row]];
+                    }
+                }
+            });
+            for (const auto& partial : partial_counts) {
+                for (uint64_t group = 0; group < group_count; group++) {
+                    counts[group] += partial[group];
+                }
+            }
+            return;
+        }
+
+        auto& column = chunk.data[value_column];
+        vector::unified_vector_format input(resource, count);
+        column.to_unified_format(count, input);
+        const auto type = column.type().to_physical_type();
+
+        switch (value.type) {
+            case aggregate_type::sum:
+            case aggregate_type::avg: {
+                sum_switch(type,
+                           input,
+                           row_groups_,
+                           count,
+                           partitions,
+                           [this](uint64_t n, const std::function<void(uint64_t)>& task) { run_partitions_(n, task); },
+                           result,
+                           group_count,
+                           value.type == aggregate_type::avg);
+                break;
+            }
+            case aggregate_type::min:
+            case aggregate_type::max: {
+                const bool is_min = value.type == aggregate_type::min;
+                std::pmr::vector<uint64_t> selected(group_count, INVALID_ID, resource);
+                std::vector<std::pmr::vector<uint64_t>> partial_selected(
+                    partitions - 1,
+                    std::pmr::vector<uint64_t>(group_count, INVALID_ID, local_resource));
+                run_partitions_(partitions, [&](uint64_t partition) {
+                    select_rows_switch(type,
+                                       input,
+                                       row_groups_,
+                                       partition_start(count, partitions, partition),
+                                       partition_start(count, partitions, partition + 1),
+                                       partition == 0 ? selected : partial_selected[partition - 1],
+                                       is_min);
+                });
+                for (const auto& partial : partial_selected) {
+                    merge_rows_switch(type, input, partial, selected, is_min);
+                }
+                gather_rows(column, result, selected);
+                break;
+            }
+            default:
+                throw std::runtime_error("invalid aggregate type in table::operator_hash_aggregate");
+        }
+    }
+
+} // namespace components::table::operators
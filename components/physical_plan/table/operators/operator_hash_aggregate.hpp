@@ -0,0 +1,57 @@
+#pragma once
+
+#include <components/physical_plan/base/operators/operator.hpp>
+#include <expressions/forward.hpp>
+#include <expressions/key.hpp>
+#include <functional>
+
+namespace components::table::operators {
+
+    // GROUP BY over columns: rows are assigned to groups through a hash table on the key columns
+    // and every aggregate keeps its per-group state, so no row matrices are built
+    class operator_hash_aggregate_t final : public read_write_operator_t {
+    public:
+        explicit operator_hash_aggregate_t(services::collection::context_collection_t* context);
+        explicit operator_hash_aggregate_t(std::pmr::memory_resource* resource);
+
+        void add_key(const std::string& name, const expressions::key_t& field);
+        void add_value(const std::string& name, expressions::aggregate_type type, const expressions::key_t& field);
+
+        // false if a key is a column of `types` the hash table can not compare, keys missing from them are not checked
+        bool can_hash(const std::pmr::vector<types::complex_logical_type>& types) const;
+        // operator_group_t with the same keys and values, it groups keys of any type
+        operator_ptr make_group_operator() const;
+
+    private:
+        struct group_column_t {
+            std::string name;
+            expressions::key_t field;
+        };
+
+        struct aggregate_column_t {
+            std::string name;
+            expressions::aggregate_type type;
+            expressions::key_t field;
+        };
+
+        std::pmr::vector<group_column_t> keys_;
+        std::pmr::vector<aggregate_column_t> values_;
+        // group of every input row (INVALID_ID for rows with a null key) and the first row of every group
+        std::pmr::vector<uint64_t> row_groups_;
+        std::pmr::vector<uint64_t> group_rows_;
+
+        void on_execute_impl(pipeline::context_t* pipeline_context) final;
+
+        // inputs large enough are split into row partitions grouped and aggregated on the collection scan pool
+        uint64_t partition_count_(uint64_t rows) const;
+        void run_partitions_(uint64_t partitions, const std::function<void(uint64_t)>& task) const;
+
+        void find_groups_(vector::data_chunk_t& chunk, std::vector<uint64_t>& key_columns, uint64_t partitions);
+        void aggregate_(vector::data_chunk_t& chunk,
+                        const aggregate_column_t& value,
+                        uint64_t value_column,
+                        vector::vector_t& result,
+                        uint64_t partitions);
+    };
+
+} // namespace components::table::operators
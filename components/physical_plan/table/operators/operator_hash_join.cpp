@@ -0,0 +1,399 @@
+#include "operator_hash_join.hpp"
+#include "hash_utils.hpp"
+#include "operator_join.hpp"
+
+#include <components/vector/vector_operations.hpp>
+#include <services/collection/collection.hpp>
+
+namespace components::table::operators {
+
+    namespace {
+
+        using vector::INVALID_ID;
+
+        // key columns of an equality in either order of its keys, INVALID_ID if one side has neither of them
+        // or the keys have different physical types
+        std::pair<size_t, size_t> resolve_key(const expressions::compare_expression_ptr& expression,
+                                              const std::pmr::vector<types::complex_logical_type>& left,
+                                              const std::pmr::vector<types::complex_logical_type>& right) {
+            const auto& name_left = expression->key_left().as_string();
+            const auto& name_right = expression->key_right().as_string();
+            std::pair<size_t, size_t> key{find_column(left, name_left), find_column(right, name_right)};
+            if (key.first == INVALID_ID || key.second == INVALID_ID) {
+                key = {find_column(left, name_right), find_column(right, name_left)};
+            }
+            if (key.first == INVALID_ID || key.second == INVALID_ID ||
+                left[key.first].to_physical_type() != right[key.second].to_physical_type() ||
+                !is_hashable_key(left[key.first].to_physical_type())) {
+                return {INVALID_ID, INVALID_ID};
+            }
+            return key;
+        }
+
+        bool has_null_key(const std::vector<vector::unified_vector_format>& keys, uint64_t row) {
+            for (const auto& key : keys) {
+                if (!key.validity.row_is_valid(key.referenced_indexing->get_index(row))) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template<typename T>
+        void match_keys(const vector::unified_vector_format& probe,
+                        const vector::unified_vector_format& build,
+                        const uint64_t* probe_rows,
+                        const uint64_t* build_rows,
+                        uint8_t* matches,
+                        uint64_t count) {
+            auto probe_data = probe.get_data<T>();
+            auto build_data = build.get_data<T>();
+            for (uint64_t i = 0; i < count; i++) {
+                auto probe_idx = probe.referenced_indexing->get_index(probe_rows[i]);
+                auto build_idx = build.referenced_indexing->get_index(build_rows[i]);
+                matches[i] &= static_cast<uint8_t>(probe_data[probe_idx] == build_data[build_idx]);
+            }
+        }
+
+        void match_keys_switch(types::physical_type type,
+                               const vector::unified_vector_format& probe,
+                               const vector::unified_vector_format& build,
+                               const uint64_t* probe_rows,
+                               const uint64_t* build_rows,
+                               uint8_t* matches,
+                               uint64_t count) {
+            switch (type) {
+                case types::physical_type::BOOL:
+                case types::physical_type::INT8:
+                    return match_keys<int8_t>(probe, build, probe_rows, build_rows, matches, count);
+                case types::physical_type::INT16:
+                    return match_keys<int16_t>(probe, build, probe_rows, build_rows, matches, count);
+                case types::physical_type::INT32:
+                    return match_keys<int32_t>(probe, build, probe_rows, build_rows, matches, count);
+                case types::physical_type::INT64:
+                    return match_keys<int64_t>(probe, build, probe_rows, build_rows, matches, count);
+                case types::physical_type::UINT8:
+                    return match_keys<uint8_t>(probe, build, probe_rows, build_rows, matches, count);
+                case types::physical_type::UINT16:
+                    return match_keys<uint16_t>(probe, build, probe_rows, build_rows, matches, count);
+                case types::physical_type::UINT32:
+                    return match_keys<uint32_t>(probe, build, probe_rows, build_rows, matches, count);
+                case types::physical_type::UINT64:
+                    return match_keys<uint64_t>(probe, build, probe_rows, build_rows, matches, count);
+                case types::physical_type::FLOAT:
+                    return match_keys<float>(probe, build, probe_rows, build_rows, matches, count);
+                case types::physical_type::DOUBLE:
+                    return match_keys<double>(probe, build, probe_rows, build_rows, matches, count);
+                case types::physical_type::STRING:
+                    return match_keys<std::string_view>(probe, build, probe_rows, build_rows, matches, count);
+                default:
+                    throw std::runtime_error("invalid join key type in table::operator_hash_join");
+            }
+        }
+
+    } // namespace
+
+    bool is_equi_join_expression(const expressions::compare_expression_ptr& expression) {
+        if (!expression) {
+            return false;
+        }
+        switch (expression->type()) {
+            case expressions::compare_type::union_and: {
+                if (expression->children().empty()) {
+                    return false;
+                }
+                for (const auto& child : expression->children()) {
+                    if (!is_equi_join_expression(
+                            reinterpret_cast<const expressions::compare_expression_ptr&>(child))) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            case expressions::compare_type::eq:
+                return expression->key_left().is_string() && expression->key_right().is_string();
+            default:
+                return false;
+        }
+    }
+
+    bool can_hash_join(const expressions::compare_expression_ptr& expression,
+                       const std::pmr::vector<types::complex_logical_type>& left,
+                       const std::pmr::vector<types::complex_logical_type>& right) {
+        if (expression->type() == expressions::compare_type::union_and) {
+            return std::all_of(expression->children().begin(), expression->children().end(), [&](const auto& child) {
+                return can_hash_join(reinterpret_cast<const expressions::compare_expression_ptr&>(child), left, right);
+            });
+        }
+        return resolve_key(expression, left, right).first != INVALID_ID;
+    }
+
+    operator_hash_join_t::operator_hash_join_t(services::collection::context_collection_t* context,
+                                               type join_type,
+                                               const expressions::compare_expression_ptr& expression)
+        : read_only_operator_t(context, operator_type::join)
+        , join_type_(join_type)
+        , expression_(expression)
+        , left_rows_(std::pmr::get_default_resource())
+        , right_rows_(std::pmr::get_default_resource()) {}
+
+    void operator_hash_join_t::on_execute_impl(pipeline::context_t* context) {
+        if (!left_ || !right_) {
+            return;
+        }
+        if (left_->output() && right_->output()) {
+            auto& chunk_left = left_->output()->data_chunk();
+            auto& chunk_right = right_->output()->data_chunk();
+
+            auto res_types = chunk_left.types();
+            for (const auto& type : chunk_right.types()) {
+                if (std::find_if(res_types.begin(), res_types.end(), [&type](const types::complex_logical_type& rhs) {
+                        return type.alias() == rhs.alias();
+                    }) == res_types.end()) {
+                    res_types.emplace_back(type);
+                }
+            }
+
+            if (context_) {
+                trace(context_->log(), "operator_hash_join::left_size(): {}", chunk_left.size());
+                trace(context_->log(), "operator_hash_join::right_size(): {}", chunk_right.size());
+            }
+
+            keys_.clear();
+            if (!collect_keys_(expression_, chunk_left.types(), chunk_right.types())) {
+                // the planner checks the keys against the schemas, they may have changed since then
+                operator_ptr join(new operator_join_t(context_, join_type_, expression_));
+                join->set_children(left_, right_);
+                join->on_execute(context);
+                take_output(join);
+                return;
+            }
+
+            left_rows_ = std::pmr::vector<uint64_t>(left_->output()->resource());
+            right_rows_ = std::pmr::vector<uint64_t>(left_->output()->resource());
+            build_and_probe_(chunk_left, chunk_right);
+
+            auto result_size = static_cast<uint64_t>(left_rows_.size());
+            output_ = base::operators::make_operator_data(left_->output()->resource(),
+                                                          res_types,
+                                                          std::max(result_size, vector::DEFAULT_VECTOR_CAPACITY));
+            // right columns overwrite left ones with the same alias, like in operator_join_t
+            gather_(chunk_left, left_rows_);
+            gather_(chunk_right, right_rows_);
+            output_->data_chunk().set_cardinality(result_size);
+
+            if (context_) {
+                trace(context_->log(), "operator_hash_join::result_size(): {}", output_->size());
+            }
+        }
+    }
+
+    bool operator_hash_join_t::collect_keys_(const expressions::compare_expression_ptr& expression,
+                                             const std::pmr::vector<types::complex_logical_type>& types_left,
+                                             const std::pmr::vector<types::complex_logical_type>& types_right) {
+        if (expression->type() == expressions::compare_type::union_and) {
+            for (const auto& child : expression->children()) {
+                if (!collect_keys_(reinterpret_cast<const expressions::compare_expression_ptr&>(child),
+                                   types_left,
+                                   types_right)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        assert(expression->type() == expressions::compare_type::eq);
+        auto key = resolve_key(expression, types_left, types_right);
+        if (key.first == INVALID_ID) {
+            return false;
+        }
+        keys_.push_back({key.first, key.second});
+        return true;
+    }
+
+    void operator_hash_join_t::build_and_probe_(vector::data_chunk_t& chunk_left, vector::data_chunk_t& chunk_right) {
+        // build on the smaller side, probe with the larger one
+        const bool build_left = chunk_left.size() < chunk_right.size();
+        auto& build = build_left ? chunk_left : chunk_right;
+        auto& probe = build_left ? chunk_right : chunk_left;
+        const bool left_outer = join_type_ == type::left || join_type_ == type::full;
+        const bool right_outer = join_type_ == type::right || join_type_ == type::full;
+        const bool emit_unmatched_build = build_left ? left_outer : right_outer;
+        const bool emit_unmatched_probe = build_left ? right_outer : left_outer;
+
+        auto emit = [&](uint64_t probe_row, uint64_t build_row) {
+            left_rows_.push_back(build_left ? build_row : probe_row);
+            right_rows_.push_back(build_left ? probe_row : build_row);
+        };
+
+        auto* resource = build.resource();
+        const uint64_t build_count = build.size();
+        const uint64_t probe_count = probe.size();
+        if (probe_count == 0 || build_count == 0) {
+            if (emit_unmatched_probe) {
+                for (uint64_t i = 0; i < probe_count; i++) {
+                    emit(i, INVALID_ID);
+                }
+            }
+            if (emit_unmatched_build) {
+                for (uint64_t i = 0; i < build_count; i++) {
+                    emit(INVALID_ID, i);
+                }
+            }
+            return;
+        }
+
+        std::vector<uint64_t> build_columns;
+        std::vector<uint64_t> probe_columns;
+        std::vector<types::physical_type> key_types;
+        for (const auto& key : keys_) {
+            build_columns.push_back(build_left ? key.left : key.right);
+            probe_columns.push_back(build_left ? key.right : key.left);
+            key_types.push_back(chunk_left.data[key.left].type().to_physical_type());
+        }
+
+        std::vector<vector::unified_vector_format> build_keys;
+        std::vector<vector::unified_vector_format> probe_keys;
+        build_keys.reserve(keys_.size());
+        probe_keys.reserve(keys_.size());
+        for (size_t i = 0; i < keys_.size(); i++) {
+            build_keys.emplace_back(resource, build_count);
+            build.data[build_columns[i]].to_unified_format(build_count, build_keys.back());
+            probe_keys.emplace_back(resource, probe_count);
+            probe.data[probe_columns[i]].to_unified_format(probe_count, probe_keys.back());
+        }
+
+        vector::vector_t build_hashes(resource, types::logical_type::UBIGINT, build_count);
+        build.hash(build_columns, build_hashes);
+        build_hashes.flatten(build_count);
+        vector::vector_t probe_hashes(resource, types::logical_type::UBIGINT, probe_count);
+        probe.hash(probe_columns, probe_hashes);
+        probe_hashes.flatten(probe_count);
+        const auto* build_hash_data = build_hashes.data<uint64_t>();
+        const auto* probe_hash_data = probe_hashes.data<uint64_t>();
+
+        // chained hash table: heads[bucket] -> first build row, chain[row] -> next build row in the same bucket
+        const uint64_t bucket_mask = vector::next_power_of_two(build_count * 2) - 1;
+        std::pmr::vector<uint64_t> heads(bucket_mask + 1, INVALID_ID, resource);
+        std::pmr::vector<uint64_t> chain(build_count, INVALID_ID, resource);
+        // insert backwards so that every chain is walked in build row order
+        for (uint64_t row = build_count; row-- > 0;) {
+            if (has_null_key(build_keys, row)) {
+                continue;
+            }
+            auto& head = heads[bucket_hash(build_hash_data[row]) & bucket_mask];
+            chain[row] = head;
+            head = row;
+        }
+
+        std::pmr::vector<bool> build_matched(emit_unmatched_build ? build_count : 0, false, resource);
+        std::pmr::vector<bool> probe_matched(vector::DEFAULT_VECTOR_CAPACITY, false, resource);
+        std::pmr::vector<uint8_t> matches(vector::DEFAULT_VECTOR_CAPACITY, 0, resource);
+        vector::indexing_vector_t probe_sel(resource, vector::DEFAULT_VECTOR_CAPACITY);
+        vector::indexing_vector_t build_sel(resource, vector::DEFAULT_VECTOR_CAPACITY);
+
+        for (uint64_t offset = 0; offset < probe_count; offset += vector::DEFAULT_VECTOR_CAPACITY) {
+            const uint64_t batch_size = std::min(vector::DEFAULT_VECTOR_CAPACITY, probe_count - offset);
+            std::fill(probe_matched.begin(), probe_matched.end(), false);
+
+            uint64_t active = 0;
+            for (uint64_t i = 0; i < batch_size; i++) {
+                const uint64_t row = offset + i;
+                if (has_null_key(probe_keys, row)) {
+                    continue;
+                }
+                const auto head = heads[bucket_hash(probe_hash_data[row]) & bucket_mask];
+                if (head != INVALID_ID) {
+                    probe_sel.set_index(active, row);
+                    build_sel.set_index(active, head);
+                    ++active;
+                }
+            }
+
+            while (active > 0) {
+                for (uint64_t i = 0; i < active; i++) {
+                    matches[i] = static_cast<uint8_t>(probe_hash_data[probe_sel.get_index(i)] ==
+                                                      build_hash_data[build_sel.get_index(i)]);
+                }
+                for (size_t k = 0; k < keys_.size(); k++) {
+                    match_keys_switch(key_types[k],
+                                      probe_keys[k],
+                                      build_keys[k],
+                                      probe_sel.data(),
+                                      build_sel.data(),
+                                      matches.data(),
+                                      active);
+                }
+
+                uint64_t next_active = 0;
+                for (uint64_t i = 0; i < active; i++) {
+                    const auto probe_row = probe_sel.get_index(i);
+                    const auto build_row = build_sel.get_index(i);
+                    if (matches[i]) {
+                        emit(probe_row, build_row);
+                        probe_matched[probe_row - offset] = true;
+                        if (emit_unmatched_build) {
+                            build_matched[build_row] = true;
+                        }
+                    }
+                    const auto next_row = chain[build_row];
+                    if (next_row != INVALID_ID) {
+                        probe_sel.set_index(next_active, probe_row);
+                        build_sel.set_index(next_active, next_row);
+                        ++next_active;
+                    }
+                }
+                active = next_active;
+            }
+
+            if (emit_unmatched_probe) {
+                for (uint64_t i = 0; i < batch_size; i++) {
+                    if (!probe_matched[i]) {
+                        emit(offset + i, INVALID_ID);
+                    }
+                }
+            }
+        }
+
+        if (emit_unmatched_build) {
+            for (uint64_t row = 0; row < build_count; row++) {
+                if (!build_matched[row]) {
+                    emit(INVALID_ID, row);
+                }
+            }
+        }
+    }
+
+    void operator_hash_join_t::gather_(const vector::data_chunk_t& chunk, const std::pmr::vector<uint64_t>& rows) {
+        auto& chunk_res = output_->data_chunk();
+        const auto count = static_cast<uint64_t>(rows.size());
+        if (count == 0) {
+            return;
+        }
+        vector::indexing_vector_t indexing(chunk.resource(), count);
+        for (uint64_t i = 0; i < count; i++) {
+            indexing.set_index(i, rows[i] == INVALID_ID ? 0 : rows[i]);
+        }
+        for (const auto& column : chunk.data) {
+            auto& target = chunk_res.data[chunk_res.column_index(column.type().alias())];
+            if (chunk.size() == 0) {
+                for (uint64_t i = 0; i < count; i++) {
+                    target.validity().set_invalid(i);
+                }
+                continue;
+            }
+            if (column.type() == target.type()) {
+                vector::vector_ops::copy(column, target, indexing, count, 0, 0);
+            } else {
+                for (uint64_t i = 0; i < count; i++) {
+                    target.set_value(i, column.value(indexing.get_index(i)));
+                }
+            }
+            for (uint64_t i = 0; i < count; i++) {
+                if (rows[i] == INVALID_ID) {
+                    target.validity().set_invalid(i);
+                }
+            }
+        }
+    }
+
+} // namespace components::table::operators
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <components/logical_plan/node_join.hpp>
+#include <components/physical_plan/base/operators/operator.hpp>
+#include <expressions/compare_expression.hpp>
+
+namespace components::table::operators {
+
+    // true if expression is an equality of two columns or a conjunction of such equalities
+    bool is_equi_join_expression(const expressions::compare_expression_ptr& expression);
+
+    // true if each equality has a key column on either side and both keys have the same hashable physical type
+    bool can_hash_join(const expressions::compare_expression_ptr& expression,
+                       const std::pmr::vector<types::complex_logical_type>& left,
+                       const std::pmr::vector<types::complex_logical_type>& right);
+
+    class operator_hash_join_t final : public read_only_operator_t {
+    public:
+        using type = logical_plan::join_type;
+
+        explicit operator_hash_join_t(services::collection::context_collection_t* context,
+                                      type join_type,
+                                      const expressions::compare_expression_ptr& expression);
+
+    private:
+        struct key_pair_t {
+            size_t left;
+            size_t right;
+        };
+
+        type join_type_;
+        expressions::compare_expression_ptr expression_;
+        std::vector<key_pair_t> keys_;
+        std::pmr::vector<uint64_t> left_rows_;
+        std::pmr::vector<uint64_t> right_rows_;
+
+        void on_execute_impl(pipeline::context_t* context) final;
+        bool collect_keys_(const expressions::compare_expression_ptr& expression,
+                           const std::pmr::vector<types::complex_logical_type>& types_left,
+                           const std::pmr::vector<types::complex_logical_type>& types_right);
+        void build_and_probe_(vector::data_chunk_t& chunk_left, vector::data_chunk_t& chunk_right);
+        void gather_(const vector::data_chunk_t& chunk, const std::pmr::vector<uint64_t>& rows);
+    };
+
+} // namespace components::table::operators
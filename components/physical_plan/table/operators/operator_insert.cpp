@@ -8,22 +8,20 @@ namespace components::table::operators {
 
     void operator_insert::on_execute_impl(pipeline::context_t* pipeline_context) {
         if (left_ && left_->output()) {
+            auto& chunk = left_->output()->data_chunk();
             modified_ = base::operators::make_operator_write_data<size_t>(context_->resource());
-            output_ = base::operators::make_operator_data(context_->resource(),
-                                                          left_->output()->data_chunk().types(),
-                                                          left_->output()->data_chunk().size());
+            output_ = base::operators::make_operator_data(context_->resource(), chunk.types(), chunk.size());
+            // referenced before the append, it may slice the chunk when the rows span several row groups
+            output_->data_chunk().reference(chunk);
             table::table_append_state state(context_->resource());
             context_->table_storage().table().append_lock(state);
             context_->table_storage().table().initialize_append(state);
-            for (size_t id = 0; id < left_->output()->data_chunk().size(); id++) {
+            for (size_t id = 0; id < chunk.size(); id++) {
                 modified_->append(id + state.row_start);
-                context_->index_engine()->insert_row(left_->output()->data_chunk(),
-                                                     id + state.row_start,
-                                                     pipeline_context);
             }
-            context_->table_storage().table().append(left_->output()->data_chunk(), state);
+            context_->index_engine()->insert_rows(chunk, state.row_start, pipeline_context);
+            context_->table_storage().table().append(chunk, state);
             context_->table_storage().table().finalize_append(state);
-            left_->output()->data_chunk().copy(output_->data_chunk(), 0);
         }
     }
 
@@ -1,11 +1,12 @@
 #include "operator_sort.hpp"
-#include "transformation.hpp"
+#include <components/vector/vector_operations.hpp>
 #include <services/collection/collection.hpp>
 
 namespace components::table::operators {
 
-    operator_sort_t::operator_sort_t(services::collection::context_collection_t* context)
-        : read_only_operator_t(context, operator_type::sort) {}
+    operator_sort_t::operator_sort_t(services::collection::context_collection_t* context, logical_plan::limit_t limit)
+        : read_only_operator_t(context, operator_type::sort)
+        , limit_(limit) {}
 
     void operator_sort_t::add(size_t index, operator_sort_t::order order_) { sorter_.add(index, order_); }
 
@@ -20,12 +21,18 @@ namespace components::table::operators {
     void operator_sort_t::on_execute_impl(pipeline::context_t*) {
         if (left_ && left_->output()) {
             auto& chunk = left_->output()->data_chunk();
-            // TODO: sort inplace
-            auto matrix = impl::transpose(left_->output()->resource(), chunk);
-            std::sort(matrix.begin(), matrix.end(), sorter_);
-            output_ = base::operators::make_operator_data(
-                left_->output()->resource(),
-                impl::transpose(left_->output()->resource(), matrix, chunk.types()));
+            auto rows = sorter_.sort(chunk, limit_);
+            const auto count = static_cast<uint64_t>(rows.size());
+            output_ = base::operators::make_operator_data(left_->output()->resource(),
+                                                          chunk.types(),
+                                                          std::max(count, vector::DEFAULT_VECTOR_CAPACITY));
+            if (count > 0) {
+                vector::indexing_vector_t indexing(chunk.resource(), rows.data());
+                for (size_t i = 0; i < chunk.column_count(); i++) {
+                    vector::vector_ops::copy(chunk.data[i], output_->data_chunk().data[i], indexing, count, 0, 0);
+                }
+            }
+            output_->data_chunk().set_cardinality(count);
         }
     }
 
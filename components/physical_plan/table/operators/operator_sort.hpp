@@ -1,5 +1,6 @@
 #pragma once
 
+#include <components/logical_plan/node_limit.hpp>
 #include <components/physical_plan/base/operators/operator.hpp>
 #include <components/physical_plan/table/operators/sort/sort.hpp>
 
@@ -9,7 +10,8 @@ namespace components::table::operators {
     public:
         using order = sort::order;
 
-        explicit operator_sort_t(services::collection::context_collection_t* context);
+        explicit operator_sort_t(services::collection::context_collection_t* context,
+                                 logical_plan::limit_t limit = logical_plan::limit_t::unlimit());
 
         void add(size_t index, order order_ = order::ascending);
         // TODO: remove this method, calculate index via schema
@@ -18,6 +20,7 @@ namespace components::table::operators {
 
     private:
         sort::sorter_t sorter_;
+        logical_plan::limit_t limit_;
 
         void on_execute_impl(pipeline::context_t* pipeline_context) final;
     };
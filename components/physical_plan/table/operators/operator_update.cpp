@@ -1,5 +1,8 @@
 #include "operator_update.hpp"
 #include "check_expr.hpp"
+#include "expression_executor.hpp"
+
+#include <components/vector/vector_operations.hpp>
 
 #include <services/collection/collection.hpp>
 
@@ -41,7 +44,10 @@ namespace components::table::operators {
                     context_->table_storage().table().initialize_append(state);
                     for (size_t id = 0; id < output_->data_chunk().size(); id++) {
                         modified_->append(id + state.row_start);
-                        context_->index_engine()->insert_row(output_->data_chunk(), id, pipeline_context);
+                        context_->index_engine()->insert_row(output_->data_chunk(),
+                                                             id,
+                                                             static_cast<int64_t>(id + state.row_start),
+                                                             pipeline_context);
                     }
                     context_->table_storage().table().append(output_->data_chunk(), state);
                 }
@@ -64,7 +70,8 @@ namespace components::table::operators {
                                                i,
                                                j)) {
                             row_ids.set_value(index, chunk_left.row_ids.value(i));
-                            context_->index_engine()->delete_row(chunk_left, i, pipeline_context);
+                            auto row_id = row_ids.data<int64_t>()[index];
+                            context_->index_engine()->delete_row(chunk_left, i, row_id, pipeline_context);
                             bool modified = false;
                             for (const auto& expr : updates_) {
                                 modified |= expr->execute(chunk_left, chunk_right, i, j, &pipeline_context->parameters);
@@ -78,7 +85,7 @@ namespace components::table::operators {
                                 out_chunk.data[k].set_value(index, chunk_left.data[k].value(i));
                             }
                             ++index;
-                            context_->index_engine()->insert_row(chunk_left, i, pipeline_context);
+                            context_->index_engine()->insert_row(chunk_left, i, row_id, pipeline_context);
                         }
                     }
                 }
@@ -102,12 +109,15 @@ namespace components::table::operators {
                 for (size_t i = 0; i < types.size(); i++) {
                     name_index_map.emplace(types[i].alias(), i);
                 }
-                output_ = base::operators::make_operator_data(left_->output()->resource(), types);
+                output_ = base::operators::make_operator_data(left_->output()->resource(),
+                                                              types,
+                                                              std::max(chunk.size(), vector::DEFAULT_VECTOR_CAPACITY));
                 auto& out_chunk = output_->data_chunk();
                 modified_ = base::operators::make_operator_write_data<size_t>(context_->resource());
                 no_modified_ = base::operators::make_operator_write_data<size_t>(context_->resource());
                 auto state = context_->table_storage().table().initialize_update({});
                 vector::vector_t row_ids(context_->resource(), logical_type::BIGINT, chunk.size());
+                vector::indexing_vector_t indexing(context_->resource(), chunk.size());
                 size_t index = 0;
                 for (size_t i = 0; i < chunk.size(); i++) {
                     if (check_expr_general(comp_expr_, &pipeline_context->parameters, chunk, name_index_map, i)) {
@@ -118,23 +128,43 @@ namespace components::table::operators {
                         } else {
                             row_ids.set_value(index, chunk.row_ids.value(i));
                         }
-                        context_->index_engine()->delete_row(chunk, i, pipeline_context);
-                        bool modified = false;
+                        indexing.set_index(index, i);
+                        index++;
+                    }
+                }
+                for (size_t k = 0; k < index; k++) {
+                    context_->index_engine()->delete_row(chunk,
+                                                         indexing.get_index(k),
+                                                         row_ids.data<int64_t>()[k],
+                                                         pipeline_context);
+                }
+                std::vector<bool> modified(index, false);
+                auto executor =
+                    update_executor_t::compile(context_->resource(), updates_, chunk, &pipeline_context->parameters);
+                if (executor) {
+                    executor->execute(chunk, indexing, index, modified);
+                } else {
+                    for (size_t k = 0; k < index; k++) {
+                        auto i = indexing.get_index(k);
+                        bool is_modified = false;
                         for (const auto& expr : updates_) {
-                            modified |= expr->execute(chunk, chunk, i, i, &pipeline_context->parameters);
-                        }
-                        if (modified) {
-                            modified_->append(i);
-                        } else {
-                            no_modified_->append(i);
-                        }
-                        for (size_t j = 0; j < chunk.column_count(); j++) {
-                            out_chunk.data[j].set_value(index, chunk.data[j].value(i));
+                            is_modified |= expr->execute(chunk, chunk, i, i, &pipeline_context->parameters);
                         }
-                        context_->index_engine()->insert_row(chunk, i, pipeline_context);
-                        index++;
+                        modified[k] = is_modified;
                     }
                 }
+                for (size_t k = 0; k < index; k++) {
+                    auto i = indexing.get_index(k);
+                    if (modified[k]) {
+                        modified_->append(i);
+                    } else {
+                        no_modified_->append(i);
+                    }
+                    context_->index_engine()->insert_row(chunk, i, row_ids.data<int64_t>()[k], pipeline_context);
+                }
+                for (size_t j = 0; j < chunk.column_count(); j++) {
+                    vector::vector_ops::copy(chunk.data[j], out_chunk.data[j], indexing, index, 0, 0);
+                }
                 out_chunk.set_cardinality(index);
                 row_ids.resize(chunk.size(), index);
                 context_->table_storage().table().update(*state, row_ids, left_->output()->data_chunk());
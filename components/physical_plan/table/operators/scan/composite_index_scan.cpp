@@ -0,0 +1,53 @@
+#include "composite_index_scan.hpp"
+#include "projection.hpp"
+#include <services/collection/collection.hpp>
+
+namespace components::table::operators {
+
+    composite_index_scan::composite_index_scan(services::collection::context_collection_t* context,
+                                               index::index_match_t match,
+                                               logical_plan::limit_t limit,
+                                               std::vector<std::string> columns)
+        : read_only_operator_t(context, operator_type::match)
+        , index_name_(match.index->name())
+        , match_(std::move(match))
+        , limit_(limit)
+        , columns_(std::move(columns)) {
+        // index is searched by name on execute, it could be dropped after planning
+        match_.index = nullptr;
+    }
+
+    void composite_index_scan::on_execute_impl(pipeline::context_t* pipeline_context) {
+        trace(context_->log(), "composite_index_scan by index \"{}\"", index_name_);
+        if (!limit_.check(0)) {
+            return; //limit = 0
+        }
+        auto& table = context_->table_storage().table();
+        auto column_indices = projection_indices(table, columns_);
+        auto match = match_;
+        match.index = index::search_index(context_->index_engine(), index_name_);
+        if (!match.index) {
+            output_ =
+                base::operators::make_operator_data(context_->resource(), projection_types(table, column_indices));
+            return;
+        }
+        auto range = index::search_range(match, &pipeline_context->parameters);
+        size_t rows = std::distance(range.first, range.second);
+        if (limit_.limit() != logical_plan::limit_t::unlimit().limit()) {
+            rows = std::min<size_t>(rows, limit_.limit());
+        }
+        vector::vector_t row_ids(context_->resource(), logical_type::BIGINT, rows);
+        size_t count = 0;
+        for (auto it = range.first; it != range.second && count < rows; ++it) {
+            row_ids.set_value(count, types::logical_value_t{it->row_index});
+            ++count;
+        }
+
+        table::column_fetch_state state;
+        output_ =
+            base::operators::make_operator_data(context_->resource(), projection_types(table, column_indices), rows);
+        table.fetch(output_->data_chunk(), column_indices, row_ids, rows, state);
+        output_->data_chunk().row_ids = row_ids;
+    }
+
+} // namespace components::table::operators
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <components/index/index_engine.hpp>
+
+#include <components/logical_plan/node_limit.hpp>
+#include <components/physical_plan/base/operators/operator.hpp>
+
+namespace components::table::operators {
+
+    // range scan of a composite index: equality on a prefix of its keys and bounds on the next key
+    // `columns` are the names of the columns to fetch, every column is fetched if it is empty
+    class composite_index_scan final : public read_only_operator_t {
+    public:
+        composite_index_scan(services::collection::context_collection_t* collection,
+                             index::index_match_t match,
+                             logical_plan::limit_t limit,
+                             std::vector<std::string> columns = {});
+
+    private:
+        void on_execute_impl(pipeline::context_t* pipeline_context) final;
+
+        const std::string index_name_;
+        index::index_match_t match_;
+        const logical_plan::limit_t limit_;
+        const std::vector<std::string> columns_;
+    };
+
+} // namespace components::table::operators
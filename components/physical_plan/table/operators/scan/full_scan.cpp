@@ -1,5 +1,7 @@
 #include "full_scan.hpp"
 
+#include <components/physical_plan/table/operators/scan/parallel_scan.hpp>
+#include <components/physical_plan/table/operators/scan/projection.hpp>
 #include <components/physical_plan/table/operators/transformation.hpp>
 #include <services/collection/collection.hpp>
 
@@ -52,10 +54,12 @@ namespace components::table::operators {
 
     full_scan::full_scan(services::collection::context_collection_t* context,
                          const expressions::compare_expression_ptr& exresssion,
-                         logical_plan::limit_t limit)
+                         logical_plan::limit_t limit,
+                         std::vector<std::string> columns)
         : read_only_operator_t(context, operator_type::match)
         , exresssion_(exresssion)
-        , limit_(limit) {}
+        , limit_(limit)
+        , columns_(std::move(columns)) {}
 
     void full_scan::on_execute_impl(pipeline::context_t* pipeline_context) {
         trace(context_->log(), "full_scan");
@@ -64,22 +68,25 @@ namespace components::table::operators {
             return; //limit = 0
         }
 
-        auto types = context_->table_storage().table().copy_types();
-        output_ = base::operators::make_operator_data(context_->resource(), types);
-        std::vector<table::storage_index_t> column_indices;
-        column_indices.reserve(context_->table_storage().table().column_count());
-        for (int64_t i = 0; i < context_->table_storage().table().column_count(); i++) {
-            column_indices.emplace_back(i);
+        auto& table = context_->table_storage().table();
+        auto types = table.copy_types();
+        auto column_indices = projection_indices(table, columns_);
+        if (is_streaming()) {
+            stream_ = std::make_unique<scan_stream_t>(
+                context_,
+                transform_predicate(exresssion_, types, pipeline_context ? &pipeline_context->parameters : nullptr),
+                limit_,
+                column_indices);
+            output_ = stream_->next();
+            return;
         }
-        table::table_scan_state state(std::pmr::get_default_resource());
         auto filter =
             transform_predicate(exresssion_, types, pipeline_context ? &pipeline_context->parameters : nullptr);
-        context_->table_storage().table().initialize_scan(state, column_indices, filter.get());
-        // TODO: check limit inside scan
-        context_->table_storage().table().scan(output_->data_chunk(), state);
-        if (limit_.limit() >= 0) {
-            output_->data_chunk().set_cardinality(std::min<size_t>(output_->data_chunk().size(), limit_.limit()));
-        }
+        output_ = parallel_scan(context_, filter.get(), limit_, column_indices);
     }
 
+    bool full_scan::has_next_chunk_impl() const { return stream_ && stream_->has_next(); }
+
+    void full_scan::on_next_chunk_impl(pipeline::context_t*) { output_ = stream_->next(); }
+
 } // namespace components::table::operators
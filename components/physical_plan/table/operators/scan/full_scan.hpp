@@ -2,6 +2,7 @@
 
 #include <components/logical_plan/node_limit.hpp>
 #include <components/physical_plan/base/operators/operator.hpp>
+#include <components/physical_plan/table/operators/scan/scan_stream.hpp>
 #include <components/table/column_state.hpp>
 #include <expressions/compare_expression.hpp>
 
@@ -9,17 +10,23 @@ namespace components::table::operators {
 
     std::unique_ptr<table::table_filter_t> transform_predicate(const expressions::compare_expression_ptr& exresssion);
 
+    // `columns` are the names of the columns to read, every column is read if it is empty
     class full_scan final : public read_only_operator_t {
     public:
         full_scan(services::collection::context_collection_t* collection,
                   const expressions::compare_expression_ptr& exresssion,
-                  logical_plan::limit_t limit);
+                  logical_plan::limit_t limit,
+                  std::vector<std::string> columns = {});
 
     private:
         void on_execute_impl(pipeline::context_t* pipeline_context) final;
+        bool has_next_chunk_impl() const final;
+        void on_next_chunk_impl(pipeline::context_t* pipeline_context) final;
 
         expressions::compare_expression_ptr exresssion_;
         const logical_plan::limit_t limit_;
+        const std::vector<std::string> columns_;
+        std::unique_ptr<scan_stream_t> stream_;
     };
 
 } // namespace components::table::operators
@@ -1,4 +1,5 @@
 #include "index_scan.hpp"
+#include "projection.hpp"
 #include <components/index/disk/route.hpp>
 #include <services/collection/collection.hpp>
 
@@ -9,33 +10,16 @@ namespace components::table::operators {
     std::vector<range> search_range_by_index(index::index_t* index,
                                              const expressions::compare_expression_ptr& expr,
                                              const logical_plan::storage_parameters* parameters) {
-        using expressions::compare_type;
-        using logical_plan::get_parameter;
-        auto value = get_parameter(parameters, expr->value()).as_logical_value();
-        switch (expr->type()) {
-            case compare_type::eq:
-                return {index->find(value)};
-            case compare_type::ne:
-                return {index->lower_bound(value), index->upper_bound(value)};
-            case compare_type::gt:
-                return {index->upper_bound(value)};
-            case compare_type::lt:
-                return {index->lower_bound(value)};
-            case compare_type::gte:
-                return {index->find(value), index->upper_bound(value)};
-            case compare_type::lte:
-                return {index->lower_bound(value), index->find(value)};
-            default:
-                //todo: error
-                return {{index->cend(), index->cend()}, {index->cend(), index->cend()}};
-        }
+        auto value = logical_plan::get_parameter(parameters, expr->value()).as_logical_value();
+        return index::search_range(index, expr->type(), value);
     }
 
     base::operators::operator_data_ptr search_by_index(index::index_t* index,
                                                        const expressions::compare_expression_ptr& expr,
                                                        const logical_plan::limit_t& limit,
                                                        const logical_plan::storage_parameters* parameters,
-                                                       table::data_table_t& table) {
+                                                       table::data_table_t& table,
+                                                       const std::vector<std::string>& columns) {
         auto ranges = search_range_by_index(index, expr, parameters);
         size_t rows = 0;
         for (const auto& range : ranges) {
@@ -55,13 +39,9 @@ namespace components::table::operators {
         }
 
         table::column_fetch_state state;
-        std::vector<table::storage_index_t> column_indices;
-        column_indices.reserve(table.column_count());
-        for (int64_t i = 0; i < table.column_count(); i++) {
-            column_indices.emplace_back(i);
-        }
-
-        auto result = base::operators::make_operator_data(index->resource(), table.copy_types(), rows);
+        auto column_indices = projection_indices(table, columns);
+        auto result =
+            base::operators::make_operator_data(index->resource(), projection_types(table, column_indices), rows);
         table.fetch(result->data_chunk(), column_indices, row_ids, rows, state);
         result->data_chunk().row_ids = row_ids;
         return result;
@@ -69,14 +49,16 @@ namespace components::table::operators {
 
     index_scan::index_scan(services::collection::context_collection_t* context,
                            expressions::compare_expression_ptr expr,
-                           logical_plan::limit_t limit)
+                           logical_plan::limit_t limit,
+                           std::vector<std::string> columns)
         : read_only_operator_t(context, operator_type::match)
         , expr_(std::move(expr))
-        , limit_(limit) {}
+        , limit_(limit)
+        , columns_(std::move(columns)) {}
 
     void index_scan::on_execute_impl(pipeline::context_t* pipeline_context) {
         trace(context_->log(), "index_scan by field \"{}\"", expr_->key_left().as_string());
-        auto* index = index::search_index(context_->index_engine(), {expr_->key_left()});
+        auto* index = index::search_index(context_->index_engine(), {expr_->key_left()}, expr_->type());
         context_->table_storage().table();
         if (index && index->is_disk()) {
             trace(context_->log(), "index_scan: send query into disk");
@@ -91,32 +73,30 @@ namespace components::table::operators {
             if (!limit_.check(0)) {
                 return; //limit = 0
             }
+            auto& table = context_->table_storage().table();
             if (index) {
-                output_ = search_by_index(index,
-                                          expr_,
-                                          limit_,
-                                          &pipeline_context->parameters,
-                                          context_->table_storage().table());
+                output_ = search_by_index(index, expr_, limit_, &pipeline_context->parameters, table, columns_);
             } else {
-                output_ = base::operators::make_operator_data(context_->resource(),
-                                                              context_->table_storage().table().copy_types());
+                output_ = base::operators::make_operator_data(
+                    context_->resource(),
+                    projection_types(table, projection_indices(table, columns_)));
             }
         }
     }
 
     void index_scan::on_resume_impl(pipeline::context_t* pipeline_context) {
         trace(context_->log(), "resume index_scan by field \"{}\"", expr_->key_left().as_string());
-        auto* index = index::search_index(context_->index_engine(), {expr_->key_left()});
+        auto* index = index::search_index(context_->index_engine(), {expr_->key_left()}, expr_->type());
         trace(context_->log(), "index_scan: prepare result");
         if (!limit_.check(0)) {
             return; //limit = 0
         }
+        auto& table = context_->table_storage().table();
         if (index) {
-            output_ =
-                search_by_index(index, expr_, limit_, &pipeline_context->parameters, context_->table_storage().table());
+            output_ = search_by_index(index, expr_, limit_, &pipeline_context->parameters, table, columns_);
         } else {
             output_ = base::operators::make_operator_data(context_->resource(),
-                                                          context_->table_storage().table().copy_types());
+                                                          projection_types(table, projection_indices(table, columns_)));
         }
     }
 
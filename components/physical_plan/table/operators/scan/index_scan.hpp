@@ -7,11 +7,13 @@
 
 namespace components::table::operators {
 
+    // `columns` are the names of the columns to fetch, every column is fetched if it is empty
     class index_scan final : public read_only_operator_t {
     public:
         index_scan(services::collection::context_collection_t* collection,
                    expressions::compare_expression_ptr expr,
-                   logical_plan::limit_t limit);
+                   logical_plan::limit_t limit,
+                   std::vector<std::string> columns = {});
 
     private:
         void on_execute_impl(pipeline::context_t* pipeline_context) final;
@@ -19,6 +21,7 @@ namespace components::table::operators {
 
         const expressions::compare_expression_ptr expr_;
         const logical_plan::limit_t limit_;
+        const std::vector<std::string> columns_;
     };
 
 } // namespace components::table::operators
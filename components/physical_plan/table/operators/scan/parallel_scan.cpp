@@ -0,0 +1,156 @@
+#include "parallel_scan.hpp"
+#include "projection.hpp"
+
+#include <components/vector/vector_operations.hpp>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <services/collection/collection.hpp>
+
+namespace components::table::operators {
+
+    base::operators::operator_data_ptr parallel_scan(services::collection::context_collection_t* context,
+                                                     const table::table_filter_t* filter,
+                                                     const logical_plan::limit_t& limit,
+                                                     const std::vector<table::storage_index_t>& column_indices) {
+        auto& table = context->table_storage().table();
+        auto types = projection_types(table, column_indices);
+        const auto column_count = column_indices.size();
+
+        // the row id column goes last, filters refer to the table columns and do not depend on the projection
+        auto scan_indices = column_indices;
+        scan_indices.emplace_back();
+        auto scan_types = types;
+        scan_types.emplace_back(types::logical_type::BIGINT);
+
+        table::parallel_table_scan_state parallel_state;
+        table.initialize_parallel_scan(parallel_state);
+        const bool limited = limit.limit() >= 0;
+        const auto limit_rows = limited ? static_cast<uint64_t>(limit.limit()) : uint64_t(0);
+
+        struct morsel_t {
+            std::vector<vector::data_chunk_t> batches;
+            uint64_t rows = 0;
+        };
+        std::mutex lock;
+        std::map<uint64_t, morsel_t> morsels;
+        // morsels being read, they are claimed in table order under the lock
+        std::set<uint64_t> running;
+        bool limit_reached = false;
+
+        // rows of the finished morsels before the first running one, no morsel before them is missing
+        // because later claims only get later morsels; called under the lock
+        auto prefix_rows = [&]() {
+            auto first_running = running.empty() ? std::numeric_limits<uint64_t>::max() : *running.begin();
+            uint64_t rows = 0;
+            for (const auto& [index, morsel] : morsels) {
+                if (index > first_running) {
+                    break;
+                }
+                rows += morsel.rows;
+            }
+            return rows;
+        };
+
+        // workers allocate from the default resource, the collection resource is used on the executor thread only
+        // with a limit no morsel is claimed once the table order prefix holds enough rows, and running morsels
+        // past it are dropped
+        auto worker = [&](uint64_t) {
+            table::table_scan_state state(std::pmr::get_default_resource());
+            while (true) {
+                uint64_t index;
+                {
+                    std::lock_guard guard(lock);
+                    if (limit_reached || !table.next_parallel_scan(parallel_state, state, scan_indices, filter)) {
+                        break;
+                    }
+                    index = state.table_state.batch_index;
+                    running.insert(index);
+                }
+                morsel_t morsel;
+                bool dropped = false;
+                while (true) {
+                    vector::data_chunk_t batch(std::pmr::get_default_resource(), scan_types);
+                    table.scan(batch, state);
+                    if (batch.size() == 0) {
+                        break;
+                    }
+                    morsel.rows += batch.size();
+                    morsel.batches.emplace_back(std::move(batch));
+                    if (limited) {
+                        std::lock_guard guard(lock);
+                        if (limit_reached) {
+                            dropped = true;
+                            break;
+                        }
+                        // the first running morsel stops at the limit, the rest of it would not be returned
+                        if (*running.begin() == index && prefix_rows() + morsel.rows >= limit_rows) {
+                            break;
+                        }
+                    }
+                }
+                std::lock_guard guard(lock);
+                running.erase(index);
+                if (!dropped) {
+                    morsels.emplace(index, std::move(morsel));
+                    limit_reached = limited && prefix_rows() >= limit_rows;
+                }
+            }
+        };
+        auto* pool = context->scan_pool();
+        if (pool) {
+            pool->parallel_for(std::min(pool->concurrency(), table.max_threads()), worker);
+        } else {
+            worker(0);
+        }
+
+        uint64_t total = 0;
+        for (const auto& [index, morsel] : morsels) {
+            total += morsel.rows;
+        }
+        if (limited) {
+            total = std::min(total, limit_rows);
+        }
+
+        // rows of a single batch, like a small table or a limit within the first batch, are moved instead of copied
+        for (auto& [index, morsel] : morsels) {
+            if (morsel.rows == 0) {
+                continue;
+            }
+            auto& batch = morsel.batches.front();
+            if (batch.size() < total) {
+                break;
+            }
+            batch.row_ids = std::move(batch.data.back());
+            batch.data.pop_back();
+            batch.set_cardinality(total);
+            // scans may leave constant or sequence vectors, the copy below flattens them as well
+            batch.flatten();
+            batch.row_ids.flatten(total);
+            return base::operators::make_operator_data(context->resource(), std::move(batch));
+        }
+
+        auto output = base::operators::make_operator_data(context->resource(),
+                                                          types,
+                                                          std::max(total, vector::DEFAULT_VECTOR_CAPACITY));
+        auto& result = output->data_chunk();
+        uint64_t offset = 0;
+        for (const auto& [index, morsel] : morsels) {
+            for (const auto& batch : morsel.batches) {
+                if (offset == total) {
+                    break;
+                }
+                auto count = std::min(batch.size(), total - offset);
+                for (uint64_t i = 0; i < column_count; i++) {
+                    vector::vector_ops::copy(batch.data[i], result.data[i], count, 0, offset);
+                }
+                vector::vector_ops::copy(batch.data[column_count], result.row_ids, count, 0, offset);
+                offset += count;
+            }
+        }
+        result.set_cardinality(total);
+        return output;
+    }
+
+} // namespace components::table::operators
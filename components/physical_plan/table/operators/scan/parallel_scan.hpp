@@ -0,0 +1,22 @@
+#pragma once
+
+#include <components/logical_plan/node_limit.hpp>
+#include <components/physical_plan/base/operators/operator_data.hpp>
+#include <components/table/column_state.hpp>
+
+namespace services::collection {
+    class context_collection_t;
+} // namespace services::collection
+
+namespace components::table::operators {
+
+    // reads every row of the table passing `filter` into a single chunk, row ids are kept in its row_ids
+    // row group morsels are claimed by the workers of the collection scan pool and concatenated in table order,
+    // with a limit no morsel is claimed once the rows before it in table order reach the limit
+    // only the columns of `column_indices` are read and materialized
+    base::operators::operator_data_ptr parallel_scan(services::collection::context_collection_t* context,
+                                                     const table::table_filter_t* filter,
+                                                     const logical_plan::limit_t& limit,
+                                                     const std::vector<table::storage_index_t>& column_indices);
+
+} // namespace components::table::operators
@@ -0,0 +1,39 @@
+#include "projection.hpp"
+
+#include <algorithm>
+
+namespace components::table::operators {
+
+    std::vector<table::storage_index_t> projection_indices(const table::data_table_t& table,
+                                                           const std::vector<std::string>& columns) {
+        const auto& definitions = table.columns();
+        std::vector<table::storage_index_t> column_indices;
+        column_indices.reserve(columns.empty() ? definitions.size() : columns.size());
+        for (uint64_t i = 0; i < definitions.size(); i++) {
+            if (columns.empty() || std::find(columns.begin(), columns.end(), definitions[i].name()) != columns.end()) {
+                column_indices.emplace_back(i);
+            }
+        }
+        if (column_indices.empty()) {
+            for (uint64_t i = 0; i < definitions.size(); i++) {
+                column_indices.emplace_back(i);
+            }
+        }
+        return column_indices;
+    }
+
+    std::pmr::vector<types::complex_logical_type>
+    projection_types(const table::data_table_t& table, const std::vector<table::storage_index_t>& column_indices) {
+        auto types = table.copy_types();
+        if (column_indices.size() == types.size()) {
+            return types;
+        }
+        std::pmr::vector<types::complex_logical_type> result(types.get_allocator().resource());
+        result.reserve(column_indices.size());
+        for (const auto& index : column_indices) {
+            result.push_back(types[index.primary_index()]);
+        }
+        return result;
+    }
+
+} // namespace components::table::operators
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <components/table/column_state.hpp>
+#include <components/table/data_table.hpp>
+
+#include <string>
+#include <vector>
+
+namespace components::table::operators {
+
+    // table columns named by `columns` in table order, every column if `columns` is empty
+    // names which are not columns of the table are skipped, every column is read if none is left
+    std::vector<table::storage_index_t> projection_indices(const table::data_table_t& table,
+                                                           const std::vector<std::string>& columns);
+
+    // types of the columns read by `column_indices`
+    std::pmr::vector<types::complex_logical_type>
+    projection_types(const table::data_table_t& table, const std::vector<table::storage_index_t>& column_indices);
+
+} // namespace components::table::operators
@@ -0,0 +1,56 @@
+#include "scan_stream.hpp"
+#include "projection.hpp"
+
+#include <services/collection/collection.hpp>
+
+namespace components::table::operators {
+
+    scan_stream_t::scan_stream_t(services::collection::context_collection_t* context,
+                                 std::unique_ptr<table::table_filter_t> filter,
+                                 logical_plan::limit_t limit,
+                                 const std::vector<table::storage_index_t>& column_indices)
+        : context_(context)
+        , filter_(std::move(filter))
+        , state_(std::make_unique<table::table_scan_state>(std::pmr::get_default_resource()))
+        , types_(projection_types(context_->table_storage().table(), column_indices))
+        , limit_(limit) {
+        context_->table_storage().table().initialize_scan(*state_, column_indices, filter_.get());
+        next_ = read_();
+    }
+
+    bool scan_stream_t::has_next() const noexcept { return next_ != nullptr; }
+
+    base::operators::operator_data_ptr scan_stream_t::next() {
+        if (!next_) {
+            return base::operators::make_operator_data(context_->resource(), types_);
+        }
+        auto result = std::move(next_);
+        next_ = read_();
+        return result;
+    }
+
+    base::operators::operator_data_ptr scan_stream_t::read_() {
+        if (!state_) {
+            return nullptr;
+        }
+        if (limit_.limit() >= 0 && emitted_ >= static_cast<size_t>(limit_.limit())) {
+            state_.reset();
+            return nullptr;
+        }
+        auto& table = context_->table_storage().table();
+        auto data = base::operators::make_operator_data(context_->resource(), types_);
+        table.scan(data->data_chunk(), *state_);
+        if (data->data_chunk().size() == 0) {
+            // releases pinned segments as soon as the table is read
+            state_.reset();
+            return nullptr;
+        }
+        if (limit_.limit() >= 0) {
+            data->data_chunk().set_cardinality(
+                std::min<size_t>(data->data_chunk().size(), static_cast<size_t>(limit_.limit()) - emitted_));
+        }
+        emitted_ += data->data_chunk().size();
+        return data;
+    }
+
+} // namespace components::table::operators
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <components/logical_plan/node_limit.hpp>
+#include <components/physical_plan/base/operators/operator_data.hpp>
+#include <components/table/column_state.hpp>
+#include <components/table/table_state.hpp>
+
+namespace services::collection {
+    class context_collection_t;
+} // namespace services::collection
+
+namespace components::table::operators {
+
+    // reads a table by batches of at most DEFAULT_VECTOR_CAPACITY rows
+    // one batch is read ahead, so has_next() is exact and the last batch is never empty
+    // batches hold the columns of `column_indices` only, the filter may refer to any column of the table
+    class scan_stream_t {
+    public:
+        scan_stream_t(services::collection::context_collection_t* context,
+                      std::unique_ptr<table::table_filter_t> filter,
+                      logical_plan::limit_t limit,
+                      const std::vector<table::storage_index_t>& column_indices);
+
+        bool has_next() const noexcept;
+        // returns the next batch, an empty one if the scan is over
+        base::operators::operator_data_ptr next();
+
+    private:
+        base::operators::operator_data_ptr read_();
+
+        services::collection::context_collection_t* context_;
+        std::unique_ptr<table::table_filter_t> filter_;
+        std::unique_ptr<table::table_scan_state> state_;
+        std::pmr::vector<types::complex_logical_type> types_;
+        const logical_plan::limit_t limit_;
+        size_t emitted_{0};
+        base::operators::operator_data_ptr next_{nullptr};
+    };
+
+} // namespace components::table::operators
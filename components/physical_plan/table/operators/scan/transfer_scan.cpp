@@ -1,12 +1,17 @@
 #include "transfer_scan.hpp"
+#include "parallel_scan.hpp"
+#include "projection.hpp"
 
 #include <services/collection/collection.hpp>
 
 namespace components::table::operators {
 
-    transfer_scan::transfer_scan(services::collection::context_collection_t* context, logical_plan::limit_t limit)
+    transfer_scan::transfer_scan(services::collection::context_collection_t* context,
+                                 logical_plan::limit_t limit,
+                                 std::vector<std::string> columns)
         : read_only_operator_t(context, operator_type::match)
-        , limit_(limit) {}
+        , limit_(limit)
+        , columns_(std::move(columns)) {}
 
     void transfer_scan::on_execute_impl(pipeline::context_t*) {
         trace(context_->log(), "transfer_scan");
@@ -15,20 +20,17 @@ namespace components::table::operators {
             return; //limit = 0
         }
 
-        auto types = context_->table_storage().table().copy_types();
-        output_ = base::operators::make_operator_data(context_->resource(), types);
-        std::vector<table::storage_index_t> column_indices;
-        column_indices.reserve(context_->table_storage().table().column_count());
-        for (int64_t i = 0; i < context_->table_storage().table().column_count(); i++) {
-            column_indices.emplace_back(i);
-        }
-        table::table_scan_state state(std::pmr::get_default_resource());
-        context_->table_storage().table().initialize_scan(state, column_indices);
-        // TODO: check limit inside scan
-        context_->table_storage().table().scan(output_->data_chunk(), state);
-        if (limit_.limit() >= 0) {
-            output_->data_chunk().set_cardinality(std::min<size_t>(output_->data_chunk().size(), limit_.limit()));
+        auto column_indices = projection_indices(context_->table_storage().table(), columns_);
+        if (is_streaming()) {
+            stream_ = std::make_unique<scan_stream_t>(context_, nullptr, limit_, column_indices);
+            output_ = stream_->next();
+            return;
         }
+        output_ = parallel_scan(context_, nullptr, limit_, column_indices);
     }
 
+    bool transfer_scan::has_next_chunk_impl() const { return stream_ && stream_->has_next(); }
+
+    void transfer_scan::on_next_chunk_impl(pipeline::context_t*) { output_ = stream_->next(); }
+
 } // namespace components::table::operators
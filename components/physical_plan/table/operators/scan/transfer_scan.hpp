@@ -2,17 +2,25 @@
 
 #include <components/logical_plan/node_limit.hpp>
 #include <components/physical_plan/base/operators/operator.hpp>
+#include <components/physical_plan/table/operators/scan/scan_stream.hpp>
 
 namespace components::table::operators {
 
+    // `columns` are the names of the columns to read, every column is read if it is empty
     class transfer_scan final : public read_only_operator_t {
     public:
-        transfer_scan(services::collection::context_collection_t* collection, logical_plan::limit_t limit);
+        transfer_scan(services::collection::context_collection_t* collection,
+                      logical_plan::limit_t limit,
+                      std::vector<std::string> columns = {});
 
     private:
         void on_execute_impl(pipeline::context_t* pipeline_context) final;
+        bool has_next_chunk_impl() const final;
+        void on_next_chunk_impl(pipeline::context_t* pipeline_context) final;
 
         const logical_plan::limit_t limit_;
+        const std::vector<std::string> columns_;
+        std::unique_ptr<scan_stream_t> stream_;
     };
 
 } // namespace components::table::operators
@@ -1,40 +1,332 @@
 #include "sort.hpp"
 
+#include <cstring>
+#include <numeric>
+
 namespace components::table::sort {
 
+    namespace {
+
+        constexpr size_t string_prefix_size = 16;
+        // below this many rows comparison sort is cheaper than going over every key byte
+        constexpr uint64_t radix_sort_threshold = 256;
+
+        struct key_column_t {
+            size_t index;
+            order order_;
+            types::physical_type type;
+            size_t offset;
+            size_t width;
+        };
+
+        template<typename T>
+        void store_big_endian(T value, uint8_t* out) {
+            for (size_t i = sizeof(T); i-- > 0;) {
+                out[i] = static_cast<uint8_t>(value & 0xFF);
+                value = static_cast<T>(value >> 8);
+            }
+        }
+
+        // maps a value to unsigned bits whose big-endian bytes order as the value does
+        template<typename T>
+        auto normalize(T value) {
+            if constexpr (std::is_same_v<T, bool>) {
+                return static_cast<uint8_t>(value);
+            } else if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+                using bits_t = std::conditional_t<std::is_same_v<T, float>, uint32_t, uint64_t>;
+                constexpr auto sign = bits_t(1) << (sizeof(bits_t) * 8 - 1);
+                if (value == T(0)) {
+                    value = T(0); // -0.0 == 0.0
+                }
+                bits_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                return (bits & sign) ? static_cast<bits_t>(~bits) : static_cast<bits_t>(bits | sign);
+            } else if constexpr (std::is_signed_v<T>) {
+                using bits_t = std::make_unsigned_t<T>;
+                return static_cast<bits_t>(static_cast<bits_t>(value) ^ (bits_t(1) << (sizeof(T) * 8 - 1)));
+            } else {
+                return value;
+            }
+        }
+
+        void invert(uint8_t* out, size_t width) {
+            for (size_t i = 0; i < width; i++) {
+                out[i] = static_cast<uint8_t>(~out[i]);
+            }
+        }
+
+        template<typename T>
+        void encode_column(const vector::unified_vector_format& format,
+                           const key_column_t& column,
+                           uint64_t count,
+                           uint8_t* keys,
+                           size_t row_width) {
+            auto data = format.get_data<T>();
+            for (uint64_t row = 0; row < count; row++) {
+                auto* out = keys + row * row_width + column.offset;
+                const auto idx = format.referenced_indexing->get_index(row);
+                if (format.validity.row_is_valid(idx)) {
+                    out[0] = 0;
+                    if constexpr (std::is_same_v<T, std::string_view>) {
+                        const auto& value = data[idx];
+                        const auto size = std::min(value.size(), string_prefix_size);
+                        std::memcpy(out + 1, value.data(), size);
+                        std::memset(out + 1 + size, 0, string_prefix_size - size);
+                    } else {
+                        store_big_endian(normalize(data[idx]), out + 1);
+                    }
+                } else {
+                    out[0] = 1;
+                    std::memset(out + 1, 0, column.width - 1);
+                }
+                if (column.order_ == order::descending) {
+                    invert(out, column.width);
+                }
+            }
+        }
+
+        void encode_column_switch(const vector::unified_vector_format& format,
+                                  const key_column_t& column,
+                                  uint64_t count,
+                                  uint8_t* keys,
+                                  size_t row_width) {
+            switch (column.type) {
+                case types::physical_type::BOOL:
+                    return encode_column<bool>(format, column, count, keys, row_width);
+                case types::physical_type::INT8:
+                    return encode_column<int8_t>(format, column, count, keys, row_width);
+                case types::physical_type::INT16:
+                    return encode_column<int16_t>(format, column, count, keys, row_width);
+                case types::physical_type::INT32:
+                    return encode_column<int32_t>(format, column, count, keys, row_width);
+                case types::physical_type::INT64:
+                    return encode_column<int64_t>(format, column, count, keys, row_width);
+                case types::physical_type::UINT8:
+                    return encode_column<uint8_t>(format, column, count, keys, row_width);
+                case types::physical_type::UINT16:
+                    return encode_column<uint16_t>(format, column, count, keys, row_width);
+                case types::physical_type::UINT32:
+                    return encode_column<uint32_t>(format, column, count, keys, row_width);
+                case types::physical_type::UINT64:
+                    return encode_column<uint64_t>(format, column, count, keys, row_width);
+                case types::physical_type::FLOAT:
+                    return encode_column<float>(format, column, count, keys, row_width);
+                case types::physical_type::DOUBLE:
+                    return encode_column<double>(format, column, count, keys, row_width);
+                case types::physical_type::STRING:
+                    return encode_column<std::string_view>(format, column, count, keys, row_width);
+                default:
+                    // only the null flag goes to the key, values are compared as logical values
+                    for (uint64_t row = 0; row < count; row++) {
+                        auto* out = keys + row * row_width + column.offset;
+                        out[0] = format.validity.row_is_valid(format.referenced_indexing->get_index(row)) ? 0 : 1;
+                        if (column.order_ == order::descending) {
+                            invert(out, column.width);
+                        }
+                    }
+                    break;
+            }
+        }
+
+        size_t key_width(types::physical_type type) {
+            switch (type) {
+                case types::physical_type::BOOL:
+                case types::physical_type::INT8:
+                case types::physical_type::UINT8:
+                    return 1 + sizeof(uint8_t);
+                case types::physical_type::INT16:
+                case types::physical_type::UINT16:
+                    return 1 + sizeof(uint16_t);
+                case types::physical_type::INT32:
+                case types::physical_type::UINT32:
+                case types::physical_type::FLOAT:
+                    return 1 + sizeof(uint32_t);
+                case types::physical_type::INT64:
+                case types::physical_type::UINT64:
+                case types::physical_type::DOUBLE:
+                    return 1 + sizeof(uint64_t);
+                case types::physical_type::STRING:
+                    return 1 + string_prefix_size;
+                default:
+                    return 1;
+            }
+        }
+
+        bool is_exact_key(types::physical_type type) {
+            return type != types::physical_type::STRING && key_width(type) > 1;
+        }
+
+        template<typename T>
+        int compare_values(const vector::unified_vector_format& format, uint64_t lhs, uint64_t rhs) {
+            auto data = format.get_data<T>();
+            const auto& l = data[format.referenced_indexing->get_index(lhs)];
+            const auto& r = data[format.referenced_indexing->get_index(rhs)];
+            return l < r ? -1 : (r < l ? 1 : 0);
+        }
+
+        // full comparison of one column, used for columns whose key is not exact
+        int compare_column(const vector::vector_t& column,
+                           const vector::unified_vector_format& format,
+                           types::physical_type type,
+                           uint64_t lhs,
+                           uint64_t rhs) {
+            const bool l_valid = format.validity.row_is_valid(format.referenced_indexing->get_index(lhs));
+            const bool r_valid = format.validity.row_is_valid(format.referenced_indexing->get_index(rhs));
+            if (!l_valid || !r_valid) {
+                return static_cast<int>(!l_valid) - static_cast<int>(!r_valid);
+            }
+            switch (type) {
+                case types::physical_type::BOOL:
+                    return compare_values<bool>(format, lhs, rhs);
+                case types::physical_type::INT8:
+                    return compare_values<int8_t>(format, lhs, rhs);
+                case types::physical_type::INT16:
+                    return compare_values<int16_t>(format, lhs, rhs);
+                case types::physical_type::INT32:
+                    return compare_values<int32_t>(format, lhs, rhs);
+                case types::physical_type::INT64:
+                    return compare_values<int64_t>(format, lhs, rhs);
+                case types::physical_type::UINT8:
+                    return compare_values<uint8_t>(format, lhs, rhs);
+                case types::physical_type::UINT16:
+                    return compare_values<uint16_t>(format, lhs, rhs);
+                case types::physical_type::UINT32:
+                    return compare_values<uint32_t>(format, lhs, rhs);
+                case types::physical_type::UINT64:
+                    return compare_values<uint64_t>(format, lhs, rhs);
+                case types::physical_type::FLOAT:
+                    return compare_values<float>(format, lhs, rhs);
+                case types::physical_type::DOUBLE:
+                    return compare_values<double>(format, lhs, rhs);
+                case types::physical_type::STRING:
+                    return compare_values<std::string_view>(format, lhs, rhs);
+                default:
+                    return static_cast<int>(column.value(lhs).compare(column.value(rhs)));
+            }
+        }
+
+        // LSD radix sort of fixed-width rows by their first key_width bytes, returns the buffer holding the result
+        uint8_t* radix_sort(uint8_t* data, uint8_t* temp, uint64_t count, size_t row_width, size_t key_width) {
+            std::vector<uint64_t> counts(256);
+            for (size_t byte = key_width; byte-- > 0;) {
+                std::fill(counts.begin(), counts.end(), 0);
+                for (uint64_t row = 0; row < count; row++) {
+                    ++counts[data[row * row_width + byte]];
+                }
+                if (counts[data[byte]] == count) {
+                    continue; // the same byte in every row
+                }
+                uint64_t position = 0;
+                for (auto& bucket : counts) {
+                    auto size = bucket;
+                    bucket = position;
+                    position += size;
+                }
+                for (uint64_t row = 0; row < count; row++) {
+                    auto* source = data + row * row_width;
+                    std::memcpy(temp + counts[source[byte]]++ * row_width, source, row_width);
+                }
+                std::swap(data, temp);
+            }
+            return data;
+        }
+
+    } // namespace
+
     sorter_t::sorter_t(size_t index, order order_) { add(index, order_); }
     sorter_t::sorter_t(const std::string& key, order order_) { add(key, order_); }
 
-    void sorter_t::add(size_t index, order order_) {
-        functions_.emplace_back([index, order_](const std::pmr::vector<types::logical_value_t>& vec1,
-                                                const std::pmr::vector<types::logical_value_t>& vec2) {
-            auto k_order = static_cast<int>(order_ == order::ascending ? compare_t::more : compare_t::less);
-            return static_cast<compare_t>(k_order * static_cast<int>(vec1.at(index).compare(vec2.at(index))));
-        });
-    }
+    void sorter_t::add(size_t index, order order_) { columns_.push_back({index, {}, order_}); }
 
-    void sorter_t::add(const std::string& key, order order_) {
-        functions_.emplace_back([&key, order_](const std::pmr::vector<types::logical_value_t>& vec1,
-                                               const std::pmr::vector<types::logical_value_t>& vec2) {
-            auto pos_1 =
-                std::find_if(vec1.begin(), vec1.end(), [&key](const auto& val) { return val.type().alias() == key; }) -
-                vec1.begin();
-            auto pos_2 =
-                std::find_if(vec2.begin(), vec2.end(), [&key](const auto& val) { return val.type().alias() == key; }) -
-                vec2.begin();
-            auto k_order = static_cast<int>(order_ == order::ascending ? compare_t::less : compare_t::more);
-            if (pos_1 == vec1.size() && pos_2 == vec2.size()) {
-                return compare_t::equals;
-            } else if (pos_1 >= vec1.size()) {
-                return static_cast<compare_t>(
-                    k_order * static_cast<int>(types::logical_value_t{nullptr}.compare(vec2.at(pos_2))));
-            } else if (pos_2 >= vec2.size()) {
-                return static_cast<compare_t>(
-                    k_order * static_cast<int>(vec1.at(pos_1).compare(types::logical_value_t{nullptr})));
-            } else {
-                return static_cast<compare_t>(k_order * static_cast<int>(vec1.at(pos_1).compare(vec2.at(pos_2))));
+    void sorter_t::add(const std::string& key, order order_) { columns_.push_back({vector::INVALID_ID, key, order_}); }
+
+    std::pmr::vector<uint64_t> sorter_t::sort(vector::data_chunk_t& chunk, const logical_plan::limit_t& limit) const {
+        auto* resource = chunk.resource();
+        const auto count = chunk.size();
+        std::pmr::vector<uint64_t> rows(count, resource);
+        std::iota(rows.begin(), rows.end(), uint64_t(0));
+
+        // the key covers columns up to the first one that can not be encoded exactly, the rest is compared by value
+        std::vector<key_column_t> key_columns;
+        size_t width = 0;
+        size_t exact_columns = 0;
+        for (const auto& column : columns_) {
+            auto index = column.index;
+            if (index == vector::INVALID_ID) {
+                for (size_t i = 0; i < chunk.column_count(); i++) {
+                    if (chunk.data[i].type().alias() == column.key) {
+                        index = i;
+                        break;
+                    }
+                }
+                if (index == vector::INVALID_ID) {
+                    continue; // missing column compares equal for every row
+                }
+            }
+            auto type = chunk.data.at(index).type().to_physical_type();
+            key_columns.push_back({index, column.order_, type, width, key_width(type)});
+            if (exact_columns == key_columns.size() - 1) {
+                width += key_columns.back().width;
+                if (is_exact_key(type)) {
+                    ++exact_columns;
+                }
+            }
+        }
+        if (key_columns.empty() || count == 0) {
+            if (limit.limit() >= 0 && static_cast<uint64_t>(limit.limit()) < count) {
+                rows.resize(static_cast<size_t>(limit.limit()));
+            }
+            return rows;
+        }
+        const size_t encoded_columns = std::min(exact_columns + 1, key_columns.size());
+        const bool exact = exact_columns == key_columns.size();
+
+        // every row: key bytes followed by the row index
+        const size_t row_width = width + sizeof(uint64_t);
+        std::pmr::vector<uint8_t> keys(count * row_width, resource);
+        std::vector<vector::unified_vector_format> formats;
+        formats.reserve(key_columns.size());
+        for (size_t i = 0; i < key_columns.size(); i++) {
+            formats.emplace_back(resource, count);
+            chunk.data[key_columns[i].index].to_unified_format(count, formats.back());
+            if (i < encoded_columns) {
+                encode_column_switch(formats.back(), key_columns[i], count, keys.data(), row_width);
+            }
+        }
+        for (uint64_t row = 0; row < count; row++) {
+            std::memcpy(keys.data() + row * row_width + width, &row, sizeof(uint64_t));
+        }
+
+        auto less = [&](uint64_t lhs, uint64_t rhs) {
+            auto res = std::memcmp(keys.data() + lhs * row_width, keys.data() + rhs * row_width, width);
+            if (res != 0 || exact) {
+                return res < 0;
+            }
+            for (size_t i = exact_columns; i < key_columns.size(); i++) {
+                const auto& column = key_columns[i];
+                res = compare_column(chunk.data[column.index], formats[i], column.type, lhs, rhs);
+                if (res != 0) {
+                    return column.order_ == order::ascending ? res < 0 : res > 0;
+                }
+            }
+            return false;
+        };
+
+        if (limit.limit() >= 0 && static_cast<uint64_t>(limit.limit()) < count) {
+            // top-N: heap of the best `limit` rows
+            const auto top = static_cast<size_t>(limit.limit());
+            std::partial_sort(rows.begin(), rows.begin() + static_cast<std::ptrdiff_t>(top), rows.end(), less);
+            rows.resize(top);
+        } else if (exact && count >= radix_sort_threshold) {
+            std::pmr::vector<uint8_t> temp(keys.size(), resource);
+            const auto* sorted = radix_sort(keys.data(), temp.data(), count, row_width, width);
+            for (uint64_t row = 0; row < count; row++) {
+                std::memcpy(&rows[row], sorted + row * row_width + width, sizeof(uint64_t));
             }
-        });
+        } else {
+            std::sort(rows.begin(), rows.end(), less);
+        }
+        return rows;
     }
 
-} // namespace components::table::sort
\ No newline at end of file
+} // namespace components::table::sort
@@ -1,22 +1,20 @@
 #pragma once
-#include <components/types/logical_value.hpp>
-#include <functional>
+
+#include <components/logical_plan/node_limit.hpp>
+#include <components/vector/data_chunk.hpp>
 #include <memory_resource>
 
 namespace components::table::sort {
 
-    using types::compare_t;
-
     enum class order
     {
         descending = -1,
         ascending = 1
     };
 
+    // Sort columns are encoded into fixed-width keys that compare with memcmp (nulls last for ascending order).
+    // Strings keep only a prefix in the key, ties on it are resolved by comparing the values.
     class sorter_t {
-        using function_t = std::function<compare_t(const std::pmr::vector<types::logical_value_t>&,
-                                                   const std::pmr::vector<types::logical_value_t>&)>;
-
     public:
         explicit sorter_t() = default;
         explicit sorter_t(size_t index, order order_ = order::ascending);
@@ -26,21 +24,17 @@ namespace components::table::sort {
         // slow, but does not require a schema; TODO: remove
         void add(const std::string& key, order order_ = order::ascending);
 
-        bool operator()(const std::pmr::vector<types::logical_value_t>& vec1,
-                        const std::pmr::vector<types::logical_value_t>& vec2) const {
-            for (const auto& f : functions_) {
-                auto res = f(vec1, vec2);
-                if (res < compare_t::equals) {
-                    return true;
-                } else if (res > compare_t::equals) {
-                    return false;
-                }
-            }
-            return true;
-        }
+        // row indices of the chunk in sorted order, only the first `limit` rows are selected when it is set
+        std::pmr::vector<uint64_t> sort(vector::data_chunk_t& chunk, const logical_plan::limit_t& limit) const;
 
     private:
-        std::vector<function_t> functions_;
+        struct column_t {
+            size_t index;
+            std::string key;
+            order order_;
+        };
+
+        std::vector<column_t> columns_;
     };
 
 } // namespace components::table::sort
@@ -8,6 +8,7 @@
 #include <components/physical_plan/collection/operators/aggregate/operator_min.hpp>
 #include <components/physical_plan/collection/operators/aggregate/operator_sum.hpp>
 #include <components/physical_plan/collection/operators/scan/full_scan.hpp>
+#include <components/physical_plan/table/operators/aggregate/kernels.hpp>
 #include <components/physical_plan/table/operators/aggregate/operator_avg.hpp>
 #include <components/physical_plan/table/operators/aggregate/operator_count.hpp>
 #include <components/physical_plan/table/operators/aggregate/operator_max.hpp>
@@ -204,7 +205,7 @@ TEST_CASE("operator::aggregate::sum") {
             sum_.set_children(boost::intrusive_ptr(
                 new table::operators::full_scan(d(table), cond, logical_plan::limit_t::unlimit())));
             sum_.on_execute(nullptr);
-            REQUIRE(sum_.value().value<int64_t>() == 5050);
+            REQUIRE(sum_.value().value<types::int128_t>() == 5050);
         }
     }
 
@@ -228,7 +229,7 @@ TEST_CASE("operator::aggregate::sum") {
             sum_.set_children(boost::intrusive_ptr(
                 new table::operators::full_scan(d(table), cond, logical_plan::limit_t::unlimit())));
             sum_.on_execute(&pipeline_context);
-            REQUIRE(sum_.value().value<int64_t>() == 45);
+            REQUIRE(sum_.value().value<types::int128_t>() == 45);
         }
     }
 }
@@ -284,3 +285,93 @@ TEST_CASE("operator::aggregate::avg") {
         }
     }
 }
+
+TEST_CASE("operator::aggregate::kernels") {
+    using namespace components::table::operators::aggregate;
+    using types::logical_type;
+    using types::logical_value_t;
+    auto resource = std::pmr::synchronized_pool_resource();
+    constexpr uint64_t count = 1000;
+
+    SECTION("flat") {
+        vector::vector_t column(&resource, logical_type::INTEGER, count);
+        for (uint64_t i = 0; i < count; i++) {
+            column.set_value(i, logical_value_t{int32_t(i)});
+        }
+        REQUIRE(sum_column(column, count)->value<int64_t>() == 499500);
+        REQUIRE(avg_column(column, count)->value<double>() == 499.5);
+        REQUIRE(min_max_column(column, count, true)->value<int32_t>() == 0);
+        REQUIRE(min_max_column(column, count, false)->value<int32_t>() == 999);
+
+        // every third value is null
+        int64_t sum = 0;
+        uint64_t valid = 0;
+        for (uint64_t i = 0; i < count; i++) {
+            if (i % 3 == 0) {
+                column.validity().set_invalid(i);
+            } else {
+                sum += int64_t(i);
+                ++valid;
+            }
+        }
+        REQUIRE(sum_column(column, count)->value<int64_t>() == sum);
+        REQUIRE(avg_column(column, count)->value<double>() == double(sum) / double(valid));
+        REQUIRE(min_max_column(column, count, true)->value<int32_t>() == 1);
+        REQUIRE(min_max_column(column, count, false)->value<int32_t>() == 998);
+    }
+
+    SECTION("constant") {
+        vector::vector_t column(&resource, logical_value_t{int64_t(7)});
+        REQUIRE(column.get_vector_type() == vector::vector_type::CONSTANT);
+        REQUIRE(sum_column(column, count)->value<types::int128_t>() == 7000);
+        REQUIRE(avg_column(column, count)->value<double>() == 7.0);
+        REQUIRE(min_max_column(column, count, true)->value<int64_t>() == 7);
+    }
+
+    SECTION("dictionary") {
+        vector::vector_t column(&resource, logical_type::BIGINT, 4);
+        for (uint64_t i = 0; i < 4; i++) {
+            column.set_value(i, logical_value_t{int64_t(i * 10)});
+        }
+        vector::indexing_vector_t indexing(&resource, count);
+        for (uint64_t i = 0; i < count; i++) {
+            indexing.set_index(i, i % 4);
+        }
+        column.slice(indexing, count);
+        REQUIRE(column.get_vector_type() == vector::vector_type::DICTIONARY);
+        REQUIRE(sum_column(column, count)->value<types::int128_t>() == 15000);
+        REQUIRE(min_max_column(column, count, false)->value<int64_t>() == 30);
+    }
+
+    SECTION("widening") {
+        vector::vector_t tiny(&resource, logical_type::TINYINT, 3);
+        tiny.set_value(0, logical_value_t{int8_t(100)});
+        tiny.set_value(1, logical_value_t{int8_t(100)});
+        tiny.set_value(2, logical_value_t{int8_t(-100)});
+        REQUIRE(sum_column(tiny, 3)->value<int64_t>() == 100);
+
+        vector::vector_t big(&resource, logical_type::BIGINT, 2);
+        big.set_value(0, logical_value_t{std::numeric_limits<int64_t>::max()});
+        big.set_value(1, logical_value_t{int64_t(1)});
+        REQUIRE(sum_column(big, 2)->type().type() == logical_type::HUGEINT);
+        REQUIRE(sum_column(big, 2)->value<types::int128_t>() ==
+                types::int128_t(std::numeric_limits<int64_t>::max()) + 1);
+    }
+
+    SECTION("strings and nulls") {
+        vector::vector_t strings(&resource, logical_type::STRING_LITERAL, 3);
+        strings.set_value(0, logical_value_t{std::string("b")});
+        strings.set_value(1, logical_value_t{std::string("a")});
+        strings.set_value(2, logical_value_t{std::string("c")});
+        REQUIRE(*min_max_column(strings, 3, true)->value<std::string*>() == "a");
+        REQUIRE_FALSE(sum_column(strings, 3).has_value());
+
+        vector::vector_t nulls(&resource, logical_type::DOUBLE, 3);
+        for (uint64_t i = 0; i < 3; i++) {
+            nulls.validity().set_invalid(i);
+        }
+        REQUIRE(sum_column(nulls, 3)->value<double>() == 0.0);
+        REQUIRE(avg_column(nulls, 3)->is_null());
+        REQUIRE(min_max_column(nulls, 3, true)->is_null());
+    }
+}
@@ -14,6 +14,7 @@
 #include <components/physical_plan/table/operators/aggregate/operator_sum.hpp>
 #include <components/physical_plan/table/operators/get/simple_value.hpp>
 #include <components/physical_plan/table/operators/operator_group.hpp>
+#include <components/physical_plan/table/operators/operator_hash_aggregate.hpp>
 #include <components/physical_plan/table/operators/operator_sort.hpp>
 #include <components/physical_plan/table/operators/scan/transfer_scan.hpp>
 
@@ -247,3 +248,94 @@ TEST_CASE("operator::group::all") {
         */
     }
 }
+
+TEST_CASE("operator::group::hash_aggregate") {
+    auto resource = std::pmr::synchronized_pool_resource();
+
+    auto gen_chunk = [&resource]() {
+        std::pmr::vector<types::complex_logical_type> types(&resource);
+        types.emplace_back(types::logical_type::STRING_LITERAL, "name");
+        types.emplace_back(types::logical_type::BIGINT, "count");
+        vector::data_chunk_t chunk(&resource, types, 101);
+        chunk.set_cardinality(101);
+        for (int64_t num = 0; num < 100; ++num) {
+            chunk.set_value(0, static_cast<uint64_t>(num), types::logical_value_t{"Name " + std::to_string(num % 10)});
+            chunk.set_value(1, static_cast<uint64_t>(num), types::logical_value_t{num % 20});
+        }
+        // rows with a null key do not form a group
+        chunk.set_value(1, 100, types::logical_value_t{int64_t(1000)});
+        chunk.data[0].validity().set_invalid(100);
+        return chunk;
+    };
+
+    SECTION("keys") {
+        table::operators::operator_hash_aggregate_t group(&resource);
+        group.set_children(boost::intrusive_ptr(new base::operators::operator_raw_data_t(gen_chunk())));
+        group.add_key("name", key("name"));
+        group.add_key("count", key("count"));
+        group.on_execute(nullptr);
+        REQUIRE(group.output()->size() == 20);
+    }
+
+    SECTION("missing key") {
+        table::operators::operator_hash_aggregate_t group(&resource);
+        group.set_children(boost::intrusive_ptr(new base::operators::operator_raw_data_t(gen_chunk())));
+        group.add_key("id_", key("id_"));
+        group.on_execute(nullptr);
+        REQUIRE(group.output()->size() == 0);
+    }
+
+    SECTION("aggregates") {
+        table::operators::operator_hash_aggregate_t group(&resource);
+        group.set_children(boost::intrusive_ptr(new base::operators::operator_raw_data_t(gen_chunk())));
+        group.add_key("name", key("name"));
+        group.add_value("count_", aggregate_type::count, key("count"));
+        group.add_value("sum_", aggregate_type::sum, key("count"));
+        group.add_value("avg_", aggregate_type::avg, key("count"));
+        group.add_value("min_", aggregate_type::min, key("count"));
+        group.add_value("max_", aggregate_type::max, key("count"));
+        group.on_execute(nullptr);
+
+        const auto& chunk = group.output()->data_chunk();
+        REQUIRE(chunk.size() == 10);
+        for (size_t i = 0; i < chunk.size(); i++) {
+            auto number = static_cast<int64_t>(i);
+            REQUIRE(chunk.value(chunk.column_index("name"), i).value<std::string_view>() ==
+                    "Name " + std::to_string(number));
+            REQUIRE(chunk.value(chunk.column_index("count_"), i).value<uint64_t>() == 10);
+            REQUIRE(chunk.value(chunk.column_index("sum_"), i).value<types::int128_t>() ==
+                    5 * (number % 20) + 5 * ((number + 10) % 20));
+            REQUIRE(chunk.value(chunk.column_index("avg_"), i).value<double>() ==
+                    Approx((number % 20 + (number + 10) % 20) / 2.0));
+            REQUIRE(chunk.value(chunk.column_index("min_"), i).value<int64_t>() == number % 20);
+            REQUIRE(chunk.value(chunk.column_index("max_"), i).value<int64_t>() == (number + 10) % 20);
+        }
+    }
+
+    SECTION("key types") {
+        table::operators::operator_hash_aggregate_t group(&resource);
+        group.add_key("name", key("name"));
+        group.add_key("count", key("count"));
+        REQUIRE(group.can_hash(gen_chunk().types()));
+
+        std::pmr::vector<types::complex_logical_type> types(&resource);
+        types.emplace_back(types::logical_type::STRING_LITERAL, "name");
+        types.emplace_back(types::logical_type::HUGEINT, "count");
+        REQUIRE_FALSE(group.can_hash(types));
+        // such keys are grouped by operator_group_t
+        REQUIRE(group.make_group_operator());
+    }
+
+    SECTION("without keys") {
+        table::operators::operator_hash_aggregate_t group(&resource);
+        group.set_children(boost::intrusive_ptr(new base::operators::operator_raw_data_t(gen_chunk())));
+        group.add_value("count_", aggregate_type::count, key("count"));
+        group.add_value("max_", aggregate_type::max, key("count"));
+        group.on_execute(nullptr);
+
+        const auto& chunk = group.output()->data_chunk();
+        REQUIRE(chunk.size() == 1);
+        REQUIRE(chunk.value(0, 0).value<uint64_t>() == 101);
+        REQUIRE(chunk.value(1, 0).value<int64_t>() == 1000);
+    }
+}
@@ -0,0 +1,148 @@
+#include <catch2/catch.hpp>
+
+#include <components/physical_plan/base/operators/operator_raw_data.hpp>
+#include <components/physical_plan/table/operators/operator_hash_join.hpp>
+
+using namespace components;
+using namespace components::expressions;
+using key = components::expressions::key_t;
+
+namespace {
+
+    vector::data_chunk_t gen_left_chunk(std::pmr::memory_resource* resource) {
+        std::pmr::vector<types::complex_logical_type> types(resource);
+        types.emplace_back(types::logical_type::BIGINT, "key_1");
+        types.emplace_back(types::logical_type::BIGINT, "key_2");
+        types.emplace_back(types::logical_type::STRING_LITERAL, "name");
+        vector::data_chunk_t chunk(resource, types, 101);
+        chunk.set_cardinality(101);
+        for (int64_t num = 0, reversed = 100; num < 101; ++num, --reversed) {
+            chunk.set_value(0, static_cast<uint64_t>(num), types::logical_value_t{num});
+            chunk.set_value(1, static_cast<uint64_t>(num), types::logical_value_t{reversed});
+            chunk.set_value(2, static_cast<uint64_t>(num), types::logical_value_t{"Name " + std::to_string(num)});
+        }
+        return chunk;
+    }
+
+    vector::data_chunk_t gen_right_chunk(std::pmr::memory_resource* resource) {
+        std::pmr::vector<types::complex_logical_type> types(resource);
+        types.emplace_back(types::logical_type::BIGINT, "key");
+        types.emplace_back(types::logical_type::BIGINT, "value");
+        vector::data_chunk_t chunk(resource, types, 100);
+        chunk.set_cardinality(100);
+        for (int64_t num = 0; num < 100; ++num) {
+            chunk.set_value(0, static_cast<uint64_t>(num), types::logical_value_t{(num + 25) * 2});
+            chunk.set_value(1, static_cast<uint64_t>(num), types::logical_value_t{(num + 25) * 2 * 10});
+        }
+        return chunk;
+    }
+
+    base::operators::operator_ptr make_hash_join(std::pmr::memory_resource* resource,
+                                                 logical_plan::join_type type,
+                                                 const compare_expression_ptr& expr) {
+        base::operators::operator_ptr join(new table::operators::operator_hash_join_t(nullptr, type, expr));
+        join->set_children(boost::intrusive_ptr(new base::operators::operator_raw_data_t(gen_left_chunk(resource))),
+                           boost::intrusive_ptr(new base::operators::operator_raw_data_t(gen_right_chunk(resource))));
+        return join;
+    }
+
+    size_t count_nulls(const vector::data_chunk_t& chunk, const std::string& column) {
+        size_t result = 0;
+        const auto& validity = chunk.data[chunk.column_index(column)].validity();
+        for (size_t i = 0; i < chunk.size(); i++) {
+            result += !validity.row_is_valid(i);
+        }
+        return result;
+    }
+
+} // namespace
+
+TEST_CASE("operator::join::hash_join") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto expr = make_compare_expression(&resource, compare_type::eq, key("key_1"), key("key"));
+
+    SECTION("equi join detection") {
+        REQUIRE(table::operators::is_equi_join_expression(expr));
+        auto and_expr = make_compare_union_expression(&resource, compare_type::union_and);
+        and_expr->append_child(expr);
+        and_expr->append_child(make_compare_expression(&resource, compare_type::eq, key("key_2"), key("key")));
+        REQUIRE(table::operators::is_equi_join_expression(and_expr));
+        and_expr->append_child(make_compare_expression(&resource, compare_type::gt, key("key_2"), key("key")));
+        REQUIRE_FALSE(table::operators::is_equi_join_expression(and_expr));
+        REQUIRE_FALSE(table::operators::is_equi_join_expression(
+            make_compare_expression(&resource, compare_type::eq, key("key_1"), core::parameter_id_t{1})));
+    }
+
+    SECTION("hash join keys") {
+        auto types_left = gen_left_chunk(&resource).types();
+        auto types_right = gen_right_chunk(&resource).types();
+        auto can_hash_join = [&](const std::string& name_left, const std::string& name_right) {
+            return table::operators::can_hash_join(
+                make_compare_expression(&resource, compare_type::eq, key(name_left), key(name_right)),
+                types_left,
+                types_right);
+        };
+        REQUIRE(can_hash_join("key_1", "key"));
+        REQUIRE(can_hash_join("key", "key_1"));
+        // both keys of one input
+        REQUIRE_FALSE(can_hash_join("key_1", "key_2"));
+        // keys of different types
+        REQUIRE_FALSE(can_hash_join("name", "key"));
+        auto and_expr = make_compare_union_expression(&resource, compare_type::union_and);
+        and_expr->append_child(expr);
+        and_expr->append_child(make_compare_expression(&resource, compare_type::eq, key("key_2"), key("missing")));
+        REQUIRE_FALSE(table::operators::can_hash_join(and_expr, types_left, types_right));
+    }
+
+    SECTION("inner") {
+        auto join = make_hash_join(&resource, logical_plan::join_type::inner, expr);
+        join->on_execute(nullptr);
+        const auto& chunk = join->output()->data_chunk();
+        REQUIRE(chunk.size() == 26);
+        for (size_t i = 0; i < chunk.size(); i++) {
+            auto key_1 = chunk.value(chunk.column_index("key_1"), i).value<int64_t>();
+            REQUIRE(chunk.value(chunk.column_index("key"), i).value<int64_t>() == key_1);
+            REQUIRE(chunk.value(chunk.column_index("value"), i).value<int64_t>() == key_1 * 10);
+            REQUIRE(chunk.value(chunk.column_index("name"), i).value<std::string_view>() ==
+                    "Name " + std::to_string(key_1));
+        }
+    }
+
+    SECTION("left outer") {
+        auto join = make_hash_join(&resource, logical_plan::join_type::left, expr);
+        join->on_execute(nullptr);
+        const auto& chunk = join->output()->data_chunk();
+        REQUIRE(chunk.size() == 101);
+        REQUIRE(count_nulls(chunk, "key") == 75);
+        REQUIRE(count_nulls(chunk, "key_1") == 0);
+    }
+
+    SECTION("right outer") {
+        auto join = make_hash_join(&resource, logical_plan::join_type::right, expr);
+        join->on_execute(nullptr);
+        const auto& chunk = join->output()->data_chunk();
+        REQUIRE(chunk.size() == 100);
+        REQUIRE(count_nulls(chunk, "key_1") == 74);
+        REQUIRE(count_nulls(chunk, "key") == 0);
+    }
+
+    SECTION("full outer") {
+        auto join = make_hash_join(&resource, logical_plan::join_type::full, expr);
+        join->on_execute(nullptr);
+        const auto& chunk = join->output()->data_chunk();
+        REQUIRE(chunk.size() == 175);
+        REQUIRE(count_nulls(chunk, "key_1") == 74);
+        REQUIRE(count_nulls(chunk, "key") == 75);
+    }
+
+    SECTION("two join predicates") {
+        auto and_expr = make_compare_union_expression(&resource, compare_type::union_and);
+        and_expr->append_child(expr);
+        and_expr->append_child(make_compare_expression(&resource, compare_type::eq, key("key_2"), key("key")));
+        auto join = make_hash_join(&resource, logical_plan::join_type::inner, and_expr);
+        join->on_execute(nullptr);
+        const auto& chunk = join->output()->data_chunk();
+        REQUIRE(chunk.size() == 1);
+        REQUIRE(chunk.value(chunk.column_index("key"), 0).value<int64_t>() == 50);
+    }
+}
@@ -180,6 +180,23 @@ TEST_CASE("operator::full_scan") {
             REQUIRE(scan.output()->size() == 1);
         }
     }
+
+    SECTION("projection") {
+        auto cond = make_compare_expression(&resource, compare_type::gt, key("count"), core::parameter_id_t(1));
+        logical_plan::storage_parameters parameters(&resource);
+        add_parameter(parameters, core::parameter_id_t(1), new_value(static_cast<int64_t>(90)));
+        pipeline::context_t pipeline_context(std::move(parameters));
+
+        SECTION("table") {
+            // the filtered column is not projected
+            table::operators::full_scan scan(d(table), cond, logical_plan::limit_t::unlimit(), {"countStr", "unknown"});
+            scan.on_execute(&pipeline_context);
+            REQUIRE(scan.output()->size() == 10);
+            REQUIRE(scan.output()->data_chunk().column_count() == 1);
+            REQUIRE(scan.output()->data_chunk().data[0].type().alias() == "countStr");
+            REQUIRE(scan.output()->data_chunk().value(0, 0).value<std::string_view>() == "91");
+        }
+    }
 }
 
 TEST_CASE("operator::delete") {
@@ -466,6 +483,50 @@ TEST_CASE("operator::update") {
             }
         }
     }
+
+    SECTION("find::update_calculate") {
+        logical_plan::storage_parameters parameters(&resource);
+        add_parameter(parameters, core::parameter_id_t(1), new_value(static_cast<int64_t>(90)));
+        add_parameter(parameters, core::parameter_id_t(2), new_value(static_cast<int64_t>(1000)));
+        add_parameter(parameters, core::parameter_id_t(3), new_value(0.5));
+        add_parameter(parameters, core::parameter_id_t(4), new_value(550.0));
+        pipeline::context_t pipeline_context(std::move(parameters));
+
+        auto cond = make_compare_expression(&resource, compare_type::gt, key("count"), core::parameter_id_t(1));
+        auto cond_count = make_compare_expression(&resource, compare_type::gt, key("count"), core::parameter_id_t(2));
+        auto cond_double =
+            make_compare_expression(&resource, compare_type::eq, key("countDouble"), core::parameter_id_t(4));
+
+        // count = count + 1000, countDouble = count * 0.5 with the new count
+        update_expr_ptr script_update_1 = new update_expr_set_t(expressions::key_t{"count"});
+        script_update_1->left() = new update_expr_calculate_t(update_expr_type::add);
+        script_update_1->left()->left() =
+            new update_expr_get_value_t(expressions::key_t{"count"}, update_expr_get_value_t::side_t::to);
+        script_update_1->left()->right() = new update_expr_get_const_value_t(core::parameter_id_t(2));
+        update_expr_ptr script_update_2 = new update_expr_set_t(expressions::key_t{"countDouble"});
+        script_update_2->left() = new update_expr_calculate_t(update_expr_type::mult);
+        script_update_2->left()->left() =
+            new update_expr_get_value_t(expressions::key_t{"count"}, update_expr_get_value_t::side_t::to);
+        script_update_2->left()->right() = new update_expr_get_const_value_t(core::parameter_id_t(3));
+
+        SECTION("table") {
+            table::operators::operator_update update_(d(table), {script_update_1, script_update_2}, false);
+            update_.set_children(boost::intrusive_ptr(
+                new table::operators::full_scan(d(table), cond, logical_plan::limit_t::unlimit())));
+            update_.on_execute(&pipeline_context);
+            REQUIRE(update_.modified()->size() == 10);
+            {
+                table::operators::full_scan scan(d(table), cond_count, logical_plan::limit_t::unlimit());
+                scan.on_execute(&pipeline_context);
+                REQUIRE(scan.output()->size() == 10);
+            }
+            {
+                table::operators::full_scan scan(d(table), cond_double, logical_plan::limit_t::unlimit());
+                scan.on_execute(&pipeline_context);
+                REQUIRE(scan.output()->size() == 1);
+            }
+        }
+    }
 }
 
 TEST_CASE("operator::index_scan") {
@@ -670,6 +731,18 @@ TEST_CASE("operator::transfer_scan") {
             REQUIRE(scan.output()->size() == 1);
         }
     }
+
+    SECTION("projection") {
+        SECTION("table") {
+            table::operators::transfer_scan scan(d(table), logical_plan::limit_t::unlimit(), {"countDouble", "count"});
+            scan.on_execute(nullptr);
+            REQUIRE(scan.output()->size() == 100);
+            // columns keep the table order
+            REQUIRE(scan.output()->data_chunk().column_count() == 2);
+            REQUIRE(scan.output()->data_chunk().data[0].type().alias() == "count");
+            REQUIRE(scan.output()->data_chunk().data[1].type().alias() == "countDouble");
+        }
+    }
 }
 
 TEST_CASE("operator::index::delete_and_update") {
@@ -0,0 +1,98 @@
+#include <catch2/catch.hpp>
+
+#include <components/physical_plan/base/operators/operator_raw_data.hpp>
+#include <components/physical_plan/table/operators/operator_sort.hpp>
+
+using namespace components;
+
+namespace {
+
+    constexpr size_t kRows = 1000;
+
+    // long names share a prefix longer than the one kept in sort keys
+    std::string gen_name(size_t num) { return "a very long common name prefix " + std::to_string(num % 7); }
+
+    vector::data_chunk_t gen_chunk(std::pmr::memory_resource* resource) {
+        std::pmr::vector<types::complex_logical_type> types(resource);
+        types.emplace_back(types::logical_type::BIGINT, "number");
+        types.emplace_back(types::logical_type::DOUBLE, "value");
+        types.emplace_back(types::logical_type::STRING_LITERAL, "name");
+        vector::data_chunk_t chunk(resource, types, kRows);
+        chunk.set_cardinality(kRows);
+        for (size_t num = 0; num < kRows; ++num) {
+            auto number = static_cast<int64_t>((num * 7919) % kRows) - 500;
+            chunk.set_value(0, num, types::logical_value_t{number});
+            chunk.set_value(1, num, types::logical_value_t{static_cast<double>(number % 10) / 4});
+            chunk.set_value(2, num, types::logical_value_t{gen_name(num)});
+        }
+        chunk.data[1].validity().set_invalid(0);
+        return chunk;
+    }
+
+    boost::intrusive_ptr<table::operators::operator_sort_t>
+    make_sort(std::pmr::memory_resource* resource,
+              logical_plan::limit_t limit = logical_plan::limit_t::unlimit()) {
+        auto sort = boost::intrusive_ptr(new table::operators::operator_sort_t(nullptr, limit));
+        sort->set_children(boost::intrusive_ptr(new base::operators::operator_raw_data_t(gen_chunk(resource))));
+        return sort;
+    }
+
+} // namespace
+
+TEST_CASE("operator::sort") {
+    using order = table::operators::operator_sort_t::order;
+    auto resource = std::pmr::synchronized_pool_resource();
+
+    SECTION("single column") {
+        auto sort = make_sort(&resource);
+        sort->add("number", order::ascending);
+        sort->on_execute(nullptr);
+        const auto& chunk = sort->output()->data_chunk();
+        REQUIRE(chunk.size() == kRows);
+        for (size_t i = 0; i < chunk.size(); i++) {
+            REQUIRE(chunk.value(0, i).value<int64_t>() == static_cast<int64_t>(i) - 500);
+        }
+    }
+
+    SECTION("descending with nulls") {
+        auto sort = make_sort(&resource);
+        sort->add(1, order::descending);
+        sort->on_execute(nullptr);
+        const auto& chunk = sort->output()->data_chunk();
+        REQUIRE(chunk.size() == kRows);
+        REQUIRE_FALSE(chunk.data[1].validity().row_is_valid(0));
+        for (size_t i = 2; i < chunk.size(); i++) {
+            REQUIRE(chunk.value(1, i - 1).value<double>() >= chunk.value(1, i).value<double>());
+        }
+        REQUIRE(chunk.value(1, kRows - 1).value<double>() == -2.25);
+    }
+
+    SECTION("multiple columns") {
+        auto sort = make_sort(&resource);
+        sort->add("name", order::ascending);
+        sort->add("number", order::descending);
+        sort->on_execute(nullptr);
+        const auto& chunk = sort->output()->data_chunk();
+        REQUIRE(chunk.size() == kRows);
+        for (size_t i = 1; i < chunk.size(); i++) {
+            auto prev_name = std::string(chunk.value(2, i - 1).value<std::string_view>());
+            auto name = std::string(chunk.value(2, i).value<std::string_view>());
+            REQUIRE(prev_name <= name);
+            if (prev_name == name) {
+                REQUIRE(chunk.value(0, i - 1).value<int64_t>() > chunk.value(0, i).value<int64_t>());
+            }
+        }
+        REQUIRE(chunk.value(2, 0).value<std::string_view>() == gen_name(0));
+    }
+
+    SECTION("top-n") {
+        auto sort = make_sort(&resource, logical_plan::limit_t(10));
+        sort->add({0}, order::descending);
+        sort->on_execute(nullptr);
+        const auto& chunk = sort->output()->data_chunk();
+        REQUIRE(chunk.size() == 10);
+        for (size_t i = 0; i < chunk.size(); i++) {
+            REQUIRE(chunk.value(0, i).value<int64_t>() == 499 - static_cast<int64_t>(i));
+        }
+    }
+}
@@ -16,12 +16,14 @@ namespace services::collection::planner {
 
     using components::logical_plan::node_type;
 
-    components::base::operators::operator_ptr create_plan(const context_storage_t& context,
-                                                          const components::logical_plan::node_ptr& node,
-                                                          components::logical_plan::limit_t limit) {
+    components::base::operators::operator_ptr
+    create_plan(const context_storage_t& context,
+                const components::logical_plan::node_ptr& node,
+                components::logical_plan::limit_t limit,
+                const components::logical_plan::storage_parameters* parameters) {
         switch (node->type()) {
             case node_type::aggregate_t:
-                return impl::create_plan_aggregate(context, node, std::move(limit));
+                return impl::create_plan_aggregate(context, node, std::move(limit), parameters);
             case node_type::data_t:
                 return impl::create_plan_data(node);
             case node_type::delete_t:
@@ -29,7 +31,7 @@ namespace services::collection::planner {
             case node_type::insert_t:
                 return impl::create_plan_insert(context, node, std::move(limit));
             case node_type::match_t:
-                return impl::create_plan_match(context, node, std::move(limit));
+                return impl::create_plan_match(context, node, std::move(limit), parameters);
             case node_type::group_t:
                 return impl::create_plan_group(context, node);
             case node_type::sort_t:
@@ -37,7 +39,7 @@ namespace services::collection::planner {
             case node_type::update_t:
                 return impl::create_plan_update(context, node);
             case node_type::join_t:
-                return impl::create_plan_join(context, node, std::move(limit));
+                return impl::create_plan_join(context, node, std::move(limit), parameters);
             case node_type::create_index_t:
                 return impl::create_plan_add_index(context, node);
             case node_type::drop_index_t:
@@ -54,12 +56,14 @@ namespace services::table::planner {
 
     using components::logical_plan::node_type;
 
-    components::base::operators::operator_ptr create_plan(const context_storage_t& context,
-                                                          const components::logical_plan::node_ptr& node,
-                                                          components::logical_plan::limit_t limit) {
+    components::base::operators::operator_ptr
+    create_plan(const context_storage_t& context,
+                const components::logical_plan::node_ptr& node,
+                components::logical_plan::limit_t limit,
+                const components::logical_plan::storage_parameters* parameters) {
         switch (node->type()) {
             case node_type::aggregate_t:
-                return impl::create_plan_aggregate(context, node, std::move(limit));
+                return impl::create_plan_aggregate(context, node, std::move(limit), parameters);
             case node_type::data_t:
                 return impl::create_plan_data(node);
             case node_type::delete_t:
@@ -67,15 +71,15 @@ namespace services::table::planner {
             case node_type::insert_t:
                 return impl::create_plan_insert(context, node, std::move(limit));
             case node_type::match_t:
-                return impl::create_plan_match(context, node, std::move(limit));
+                return impl::create_plan_match(context, node, std::move(limit), parameters);
             case node_type::group_t:
                 return impl::create_plan_group(context, node);
             case node_type::sort_t:
-                return impl::create_plan_sort(context, node);
+                return impl::create_plan_sort(context, node, std::move(limit));
             case node_type::update_t:
                 return impl::create_plan_update(context, node);
             case node_type::join_t:
-                return impl::create_plan_join(context, node, std::move(limit));
+                return impl::create_plan_join(context, node, std::move(limit), parameters);
             case node_type::create_index_t:
                 return impl::create_plan_add_index(context, node);
             case node_type::drop_index_t:
@@ -1,8 +1,16 @@
 #include "create_plan_aggregate.hpp"
+#include "create_plan_group.hpp"
+#include "create_plan_match.hpp"
 
 #include <components/physical_plan/collection/operators/aggregation.hpp>
 #include <components/physical_plan/table/operators/aggregation.hpp>
+#include <components/physical_plan/table/operators/scan/transfer_scan.hpp>
 #include <components/physical_plan_generator/create_plan.hpp>
+#include <components/planner/planner.hpp>
+#include <services/collection/collection.hpp>
+
+#include <algorithm>
+#include <optional>
 
 namespace services::collection::planner::impl {
 
@@ -11,22 +19,23 @@ namespace services::collection::planner::impl {
     components::collection::operators::operator_ptr
     create_plan_aggregate(const context_storage_t& context,
                           const components::logical_plan::node_ptr& node,
-                          components::logical_plan::limit_t limit) {
+                          components::logical_plan::limit_t limit,
+                          const components::logical_plan::storage_parameters* parameters) {
         auto op = boost::intrusive_ptr(
             new components::collection::operators::aggregation(context.at(node->collection_full_name())));
         for (const components::logical_plan::node_ptr& child : node->children()) {
             switch (child->type()) {
                 case node_type::match_t:
-                    op->set_match(create_plan(context, child, limit));
+                    op->set_match(create_plan(context, child, limit, parameters));
                     break;
                 case node_type::group_t:
-                    op->set_group(create_plan(context, child, limit));
+                    op->set_group(create_plan(context, child, limit, parameters));
                     break;
                 case node_type::sort_t:
-                    op->set_sort(create_plan(context, child, limit));
+                    op->set_sort(create_plan(context, child, limit, parameters));
                     break;
                 default:
-                    op->set_children(create_plan(context, child, limit));
+                    op->set_children(create_plan(context, child, limit, parameters));
                     break;
             }
         }
@@ -39,24 +48,86 @@ namespace services::table::planner::impl {
 
     using components::logical_plan::node_type;
 
-    components::base::operators::operator_ptr create_plan_aggregate(const context_storage_t& context,
-                                                                    const components::logical_plan::node_ptr& node,
-                                                                    components::logical_plan::limit_t limit) {
-        auto op = boost::intrusive_ptr(
-            new components::table::operators::aggregation(context.at(node->collection_full_name())));
+    namespace {
+
+        // columns of the table read by the aggregate, empty if every column is needed
+        std::vector<std::string> required_columns(collection::context_collection_t* context,
+                                                  const components::logical_plan::node_ptr& node) {
+            auto fields = components::planner::required_fields(node);
+            if (!context || !fields) {
+                return {};
+            }
+            const auto& definitions = context->table_storage().table().columns();
+            std::vector<std::string> columns;
+            for (const auto& field : *fields) {
+                if (std::any_of(definitions.begin(), definitions.end(), [&field](const auto& definition) {
+                        return definition.name() == field;
+                    })) {
+                    columns.push_back(field);
+                }
+            }
+            // rows are still counted (e.g. by count), so one column is read even if no value is used
+            if (columns.empty() && !definitions.empty()) {
+                columns.push_back(definitions.front().name());
+            }
+            return columns;
+        }
+
+    } // namespace
+
+    components::base::operators::operator_ptr
+    create_plan_aggregate(const context_storage_t& context,
+                          const components::logical_plan::node_ptr& node,
+                          components::logical_plan::limit_t limit,
+                          const components::logical_plan::storage_parameters* parameters) {
+        auto* collection_context = context.at(node->collection_full_name());
+        auto op = boost::intrusive_ptr(new components::table::operators::aggregation(collection_context));
+        // with a sort the limit applies to its output (top-N), rows before it can not be cut
+        const bool has_sort = std::any_of(node->children().begin(),
+                                          node->children().end(),
+                                          [](const components::logical_plan::node_ptr& child) {
+                                              return child->type() == node_type::sort_t;
+                                          });
+        auto input_limit = has_sort ? components::logical_plan::limit_t::unlimit() : limit;
+        // columns which are not used above the scan are neither read nor materialized
+        auto columns = required_columns(collection_context, node);
+        const bool has_input = std::any_of(node->children().begin(),
+                                           node->children().end(),
+                                           [](const components::logical_plan::node_ptr& child) {
+                                               return child->type() != node_type::group_t &&
+                                                      child->type() != node_type::sort_t;
+                                           });
+        if (!has_input && !columns.empty()) {
+            op->set_match(boost::intrusive_ptr(new components::table::operators::transfer_scan(
+                collection_context,
+                components::logical_plan::limit_t::unlimit(),
+                columns)));
+        }
+        // the group reads table columns, possibly filtered by a match, unless another input (e.g. a join) is planned
+        const bool reads_table = std::all_of(node->children().begin(),
+                                             node->children().end(),
+                                             [](const components::logical_plan::node_ptr& child) {
+                                                 return child->type() == node_type::match_t ||
+                                                        child->type() == node_type::group_t ||
+                                                        child->type() == node_type::sort_t;
+                                             });
+        std::optional<std::pmr::vector<components::types::complex_logical_type>> input_types;
+        if (reads_table && collection_context && collection_context->uses_datatable()) {
+            input_types = collection_context->table_storage().table().copy_types();
+        }
         for (const components::logical_plan::node_ptr& child : node->children()) {
             switch (child->type()) {
                 case node_type::match_t:
-                    op->set_match(create_plan(context, child, limit));
+                    op->set_match(create_plan_match(context, child, input_limit, parameters, columns));
                     break;
                 case node_type::group_t:
-                    op->set_group(create_plan(context, child, limit));
+                    op->set_group(create_plan_group(context, child, input_types ? &*input_types : nullptr));
                     break;
                 case node_type::sort_t:
-                    op->set_sort(create_plan(context, child, limit));
+                    op->set_sort(create_plan(context, child, limit, parameters));
                     break;
                 default:
-                    op->set_children(create_plan(context, child, limit));
+                    op->set_children(create_plan(context, child, input_limit, parameters));
                     break;
             }
         }
@@ -2,6 +2,7 @@
 
 #include <components/logical_plan/node.hpp>
 #include <components/logical_plan/node_limit.hpp>
+#include <components/logical_plan/param_storage.hpp>
 #include <components/physical_plan/base/operators/operator.hpp>
 #include <services/memory_storage/context_storage.hpp>
 
@@ -10,14 +11,17 @@ namespace services::collection::planner::impl {
     components::collection::operators::operator_ptr
     create_plan_aggregate(const context_storage_t& context,
                           const components::logical_plan::node_ptr& node,
-                          components::logical_plan::limit_t limit);
+                          components::logical_plan::limit_t limit,
+                          const components::logical_plan::storage_parameters* parameters = nullptr);
 
 }
 
 namespace services::table::planner::impl {
 
-    components::base::operators::operator_ptr create_plan_aggregate(const context_storage_t& context,
-                                                                    const components::logical_plan::node_ptr& node,
-                                                                    components::logical_plan::limit_t limit);
+    components::base::operators::operator_ptr
+    create_plan_aggregate(const context_storage_t& context,
+                          const components::logical_plan::node_ptr& node,
+                          components::logical_plan::limit_t limit,
+                          const components::logical_plan::storage_parameters* parameters = nullptr);
 
 }
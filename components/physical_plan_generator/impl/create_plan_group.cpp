@@ -11,13 +11,7 @@
 #include <components/physical_plan/collection/operators/get/simple_value.hpp>
 #include <components/physical_plan/collection/operators/operator_group.hpp>
 
-#include <components/physical_plan/table/operators/aggregate/operator_avg.hpp>
-#include <components/physical_plan/table/operators/aggregate/operator_count.hpp>
-#include <components/physical_plan/table/operators/aggregate/operator_max.hpp>
-#include <components/physical_plan/table/operators/aggregate/operator_min.hpp>
-#include <components/physical_plan/table/operators/aggregate/operator_sum.hpp>
-#include <components/physical_plan/table/operators/get/simple_value.hpp>
-#include <components/physical_plan/table/operators/operator_group.hpp>
+#include <components/physical_plan/table/operators/operator_hash_aggregate.hpp>
 
 namespace services::collection::planner::impl {
 
@@ -138,7 +132,7 @@ namespace services::table::planner::impl {
 
     namespace {
 
-        void add_group_scalar(boost::intrusive_ptr<components::table::operators::operator_group_t>& group,
+        void add_group_scalar(boost::intrusive_ptr<components::table::operators::operator_hash_aggregate_t>& group,
                               const components::expressions::scalar_expression_t* expr) {
             using components::expressions::scalar_type;
 
@@ -147,8 +141,7 @@ namespace services::table::planner::impl {
                     auto field = expr->params().empty()
                                      ? expr->key()
                                      : std::get<components::expressions::key_t>(expr->params().front());
-                    group->add_key(expr->key().as_string(),
-                                   components::table::operators::get::simple_value_t::create(field));
+                    group->add_key(expr->key().as_string(), field);
                     break;
                 }
                 default:
@@ -157,56 +150,24 @@ namespace services::table::planner::impl {
             }
         }
 
-        void add_group_aggregate(collection::context_collection_t* context,
-                                 boost::intrusive_ptr<components::table::operators::operator_group_t>& group,
+        void add_group_aggregate(boost::intrusive_ptr<components::table::operators::operator_hash_aggregate_t>& group,
                                  const components::expressions::aggregate_expression_t* expr) {
             using components::expressions::aggregate_type;
 
             switch (expr->type()) {
                 case aggregate_type::count: {
-                    group->add_value(
-                        expr->key().as_string(),
-                        boost::intrusive_ptr(new components::table::operators::aggregate::operator_count_t(context)));
-                    break;
-                }
-                case aggregate_type::sum: {
-                    assert(std::holds_alternative<components::expressions::key_t>(expr->params().front()) &&
-                           "[add_group_aggregate] aggregate_type::sum:  variant intermediate_store_ holds the "
-                           "alternative components::expressions::key_t");
-                    auto field = std::get<components::expressions::key_t>(expr->params().front());
-                    group->add_value(expr->key().as_string(),
-                                     boost::intrusive_ptr(
-                                         new components::table::operators::aggregate::operator_sum_t(context, field)));
-                    break;
-                }
-                case aggregate_type::avg: {
-                    assert(std::holds_alternative<components::expressions::key_t>(expr->params().front()) &&
-                           "[add_group_aggregate] aggregate_type::avg:  variant intermediate_store_ holds the "
-                           "alternative components::expressions::key_t");
-                    auto field = std::get<components::expressions::key_t>(expr->params().front());
-                    group->add_value(expr->key().as_string(),
-                                     boost::intrusive_ptr(
-                                         new components::table::operators::aggregate::operator_avg_t(context, field)));
-                    break;
-                }
-                case aggregate_type::min: {
-                    assert(std::holds_alternative<components::expressions::key_t>(expr->params().front()) &&
-                           "[add_group_aggregate] aggregate_type::min:  variant intermediate_store_ holds the "
-                           "alternative components::expressions::key_t");
-                    auto field = std::get<components::expressions::key_t>(expr->params().front());
-                    group->add_value(expr->key().as_string(),
-                                     boost::intrusive_ptr(
-                                         new components::table::operators::aggregate::operator_min_t(context, field)));
+                    group->add_value(expr->key().as_string(), expr->type(), {});
                     break;
                 }
+                case aggregate_type::sum:
+                case aggregate_type::avg:
+                case aggregate_type::min:
                 case aggregate_type::max: {
                     assert(std::holds_alternative<components::expressions::key_t>(expr->params().front()) &&
-                           "[add_group_aggregate] aggregate_type::max:  variant intermediate_store_ holds the "
+                           "[add_group_aggregate] variant intermediate_store_ holds the "
                            "alternative components::expressions::key_t");
                     auto field = std::get<components::expressions::key_t>(expr->params().front());
-                    group->add_value(expr->key().as_string(),
-                                     boost::intrusive_ptr(
-                                         new components::table::operators::aggregate::operator_max_t(context, field)));
+                    group->add_value(expr->key().as_string(), expr->type(), field);
                     break;
                 }
                 default:
@@ -217,14 +178,16 @@ namespace services::table::planner::impl {
 
     } // namespace
 
-    components::base::operators::operator_ptr create_plan_group(const context_storage_t& context,
-                                                                const components::logical_plan::node_ptr& node) {
-        boost::intrusive_ptr<components::table::operators::operator_group_t> group;
+    components::base::operators::operator_ptr
+    create_plan_group(const context_storage_t& context,
+                      const components::logical_plan::node_ptr& node,
+                      const std::pmr::vector<components::types::complex_logical_type>* input_types) {
+        boost::intrusive_ptr<components::table::operators::operator_hash_aggregate_t> group;
         auto collection_context = context.at(node->collection_full_name());
         if (collection_context) {
-            group = new components::table::operators::operator_group_t(collection_context);
+            group = new components::table::operators::operator_hash_aggregate_t(collection_context);
         } else {
-            group = new components::table::operators::operator_group_t(node->resource());
+            group = new components::table::operators::operator_hash_aggregate_t(node->resource());
         }
         std::for_each(node->expressions().begin(),
                       node->expressions().end(),
@@ -235,11 +198,13 @@ namespace services::table::planner::impl {
                                   static_cast<const components::expressions::scalar_expression_t*>(expr.get()));
                           } else if (expr->group() == components::expressions::expression_group::aggregate) {
                               add_group_aggregate(
-                                  context.at(node->collection_full_name()),
                                   group,
                                   static_cast<const components::expressions::aggregate_expression_t*>(expr.get()));
                           }
                       });
+        if (input_types && !group->can_hash(*input_types)) {
+            return group->make_group_operator();
+        }
         return group;
     }
 
@@ -13,7 +13,11 @@ namespace services::collection::planner::impl {
 
 namespace services::table::planner::impl {
 
-    components::base::operators::operator_ptr create_plan_group(const context_storage_t& context,
-                                                                const components::logical_plan::node_ptr& node);
+    // `input_types` are the columns read by the group when they are known while planning,
+    // keys the hash aggregate can not compare are grouped by operator_group_t instead
+    components::base::operators::operator_ptr
+    create_plan_group(const context_storage_t& context,
+                      const components::logical_plan::node_ptr& node,
+                      const std::pmr::vector<components::types::complex_logical_type>* input_types = nullptr);
 
 }
@@ -1,16 +1,21 @@
 #include "create_plan_join.hpp"
 
 #include <components/expressions/compare_expression.hpp>
+#include <components/logical_plan/node_data.hpp>
 #include <components/logical_plan/node_join.hpp>
 #include <components/physical_plan/collection/operators/operator_join.hpp>
+#include <components/physical_plan/table/operators/operator_hash_join.hpp>
 #include <components/physical_plan/table/operators/operator_join.hpp>
 #include <components/physical_plan_generator/create_plan.hpp>
+#include <services/collection/collection.hpp>
 
 namespace services::collection::planner::impl {
 
-    components::collection::operators::operator_ptr create_plan_join(const context_storage_t& context,
-                                                                     const components::logical_plan::node_ptr& node,
-                                                                     components::logical_plan::limit_t limit) {
+    components::collection::operators::operator_ptr
+    create_plan_join(const context_storage_t& context,
+                     const components::logical_plan::node_ptr& node,
+                     components::logical_plan::limit_t limit,
+                     const components::logical_plan::storage_parameters* parameters) {
         const auto* join_node = static_cast<const components::logical_plan::node_join_t*>(node.get());
         // assign left collection as actor for join
         auto expr = reinterpret_cast<const components::expressions::compare_expression_ptr*>(&node->expressions()[0]);
@@ -22,10 +27,10 @@ namespace services::collection::planner::impl {
         components::collection::operators::operator_ptr left;
         components::collection::operators::operator_ptr right;
         if (node->children().front()) {
-            left = create_plan(context, node->children().front(), limit);
+            left = create_plan(context, node->children().front(), limit, parameters);
         }
         if (node->children().back()) {
-            right = create_plan(context, node->children().back(), limit);
+            right = create_plan(context, node->children().back(), limit, parameters);
         }
         join->set_children(std::move(left), std::move(right));
         return join;
@@ -35,22 +40,98 @@ namespace services::collection::planner::impl {
 
 namespace services::table::planner::impl {
 
-    components::base::operators::operator_ptr create_plan_join(const context_storage_t& context,
-                                                               const components::logical_plan::node_ptr& node,
-                                                               components::logical_plan::limit_t limit) {
+    using components::logical_plan::node_type;
+
+    namespace {
+
+        // schema of the rows a join input produces, false if it is not known while planning
+        bool output_types(const context_storage_t& context,
+                          const components::logical_plan::node_ptr& node,
+                          std::pmr::vector<components::types::complex_logical_type>& types) {
+            switch (node->type()) {
+                case node_type::join_t: {
+                    std::pmr::vector<components::types::complex_logical_type> right(types.get_allocator());
+                    if (node->children().size() != 2 || !output_types(context, node->children().front(), types) ||
+                        !output_types(context, node->children().back(), right)) {
+                        return false;
+                    }
+                    for (const auto& type : right) {
+                        if (std::none_of(types.begin(), types.end(), [&type](const auto& lhs) {
+                                return lhs.alias() == type.alias();
+                            })) {
+                            types.push_back(type);
+                        }
+                    }
+                    return true;
+                }
+                case node_type::aggregate_t: {
+                    // a group projects its own columns
+                    if (std::any_of(node->children().begin(), node->children().end(), [](const auto& child) {
+                            return child->type() != node_type::match_t && child->type() != node_type::sort_t;
+                        })) {
+                        return false;
+                    }
+                    auto it = context.find(node->collection_full_name());
+                    if (it == context.end() || !it->second || !it->second->uses_datatable()) {
+                        return false;
+                    }
+                    types = it->second->table_storage().table().copy_types();
+                    return true;
+                }
+                case node_type::data_t: {
+                    const auto* data = static_cast<const components::logical_plan::node_data_t*>(node.get());
+                    if (!data->uses_data_chunk()) {
+                        return false;
+                    }
+                    types = data->data_chunk().types();
+                    return true;
+                }
+                default:
+                    return false;
+            }
+        }
+
+        // hash join only if both key columns are known to exist with the same type, otherwise nested loop join
+        bool use_hash_join(const context_storage_t& context,
+                           const components::logical_plan::node_join_t* join_node,
+                           const components::expressions::compare_expression_ptr& expr) {
+            if (join_node->type() == components::logical_plan::join_type::cross ||
+                !components::table::operators::is_equi_join_expression(expr) || join_node->children().size() != 2) {
+                return false;
+            }
+            std::pmr::vector<components::types::complex_logical_type> left(std::pmr::get_default_resource());
+            std::pmr::vector<components::types::complex_logical_type> right(std::pmr::get_default_resource());
+            return output_types(context, join_node->children().front(), left) &&
+                   output_types(context, join_node->children().back(), right) &&
+                   components::table::operators::can_hash_join(expr, left, right);
+        }
+
+    } // namespace
+
+    components::base::operators::operator_ptr
+    create_plan_join(const context_storage_t& context,
+                     const components::logical_plan::node_ptr& node,
+                     components::logical_plan::limit_t limit,
+                     const components::logical_plan::storage_parameters* parameters) {
         const auto* join_node = static_cast<const components::logical_plan::node_join_t*>(node.get());
         // assign left table as actor for join
         auto expr = reinterpret_cast<const components::expressions::compare_expression_ptr*>(&node->expressions()[0]);
         auto collection_context = context.at(node->children().front()->collection_full_name());
-        auto join = boost::intrusive_ptr(
-            new components::table::operators::operator_join_t(collection_context, join_node->type(), *expr));
+        components::base::operators::operator_ptr join;
+        if (use_hash_join(context, join_node, *expr)) {
+            join = boost::intrusive_ptr(
+                new components::table::operators::operator_hash_join_t(collection_context, join_node->type(), *expr));
+        } else {
+            join = boost::intrusive_ptr(
+                new components::table::operators::operator_join_t(collection_context, join_node->type(), *expr));
+        }
         components::base::operators::operator_ptr left;
         components::base::operators::operator_ptr right;
         if (node->children().front()) {
-            left = create_plan(context, node->children().front(), limit);
+            left = create_plan(context, node->children().front(), limit, parameters);
         }
         if (node->children().back()) {
-            right = create_plan(context, node->children().back(), limit);
+            right = create_plan(context, node->children().back(), limit, parameters);
         }
         join->set_children(std::move(left), std::move(right));
         return join;
@@ -1,18 +1,110 @@
 #include "create_plan_match.hpp"
+
+#include <algorithm>
+
 #include <components/expressions/compare_expression.hpp>
 #include <components/index/index_engine.hpp>
 #include <components/physical_plan/collection/operators/merge/operator_merge.hpp>
 #include <components/physical_plan/collection/operators/operator_match.hpp>
+#include <components/physical_plan/collection/operators/scan/composite_index_scan.hpp>
 #include <components/physical_plan/collection/operators/scan/full_scan.hpp>
 #include <components/physical_plan/collection/operators/scan/index_scan.hpp>
+#include <components/physical_plan/collection/operators/scan/primary_key_scan.hpp>
 #include <components/physical_plan/collection/operators/scan/transfer_scan.hpp>
 #include <components/physical_plan/table/operators/operator_match.hpp>
+#include <components/physical_plan/table/operators/scan/composite_index_scan.hpp>
 #include <components/physical_plan/table/operators/scan/full_scan.hpp>
 #include <components/physical_plan/table/operators/scan/index_scan.hpp>
 #include <components/physical_plan/table/operators/scan/transfer_scan.hpp>
 
 #include <services/collection/collection.hpp>
 
+namespace {
+
+    using components::expressions::compare_expression_ptr;
+    using components::expressions::compare_type;
+    using components::logical_plan::storage_parameters;
+
+    // an index scan pays a lookup per found entry, a full scan reads documents sequentially:
+    // the index is used while it finds at most this share of the collection
+    constexpr double max_index_scan_selectivity = 0.3;
+    // selectivities of comparisons which values are unknown when the plan is built
+    constexpr double default_equal_selectivity = 0.05;
+    constexpr double default_range_selectivity = 0.3;
+    // a disk index answers asynchronously, a small collection is scanned faster than the round trip
+    constexpr std::size_t min_disk_index_scan_size = 64;
+
+    std::size_t max_index_scan_count(std::size_t size) {
+        return static_cast<std::size_t>(static_cast<double>(size) * max_index_scan_selectivity);
+    }
+
+    bool has_parameter(const storage_parameters* parameters, const compare_expression_ptr& expr) {
+        return parameters && expr->key_right().is_null() &&
+               parameters->parameters.find(expr->value()) != parameters->parameters.end();
+    }
+
+    double default_selectivity(compare_type compare) {
+        switch (compare) {
+            case compare_type::eq:
+                return default_equal_selectivity;
+            case compare_type::ne:
+                return 1.0 - default_equal_selectivity;
+            default:
+                return default_range_selectivity;
+        }
+    }
+
+    // counting stops as soon as the entries are more than max_count
+    std::size_t count_entries(const std::vector<components::index::index_t::range>& ranges, std::size_t max_count) {
+        std::size_t count = 0;
+        for (const auto& range : ranges) {
+            for (auto it = range.first; it != range.second && count <= max_count; ++it) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    // whether reading "key <compare> value" from the index is cheaper than checking every one of size records
+    bool is_index_scan_cheaper(components::index::index_t* index,
+                               const compare_expression_ptr& expr,
+                               const storage_parameters* parameters,
+                               std::size_t size) {
+        if (index->is_disk()) {
+            return size >= min_disk_index_scan_size &&
+                   default_selectivity(expr->type()) <= max_index_scan_selectivity;
+        }
+        if (has_parameter(parameters, expr)) {
+            auto max_count = max_index_scan_count(size);
+            auto value = parameters->parameters.at(expr->value()).as_logical_value();
+            return count_entries(components::index::search_range(index, expr->type(), value), max_count) <= max_count;
+        }
+        return default_selectivity(expr->type()) <= max_index_scan_selectivity;
+    }
+
+    bool is_index_scan_cheaper(const components::index::index_match_t& match,
+                               const storage_parameters* parameters,
+                               std::size_t size) {
+        if (match.index->is_disk()) {
+            return size >= min_disk_index_scan_size;
+        }
+        bool has_values = std::all_of(match.equals.begin(),
+                                      match.equals.end(),
+                                      [parameters](const compare_expression_ptr& term) {
+                                          return has_parameter(parameters, term);
+                                      }) &&
+                          (!match.lower || has_parameter(parameters, match.lower)) &&
+                          (!match.upper || has_parameter(parameters, match.upper));
+        if (has_values) {
+            auto max_count = max_index_scan_count(size);
+            return count_entries({components::index::search_range(match, parameters)}, max_count) <= max_count;
+        }
+        // an equality on the key prefix or a bounded key is selective enough
+        return true;
+    }
+
+} // namespace
+
 namespace services::collection::planner::impl {
 
     bool is_can_index_find_by_predicate(components::expressions::compare_type compare) {
@@ -26,17 +118,52 @@ namespace services::collection::planner::impl {
         return compare == compare_type::eq;
     }
 
+    bool is_primary_key_lookup(const components::expressions::compare_expression_ptr& expr,
+                               const components::logical_plan::storage_parameters* parameters) {
+        if (!is_can_primary_key_find_by_predicate(expr->type()) || !expr->key_left().is_string() ||
+            expr->key_left().as_string() != "_id" || !has_parameter(parameters, expr)) {
+            return false;
+        }
+        return parameters->parameters.at(expr->value()).is_string();
+    }
+
     components::collection::operators::operator_ptr
     create_plan_match_(context_collection_t* context_,
                        const components::expressions::compare_expression_ptr& expr,
-                       components::logical_plan::limit_t limit) {
-        //if (is_can_primary_key_find_by_predicate(expr->type()) && expr->key().as_string() == "_id") {
-        //return boost::intrusive_ptr(new components::collection::operators::primary_key_scan(context_));
-        //}
+                       components::logical_plan::limit_t limit,
+                       const components::logical_plan::storage_parameters* parameters) {
         if (context_) {
-            if (is_can_index_find_by_predicate(expr->type()) &&
-                components::index::search_index(context_->index_engine(), {expr->key_left()})) {
-                return boost::intrusive_ptr(new components::collection::operators::index_scan(context_, expr, limit));
+            if (is_primary_key_lookup(expr, parameters)) {
+                return boost::intrusive_ptr(
+                    new components::collection::operators::primary_key_scan(context_, expr, limit));
+            }
+            const auto size = context_->document_storage().size();
+            if (is_can_index_find_by_predicate(expr->type())) {
+                auto* index =
+                    components::index::search_index(context_->index_engine(), {expr->key_left()}, expr->type());
+                if (index && is_index_scan_cheaper(index, expr, parameters, size)) {
+                    return boost::intrusive_ptr(
+                        new components::collection::operators::index_scan(context_, expr, limit));
+                }
+            }
+            if (expr->type() == components::expressions::compare_type::union_and) {
+                auto match = components::index::search_index(context_->index_engine(), expr);
+                if (match.index && is_index_scan_cheaper(match, parameters, size)) {
+                    if (match.is_exact) {
+                        return boost::intrusive_ptr(
+                            new components::collection::operators::composite_index_scan(context_, match, limit));
+                    }
+                    // terms not covered by the index are checked on the found documents
+                    boost::intrusive_ptr scan(new components::collection::operators::composite_index_scan(
+                        context_,
+                        match,
+                        components::logical_plan::limit_t::unlimit()));
+                    auto predicate = components::collection::operators::predicates::create_predicate(expr);
+                    boost::intrusive_ptr filter(
+                        new components::collection::operators::operator_match_t(context_, std::move(predicate), limit));
+                    filter->set_children(std::move(scan));
+                    return filter;
+                }
             }
             auto predicate = components::collection::operators::predicates::create_predicate(expr);
             return boost::intrusive_ptr(
@@ -48,16 +175,18 @@ namespace services::collection::planner::impl {
         }
     }
 
-    components::collection::operators::operator_ptr create_plan_match(const context_storage_t& context,
-                                                                      const components::logical_plan::node_ptr& node,
-                                                                      components::logical_plan::limit_t limit) {
+    components::collection::operators::operator_ptr
+    create_plan_match(const context_storage_t& context,
+                      const components::logical_plan::node_ptr& node,
+                      components::logical_plan::limit_t limit,
+                      const components::logical_plan::storage_parameters* parameters) {
         if (node->expressions().empty()) {
             return boost::intrusive_ptr(
                 new components::collection::operators::transfer_scan(context.at(node->collection_full_name()), limit));
         } else { //todo: other kinds scan
             auto expr =
                 reinterpret_cast<const components::expressions::compare_expression_ptr*>(&node->expressions()[0]);
-            return create_plan_match_(context.at(node->collection_full_name()), *expr, limit);
+            return create_plan_match_(context.at(node->collection_full_name()), *expr, limit, parameters);
         }
     }
 
@@ -79,31 +208,52 @@ namespace services::table::planner::impl {
     components::base::operators::operator_ptr
     create_plan_match_(collection::context_collection_t* context_,
                        const components::expressions::compare_expression_ptr& expr,
-                       components::logical_plan::limit_t limit) {
+                       components::logical_plan::limit_t limit,
+                       const components::logical_plan::storage_parameters* parameters,
+                       const std::vector<std::string>& columns) {
         //if (is_can_primary_key_find_by_predicate(expr->type()) && expr->key().as_string() == "_id") {
         //return boost::intrusive_ptr(new components::table::operators::primary_key_scan(context_));
         //}
         if (context_) {
-            if (is_can_index_find_by_predicate(expr->type()) &&
-                components::index::search_index(context_->index_engine(), {expr->key_left()})) {
-                return boost::intrusive_ptr(new components::table::operators::index_scan(context_, expr, limit));
+            // deleted rows are counted too, the estimate only needs the order of magnitude
+            const auto size = context_->table_storage().table().row_group()->total_rows();
+            if (is_can_index_find_by_predicate(expr->type())) {
+                auto* index =
+                    components::index::search_index(context_->index_engine(), {expr->key_left()}, expr->type());
+                if (index && is_index_scan_cheaper(index, expr, parameters, size)) {
+                    return boost::intrusive_ptr(
+                        new components::table::operators::index_scan(context_, expr, limit, columns));
+                }
             }
-            return boost::intrusive_ptr(new components::table::operators::full_scan(context_, expr, limit));
+            if (expr->type() == components::expressions::compare_type::union_and) {
+                // operator_match_t drops row ids, so only a conjunction answered by the index entirely is used
+                auto match = components::index::search_index(context_->index_engine(), expr);
+                if (match.index && match.is_exact && is_index_scan_cheaper(match, parameters, size)) {
+                    return boost::intrusive_ptr(
+                        new components::table::operators::composite_index_scan(context_, match, limit, columns));
+                }
+            }
+            return boost::intrusive_ptr(new components::table::operators::full_scan(context_, expr, limit, columns));
         } else {
             return boost::intrusive_ptr(new components::table::operators::operator_match_t(context_, expr, limit));
         }
     }
 
-    components::base::operators::operator_ptr create_plan_match(const context_storage_t& context,
-                                                                const components::logical_plan::node_ptr& node,
-                                                                components::logical_plan::limit_t limit) {
+    components::base::operators::operator_ptr
+    create_plan_match(const context_storage_t& context,
+                      const components::logical_plan::node_ptr& node,
+                      components::logical_plan::limit_t limit,
+                      const components::logical_plan::storage_parameters* parameters,
+                      const std::vector<std::string>& columns) {
         if (node->expressions().empty()) {
             return boost::intrusive_ptr(
-                new components::table::operators::transfer_scan(context.at(node->collection_full_name()), limit));
+                new components::table::operators::transfer_scan(context.at(node->collection_full_name()),
+                                                                limit,
+                                                                columns));
         } else { //todo: other kinds scan
             auto expr =
                 reinterpret_cast<const components::expressions::compare_expression_ptr*>(&node->expressions()[0]);
-            return create_plan_match_(context.at(node->collection_full_name()), *expr, limit);
+            return create_plan_match_(context.at(node->collection_full_name()), *expr, limit, parameters, columns);
         }
     }
 
@@ -2,21 +2,28 @@
 
 #include <components/logical_plan/node.hpp>
 #include <components/logical_plan/node_limit.hpp>
+#include <components/logical_plan/param_storage.hpp>
 #include <components/physical_plan/base/operators/operator.hpp>
 #include <services/memory_storage/context_storage.hpp>
 
 namespace services::collection::planner::impl {
 
-    components::collection::operators::operator_ptr create_plan_match(const context_storage_t& context,
-                                                                      const components::logical_plan::node_ptr& node,
-                                                                      components::logical_plan::limit_t limit);
+    components::collection::operators::operator_ptr
+    create_plan_match(const context_storage_t& context,
+                      const components::logical_plan::node_ptr& node,
+                      components::logical_plan::limit_t limit,
+                      const components::logical_plan::storage_parameters* parameters = nullptr);
 
 }
 
 namespace services::table::planner::impl {
 
-    components::base::operators::operator_ptr create_plan_match(const context_storage_t& context,
-                                                                const components::logical_plan::node_ptr& node,
-                                                                components::logical_plan::limit_t limit);
+    // `columns` are the names of the columns the scan has to read, every column is read if it is empty
+    components::base::operators::operator_ptr
+    create_plan_match(const context_storage_t& context,
+                      const components::logical_plan::node_ptr& node,
+                      components::logical_plan::limit_t limit,
+                      const components::logical_plan::storage_parameters* parameters = nullptr,
+                      const std::vector<std::string>& columns = {});
 
 }
@@ -25,9 +25,10 @@ namespace services::collection::planner::impl {
 namespace services::table::planner::impl {
 
     components::base::operators::operator_ptr create_plan_sort(const context_storage_t& context,
-                                                               const components::logical_plan::node_ptr& node) {
+                                                               const components::logical_plan::node_ptr& node,
+                                                               components::logical_plan::limit_t limit) {
         auto sort = boost::intrusive_ptr(
-            new components::table::operators::operator_sort_t(context.at(node->collection_full_name())));
+            new components::table::operators::operator_sort_t(context.at(node->collection_full_name()), limit));
         std::for_each(node->expressions().begin(),
                       node->expressions().end(),
                       [&sort](const components::expressions::expression_ptr& expr) {
@@ -1,7 +1,11 @@
 #include <actor-zeta.hpp>
 #include <catch2/catch.hpp>
 #include <components/expressions/compare_expression.hpp>
+#include <components/index/single_field_index.hpp>
 #include <components/logical_plan/node_match.hpp>
+#include <components/physical_plan/collection/operators/scan/full_scan.hpp>
+#include <components/physical_plan/collection/operators/scan/index_scan.hpp>
+#include <components/physical_plan/collection/operators/scan/primary_key_scan.hpp>
 #include <components/physical_plan/tests/operators/test_operator_generaty.hpp>
 #include <components/physical_plan_generator/create_plan.hpp>
 
@@ -37,3 +41,60 @@ TEST_CASE("create_plan::match") {
         REQUIRE(node_match->to_string() == R"_($match: {"key": {$eq: #1}})_");
     }
 }
+
+TEST_CASE("create_plan::match::scan_choice") {
+    using namespace components::collection::operators;
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto tape = std::make_unique<components::document::impl::base_document>(&resource);
+    auto new_value = [&](auto value) { return components::document::value_t{tape.get(), value}; };
+    auto collection = create_collection(&resource);
+    components::index::keys_base_storage_t keys(collection->resource_);
+    keys.emplace_back("count");
+    components::index::make_index<components::index::single_field_index_t>(d(collection)->index_engine(),
+                                                                           "single_count",
+                                                                           keys);
+    fill_collection(collection);
+    services::context_storage_t context;
+    context.emplace(get_name(), d(collection));
+
+    auto execute = [&](compare_type type, const char* field, components::document::value_t value) {
+        storage_parameters parameters(&resource);
+        add_parameter(parameters, core::parameter_id_t(1), value);
+        components::pipeline::context_t pipeline_context(std::move(parameters));
+        auto expr = make_compare_expression(&resource, type, key(field), core::parameter_id_t(1));
+        auto node_match = make_node_match(&resource, get_name(), expr);
+        auto plan = create_plan(context,
+                                node_match,
+                                components::logical_plan::limit_t::unlimit(),
+                                &pipeline_context.parameters);
+        plan->on_execute(&pipeline_context);
+        return plan;
+    };
+
+    SECTION("primary key") {
+        auto plan = execute(compare_type::eq, "_id", new_value(gen_id(10, &resource)));
+        REQUIRE(dynamic_cast<primary_key_scan*>(plan.get()));
+        REQUIRE(plan->output()->size() == 1);
+        REQUIRE(plan->output()->documents().front()->get_long("count") == 10);
+    }
+    SECTION("primary key, unknown id") {
+        auto plan = execute(compare_type::eq, "_id", new_value(std::pmr::string("unknown")));
+        REQUIRE(dynamic_cast<primary_key_scan*>(plan.get()));
+        REQUIRE(plan->output()->size() == 0);
+    }
+    SECTION("selective index") {
+        auto plan = execute(compare_type::gt, "count", new_value(static_cast<int64_t>(90)));
+        REQUIRE(dynamic_cast<index_scan*>(plan.get()));
+        REQUIRE(plan->output()->size() == 10);
+    }
+    SECTION("not selective index") {
+        auto plan = execute(compare_type::gt, "count", new_value(static_cast<int64_t>(10)));
+        REQUIRE(dynamic_cast<full_scan*>(plan.get()));
+        REQUIRE(plan->output()->size() == 90);
+    }
+    SECTION("not selective inequality") {
+        auto plan = execute(compare_type::ne, "count", new_value(static_cast<int64_t>(10)));
+        REQUIRE(dynamic_cast<full_scan*>(plan.get()));
+        REQUIRE(plan->output()->size() == 99);
+    }
+}
@@ -0,0 +1,140 @@
+#include "fold_constants.hpp"
+
+#include <algorithm>
+
+namespace components::planner::impl {
+
+    using expressions::compare_type;
+    using logical_plan::node_type;
+
+    namespace {
+
+        const compare_expression_ptr& as_compare(const expressions::expression_ptr& expression) {
+            return reinterpret_cast<const compare_expression_ptr&>(expression);
+        }
+
+        compare_expression_ptr fold_union(std::pmr::memory_resource* resource,
+                                          const compare_expression_ptr& condition) {
+            const bool is_and = condition->type() == compare_type::union_and;
+            const auto neutral = is_and ? compare_type::all_true : compare_type::all_false;
+            const auto absorbing = is_and ? compare_type::all_false : compare_type::all_true;
+
+            std::vector<compare_expression_ptr> terms;
+            terms.reserve(condition->children().size());
+            bool is_changed = false;
+            auto append = [&terms, &is_changed](const compare_expression_ptr& term) {
+                auto is_repeated =
+                    std::any_of(terms.begin(), terms.end(), [&term](const compare_expression_ptr& other) {
+                        return expressions::expression_equal()(other, term);
+                    });
+                if (is_repeated) {
+                    is_changed = true;
+                } else {
+                    terms.push_back(term);
+                }
+            };
+
+            for (const auto& child : condition->children()) {
+                auto term = fold_condition(resource, as_compare(child));
+                is_changed |= term != child;
+                if (term->type() == absorbing) {
+                    return expressions::make_compare_expression(resource, absorbing);
+                }
+                if (term->type() == neutral) {
+                    is_changed = true;
+                } else if (term->type() == condition->type()) {
+                    is_changed = true;
+                    for (const auto& nested : term->children()) {
+                        append(as_compare(nested));
+                    }
+                } else {
+                    append(term);
+                }
+            }
+
+            if (terms.empty()) {
+                return expressions::make_compare_expression(resource, neutral);
+            }
+            if (terms.size() == 1) {
+                return terms.front();
+            }
+            if (!is_changed) {
+                return condition;
+            }
+            auto result = expressions::make_compare_union_expression(resource, condition->type());
+            for (const auto& term : terms) {
+                result->append_child(term);
+            }
+            return result;
+        }
+
+        compare_expression_ptr fold_not(std::pmr::memory_resource* resource, const compare_expression_ptr& condition) {
+            if (condition->children().size() != 1) {
+                return condition;
+            }
+            auto term = fold_condition(resource, as_compare(condition->children().front()));
+            switch (term->type()) {
+                case compare_type::all_true:
+                    return expressions::make_compare_expression(resource, compare_type::all_false);
+                case compare_type::all_false:
+                    return expressions::make_compare_expression(resource, compare_type::all_true);
+                case compare_type::union_not:
+                    if (term->children().size() == 1) {
+                        return as_compare(term->children().front());
+                    }
+                    break;
+                default:
+                    break;
+            }
+            if (term == condition->children().front()) {
+                return condition;
+            }
+            auto result = expressions::make_compare_union_expression(resource, compare_type::union_not);
+            result->append_child(term);
+            return result;
+        }
+
+    } // namespace
+
+    compare_expression_ptr fold_condition(std::pmr::memory_resource* resource,
+                                          const compare_expression_ptr& condition) {
+        switch (condition->type()) {
+            case compare_type::union_and:
+            case compare_type::union_or:
+                return fold_union(resource, condition);
+            case compare_type::union_not:
+                return fold_not(resource, condition);
+            default:
+                return condition;
+        }
+    }
+
+    void fold_constants(std::pmr::memory_resource* resource, const logical_plan::node_ptr& node) {
+        for (const auto& child : node->children()) {
+            fold_constants(resource, child);
+        }
+        if (node->type() == node_type::match_t || node->type() == node_type::join_t) {
+            auto condition = node_condition(node);
+            if (condition) {
+                auto folded = fold_condition(resource, condition);
+                if (folded != condition) {
+                    node->expressions().front() = folded;
+                }
+            }
+        }
+        if (node->type() == node_type::aggregate_t) {
+            auto& children = node->children();
+            children.erase(std::remove_if(children.begin(),
+                                          children.end(),
+                                          [](const logical_plan::node_ptr& child) {
+                                              if (child->type() != node_type::match_t) {
+                                                  return false;
+                                              }
+                                              auto condition = node_condition(child);
+                                              return condition && condition->type() == compare_type::all_true;
+                                          }),
+                           children.end());
+        }
+    }
+
+} // namespace components::planner::impl
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "utils.hpp"
+
+namespace components::planner::impl {
+
+    // flattens nested $and/$or, drops neutral and repeated terms, reduces a union with an absorbing term
+    // to a constant and removes double negation, the condition itself is returned if nothing changes
+    compare_expression_ptr fold_condition(std::pmr::memory_resource* resource,
+                                          const compare_expression_ptr& condition);
+
+    // folds conditions of match and join nodes, a match which is always true is removed from aggregate
+    void fold_constants(std::pmr::memory_resource* resource, const logical_plan::node_ptr& node);
+
+} // namespace components::planner::impl
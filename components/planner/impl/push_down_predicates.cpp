@@ -0,0 +1,104 @@
+#include "push_down_predicates.hpp"
+
+#include <algorithm>
+
+#include <components/logical_plan/node_join.hpp>
+#include <components/logical_plan/node_match.hpp>
+
+namespace components::planner::impl {
+
+    using logical_plan::join_type;
+    using logical_plan::node_type;
+
+    namespace {
+
+        // filtering the input before the join gives the same rows as filtering the join result
+        bool is_filter_preserved(const logical_plan::node_ptr& node, const logical_plan::node_ptr& input) {
+            if (node == input) {
+                return true;
+            }
+            if (node->type() != node_type::join_t || node->children().size() != 2) {
+                return false;
+            }
+            auto type = static_cast<const logical_plan::node_join_t*>(node.get())->type();
+            const bool is_left_preserved =
+                type == join_type::inner || type == join_type::cross || type == join_type::left;
+            const bool is_right_preserved =
+                type == join_type::inner || type == join_type::cross || type == join_type::right;
+            return (is_left_preserved && is_filter_preserved(node->children().front(), input)) ||
+                   (is_right_preserved && is_filter_preserved(node->children().back(), input));
+        }
+
+        void append_filter(std::pmr::memory_resource* resource,
+                           const logical_plan::node_ptr& input,
+                           std::vector<compare_expression_ptr> terms) {
+            for (const auto& child : input->children()) {
+                auto condition = node_condition(child);
+                if (child->type() == node_type::match_t && condition) {
+                    auto existing = split_conjunction(condition);
+                    existing.insert(existing.end(), terms.begin(), terms.end());
+                    child->expressions().front() = make_conjunction(resource, existing);
+                    return;
+                }
+            }
+            auto condition = make_conjunction(resource, terms);
+            auto match = logical_plan::make_node_match(resource, input->collection_full_name(), condition);
+            input->children().insert(input->children().begin(), match);
+        }
+
+    } // namespace
+
+    void push_down_predicates(std::pmr::memory_resource* resource,
+                              const statistics_t& statistics,
+                              const logical_plan::node_ptr& node) {
+        for (const auto& child : node->children()) {
+            push_down_predicates(resource, statistics, child);
+        }
+        if (node->type() != node_type::aggregate_t) {
+            return;
+        }
+        logical_plan::node_ptr join;
+        logical_plan::node_ptr match;
+        for (const auto& child : node->children()) {
+            if (child->type() == node_type::join_t) {
+                join = child;
+            } else if (child->type() == node_type::match_t && node_condition(child)) {
+                match = child;
+            }
+        }
+        if (!join || !match) {
+            return;
+        }
+
+        std::vector<logical_plan::node_ptr> inputs;
+        collect_inputs(join, inputs);
+        std::vector<std::vector<compare_expression_ptr>> pushed(inputs.size());
+        std::vector<compare_expression_ptr> kept;
+        auto terms = split_conjunction(node_condition(match));
+        for (const auto& term : terms) {
+            auto owner = condition_owner(statistics, inputs, term);
+            if (owner != -1 && inputs[owner]->type() == node_type::aggregate_t &&
+                is_filter_preserved(join, inputs[owner])) {
+                pushed[owner].push_back(term);
+            } else {
+                kept.push_back(term);
+            }
+        }
+        if (kept.size() == terms.size()) {
+            return;
+        }
+
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            if (!pushed[i].empty()) {
+                append_filter(resource, inputs[i], std::move(pushed[i]));
+            }
+        }
+        if (kept.empty()) {
+            auto& children = node->children();
+            children.erase(std::find(children.begin(), children.end(), match));
+        } else {
+            match->expressions().front() = make_conjunction(resource, kept);
+        }
+    }
+
+} // namespace components::planner::impl
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "utils.hpp"
+
+namespace components::planner::impl {
+
+    // moves terms of an aggregate filter below its join into the collections they depend on,
+    // a term stays above the join if its input can be padded by an outer join or its fields are ambiguous
+    void push_down_predicates(std::pmr::memory_resource* resource,
+                              const statistics_t& statistics,
+                              const logical_plan::node_ptr& node);
+
+} // namespace components::planner::impl
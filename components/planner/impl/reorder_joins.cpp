@@ -0,0 +1,214 @@
+#include "reorder_joins.hpp"
+
+#include <algorithm>
+
+#include <components/logical_plan/node_join.hpp>
+
+namespace components::planner::impl {
+
+    using expressions::compare_type;
+    using logical_plan::join_type;
+    using logical_plan::node_type;
+
+    namespace {
+
+        // the order of two inputs does not change the cost, hash join builds on the smaller one anyway
+        constexpr std::size_t min_reordered_inputs = 3;
+
+        struct join_term_t {
+            compare_expression_ptr condition;
+            int left;  // input of key_left
+            int right; // input of key_right
+        };
+
+        bool is_join_comparison(compare_type type) {
+            return type == compare_type::eq || type == compare_type::ne || type == compare_type::gt ||
+                   type == compare_type::lt || type == compare_type::gte || type == compare_type::lte;
+        }
+
+        // comparison with swapped operands
+        compare_type mirror(compare_type type) {
+            switch (type) {
+                case compare_type::gt:
+                    return compare_type::lt;
+                case compare_type::lt:
+                    return compare_type::gt;
+                case compare_type::gte:
+                    return compare_type::lte;
+                case compare_type::lte:
+                    return compare_type::gte;
+                default:
+                    return type;
+            }
+        }
+
+    } // namespace
+
+    void reorder_joins(std::pmr::memory_resource* resource,
+                       const statistics_t& statistics,
+                       const logical_plan::node_ptr& node) {
+        for (const auto& child : node->children()) {
+            reorder_joins(resource, statistics, child);
+        }
+        if (node->type() != node_type::aggregate_t) {
+            return;
+        }
+        auto& children = node->children();
+        auto join_it = std::find_if(children.begin(), children.end(), [](const logical_plan::node_ptr& child) {
+            return child->type() == node_type::join_t;
+        });
+        // without a projection the order of joined fields is a part of the result
+        auto has_group = std::any_of(children.begin(), children.end(), [](const logical_plan::node_ptr& child) {
+            return child->type() == node_type::group_t;
+        });
+        if (join_it == children.end() || !has_group) {
+            return;
+        }
+
+        // left-deep chain: inputs from left to right and conditions from the top join
+        std::vector<logical_plan::node_ptr> inputs;
+        std::vector<compare_expression_ptr> conditions;
+        for (auto join = *join_it;;) {
+            auto type = static_cast<const logical_plan::node_join_t*>(join.get())->type();
+            auto condition = node_condition(join);
+            if ((type != join_type::inner && type != join_type::cross) || join->children().size() != 2 ||
+                !condition || join->children().back()->type() == node_type::join_t) {
+                return;
+            }
+            conditions.push_back(condition);
+            inputs.push_back(join->children().back());
+            if (join->children().front()->type() != node_type::join_t) {
+                inputs.push_back(join->children().front());
+                break;
+            }
+            join = join->children().front();
+        }
+        std::reverse(inputs.begin(), inputs.end());
+        if (inputs.size() < min_reordered_inputs) {
+            return;
+        }
+
+        std::vector<double> estimates;
+        estimates.reserve(inputs.size());
+        for (const auto& input : inputs) {
+            if (input->type() != node_type::aggregate_t) {
+                return;
+            }
+            auto cardinality = statistics.cardinality(input->collection_full_name());
+            if (!cardinality.has_value()) {
+                return;
+            }
+            auto estimate = static_cast<double>(*cardinality);
+            for (const auto& child : input->children()) {
+                if (child->type() == node_type::match_t && node_condition(child)) {
+                    estimate *= estimate_selectivity(node_condition(child));
+                }
+            }
+            estimates.push_back(estimate);
+        }
+
+        std::vector<join_term_t> terms;
+        for (const auto& condition : conditions) {
+            for (const auto& term : split_conjunction(condition)) {
+                if (term->type() == compare_type::all_true) {
+                    continue;
+                }
+                if (!is_join_comparison(term->type()) || !term->key_left().is_string() ||
+                    !term->key_right().is_string()) {
+                    return;
+                }
+                auto left = field_owner(statistics, inputs, term->key_left().as_string());
+                auto right = field_owner(statistics, inputs, term->key_right().as_string());
+                if (left == -1 || right == -1 || left == right) {
+                    return;
+                }
+                terms.push_back({term, left, right});
+            }
+        }
+
+        // a field of several inputs is taken from the last joined one, so the result would depend on the order
+        std::vector<std::string> fields;
+        for (const auto& child : children) {
+            if (child->type() == node_type::group_t) {
+                for (const auto& expression : child->expressions()) {
+                    collect_expression_fields(expression, fields);
+                }
+            } else if (child->type() == node_type::match_t && node_condition(child)) {
+                collect_fields(node_condition(child), fields);
+            }
+        }
+        for (const auto& field : fields) {
+            if (field_owner(statistics, inputs, field) == -1) {
+                return;
+            }
+        }
+
+        std::vector<bool> is_joined(inputs.size(), false);
+        auto is_connected = [&terms, &is_joined](int input) {
+            return std::any_of(terms.begin(), terms.end(), [&is_joined, input](const join_term_t& term) {
+                return (term.left == input && is_joined[term.right]) || (term.right == input && is_joined[term.left]);
+            });
+        };
+        std::vector<int> order;
+        order.reserve(inputs.size());
+        order.push_back(static_cast<int>(std::min_element(estimates.begin(), estimates.end()) - estimates.begin()));
+        is_joined[order.front()] = true;
+        while (order.size() < inputs.size()) {
+            int next = -1;
+            bool is_next_connected = false;
+            for (int input = 0; input < static_cast<int>(inputs.size()); ++input) {
+                if (is_joined[input]) {
+                    continue;
+                }
+                auto connected = is_connected(input);
+                if (next == -1 || (connected && !is_next_connected) ||
+                    (connected == is_next_connected && estimates[input] < estimates[next])) {
+                    next = input;
+                    is_next_connected = connected;
+                }
+            }
+            order.push_back(next);
+            is_joined[next] = true;
+        }
+        if (std::is_sorted(order.begin(), order.end())) {
+            return;
+        }
+
+        // every term goes to the first join having both of its inputs
+        std::fill(is_joined.begin(), is_joined.end(), false);
+        std::vector<bool> is_used(terms.size(), false);
+        auto tree = inputs[order.front()];
+        is_joined[order.front()] = true;
+        for (std::size_t i = 1; i < order.size(); ++i) {
+            auto input = order[i];
+            std::vector<compare_expression_ptr> join_terms;
+            for (std::size_t j = 0; j < terms.size(); ++j) {
+                const auto& term = terms[j];
+                if (is_used[j]) {
+                    continue;
+                }
+                if (term.right == input && is_joined[term.left]) {
+                    join_terms.push_back(term.condition);
+                } else if (term.left == input && is_joined[term.right]) {
+                    // key_left is read from the left side of the join
+                    join_terms.push_back(expressions::make_compare_expression(resource,
+                                                                              mirror(term.condition->type()),
+                                                                              term.condition->key_right(),
+                                                                              term.condition->key_left()));
+                } else {
+                    continue;
+                }
+                is_used[j] = true;
+            }
+            auto join =
+                logical_plan::make_node_join(resource, {}, join_terms.empty() ? join_type::cross : join_type::inner);
+            join->append_child(tree);
+            join->append_child(inputs[input]);
+            join->append_expression(make_conjunction(resource, join_terms));
+            tree = join;
+            is_joined[input] = true;
+        }
+        *join_it = tree;
+    }
+
+} // namespace components::planner::impl
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "utils.hpp"
+
+namespace components::planner::impl {
+
+    // rebuilds a chain of inner joins under a projecting aggregate: it starts from the smallest estimated
+    // collection and adds the smallest one connected by a join condition, the chain is kept as is if a
+    // cardinality or an owner of a used field is unknown
+    void reorder_joins(std::pmr::memory_resource* resource,
+                       const statistics_t& statistics,
+                       const logical_plan::node_ptr& node);
+
+} // namespace components::planner::impl
@@ -0,0 +1,197 @@
+#include "utils.hpp"
+
+#include <algorithm>
+
+#include <components/expressions/aggregate_expression.hpp>
+#include <components/expressions/scalar_expression.hpp>
+#include <components/expressions/sort_expression.hpp>
+
+namespace components::planner::impl {
+
+    using expressions::compare_type;
+    using logical_plan::node_type;
+
+    namespace {
+
+        // default selectivities for comparisons with unknown values
+        constexpr double equal_selectivity = 0.1;
+        constexpr double range_selectivity = 1.0 / 3.0;
+        constexpr double other_selectivity = 0.5;
+
+        void append_field(const expressions::key_t& key, std::vector<std::string>& fields) {
+            if (key.is_string() && std::find(fields.begin(), fields.end(), key.as_string()) == fields.end()) {
+                fields.push_back(key.as_string());
+            }
+        }
+
+        void collect_param_fields(const std::pmr::vector<expressions::param_storage>& params,
+                                  std::vector<std::string>& fields) {
+            for (const auto& param : params) {
+                if (std::holds_alternative<expressions::key_t>(param)) {
+                    append_field(std::get<expressions::key_t>(param), fields);
+                } else if (std::holds_alternative<expressions::expression_ptr>(param)) {
+                    collect_expression_fields(std::get<expressions::expression_ptr>(param), fields);
+                }
+            }
+        }
+
+    } // namespace
+
+    compare_expression_ptr node_condition(const logical_plan::node_ptr& node) {
+        if (node->expressions().empty() ||
+            node->expressions().front()->group() != expressions::expression_group::compare) {
+            return nullptr;
+        }
+        return reinterpret_cast<const compare_expression_ptr&>(node->expressions().front());
+    }
+
+    std::vector<compare_expression_ptr> split_conjunction(const compare_expression_ptr& condition) {
+        std::vector<compare_expression_ptr> terms;
+        if (condition->type() == compare_type::union_and) {
+            terms.reserve(condition->children().size());
+            for (const auto& child : condition->children()) {
+                terms.push_back(reinterpret_cast<const compare_expression_ptr&>(child));
+            }
+        } else {
+            terms.push_back(condition);
+        }
+        return terms;
+    }
+
+    compare_expression_ptr make_conjunction(std::pmr::memory_resource* resource,
+                                            const std::vector<compare_expression_ptr>& terms) {
+        if (terms.empty()) {
+            return expressions::make_compare_expression(resource, compare_type::all_true);
+        }
+        if (terms.size() == 1) {
+            return terms.front();
+        }
+        auto conjunction = expressions::make_compare_union_expression(resource, compare_type::union_and);
+        for (const auto& term : terms) {
+            conjunction->append_child(term);
+        }
+        return conjunction;
+    }
+
+    void collect_fields(const compare_expression_ptr& condition, std::vector<std::string>& fields) {
+        if (condition->is_union()) {
+            for (const auto& child : condition->children()) {
+                collect_fields(reinterpret_cast<const compare_expression_ptr&>(child), fields);
+            }
+            return;
+        }
+        append_field(condition->key_left(), fields);
+        append_field(condition->key_right(), fields);
+    }
+
+    void collect_expression_fields(const expressions::expression_ptr& expression, std::vector<std::string>& fields) {
+        switch (expression->group()) {
+            case expressions::expression_group::scalar: {
+                const auto* scalar = static_cast<const expressions::scalar_expression_t*>(expression.get());
+                if (scalar->type() == expressions::scalar_type::get_field && scalar->params().empty()) {
+                    append_field(scalar->key(), fields);
+                }
+                collect_param_fields(scalar->params(), fields);
+                break;
+            }
+            case expressions::expression_group::aggregate:
+                collect_param_fields(
+                    static_cast<const expressions::aggregate_expression_t*>(expression.get())->params(),
+                    fields);
+                break;
+            case expressions::expression_group::sort:
+                append_field(static_cast<const expressions::sort_expression_t*>(expression.get())->key(), fields);
+                break;
+            case expressions::expression_group::compare:
+                collect_fields(reinterpret_cast<const compare_expression_ptr&>(expression), fields);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void collect_inputs(const logical_plan::node_ptr& node, std::vector<logical_plan::node_ptr>& inputs) {
+        for (const auto& child : node->children()) {
+            if (child->type() == node_type::join_t) {
+                collect_inputs(child, inputs);
+            } else {
+                inputs.push_back(child);
+            }
+        }
+    }
+
+    int field_owner(const statistics_t& statistics,
+                    const std::vector<logical_plan::node_ptr>& inputs,
+                    const std::string& field) {
+        int owner = -1;
+        for (std::size_t i = 0; i < inputs.size(); ++i) {
+            auto has_field = statistics.has_field(inputs[i]->collection_full_name(), field);
+            if (!has_field.has_value()) {
+                return -1;
+            }
+            if (*has_field) {
+                if (owner != -1) {
+                    return -1;
+                }
+                owner = static_cast<int>(i);
+            }
+        }
+        return owner;
+    }
+
+    int condition_owner(const statistics_t& statistics,
+                        const std::vector<logical_plan::node_ptr>& inputs,
+                        const compare_expression_ptr& condition) {
+        std::vector<std::string> fields;
+        collect_fields(condition, fields);
+        int owner = -1;
+        for (const auto& field : fields) {
+            auto field_input = field_owner(statistics, inputs, field);
+            if (field_input == -1 || (owner != -1 && owner != field_input)) {
+                return -1;
+            }
+            owner = field_input;
+        }
+        return owner;
+    }
+
+    double estimate_selectivity(const compare_expression_ptr& condition) {
+        switch (condition->type()) {
+            case compare_type::all_true:
+                return 1.0;
+            case compare_type::all_false:
+                return 0.0;
+            case compare_type::eq:
+                return equal_selectivity;
+            case compare_type::ne:
+                return 1.0 - equal_selectivity;
+            case compare_type::gt:
+            case compare_type::lt:
+            case compare_type::gte:
+            case compare_type::lte:
+                return range_selectivity;
+            case compare_type::union_and: {
+                double selectivity = 1.0;
+                for (const auto& child : condition->children()) {
+                    selectivity *= estimate_selectivity(reinterpret_cast<const compare_expression_ptr&>(child));
+                }
+                return selectivity;
+            }
+            case compare_type::union_or: {
+                double rejected = 1.0;
+                for (const auto& child : condition->children()) {
+                    rejected *= 1.0 - estimate_selectivity(reinterpret_cast<const compare_expression_ptr&>(child));
+                }
+                return 1.0 - rejected;
+            }
+            case compare_type::union_not:
+                return condition->children().empty()
+                           ? other_selectivity
+                           : 1.0 - estimate_selectivity(
+                                       reinterpret_cast<const compare_expression_ptr&>(condition->children().front()));
+            default:
+                return other_selectivity;
+        }
+    }
+
+} // namespace components::planner::impl
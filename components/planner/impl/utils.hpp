@@ -0,0 +1,46 @@
+#pragma once
+
+#include <components/expressions/compare_expression.hpp>
+#include <components/logical_plan/node.hpp>
+#include <components/planner/statistics.hpp>
+
+#include <string>
+#include <vector>
+
+namespace components::planner::impl {
+
+    using expressions::compare_expression_ptr;
+
+    // condition of a match or join node, nullptr if the node has no compare expression
+    compare_expression_ptr node_condition(const logical_plan::node_ptr& node);
+
+    // terms of $and, any other condition is a single term
+    std::vector<compare_expression_ptr> split_conjunction(const compare_expression_ptr& condition);
+
+    // $and of the terms, a single term is returned as is, no terms give $all_true
+    compare_expression_ptr make_conjunction(std::pmr::memory_resource* resource,
+                                            const std::vector<compare_expression_ptr>& terms);
+
+    // names of the fields the condition depends on
+    void collect_fields(const compare_expression_ptr& condition, std::vector<std::string>& fields);
+
+    // names of the fields read by a group, sort or compare expression
+    void collect_expression_fields(const expressions::expression_ptr& expression, std::vector<std::string>& fields);
+
+    // inputs of a join tree from left to right: every child which is not a join itself
+    void collect_inputs(const logical_plan::node_ptr& node, std::vector<logical_plan::node_ptr>& inputs);
+
+    // position of the only input having the field, -1 if the field is missing, ambiguous or unknown
+    int field_owner(const statistics_t& statistics,
+                    const std::vector<logical_plan::node_ptr>& inputs,
+                    const std::string& field);
+
+    // position of the input having all fields of the condition, -1 if there is no such input
+    int condition_owner(const statistics_t& statistics,
+                        const std::vector<logical_plan::node_ptr>& inputs,
+                        const compare_expression_ptr& condition);
+
+    // estimated fraction of documents satisfying the condition
+    double estimate_selectivity(const compare_expression_ptr& condition);
+
+} // namespace components::planner::impl
@@ -1,11 +1,51 @@
 #include "planner.hpp"
 
+#include "impl/fold_constants.hpp"
+#include "impl/push_down_predicates.hpp"
+#include "impl/reorder_joins.hpp"
+#include "impl/utils.hpp"
+
+#include <algorithm>
+
 namespace components::planner {
 
+    planner_t::planner_t(const statistics_t* statistics)
+        : statistics_(statistics) {}
+
     auto planner_t::create_plan(std::pmr::memory_resource* resource, logical_plan::node_ptr node)
         -> logical_plan::node_ptr {
         assert(resource && node);
+        impl::fold_constants(resource, node);
+        if (statistics_) {
+            impl::push_down_predicates(resource, *statistics_, node);
+            impl::reorder_joins(resource, *statistics_, node);
+        }
         return node;
     }
 
+    auto required_fields(const logical_plan::node_ptr& node) -> std::optional<std::vector<std::string>> {
+        assert(node);
+        if (node->type() != logical_plan::node_type::aggregate_t) {
+            return std::nullopt;
+        }
+        const auto& children = node->children();
+        auto has_type = [&children](logical_plan::node_type type) {
+            return std::any_of(children.begin(), children.end(), [type](const logical_plan::node_ptr& child) {
+                return child->type() == type;
+            });
+        };
+        if (!has_type(logical_plan::node_type::group_t) || has_type(logical_plan::node_type::join_t)) {
+            return std::nullopt;
+        }
+        std::vector<std::string> fields;
+        for (const auto& child : children) {
+            if (child->type() == logical_plan::node_type::group_t || child->type() == logical_plan::node_type::sort_t) {
+                for (const auto& expression : child->expressions()) {
+                    impl::collect_expression_fields(expression, fields);
+                }
+            }
+        }
+        return fields;
+    }
+
 } // namespace components::planner
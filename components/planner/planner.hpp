@@ -1,12 +1,29 @@
 #pragma once
 
+#include "statistics.hpp"
+
 #include <components/logical_plan/node.hpp>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace components::planner {
 
+    // rewrites logical plan in place: folds constant conditions, pushes filters into join inputs
+    // and reorders inner joins by cardinality, rewrites which need statistics are skipped without them
     class planner_t {
     public:
+        explicit planner_t(const statistics_t* statistics = nullptr);
+
         auto create_plan(std::pmr::memory_resource* resource, logical_plan::node_ptr node) -> logical_plan::node_ptr;
+
+    private:
+        const statistics_t* statistics_;
     };
 
+    // fields an aggregate node reads from its input: fields of its group and sort expressions
+    // fields of the match are left out, scans evaluate the condition on columns of their own
+    // std::nullopt if the whole input is returned (there is no group) or the input is a join
+    auto required_fields(const logical_plan::node_ptr& node) -> std::optional<std::vector<std::string>>;
+
 } // namespace components::planner
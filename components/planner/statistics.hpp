@@ -0,0 +1,22 @@
+#pragma once
+
+#include <components/base/collection_full_name.hpp>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace components::planner {
+
+    // what the planner knows about stored data, std::nullopt means the value is unknown
+    class statistics_t {
+    public:
+        virtual ~statistics_t() = default;
+
+        // approximate count of documents (rows) in the collection
+        virtual std::optional<uint64_t> cardinality(const collection_full_name_t& collection) const = 0;
+        // whether documents (rows) of the collection contain the field
+        virtual std::optional<bool> has_field(const collection_full_name_t& collection,
+                                              const std::string& field) const = 0;
+    };
+
+} // namespace components::planner
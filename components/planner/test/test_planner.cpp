@@ -0,0 +1,270 @@
+#include <catch2/catch.hpp>
+#include <components/expressions/aggregate_expression.hpp>
+#include <components/expressions/compare_expression.hpp>
+#include <components/expressions/scalar_expression.hpp>
+#include <components/expressions/sort_expression.hpp>
+#include <components/logical_plan/node_aggregate.hpp>
+#include <components/logical_plan/node_group.hpp>
+#include <components/logical_plan/node_join.hpp>
+#include <components/logical_plan/node_match.hpp>
+#include <components/logical_plan/node_sort.hpp>
+#include <components/planner/planner.hpp>
+
+#include <map>
+#include <set>
+
+using namespace components::logical_plan;
+using namespace components::expressions;
+using key = components::expressions::key_t;
+
+namespace {
+
+    constexpr auto database_name = "database";
+
+    struct test_statistics_t final : components::planner::statistics_t {
+        std::map<std::string, uint64_t> cardinalities;
+        std::map<std::string, std::set<std::string>> fields;
+
+        std::optional<uint64_t> cardinality(const collection_full_name_t& collection) const override {
+            auto it = cardinalities.find(collection.collection);
+            if (it == cardinalities.end()) {
+                return std::nullopt;
+            }
+            return it->second;
+        }
+
+        std::optional<bool> has_field(const collection_full_name_t& collection,
+                                      const std::string& field) const override {
+            auto it = fields.find(collection.collection);
+            if (it == fields.end()) {
+                return std::nullopt;
+            }
+            return it->second.count(field) > 0;
+        }
+    };
+
+    test_statistics_t make_statistics() {
+        test_statistics_t statistics;
+        statistics.cardinalities = {{"big", 1000}, {"middle", 100}, {"small", 10}};
+        statistics.fields = {{"big", {"id", "big_value", "middle_id"}},
+                             {"middle", {"id", "middle_value", "small_id"}},
+                             {"small", {"id", "small_value"}}};
+        return statistics;
+    }
+
+    compare_expression_ptr make_union(std::pmr::memory_resource* resource,
+                                      compare_type type,
+                                      const std::vector<compare_expression_ptr>& children) {
+        auto expr = make_compare_union_expression(resource, type);
+        for (const auto& child : children) {
+            expr->append_child(child);
+        }
+        return expr;
+    }
+
+    node_ptr make_input(std::pmr::memory_resource* resource, const char* name) {
+        return make_node_aggregate(resource, {database_name, name});
+    }
+
+    node_ptr make_join(std::pmr::memory_resource* resource,
+                       join_type type,
+                       const node_ptr& left,
+                       const node_ptr& right,
+                       const compare_expression_ptr& on) {
+        auto join = make_node_join(resource, {}, type);
+        join->append_child(left);
+        join->append_child(right);
+        join->append_expression(on);
+        return join;
+    }
+
+} // namespace
+
+TEST_CASE("planner::fold_constants") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    components::planner::planner_t planner;
+    auto eq = make_compare_expression(&resource, compare_type::eq, key("key"), core::parameter_id_t(1));
+    auto gt = make_compare_expression(&resource, compare_type::gt, key("count"), core::parameter_id_t(2));
+    auto all_true = make_compare_expression(&resource, compare_type::all_true);
+    {
+        auto nested = make_union(&resource, compare_type::union_and, {eq, all_true});
+        auto match = make_node_match(&resource,
+                                     {database_name, "collection"},
+                                     make_union(&resource, compare_type::union_and, {nested, eq, gt}));
+        planner.create_plan(&resource, match);
+        REQUIRE(match->to_string() == R"_($match: {$and: ["key": {$eq: #1}, "count": {$gt: #2}]})_");
+    }
+    {
+        auto match = make_node_match(&resource,
+                                     {database_name, "collection"},
+                                     make_union(&resource, compare_type::union_or, {eq, all_true}));
+        planner.create_plan(&resource, match);
+        REQUIRE(match->to_string() == R"_($match: {$all_true})_");
+    }
+    {
+        auto negation = make_union(&resource, compare_type::union_not, {eq});
+        auto match = make_node_match(&resource,
+                                     {database_name, "collection"},
+                                     make_union(&resource, compare_type::union_not, {negation}));
+        planner.create_plan(&resource, match);
+        REQUIRE(match->to_string() == R"_($match: {"key": {$eq: #1}})_");
+    }
+    {
+        auto aggregate = make_node_aggregate(&resource, {database_name, "collection"});
+        aggregate->append_child(make_node_match(&resource,
+                                                {database_name, "collection"},
+                                                make_union(&resource, compare_type::union_and, {all_true})));
+        planner.create_plan(&resource, aggregate);
+        REQUIRE(aggregate->to_string() == R"_($aggregate: {})_");
+    }
+}
+
+TEST_CASE("planner::push_down_predicates") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto statistics = make_statistics();
+    components::planner::planner_t planner(&statistics);
+
+    auto make_plan = [&resource](join_type type) {
+        auto on = make_compare_expression(&resource, compare_type::eq, key("middle_id"), key("id"));
+        auto aggregate = make_node_aggregate(&resource, {});
+        aggregate->append_child(
+            make_join(&resource, type, make_input(&resource, "big"), make_input(&resource, "middle"), on));
+        auto where = make_union(
+            &resource,
+            compare_type::union_and,
+            {make_compare_expression(&resource, compare_type::eq, key("big_value"), core::parameter_id_t(1)),
+             make_compare_expression(&resource, compare_type::gt, key("middle_value"), core::parameter_id_t(2)),
+             make_compare_expression(&resource, compare_type::lt, key("big_value"), key("middle_value")),
+             make_compare_expression(&resource, compare_type::eq, key("id"), core::parameter_id_t(3))});
+        aggregate->append_child(make_node_match(&resource, {}, where));
+        return aggregate;
+    };
+
+    {
+        auto plan = planner.create_plan(&resource, make_plan(join_type::inner));
+        REQUIRE(plan->children().size() == 2);
+        const auto& join = plan->children().front();
+        REQUIRE(join->children().front()->to_string() == R"_($aggregate: {$match: {"big_value": {$eq: #1}}})_");
+        REQUIRE(join->children().back()->to_string() == R"_($aggregate: {$match: {"middle_value": {$gt: #2}}})_");
+        // terms of several inputs and ambiguous fields stay above the join
+        REQUIRE(plan->children().back()->to_string() ==
+                R"_($match: {$and: ["big_value": {$lt: "middle_value"}, "id": {$eq: #3}]})_");
+    }
+    {
+        auto plan = planner.create_plan(&resource, make_plan(join_type::left));
+        const auto& join = plan->children().front();
+        REQUIRE(join->children().front()->to_string() == R"_($aggregate: {$match: {"big_value": {$eq: #1}}})_");
+        REQUIRE(join->children().back()->to_string() == R"_($aggregate: {})_");
+        REQUIRE(
+            plan->children().back()->to_string() ==
+            R"_($match: {$and: ["middle_value": {$gt: #2}, "big_value": {$lt: "middle_value"}, "id": {$eq: #3}]})_");
+    }
+    {
+        auto plan = planner.create_plan(&resource, make_plan(join_type::full));
+        const auto& join = plan->children().front();
+        REQUIRE(join->children().front()->to_string() == R"_($aggregate: {})_");
+        REQUIRE(join->children().back()->to_string() == R"_($aggregate: {})_");
+    }
+    {
+        // without statistics owners of fields are unknown
+        components::planner::planner_t blind_planner;
+        auto plan = blind_planner.create_plan(&resource, make_plan(join_type::inner));
+        REQUIRE(plan->children().front()->children().front()->to_string() == R"_($aggregate: {})_");
+    }
+}
+
+TEST_CASE("planner::reorder_joins") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto statistics = make_statistics();
+    components::planner::planner_t planner(&statistics);
+
+    auto make_plan = [&resource](const char* projected_field) {
+        auto big_middle = make_compare_expression(&resource, compare_type::eq, key("middle_id"), key("middle_value"));
+        auto middle_small = make_compare_expression(&resource, compare_type::lt, key("small_id"), key("small_value"));
+        auto join = make_join(&resource,
+                              join_type::inner,
+                              make_join(&resource,
+                                        join_type::inner,
+                                        make_input(&resource, "big"),
+                                        make_input(&resource, "middle"),
+                                        big_middle),
+                              make_input(&resource, "small"),
+                              middle_small);
+        auto aggregate = make_node_aggregate(&resource, {});
+        aggregate->append_child(join);
+        auto group = make_node_group(&resource, {});
+        group->append_expression(make_scalar_expression(&resource, scalar_type::get_field, key(projected_field)));
+        aggregate->append_child(group);
+        return aggregate;
+    };
+
+    {
+        auto plan = planner.create_plan(&resource, make_plan("big_value"));
+        const auto& top = plan->children().front();
+        REQUIRE(top->type() == node_type::join_t);
+        REQUIRE(top->children().back()->collection_full_name().collection == "big");
+        REQUIRE(top->expressions().front()->to_string() == R"_("middle_value": {$eq: "middle_id"})_");
+        const auto& bottom = top->children().front();
+        REQUIRE(bottom->children().front()->collection_full_name().collection == "small");
+        REQUIRE(bottom->children().back()->collection_full_name().collection == "middle");
+        REQUIRE(bottom->expressions().front()->to_string() == R"_("small_value": {$gt: "small_id"})_");
+    }
+    {
+        // "id" is a field of every input, the joined value depends on the order
+        auto plan = planner.create_plan(&resource, make_plan("id"));
+        const auto& top = plan->children().front();
+        REQUIRE(top->children().back()->collection_full_name().collection == "small");
+        REQUIRE(top->children().front()->children().front()->collection_full_name().collection == "big");
+    }
+}
+
+TEST_CASE("planner::required_fields") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    using components::planner::required_fields;
+
+    auto make_plan = [&resource](bool with_group) {
+        auto aggregate = make_node_aggregate(&resource, {database_name, "collection"});
+        aggregate->append_child(make_node_match(
+            &resource,
+            {database_name, "collection"},
+            make_compare_expression(&resource, compare_type::gt, key("filtered"), core::parameter_id_t(1))));
+        if (with_group) {
+            auto group = make_node_group(&resource, {database_name, "collection"});
+            group->append_expression(make_scalar_expression(&resource, scalar_type::get_field, key("name")));
+            group->append_expression(
+                make_scalar_expression(&resource, scalar_type::get_field, key("alias"), key("aliased")));
+            auto constant = make_scalar_expression(&resource, scalar_type::get_field, key("10"));
+            constant->append_param(core::parameter_id_t(2));
+            group->append_expression(constant);
+            group->append_expression(
+                make_aggregate_expression(&resource, aggregate_type::sum, key("sum(count)"), key("count")));
+            aggregate->append_child(group);
+        }
+        aggregate->append_child(make_node_sort(&resource,
+                                               {database_name, "collection"},
+                                               std::vector<expression_ptr>{
+                                                   make_sort_expression(key("name"), sort_order::asc),
+                                                   make_sort_expression(key("sorted"), sort_order::desc)}));
+        return aggregate;
+    };
+
+    {
+        auto fields = required_fields(make_plan(true));
+        REQUIRE(fields.has_value());
+        REQUIRE(*fields == std::vector<std::string>{"name", "aliased", "count", "sorted"});
+    }
+    {
+        // every field is returned without a group
+        REQUIRE_FALSE(required_fields(make_plan(false)).has_value());
+    }
+    {
+        auto aggregate = make_node_aggregate(&resource, {});
+        auto on = make_compare_expression(&resource, compare_type::eq, key("middle_id"), key("id"));
+        aggregate->append_child(
+            make_join(&resource, join_type::inner, make_input(&resource, "big"), make_input(&resource, "middle"), on));
+        auto group = make_node_group(&resource, {});
+        group->append_expression(make_scalar_expression(&resource, scalar_type::get_field, key("id")));
+        aggregate->append_child(group);
+        REQUIRE_FALSE(required_fields(aggregate).has_value());
+    }
+}
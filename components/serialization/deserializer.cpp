@@ -2,6 +2,9 @@
 
 #include "logical_plan/node_limit.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 namespace components::serializer {
 
     base_deserializer_t::base_deserializer_t(const std::pmr::string& input)
@@ -62,6 +65,56 @@ namespace components::serializer {
         return res;
     }
 
+    vector::data_chunk_t base_deserializer_t::deserialize_data_chunk(size_t index) {
+        advance_array(index);
+        auto size = deserialize_uint64(0);
+        advance_array(1);
+        std::pmr::vector<types::complex_logical_type> types(resource());
+        types.reserve(current_array_size());
+        for (size_t i = 0; i < current_array_size(); i++) {
+            advance_array(i);
+            types.emplace_back(static_cast<types::logical_type>(deserialize_uint64(0)), deserialize_string(1));
+            pop_array();
+        }
+        vector::data_chunk_t chunk(resource(), types, std::max(size, vector::DEFAULT_VECTOR_CAPACITY));
+        for (size_t i = 0; i < types.size(); i++) {
+            auto& column = chunk.data[i];
+            advance_array(i);
+            auto validity = deserialize_string(2);
+            auto values = deserialize_string(3);
+            pop_array();
+            for (uint64_t row = 0; !validity.empty() && row < size; row++) {
+                if (!(uint8_t(validity[row / 8]) >> row % 8 & 1)) {
+                    column.validity().set_invalid(row);
+                }
+            }
+            if (types[i].to_physical_type() != types::physical_type::STRING) {
+                std::memcpy(column.data(), values.data(), values.size());
+                continue;
+            }
+            auto heap = std::make_shared<vector::string_vector_buffer_t>(resource());
+            auto strings = column.data<std::string_view>();
+            const char* position = values.data();
+            for (uint64_t row = 0; row < size; row++) {
+                uint32_t length;
+                std::memcpy(&length, position, sizeof(length));
+                position += sizeof(length);
+                if (length == 0) {
+                    strings[row] = std::string_view();
+                } else {
+                    auto data = static_cast<char*>(heap->insert(const_cast<char*>(position), length));
+                    strings[row] = std::string_view(data, length);
+                }
+                position += length;
+            }
+            column.set_auxiliary(std::move(heap));
+        }
+        pop_array();
+        pop_array();
+        chunk.set_cardinality(size);
+        return chunk;
+    }
+
     std::pair<core::parameter_id_t, document::value_t>
     base_deserializer_t::deserialize_param_pair(document::impl::base_document* tape, size_t index) {
         advance_array(index);
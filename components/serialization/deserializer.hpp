@@ -44,6 +44,7 @@ namespace components::serializer {
         std::pmr::vector<expressions::param_storage> deserialize_param_storages(size_t index);
         std::pmr::vector<document_ptr> deserialize_documents(size_t index);
         std::pmr::vector<expressions::expression_ptr> deserialize_expressions(size_t index);
+        vector::data_chunk_t deserialize_data_chunk(size_t index);
         std::pair<core::parameter_id_t, document::value_t> deserialize_param_pair(document::impl::base_document* tape,
                                                                                   size_t size);
 
@@ -3,8 +3,90 @@
 #include <components/document/msgpack/msgpack_encoder.hpp>
 #include <components/expressions/key.hpp>
 
+#include <cstring>
+
 namespace components::serializer {
 
+    namespace {
+
+        bool is_string_column(const types::complex_logical_type& type) {
+            return type.to_physical_type() == types::physical_type::STRING;
+        }
+
+        // bit per row like in validity_mask_t, empty if every row is valid
+        std::string pack_validity(const vector::unified_vector_format& format, uint64_t count) {
+            std::string result;
+            if (format.validity.all_valid()) {
+                return result;
+            }
+            for (uint64_t row = 0; row < count; row++) {
+                if (format.validity.row_is_valid(format.referenced_indexing->get_index(row))) {
+                    continue;
+                }
+                if (result.empty()) {
+                    result.assign((count + 7) / 8, char(0xff));
+                }
+                result[row / 8] = char(uint8_t(result[row / 8]) & ~(1u << row % 8));
+            }
+            return result;
+        }
+
+        // fixed width values back to back, strings as 4 byte length followed by the bytes
+        std::string pack_values(const types::complex_logical_type& type,
+                                const vector::unified_vector_format& format,
+                                uint64_t count) {
+            std::string result;
+            if (is_string_column(type)) {
+                auto strings = format.get_data<std::string_view>();
+                for (uint64_t row = 0; row < count; row++) {
+                    auto index = format.referenced_indexing->get_index(row);
+                    auto value = format.validity.row_is_valid(index) ? strings[index] : std::string_view();
+                    auto length = static_cast<uint32_t>(value.size());
+                    result.append(reinterpret_cast<const char*>(&length), sizeof(length));
+                    result.append(value.data(), value.size());
+                }
+                return result;
+            }
+            auto width = type.size();
+            result.resize(count * width);
+            if (!format.referenced_indexing->is_set()) {
+                std::memcpy(result.data(), format.data, count * width);
+                return result;
+            }
+            for (uint64_t row = 0; row < count; row++) {
+                std::memcpy(result.data() + row * width,
+                            format.data + format.referenced_indexing->get_index(row) * width,
+                            width);
+            }
+            return result;
+        }
+
+    } // namespace
+
+    bool is_serializable_column(const types::complex_logical_type& type) {
+        switch (type.type()) {
+            case types::logical_type::BOOLEAN:
+            case types::logical_type::TINYINT:
+            case types::logical_type::SMALLINT:
+            case types::logical_type::INTEGER:
+            case types::logical_type::BIGINT:
+            case types::logical_type::UTINYINT:
+            case types::logical_type::USMALLINT:
+            case types::logical_type::UINTEGER:
+            case types::logical_type::UBIGINT:
+            case types::logical_type::FLOAT:
+            case types::logical_type::DOUBLE:
+            case types::logical_type::TIMESTAMP_SEC:
+            case types::logical_type::TIMESTAMP_MS:
+            case types::logical_type::TIMESTAMP_US:
+            case types::logical_type::TIMESTAMP_NS:
+            case types::logical_type::STRING_LITERAL:
+                return true;
+            default:
+                return false;
+        }
+    }
+
     base_serializer_t::base_serializer_t(std::pmr::memory_resource* resource)
         : result_(std::pmr::string(resource)) {}
 
@@ -92,6 +174,28 @@ namespace components::serializer {
             param);
     }
 
+    void base_serializer_t::append(std::string_view key, const vector::data_chunk_t& chunk) {
+        start_array(2);
+        append("size", static_cast<uint64_t>(chunk.size()));
+        start_array(chunk.column_count());
+        for (const auto& column : chunk.data) {
+            if (!is_serializable_column(column.type())) {
+                throw std::logic_error("serializer: unsupported column type of \"" + column.type().alias() + "\"");
+            }
+            // to_unified_format may flatten the column in place, its values stay the same
+            vector::unified_vector_format format(chunk.resource(), chunk.size());
+            const_cast<vector::vector_t&>(column).to_unified_format(chunk.size(), format);
+            start_array(4);
+            append("type", static_cast<uint64_t>(column.type().type()));
+            append("alias", column.type().alias());
+            append("validity", pack_validity(format, chunk.size()));
+            append("values", pack_values(column.type(), format, chunk.size()));
+            end_array();
+        }
+        end_array();
+        end_array();
+    }
+
     void base_serializer_t::append(std::string_view key, const logical_plan::node_ptr& node) { node->serialize(this); }
 
     void base_serializer_t::append(std::string_view key, const expressions::expression_ptr& expr) {
@@ -6,6 +6,7 @@
 #include <components/expressions/update_expression.hpp>
 #include <components/logical_plan/node.hpp>
 #include <components/logical_plan/param_storage.hpp>
+#include <components/vector/data_chunk.hpp>
 
 #include <boost/json.hpp>
 #include <memory_resource>
@@ -55,6 +56,9 @@ namespace components::serializer {
         invalid = 255
     };
 
+    // a data chunk is serialized column by column as raw buffers, these are the column types it supports
+    bool is_serializable_column(const types::complex_logical_type& type);
+
     class base_serializer_t {
     public:
         explicit base_serializer_t(std::pmr::memory_resource* resource);
@@ -89,6 +93,7 @@ namespace components::serializer {
         void append(std::string_view key, const std::pmr::vector<expressions::param_storage>& params);
         void append(std::string_view key, const collection_full_name_t& collection);
         void append(std::string_view key, const expressions::param_storage& param);
+        void append(std::string_view key, const vector::data_chunk_t& chunk);
 
         virtual void append(std::string_view key, const std::string& str) = 0;
         virtual void append(std::string_view key, const document::document_ptr& doc) = 0;
@@ -3,7 +3,9 @@
 #include <components/expressions/compare_expression.hpp>
 #include <components/expressions/scalar_expression.hpp>
 #include <components/logical_plan/node_delete.hpp>
+#include <components/logical_plan/node_data.hpp>
 #include <components/logical_plan/node_group.hpp>
+#include <components/logical_plan/node_insert.hpp>
 #include <components/logical_plan/node_match.hpp>
 #include <components/logical_plan/param_storage.hpp>
 #include <components/serialization/deserializer.hpp>
@@ -178,4 +180,65 @@ TEST_CASE("serialization") {
             deserializer.pop_array();
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("serialization::data_chunk") {
+    using components::types::complex_logical_type;
+    using components::types::logical_type;
+    using components::types::logical_value_t;
+    auto resource = std::pmr::synchronized_pool_resource();
+
+    constexpr uint64_t count_rows = 3000;
+    std::pmr::vector<complex_logical_type> types(&resource);
+    types.emplace_back(logical_type::BOOLEAN, "flag");
+    types.emplace_back(logical_type::BIGINT, "count");
+    types.emplace_back(logical_type::DOUBLE, "value");
+    types.emplace_back(logical_type::STRING_LITERAL, "name");
+    components::vector::data_chunk_t chunk(&resource, types, count_rows);
+    chunk.set_cardinality(count_rows);
+    for (uint64_t num = 0; num < count_rows; ++num) {
+        chunk.set_value(0, num, logical_value_t{num % 2 == 0});
+        if (num % 7 == 0) {
+            chunk.data[1].validity().set_invalid(num);
+        } else {
+            chunk.set_value(1, num, logical_value_t{int64_t(num) - 1000});
+        }
+        chunk.set_value(2, num, logical_value_t{double(num) / 4});
+        if (num % 5 == 0) {
+            chunk.data[3].validity().set_invalid(num);
+        } else {
+            chunk.set_value(3, num, logical_value_t{num % 3 == 0 ? std::string() : "name " + std::to_string(num)});
+        }
+    }
+    auto node = make_node_insert(&resource, get_name(), std::move(chunk));
+
+    msgpack_serializer_t serializer(&resource);
+    serializer.start_array(1);
+    node->serialize(&serializer);
+    serializer.end_array();
+    auto res = serializer.result();
+    msgpack_deserializer_t deserializer(res);
+    deserializer.advance_array(0);
+    auto deserialized_res = node_t::deserialize(&deserializer);
+    deserializer.pop_array();
+
+    REQUIRE(deserialized_res->type() == node_type::insert_t);
+    const auto& expected = reinterpret_cast<const node_data_ptr&>(node->children().front())->data_chunk();
+    const auto& data = reinterpret_cast<const node_data_ptr&>(deserialized_res->children().front());
+    REQUIRE(data->uses_data_chunk());
+    const auto& result = data->data_chunk();
+    REQUIRE(result.size() == count_rows);
+    REQUIRE(result.column_count() == types.size());
+    for (size_t column = 0; column < types.size(); ++column) {
+        REQUIRE(result.data[column].type().type() == types[column].type());
+        REQUIRE(result.data[column].type().alias() == types[column].alias());
+        for (uint64_t num = 0; num < count_rows; ++num) {
+            REQUIRE(result.data[column].is_null(num) == expected.data[column].is_null(num));
+            if (!expected.data[column].is_null(num)) {
+                REQUIRE(result.value(column, num) == expected.value(column, num));
+            }
+        }
+    }
+
+    REQUIRE_FALSE(is_serializable_column(complex_logical_type(logical_type::HUGEINT)));
+}
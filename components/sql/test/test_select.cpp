@@ -130,7 +130,11 @@ TEST_CASE("sql::select_from_where") {
 
     TEST_SIMPLE_UPDATE(R"_(SELECT * FROM TestDatabase.TestCollection WHERE name LIKE 'pattern';)_",
                        R"_($aggregate: {$match: {"name": {$regex: #0}}})_",
-                       vec({new_value(std::pmr::string("pattern"))}));
+                       vec({new_value(std::pmr::string("^pattern$"))}));
+
+    TEST_SIMPLE_UPDATE(R"_(SELECT * FROM TestDatabase.TestCollection WHERE name LIKE '%a_b.c\%%';)_",
+                       R"_($aggregate: {$match: {"name": {$regex: #0}}})_",
+                       vec({new_value(std::pmr::string("a[\\s\\S]b\\.c%"))}));
 }
 
 TEST_CASE("sql::select_from_order_by") {
@@ -189,4 +193,31 @@ TEST_CASE("sql::select_from_fields") {
         R"_(SELECT number, 10 size, 'title' title, true "on", false "off" FROM TestDatabase.TestCollection;)_",
         R"_($aggregate: {$group: {number, size: #0, title: #1, on: #2, off: #3}})_",
         vec({new_value(10l), new_value(std::pmr::string("title")), new_value(true), new_value(false)}));
-}
\ No newline at end of file
+}
+TEST_CASE("sql::select_placeholders") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto tape = std::make_unique<components::document::impl::base_document>(&resource);
+    auto new_value = [&](auto value) { return v{tape.get(), value}; };
+
+    TEST_SIMPLE_UPDATE(
+        R"_(SELECT * FROM TestDatabase.TestCollection WHERE number = $1 AND name = $2 OR "count" > $1;)_",
+        R"_($aggregate: {$match: {$or: [$and: ["number": {$eq: #0}, "name": {$eq: #1}], "count": {$gt: #2}]}})_",
+        vec({new_value(nullptr), new_value(nullptr), new_value(nullptr)}));
+
+    SECTION("bind") {
+        transform::transformer transformer(&resource);
+        components::logical_plan::parameter_node_t agg(&resource);
+        auto select =
+            linitial(raw_parser(R"_(SELECT * FROM TestDatabase.TestCollection WHERE number = $1 AND name = $2;)_"));
+        auto node = transformer.transform(transform::pg_cell_to_node_cast(select), &agg);
+        REQUIRE(agg.placeholders().size() == 2);
+
+        // values are bound to a copy, the statement itself stays unbound
+        auto params = agg.copy(&resource);
+        params->bind(1, 10l);
+        params->bind(2, std::string("doc 10"));
+        REQUIRE(params->parameter(core::parameter_id_t(0)) == new_value(10l));
+        REQUIRE(params->parameter(core::parameter_id_t(1)) == new_value(std::pmr::string("doc 10")));
+        REQUIRE(agg.parameter(core::parameter_id_t(0)) == new_value(nullptr));
+    }
+}
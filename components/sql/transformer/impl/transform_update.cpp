@@ -22,6 +22,10 @@ namespace components::sql::transform {
                     params->add_parameter(document::value_t(params->parameters().tape(), is_true));
                 return {new update_expr_get_const_value_t(id)};
             }
+            case T_ParamRef: {
+                auto id = params->add_placeholder(static_cast<uint16_t>(pg_ptr_cast<ParamRef>(node)->number));
+                return {new update_expr_get_const_value_t(id)};
+            }
             case T_A_Const: {
                 auto value = &(pg_ptr_cast<A_Const>(node)->val);
                 core::parameter_id_t id;
@@ -36,6 +36,22 @@ namespace components::sql::transform::impl {
         return {document::value_t(tape, nullptr), {}};
     }
 
+    core::parameter_id_t add_value(Node* node, logical_plan::parameter_node_t* params) {
+        if (nodeTag(node) == T_ParamRef) {
+            return params->add_placeholder(static_cast<uint16_t>(pg_ptr_cast<ParamRef>(node)->number));
+        }
+        return params->add_parameter(get_value(node, params->parameters().tape()).first);
+    }
+
+    // LIKE is matched by the regex of its pattern, so only a string constant can be used as the pattern
+    core::parameter_id_t add_like_pattern(Node* node, logical_plan::parameter_node_t* params) {
+        if (nodeTag(node) != T_A_Const || nodeTag(&pg_ptr_cast<A_Const>(node)->val) != T_String) {
+            throw parser_exception_t{"LIKE pattern must be a string constant", ""};
+        }
+        auto regex = like_to_regex(strVal(&pg_ptr_cast<A_Const>(node)->val));
+        return params->add_parameter(document::value_t(params->parameters().tape(), regex));
+    }
+
     compare_expression_ptr
     transform_a_expr(logical_plan::parameter_node_t* params, A_Expr* node, logical_plan::node_ptr* func_node) {
         switch (node->kind) {
@@ -85,7 +101,8 @@ namespace components::sql::transform::impl {
                 assert(nodeTag(node) == T_A_Indirection || nodeTag(node->lexpr) == T_ColumnRef ||
                        nodeTag(node->rexpr) == T_ColumnRef || nodeTag(node->lexpr) == T_A_Const ||
                        nodeTag(node->rexpr) == T_A_Const || nodeTag(node->lexpr) == T_TypeCast ||
-                       nodeTag(node->rexpr) == T_TypeCast);
+                       nodeTag(node->rexpr) == T_TypeCast || nodeTag(node->lexpr) == T_ParamRef ||
+                       nodeTag(node->rexpr) == T_ParamRef);
                 if (nodeTag(node) == T_A_Indirection) {
                     return transform_a_indirection(params, pg_ptr_cast<A_Indirection>(node));
                 }
@@ -98,18 +115,22 @@ namespace components::sql::transform::impl {
                                                        components::expressions::key_t{key_left},
                                                        components::expressions::key_t{key_right});
                     }
-                    return make_compare_expression(
-                        params->parameters().resource(),
-                        get_compare_type(strVal(node->name->lst.front().data)),
-                        components::expressions::key_t{key_left},
-                        params->add_parameter(get_value(node->rexpr, params->parameters().tape()).first));
+                    if (std::string_view(strVal(node->name->lst.front().data)) == "~~") {
+                        return make_compare_expression(params->parameters().resource(),
+                                                       compare_type::regex,
+                                                       components::expressions::key_t{key_left},
+                                                       add_like_pattern(node->rexpr, params));
+                    }
+                    return make_compare_expression(params->parameters().resource(),
+                                                   get_compare_type(strVal(node->name->lst.front().data)),
+                                                   components::expressions::key_t{key_left},
+                                                   add_value(node->rexpr, params));
                 } else {
                     auto key = strVal(pg_ptr_cast<ColumnRef>(node->rexpr)->fields->lst.back().data);
-                    return make_compare_expression(
-                        params->parameters().resource(),
-                        get_compare_type(strVal(node->name->lst.back().data)),
-                        components::expressions::key_t{key},
-                        params->add_parameter(get_value(node->lexpr, params->parameters().tape()).first));
+                    return make_compare_expression(params->parameters().resource(),
+                                                   get_compare_type(strVal(node->name->lst.back().data)),
+                                                   components::expressions::key_t{key},
+                                                   add_value(node->lexpr, params));
                 }
             }
             case AEXPR_NOT: {
@@ -159,8 +180,7 @@ namespace components::sql::transform::impl {
         std::pmr::vector<core::parameter_id_t> args;
         args.reserve(node.args->lst.size());
         for (const auto& arg : node.args->lst) {
-            auto v = impl::get_value(pg_ptr_cast<Node>(arg.data), params->parameters().tape());
-            args.emplace_back(params->add_parameter(v.first));
+            args.emplace_back(add_value(pg_ptr_cast<Node>(arg.data), params));
         }
         return logical_plan::make_node_function(params->parameters().resource(), std::move(funcname), std::move(args));
     }
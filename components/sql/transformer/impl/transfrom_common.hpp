@@ -10,6 +10,9 @@ namespace components::sql::transform::impl {
 
     std::pair<document::value_t, std::string> get_value(Node* node, document::impl::base_document* tape);
 
+    // parameter of a constant, or of a `$n` placeholder which is bound on execution
+    core::parameter_id_t add_value(Node* node, logical_plan::parameter_node_t* params);
+
     expressions::compare_expression_ptr
     transform_a_expr(logical_plan::parameter_node_t* params, A_Expr* node, logical_plan::node_ptr* func_node = nullptr);
     components::expressions::compare_expression_ptr transform_a_indirection(logical_plan::parameter_node_t* params,
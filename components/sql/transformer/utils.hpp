@@ -73,6 +73,56 @@ namespace components::sql::transform {
         throw parser_exception_t{"Unknown comparison operator: " + std::string(str), ""};
     }
 
+    // LIKE pattern as a regex for core::string_matcher_t: % is any run of bytes, _ is any byte and a backslash
+    // makes the next character literal; a leading or trailing % drops the anchor of its side, so the common
+    // 'abc%', '%abc' and '%abc%' patterns become prefix, suffix and substring searches
+    static std::string like_to_regex(std::string_view like) {
+        auto escaped = [&like](size_t pos) {
+            size_t backslashes = 0;
+            while (pos > backslashes && like[pos - backslashes - 1] == '\\') {
+                ++backslashes;
+            }
+            return backslashes % 2 == 1;
+        };
+        size_t begin = 0;
+        size_t end = like.size();
+        while (begin < end && like[begin] == '%') {
+            ++begin;
+        }
+        const bool anchor_begin = begin == 0;
+        while (end > begin && like[end - 1] == '%' && !escaped(end - 1)) {
+            --end;
+        }
+        // '%' alone matches everything, an empty pattern only the empty string
+        const bool anchor_end = end == like.size() && (anchor_begin || begin < end);
+
+        std::string regex;
+        regex.reserve(end - begin + 2);
+        if (anchor_begin) {
+            regex += '^';
+        }
+        for (size_t i = begin; i < end; i++) {
+            char c = like[i];
+            if (c == '\\' && i + 1 < end) {
+                c = like[++i];
+            } else if (c == '%') {
+                regex += "[\\s\\S]*";
+                continue;
+            } else if (c == '_') {
+                regex += "[\\s\\S]";
+                continue;
+            }
+            if (std::string_view("\\^$.|?*+()[]{}").find(c) != std::string_view::npos) {
+                regex += '\\';
+            }
+            regex += c;
+        }
+        if (anchor_end) {
+            regex += '$';
+        }
+        return regex;
+    }
+
     static expressions::aggregate_type get_aggregate_type(std::string_view str) {
         static const std::unordered_map<std::string_view, expressions::aggregate_type> lookup = {
             {"count", expressions::aggregate_type::count},
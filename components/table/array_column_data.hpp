@@ -17,7 +17,8 @@ namespace components::table {
         validity_column_data_t validity;
 
         void set_start(uint64_t new_start) override;
-        filter_propagate_result_t check_zonemap(column_scan_state& state, table_filter_t& filter) override;
+        filter_propagate_result_t
+        check_zonemap(uint64_t start_row, uint64_t count, const constant_filter_t& filter) override;
 
         void initialize_scan(column_scan_state& state) override;
         void initialize_scan_with_offset(column_scan_state& state, uint64_t row_idx) override;
@@ -27,8 +27,24 @@ namespace components::table {
         , allocation_size_(0)
         , resource_(resource) {}
 
-    filter_propagate_result_t column_data_t::check_zonemap(column_scan_state& state, table_filter_t& filter) {
-        return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+    filter_propagate_result_t
+    column_data_t::check_zonemap(uint64_t start_row, uint64_t count, const constant_filter_t& filter) {
+        if (count == 0 || !segment_statistics_t::is_supported(type_)) {
+            return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+        }
+        auto l = data_.lock();
+        if (data_.is_empty(l)) {
+            return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+        }
+        auto end_row = start_row + count;
+        auto segment = data_.get_segment(l, start_row);
+        auto result = segment->statistics().check_zonemap(filter);
+        for (segment = segment->next; segment && segment->start < end_row; segment = segment->next) {
+            if (segment->statistics().check_zonemap(filter) != result) {
+                return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+            }
+        }
+        return result;
     }
 
     uint64_t column_data_t::max_entry() { return count_; }
@@ -493,6 +509,14 @@ namespace components::table {
             updates_ = std::make_unique<update_segment_t>(*this);
         }
         updates_->update(column_index, update_vector, row_ids, update_count, base_vector);
+        if (!segment_statistics_t::is_supported(type_)) {
+            return;
+        }
+        auto l = data_.lock();
+        for (uint64_t i = 0; i < update_count; i++) {
+            auto segment = data_.get_segment(l, static_cast<uint64_t>(row_ids[i]));
+            segment->statistics().update(update_vector.value(i));
+        }
     }
 
     uint64_t column_data_t::vector_count(uint64_t vector_index) const {
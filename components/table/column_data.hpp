@@ -10,14 +10,6 @@ namespace components::table {
         class block_manager_t;
     }
 
-    enum class filter_propagate_result_t : uint8_t
-    {
-        NO_PRUNING_POSSIBLE = 0,
-        ALWAYS_TRUE = 1,
-        ALWAYS_FALSE = 2,
-        TRUE_OR_NULL = 3,
-        FALSE_OR_NULL = 4
-    };
     constexpr uint64_t MAX_ROW_ID = 36028797018960000ULL; // 2^55
 
     class column_data_t {
@@ -32,7 +24,8 @@ namespace components::table {
                       column_data_t* parent);
         virtual ~column_data_t() = default;
 
-        virtual filter_propagate_result_t check_zonemap(column_scan_state& state, table_filter_t& filter);
+        virtual filter_propagate_result_t
+        check_zonemap(uint64_t start_row, uint64_t count, const constant_filter_t& filter);
 
         storage::block_manager_t& block_manager() { return block_manager_; }
         virtual uint64_t max_entry();
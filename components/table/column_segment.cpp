@@ -331,6 +331,7 @@ namespace components::table {
             uint64_t copy_count = std::min(count, max_tuple_count - segment.count);
 
             APPENDER::template append<T>(target_ptr, segment.count, data, offset, copy_count);
+            segment.statistics().template update<T>(data, offset, copy_count);
             segment.count += copy_count;
             return copy_count;
         }
@@ -388,6 +389,7 @@ namespace components::table {
                 auto source_idx = data.referenced_indexing->get_index(offset + i);
                 auto target_idx = base_count + i;
                 if (remaining < sizeof(int32_t)) {
+                    segment.statistics().update<std::string_view>(data, offset, i);
                     segment.count += i;
                     return i;
                 }
@@ -411,6 +413,7 @@ namespace components::table {
                     use_overflow_block = true;
                 }
                 if (required_space > remaining) {
+                    segment.statistics().update<std::string_view>(data, offset, i);
                     segment.count += i;
                     return i;
                 }
@@ -439,6 +442,7 @@ namespace components::table {
                 }
                 assert(remaining_space(segment, handle) <= segment.block_manager().block_size());
             }
+            segment.statistics().update<std::string_view>(data, offset, count);
             segment.count += count;
             return count;
         }
@@ -609,7 +613,8 @@ namespace components::table {
         , block(std::move(block))
         , block_id_(block_id)
         , offset_(offset)
-        , segment_size_(segment_size) {
+        , segment_size_(segment_size)
+        , statistics_(type, count == 0) {
         assert(!block || segment_size_ <= block_manager().block_size());
 
         if (type.type() == types::logical_type::VALIDITY) {
@@ -643,7 +648,8 @@ namespace components::table {
         , block_id_(other.block_id_)
         , offset_(other.offset_)
         , segment_size_(other.segment_size_)
-        , segment_state_(std::move(other.segment_state_)) {
+        , segment_state_(std::move(other.segment_state_))
+        , statistics_(std::move(other.statistics_)) {
         assert(!block || segment_size_ <= block_manager().block_size());
     }
 
@@ -655,7 +661,8 @@ namespace components::table {
         , block_id_(other.block_id_)
         , offset_(other.offset_)
         , segment_size_(other.segment_size_)
-        , segment_state_(std::move(other.segment_state_)) {
+        , segment_state_(std::move(other.segment_state_))
+        , statistics_(std::move(other.statistics_)) {
         assert(!block || segment_size_ <= block_manager().block_size());
     }
 
@@ -841,6 +848,7 @@ namespace components::table {
         }
     }
 
+    // comparison of a single vector against a constant, `result_sel` gets the passing entries of `sel`
     template<class T, class COMP, bool HAS_NULL>
     static uint64_t filter_selection(vector::unified_vector_format& uvf,
                                      T predicate,
@@ -861,6 +869,52 @@ namespace components::table {
         }
         return result_count;
     }
+
+    // same as filter_selection for a flat vector without a prior selection:
+    // no indirections and no branches, so the loop can be vectorized
+    template<class T, class COMP, bool HAS_NULL>
+    static uint64_t filter_selection_flat(const T* __restrict vec,
+                                          const vector::validity_mask_t& mask,
+                                          T predicate,
+                                          uint64_t count,
+                                          uint64_t* __restrict result_sel) {
+        uint64_t result_count = 0;
+        for (uint64_t i = 0; i < count; i++) {
+            COMP comparator{};
+            bool comparison_result = (!HAS_NULL || mask.row_is_valid(i)) && comparator(vec[i], predicate);
+            result_sel[result_count] = i;
+            result_count += comparison_result;
+        }
+        return result_count;
+    }
+
+    template<class T, class COMP>
+    static uint64_t filter_selection_dispatch(vector::unified_vector_format& uvf,
+                                              T predicate,
+                                              vector::indexing_vector_t& indexing,
+                                              uint64_t approved_tuple_count,
+                                              vector::indexing_vector_t& new_sel) {
+        bool is_flat = !indexing.is_set() && !uvf.referenced_indexing->is_set();
+        if (uvf.validity.all_valid()) {
+            if (is_flat) {
+                return filter_selection_flat<T, COMP, false>(uvf.get_data<T>(),
+                                                             uvf.validity,
+                                                             predicate,
+                                                             approved_tuple_count,
+                                                             new_sel.data());
+            }
+            return filter_selection<T, COMP, false>(uvf, predicate, indexing, approved_tuple_count, new_sel);
+        }
+        if (is_flat) {
+            return filter_selection_flat<T, COMP, true>(uvf.get_data<T>(),
+                                                        uvf.validity,
+                                                        predicate,
+                                                        approved_tuple_count,
+                                                        new_sel.data());
+        }
+        return filter_selection<T, COMP, true>(uvf, predicate, indexing, approved_tuple_count, new_sel);
+    }
+
     template<class T>
     static void filter_selection_switch(vector::unified_vector_format& uvf,
                                         T predicate,
@@ -868,110 +922,133 @@ namespace components::table {
                                         uint64_t& approved_tuple_count,
                                         expressions::compare_type comparison_type) {
         vector::indexing_vector_t new_sel(indexing.resource(), approved_tuple_count);
-        auto& mask = uvf.validity;
-        // the inplace loops take the result as the last parameter
         switch (comparison_type) {
-            case expressions::compare_type::eq: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::equal_to<T>, false>(uvf,
-                                                                                        predicate,
-                                                                                        indexing,
-                                                                                        approved_tuple_count,
-                                                                                        new_sel);
-                } else {
-                    approved_tuple_count = filter_selection<T, std::equal_to<T>, true>(uvf,
-                                                                                       predicate,
-                                                                                       indexing,
-                                                                                       approved_tuple_count,
-                                                                                       new_sel);
-                }
-                break;
-            }
-            case expressions::compare_type::ne: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::not_equal_to<T>, false>(uvf,
-                                                                                            predicate,
-                                                                                            indexing,
-                                                                                            approved_tuple_count,
-                                                                                            new_sel);
-                } else {
-                    approved_tuple_count = filter_selection<T, std::not_equal_to<T>, true>(uvf,
-                                                                                           predicate,
-                                                                                           indexing,
-                                                                                           approved_tuple_count,
-                                                                                           new_sel);
-                }
-                break;
-            }
-            case expressions::compare_type::lt: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::less<T>, false>(uvf,
-                                                                                    predicate,
-                                                                                    indexing,
-                                                                                    approved_tuple_count,
-                                                                                    new_sel);
-                } else {
-                    approved_tuple_count = filter_selection<T, std::less<T>, true>(uvf,
-                                                                                   predicate,
-                                                                                   indexing,
-                                                                                   approved_tuple_count,
-                                                                                   new_sel);
-                }
-                break;
-            }
-            case expressions::compare_type::gt: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::greater<T>, false>(uvf,
-                                                                                       predicate,
-                                                                                       indexing,
-                                                                                       approved_tuple_count,
-                                                                                       new_sel);
-                } else {
-                    approved_tuple_count = filter_selection<T, std::greater<T>, true>(uvf,
+            case expressions::compare_type::eq:
+                approved_tuple_count = filter_selection_dispatch<T, std::equal_to<T>>(uvf,
                                                                                       predicate,
                                                                                       indexing,
                                                                                       approved_tuple_count,
                                                                                       new_sel);
-                }
                 break;
-            }
-            case expressions::compare_type::lte: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::less_equal<T>, false>(uvf,
+            case expressions::compare_type::ne:
+                approved_tuple_count = filter_selection_dispatch<T, std::not_equal_to<T>>(uvf,
                                                                                           predicate,
                                                                                           indexing,
                                                                                           approved_tuple_count,
                                                                                           new_sel);
-                } else {
-                    approved_tuple_count = filter_selection<T, std::less_equal<T>, true>(uvf,
-                                                                                         predicate,
-                                                                                         indexing,
-                                                                                         approved_tuple_count,
-                                                                                         new_sel);
-                }
                 break;
-            }
-            case expressions::compare_type::gte: {
-                if (mask.all_valid()) {
-                    approved_tuple_count = filter_selection<T, std::greater_equal<T>, false>(uvf,
-                                                                                             predicate,
-                                                                                             indexing,
-                                                                                             approved_tuple_count,
-                                                                                             new_sel);
-                } else {
-                    approved_tuple_count = filter_selection<T, std::greater_equal<T>, true>(uvf,
-                                                                                            predicate,
-                                                                                            indexing,
-                                                                                            approved_tuple_count,
-                                                                                            new_sel);
-                }
+            case expressions::compare_type::lt:
+                approved_tuple_count =
+                    filter_selection_dispatch<T, std::less<T>>(uvf, predicate, indexing, approved_tuple_count, new_sel);
+                break;
+            case expressions::compare_type::gt:
+                approved_tuple_count = filter_selection_dispatch<T, std::greater<T>>(uvf,
+                                                                                     predicate,
+                                                                                     indexing,
+                                                                                     approved_tuple_count,
+                                                                                     new_sel);
+                break;
+            case expressions::compare_type::lte:
+                approved_tuple_count = filter_selection_dispatch<T, std::less_equal<T>>(uvf,
+                                                                                        predicate,
+                                                                                        indexing,
+                                                                                        approved_tuple_count,
+                                                                                        new_sel);
+                break;
+            case expressions::compare_type::gte:
+                approved_tuple_count = filter_selection_dispatch<T, std::greater_equal<T>>(uvf,
+                                                                                           predicate,
+                                                                                           indexing,
+                                                                                           approved_tuple_count,
+                                                                                           new_sel);
                 break;
-            }
             default:
                 throw std::logic_error("Unknown comparison type for filter");
         }
         indexing = new_sel;
     }
+
+    // row by row comparison through logical values, used when the constant can not be represented
+    // in the physical type of the vector
+    static void filter_selection_generic(vector::vector_t& vector,
+                                         vector::unified_vector_format& uvf,
+                                         const constant_filter_t& filter,
+                                         vector::indexing_vector_t& indexing,
+                                         uint64_t& approved_tuple_count) {
+        vector::indexing_vector_t new_sel(indexing.resource(), approved_tuple_count);
+        uint64_t result_count = 0;
+        for (uint64_t i = 0; i < approved_tuple_count; i++) {
+            auto idx = indexing.get_index(i);
+            bool comparison_result = uvf.validity.row_is_valid(uvf.referenced_indexing->get_index(idx)) &&
+                                     filter.compare(vector.value(idx));
+            new_sel.set_index(result_count, idx);
+            result_count += comparison_result;
+        }
+        indexing = new_sel;
+        approved_tuple_count = result_count;
+    }
+
+    // strings matched by the pattern of a regex filter, compiled once with the filter
+    static void filter_selection_regex(vector::unified_vector_format& uvf,
+                                       const core::string_matcher_t& matcher,
+                                       vector::indexing_vector_t& indexing,
+                                       uint64_t& approved_tuple_count) {
+        vector::indexing_vector_t new_sel(indexing.resource(), approved_tuple_count);
+        auto data = uvf.get_data<std::string_view>();
+        uint64_t result_count = 0;
+        for (uint64_t i = 0; i < approved_tuple_count; i++) {
+            auto idx = indexing.get_index(i);
+            auto vector_idx = uvf.referenced_indexing->get_index(idx);
+            bool comparison_result = uvf.validity.row_is_valid(vector_idx) && matcher.match(data[vector_idx]);
+            new_sel.set_index(result_count, idx);
+            result_count += comparison_result;
+        }
+        indexing = new_sel;
+        approved_tuple_count = result_count;
+    }
+
+    // converts the filter constant to T; false if that would change the result of the comparison
+    template<class T>
+    static bool filter_predicate(const types::logical_value_t& constant,
+                                 const types::complex_logical_type& type,
+                                 T& predicate) {
+        if (constant.type().to_physical_type() == type.to_physical_type()) {
+            predicate = constant.value<T>();
+            return true;
+        }
+        if (!types::is_numeric(constant.type().type()) || !types::is_numeric(type.type())) {
+            return false;
+        }
+        auto cast = constant.cast_as(type);
+        if (cast.cast_as(constant.type()) != constant) {
+            return false;
+        }
+        predicate = cast.value<T>();
+        return true;
+    }
+
+    template<class T>
+    static void filter_indexing_typed(vector::vector_t& vector,
+                                      vector::unified_vector_format& uvf,
+                                      const constant_filter_t& filter,
+                                      vector::indexing_vector_t& indexing,
+                                      uint64_t& approved_tuple_count) {
+        T predicate;
+        if (!filter_predicate<T>(filter.constant, vector.type(), predicate)) {
+            filter_selection_generic(vector, uvf, filter, indexing, approved_tuple_count);
+            return;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            // floating point equality is approximate for logical values, keep it that way
+            if (filter.filter_type == expressions::compare_type::eq ||
+                filter.filter_type == expressions::compare_type::ne) {
+                filter_selection_generic(vector, uvf, filter, indexing, approved_tuple_count);
+                return;
+            }
+        }
+        filter_selection_switch<T>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+    }
+
     uint64_t column_segment_t::filter_indexing(vector::indexing_vector_t& indexing,
                                                vector::vector_t& vector,
                                                vector::unified_vector_format& uvf,
@@ -981,85 +1058,62 @@ namespace components::table {
         assert(filter.filter_type != expressions::compare_type::invalid);
         assert(!is_union_compare_condition(filter.filter_type));
         auto& constant_filter = filter.cast<constant_filter_t>();
+        if (filter.filter_type == expressions::compare_type::all_true) {
+            return approved_tuple_count;
+        }
+        if (constant_filter.constant.is_null()) {
+            // comparison with null is never true
+            approved_tuple_count = 0;
+            return approved_tuple_count;
+        }
+        if (filter.filter_type == expressions::compare_type::regex) {
+            if (!constant_filter.matcher || vector.type().to_physical_type() != types::physical_type::STRING) {
+                approved_tuple_count = 0;
+                return approved_tuple_count;
+            }
+            filter_selection_regex(uvf, *constant_filter.matcher, indexing, approved_tuple_count);
+            return approved_tuple_count;
+        }
         switch (vector.type().to_physical_type()) {
-            case types::physical_type::UINT8: {
-                auto predicate = constant_filter.constant.value<uint8_t>();
-                filter_selection_switch<uint8_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case types::physical_type::UINT8:
+                filter_indexing_typed<uint8_t>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
-            case types::physical_type::UINT16: {
-                auto predicate = constant_filter.constant.value<uint16_t>();
-                filter_selection_switch<uint16_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case types::physical_type::UINT16:
+                filter_indexing_typed<uint16_t>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
-            case types::physical_type::UINT32: {
-                auto predicate = constant_filter.constant.value<uint32_t>();
-                filter_selection_switch<uint32_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case types::physical_type::UINT32:
+                filter_indexing_typed<uint32_t>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
-            case types::physical_type::UINT64: {
-                auto predicate = constant_filter.constant.value<uint64_t>();
-                filter_selection_switch<uint64_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case types::physical_type::UINT64:
+                filter_indexing_typed<uint64_t>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
-            // case types::physical_type::UINT128: {
-            //     auto predicate = constant_filter.constant.value<uint128_t>();
-            //     filter_selection_switch<uhugeint_t>(uvf, predicate, indexing, approved_tuple_count,
-            //                                       filter.filter_type);
-            //     break;
-            // }
-            case types::physical_type::INT8: {
-                auto predicate = constant_filter.constant.value<int8_t>();
-                filter_selection_switch<int8_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case types::physical_type::INT8:
+                filter_indexing_typed<int8_t>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
-            case types::physical_type::INT16: {
-                auto predicate = constant_filter.constant.value<int16_t>();
-                filter_selection_switch<int16_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case types::physical_type::INT16:
+                filter_indexing_typed<int16_t>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
-            case types::physical_type::INT32: {
-                auto predicate = constant_filter.constant.value<int32_t>();
-                filter_selection_switch<int32_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case types::physical_type::INT32:
+                filter_indexing_typed<int32_t>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
-            case types::physical_type::INT64: {
-                auto predicate = constant_filter.constant.value<int64_t>();
-                filter_selection_switch<int64_t>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case types::physical_type::INT64:
+                filter_indexing_typed<int64_t>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
-            // case types::physical_type::INT128: {
-            //     auto predicate = constant_filter.constant.value<int128_t>();
-            //     filter_selection_switch<hugeint_t>(uvf, predicate, indexing, approved_tuple_count,
-            //                                      filter.filter_type);
-            //     break;
-            // }
-            case types::physical_type::FLOAT: {
-                auto predicate = constant_filter.constant.value<float>();
-                filter_selection_switch<float>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case types::physical_type::FLOAT:
+                filter_indexing_typed<float>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
-            case types::physical_type::DOUBLE: {
-                auto predicate = constant_filter.constant.value<double>();
-                filter_selection_switch<double>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case types::physical_type::DOUBLE:
+                filter_indexing_typed<double>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
-            case types::physical_type::STRING: {
-                auto predicate = constant_filter.constant.value<std::string_view>();
-                filter_selection_switch<std::string_view>(uvf,
-                                                          predicate,
-                                                          indexing,
-                                                          approved_tuple_count,
-                                                          filter.filter_type);
+            case types::physical_type::STRING:
+                filter_indexing_typed<std::string_view>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
-            case types::physical_type::BOOL: {
-                auto predicate = constant_filter.constant.value<bool>();
-                filter_selection_switch<bool>(uvf, predicate, indexing, approved_tuple_count, filter.filter_type);
+            case types::physical_type::BOOL:
+                filter_indexing_typed<bool>(vector, uvf, constant_filter, indexing, approved_tuple_count);
                 break;
-            }
             default:
-                throw std::logic_error("Invalid type for filter value");
+                filter_selection_generic(vector, uvf, constant_filter, indexing, approved_tuple_count);
+                break;
         }
         return approved_tuple_count;
     }
@@ -3,6 +3,7 @@
 #include <components/types/logical_value.hpp>
 #include <components/vector/vector.hpp>
 
+#include "segment_statistics.hpp"
 #include "segment_tree.hpp"
 #include "storage/block_handle.hpp"
 
@@ -93,6 +94,8 @@ namespace components::table {
 
         compressed_segment_state* segment_state() { return segment_state_.get(); }
 
+        segment_statistics_t& statistics() { return statistics_; }
+
     private:
         void scan(column_scan_state& state, uint64_t scan_count, vector::vector_t& result);
         void
@@ -102,6 +105,7 @@ namespace components::table {
         uint64_t offset_;
         uint64_t segment_size_;
         std::unique_ptr<compressed_segment_state> segment_state_;
+        segment_statistics_t statistics_;
     };
 
 } // namespace components::table
\ No newline at end of file
@@ -8,7 +8,23 @@
 
 namespace components::table {
 
+    constant_filter_t::constant_filter_t(expressions::compare_type comparison_type,
+                                         types::logical_value_t constant,
+                                         uint64_t table_index)
+        : table_filter_t(comparison_type)
+        , constant(std::move(constant))
+        , table_index(table_index) {
+        if (filter_type == expressions::compare_type::regex &&
+            this->constant.type().to_physical_type() == types::physical_type::STRING) {
+            matcher = std::make_shared<const core::string_matcher_t>(this->constant.value<std::string_view>());
+        }
+    }
+
     bool constant_filter_t::compare(const types::logical_value_t& value) const {
+        if (filter_type == expressions::compare_type::regex) {
+            return matcher && value.type().to_physical_type() == types::physical_type::STRING &&
+                   matcher->match(value.value<std::string_view>());
+        }
         auto comp = value.compare(constant);
         if (comp == types::compare_t::equals) {
             switch (filter_type) {
@@ -48,7 +64,10 @@ namespace components::table {
     }
 
     std::unique_ptr<table_filter_t> constant_filter_t::copy() const {
-        return std::make_unique<constant_filter_t>(filter_type, constant, table_index);
+        auto result = std::make_unique<constant_filter_t>(expressions::compare_type::invalid, constant, table_index);
+        result->filter_type = filter_type;
+        result->matcher = matcher;
+        return result;
     }
 
     bool conjunction_filter_t::equals(const table_filter_t& other) const {
@@ -56,11 +75,19 @@ namespace components::table {
     }
 
     std::unique_ptr<table_filter_t> conjunction_or_filter_t::copy() const {
-        return std::make_unique<conjunction_or_filter_t>();
+        auto result = std::make_unique<conjunction_or_filter_t>();
+        for (const auto& child_filter : child_filters) {
+            result->child_filters.emplace_back(child_filter->copy());
+        }
+        return result;
     }
 
     std::unique_ptr<table_filter_t> conjunction_and_filter_t::copy() const {
-        return std::make_unique<conjunction_and_filter_t>();
+        auto result = std::make_unique<conjunction_and_filter_t>();
+        for (const auto& child_filter : child_filters) {
+            result->child_filters.emplace_back(child_filter->copy());
+        }
+        return result;
     }
 
     void column_scan_state::initialize(const types::complex_logical_type& type,
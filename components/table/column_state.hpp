@@ -6,6 +6,7 @@
 #include <vector>
 
 #include <components/table/storage/buffer_handle.hpp>
+#include <core/string_matcher/string_matcher.hpp>
 
 #include "segment_tree.hpp"
 
@@ -91,10 +92,7 @@ namespace components::table {
     public:
         constant_filter_t(expressions::compare_type comparison_type,
                           types::logical_value_t constant,
-                          uint64_t table_index)
-            : table_filter_t(comparison_type)
-            , constant(std::move(constant))
-            , table_index(table_index) {}
+                          uint64_t table_index);
 
         bool compare(const types::logical_value_t& value) const;
         template<typename T>
@@ -104,6 +102,8 @@ namespace components::table {
 
         types::logical_value_t constant;
         uint64_t table_index;
+        // compiled pattern of a regex filter, shared by the copies
+        std::shared_ptr<const core::string_matcher_t> matcher;
     };
 
     template<typename T>
@@ -2,9 +2,11 @@
 
 #include <components/vector/data_chunk.hpp>
 #include <components/vector/vector_operations.hpp>
+#include <cstring>
 #include <unordered_set>
 
 #include "row_group.hpp"
+#include "storage/meta_block.hpp"
 
 namespace components::table {
 
@@ -103,6 +105,39 @@ namespace components::table {
         row_groups_->initialize_scan_with_offset(state.table_state, column_ids, start_row, end_row);
     }
 
+    uint64_t data_table_t::max_threads() const {
+        return row_groups_->total_rows() / row_groups_->row_group_size() + 1;
+    }
+
+    void data_table_t::initialize_parallel_scan(parallel_table_scan_state& state) {
+        state.next_row_group = 0;
+        state.max_row = row_groups_->total_rows();
+    }
+
+    bool data_table_t::next_parallel_scan(parallel_table_scan_state& state,
+                                          table_scan_state& scan_state,
+                                          const std::vector<storage_index_t>& column_ids,
+                                          const table_filter_t* filter) {
+        while (true) {
+            auto index = state.next_row_group++;
+            auto* row_group = row_groups_->row_group(static_cast<int64_t>(index));
+            if (!row_group || row_group->start >= state.max_row) {
+                return false;
+            }
+            scan_state.initialize(column_ids, filter);
+            scan_state.table_state.batch_index = index;
+            auto max_row = std::min<uint64_t>(state.max_row, row_group->start + row_group->count);
+            // row groups pruned by the zone maps are skipped
+            if (collection_t::initialize_scan_in_row_group(scan_state.table_state,
+                                                           *row_groups_,
+                                                           *row_group,
+                                                           0,
+                                                           max_row)) {
+                return true;
+            }
+        }
+    }
+
     uint64_t data_table_t::row_group_size() const { return row_groups_->row_group_size(); }
 
     std::shared_ptr<collection_t> data_table_t::row_group() const { return row_groups_; }
@@ -319,4 +354,331 @@ namespace components::table {
         return row_groups_->get_column_segment_info();
     }
 
-} // namespace components::table
\ No newline at end of file
+    namespace {
+
+        bool is_checkpoint_supported(const types::complex_logical_type& type) {
+            switch (type.type()) {
+                case types::logical_type::STRING_LITERAL:
+                    return true;
+                case types::logical_type::LIST:
+                case types::logical_type::ARRAY:
+                    return is_checkpoint_supported(type.child_type());
+                case types::logical_type::STRUCT:
+                    for (const auto& child : type.child_types()) {
+                        if (!is_checkpoint_supported(child)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                default:
+                    break;
+            }
+            switch (type.to_physical_type()) {
+                case types::physical_type::BOOL:
+                case types::physical_type::UINT8:
+                case types::physical_type::INT8:
+                case types::physical_type::UINT16:
+                case types::physical_type::INT16:
+                case types::physical_type::UINT32:
+                case types::physical_type::INT32:
+                case types::physical_type::UINT64:
+                case types::physical_type::INT64:
+                case types::physical_type::UINT128:
+                case types::physical_type::INT128:
+                case types::physical_type::FLOAT:
+                case types::physical_type::DOUBLE:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        // type id and alias, followed by the parameters of decimal and nested types
+        void write_type(storage::metadata_writer_t& writer, const types::complex_logical_type& type) {
+            writer.write(type.type());
+            writer.write_string(type.has_alias() ? type.alias() : std::string());
+            switch (type.type()) {
+                case types::logical_type::DECIMAL: {
+                    auto* decimal = static_cast<types::decimal_logical_type_extension*>(type.extension());
+                    writer.write<uint8_t>(decimal->width());
+                    writer.write<uint8_t>(decimal->scale());
+                    break;
+                }
+                case types::logical_type::LIST:
+                    write_type(writer, type.child_type());
+                    break;
+                case types::logical_type::ARRAY:
+                    write_type(writer, type.child_type());
+                    writer.write<uint64_t>(static_cast<types::array_logical_type_extension*>(type.extension())->size());
+                    break;
+                case types::logical_type::STRUCT:
+                    writer.write<uint64_t>(type.child_types().size());
+                    for (const auto& child : type.child_types()) {
+                        write_type(writer, child);
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        types::complex_logical_type read_type(storage::metadata_reader_t& reader) {
+            auto type = reader.read<types::logical_type>();
+            auto alias = reader.read_string();
+            switch (type) {
+                case types::logical_type::DECIMAL: {
+                    auto width = reader.read<uint8_t>();
+                    auto scale = reader.read<uint8_t>();
+                    return types::complex_logical_type::create_decimal(width, scale, std::move(alias));
+                }
+                case types::logical_type::LIST:
+                    return types::complex_logical_type::create_list(read_type(reader), std::move(alias));
+                case types::logical_type::ARRAY: {
+                    auto child = read_type(reader);
+                    auto size = reader.read<uint64_t>();
+                    return types::complex_logical_type::create_array(child, size, std::move(alias));
+                }
+                case types::logical_type::STRUCT: {
+                    std::vector<types::complex_logical_type> fields(reader.read<uint64_t>());
+                    for (auto& field : fields) {
+                        field = read_type(reader);
+                    }
+                    return types::complex_logical_type::create_struct(fields, std::move(alias));
+                }
+                default:
+                    return types::complex_logical_type(type, std::move(alias));
+            }
+        }
+
+        // validity bitmask first, then values: fixed width values are stored for every row, strings for valid rows
+        // only, struct fields and array items follow as child vectors, lists store the length of every row and then
+        // the items of all rows one after another
+        void write_vector(storage::metadata_writer_t& writer, vector::vector_t& vector, uint64_t count) {
+            vector.flatten(count);
+
+            std::vector<uint64_t> validity(vector::validity_mask_t::validity_mask_size(count) / sizeof(uint64_t), 0);
+            for (uint64_t i = 0; i < count; i++) {
+                if (vector.validity().row_is_valid(i)) {
+                    validity[i / 64] |= uint64_t(1) << (i % 64);
+                }
+            }
+            writer.write_data(validity.data(), validity.size() * sizeof(uint64_t));
+
+            switch (vector.type().type()) {
+                case types::logical_type::STRING_LITERAL: {
+                    auto* strings = vector.data<std::string_view>();
+                    for (uint64_t i = 0; i < count; i++) {
+                        if (vector.validity().row_is_valid(i)) {
+                            writer.write_string(strings[i]);
+                        }
+                    }
+                    return;
+                }
+                case types::logical_type::STRUCT:
+                    for (auto& entry : vector.entries()) {
+                        write_vector(writer, *entry, count);
+                    }
+                    return;
+                case types::logical_type::ARRAY: {
+                    auto size = static_cast<types::array_logical_type_extension*>(vector.type().extension())->size();
+                    write_vector(writer, vector.entry(), count * size);
+                    return;
+                }
+                case types::logical_type::LIST: {
+                    auto* entries = vector.data<types::list_entry_t>();
+                    std::vector<uint64_t> lengths(count, 0);
+                    uint64_t items = 0;
+                    for (uint64_t i = 0; i < count; i++) {
+                        if (vector.validity().row_is_valid(i)) {
+                            lengths[i] = entries[i].length;
+                            items += lengths[i];
+                        }
+                    }
+                    writer.write_data(lengths.data(), lengths.size() * sizeof(uint64_t));
+                    vector::indexing_vector_t indexing(vector.resource(), items);
+                    uint64_t position = 0;
+                    for (uint64_t i = 0; i < count; i++) {
+                        for (uint64_t j = 0; j < lengths[i]; j++) {
+                            indexing.set_index(position++, entries[i].offset + j);
+                        }
+                    }
+                    vector::vector_t children(vector.entry(), indexing, items);
+                    write_vector(writer, children, items);
+                    return;
+                }
+                default:
+                    writer.write_data(vector.data(), count * vector.type().size());
+                    return;
+            }
+        }
+
+        void read_vector(storage::metadata_reader_t& reader,
+                         vector::vector_t& vector,
+                         uint64_t count,
+                         std::vector<std::string>& strings) {
+            std::vector<uint64_t> validity(vector::validity_mask_t::validity_mask_size(count) / sizeof(uint64_t));
+            reader.read_data(validity.data(), validity.size() * sizeof(uint64_t));
+            for (uint64_t i = 0; i < count; i++) {
+                if (!(validity[i / 64] & (uint64_t(1) << (i % 64)))) {
+                    vector.validity().set_invalid(i);
+                }
+            }
+
+            switch (vector.type().type()) {
+                case types::logical_type::STRING_LITERAL: {
+                    auto* data = vector.data<std::string_view>();
+                    for (uint64_t i = 0; i < count; i++) {
+                        if (vector.validity().row_is_valid(i)) {
+                            data[i] = strings.emplace_back(reader.read_string());
+                        } else {
+                            data[i] = std::string_view();
+                        }
+                    }
+                    return;
+                }
+                case types::logical_type::STRUCT:
+                    for (auto& entry : vector.entries()) {
+                        read_vector(reader, *entry, count, strings);
+                    }
+                    return;
+                case types::logical_type::ARRAY: {
+                    auto size = static_cast<types::array_logical_type_extension*>(vector.type().extension())->size();
+                    read_vector(reader, vector.entry(), count * size, strings);
+                    return;
+                }
+                case types::logical_type::LIST: {
+                    std::vector<uint64_t> lengths(count);
+                    reader.read_data(lengths.data(), lengths.size() * sizeof(uint64_t));
+                    auto* entries = vector.data<types::list_entry_t>();
+                    uint64_t items = 0;
+                    for (uint64_t i = 0; i < count; i++) {
+                        entries[i] = types::list_entry_t{items, lengths[i]};
+                        items += lengths[i];
+                    }
+                    vector.reserve(items);
+                    read_vector(reader, vector.entry(), items, strings);
+                    vector.set_list_size(items);
+                    return;
+                }
+                default:
+                    reader.read_data(vector.data(), count * vector.type().size());
+                    return;
+            }
+        }
+
+    } // namespace
+
+    void data_table_t::checkpoint(storage::metadata_writer_t& writer) {
+        writer.write<uint64_t>(column_definitions_.size());
+        for (const auto& column : column_definitions_) {
+            if (!is_checkpoint_supported(column.type())) {
+                throw std::runtime_error("checkpoint is not supported for column " + column.name() + " of table " +
+                                         name_);
+            }
+            writer.write_string(column.name());
+            write_type(writer, column.type());
+        }
+
+        auto total_rows = row_groups_->total_rows();
+        auto group_size = row_group_size();
+        writer.write<uint64_t>(total_rows);
+        for (uint64_t start = 0; start < total_rows; start += group_size) {
+            auto count = std::min(group_size, total_rows - start);
+            writer.write<uint64_t>(count);
+            // committed scan keeps deleted rows in place, so the chunks line up with row ids
+            scan_table_segment(start, count, [&](vector::data_chunk_t& chunk) {
+                writer.write<uint64_t>(chunk.size());
+                for (auto& column : chunk.data) {
+                    write_vector(writer, column, chunk.size());
+                }
+            });
+        }
+
+        std::vector<int64_t> deleted;
+        int64_t next_row = 0;
+        // an empty table has no row group to scan
+        if (total_rows > 0) {
+            std::pmr::vector<types::complex_logical_type> types(resource_);
+            types.emplace_back(types::logical_type::BIGINT);
+            vector::data_chunk_t row_ids(resource_, types);
+            table_scan_state state(resource_);
+            initialize_scan(state, {storage_index_t()});
+            while (true) {
+                row_ids.reset();
+                scan(row_ids, state);
+                if (row_ids.size() == 0) {
+                    break;
+                }
+                row_ids.data[0].flatten(row_ids.size());
+                auto* ids = row_ids.data[0].data<int64_t>();
+                for (uint64_t i = 0; i < row_ids.size(); i++) {
+                    while (next_row < ids[i]) {
+                        deleted.push_back(next_row++);
+                    }
+                    next_row = ids[i] + 1;
+                }
+            }
+        }
+        while (next_row < static_cast<int64_t>(total_rows)) {
+            deleted.push_back(next_row++);
+        }
+        writer.write<uint64_t>(deleted.size());
+        writer.write_data(deleted.data(), deleted.size() * sizeof(int64_t));
+    }
+
+    std::vector<column_definition_t> data_table_t::load_columns(storage::metadata_reader_t& reader) {
+        std::vector<column_definition_t> columns;
+        auto column_count = reader.read<uint64_t>();
+        columns.reserve(column_count);
+        for (uint64_t i = 0; i < column_count; i++) {
+            auto column_name = reader.read_string();
+            columns.emplace_back(std::move(column_name), read_type(reader));
+        }
+        return columns;
+    }
+
+    std::unique_ptr<data_table_t> data_table_t::load(std::pmr::memory_resource* resource,
+                                                     storage::block_manager_t& block_manager,
+                                                     storage::metadata_reader_t& reader,
+                                                     std::string name) {
+        auto columns = load_columns(reader);
+        auto column_count = columns.size();
+        auto table = std::make_unique<data_table_t>(resource, block_manager, std::move(columns), std::move(name));
+
+        auto total_rows = reader.read<uint64_t>();
+        table_append_state state(resource);
+        table->append_lock(state);
+        table->initialize_append(state);
+        for (uint64_t loaded = 0; loaded < total_rows;) {
+            auto group_count = reader.read<uint64_t>();
+            for (uint64_t group_loaded = 0; group_loaded < group_count;) {
+                auto count = reader.read<uint64_t>();
+                vector::data_chunk_t chunk(resource, table->copy_types(), count);
+                chunk.set_cardinality(count);
+                // appended strings are copied into the segments, the chunk only has to outlive append()
+                std::vector<std::string> strings;
+                strings.reserve(count * column_count);
+                for (auto& column : chunk.data) {
+                    read_vector(reader, column, count, strings);
+                }
+                table->append(chunk, state);
+                group_loaded += count;
+            }
+            loaded += group_count;
+        }
+        table->finalize_append(state);
+
+        auto deleted_count = reader.read<uint64_t>();
+        if (deleted_count > 0) {
+            auto delete_state = table->initialize_delete({});
+            vector::vector_t row_ids(resource, types::logical_type::BIGINT, vector::DEFAULT_VECTOR_CAPACITY);
+            for (uint64_t offset = 0; offset < deleted_count; offset += vector::DEFAULT_VECTOR_CAPACITY) {
+                auto count = std::min<uint64_t>(vector::DEFAULT_VECTOR_CAPACITY, deleted_count - offset);
+                reader.read_data(row_ids.data<int64_t>(), count * sizeof(int64_t));
+                table->delete_rows(*delete_state, row_ids, count);
+            }
+        }
+        return table;
+    }
+
+} // namespace components::table
@@ -4,6 +4,11 @@
 
 namespace components::table {
 
+    namespace storage {
+        class metadata_writer_t;
+        class metadata_reader_t;
+    } // namespace storage
+
     class data_table_t {
     public:
         data_table_t(std::pmr::memory_resource* resource,
@@ -24,7 +29,15 @@ namespace components::table {
                              const std::vector<storage_index_t>& column_ids,
                              const table_filter_t* filter = nullptr);
 
+        // upper bound of useful workers of a parallel scan: the number of row groups
         uint64_t max_threads() const;
+        void initialize_parallel_scan(parallel_table_scan_state& state);
+        // claims the next row group morsel and prepares `scan_state` to read it with scan(),
+        // batch_index of the local state is the morsel number; returns false when all morsels are taken
+        bool next_parallel_scan(parallel_table_scan_state& state,
+                                table_scan_state& scan_state,
+                                const std::vector<storage_index_t>& column_ids,
+                                const table_filter_t* filter = nullptr);
 
         void scan(vector::data_chunk_t& result, table_scan_state& state);
 
@@ -79,6 +92,15 @@ namespace components::table {
 
         uint64_t calculate_size();
 
+        // writes column definitions, row groups and deleted rows; row ids are preserved by load()
+        void checkpoint(storage::metadata_writer_t& writer);
+        static std::unique_ptr<data_table_t> load(std::pmr::memory_resource* resource,
+                                                  storage::block_manager_t& block_manager,
+                                                  storage::metadata_reader_t& reader,
+                                                  std::string name = "temp");
+        // reads only the column definitions written by checkpoint()
+        static std::vector<column_definition_t> load_columns(storage::metadata_reader_t& reader);
+
     private:
         void initialize_scan_with_offset(table_scan_state& state,
                                          const std::vector<storage_index_t>& column_ids,
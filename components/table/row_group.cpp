@@ -1,5 +1,7 @@
 #include "row_group.hpp"
 
+#include <array>
+
 #include <components/table/storage/buffer_manager.hpp>
 #include <vector/data_chunk.hpp>
 
@@ -77,6 +79,14 @@ namespace components::table {
         if (state.max_row_group_row == 0) {
             return false;
         }
+        auto* filter = state.filter();
+        auto offset_row = vector_offset * vector::DEFAULT_VECTOR_CAPACITY;
+        if (filter && offset_row < state.max_row_group_row &&
+            check_zonemap(*filter, row_number, state.max_row_group_row - offset_row) ==
+                filter_propagate_result_t::ALWAYS_FALSE) {
+            state.max_row_group_row = 0;
+            return false;
+        }
         assert(!state.column_scans.empty());
         for (uint64_t i = 0; i < column_ids.size(); i++) {
             const auto& column = column_ids[i];
@@ -98,6 +108,12 @@ namespace components::table {
         if (state.max_row_group_row == 0) {
             return false;
         }
+        auto* filter = state.filter();
+        if (filter && check_zonemap(*filter, start, state.max_row_group_row) ==
+                          filter_propagate_result_t::ALWAYS_FALSE) {
+            state.max_row_group_row = 0;
+            return false;
+        }
         assert(!state.column_scans.empty());
         for (uint64_t i = 0; i < column_ids.size(); i++) {
             auto column = column_ids[i];
@@ -200,21 +216,115 @@ namespace components::table {
         }
     }
 
-    bool row_group_t::check_zonemap_segments(collection_scan_state& state) { return true; }
+    filter_propagate_result_t
+    row_group_t::check_zonemap(const table_filter_t& filter, uint64_t start_row, uint64_t count) {
+        switch (filter.filter_type) {
+            case expressions::compare_type::union_or: {
+                auto& conjunction_or = filter.cast<conjunction_or_filter_t>();
+                bool always_false = true;
+                for (auto& child_filter : conjunction_or.child_filters) {
+                    auto child_result = check_zonemap(*child_filter, start_row, count);
+                    if (child_result == filter_propagate_result_t::ALWAYS_TRUE) {
+                        return filter_propagate_result_t::ALWAYS_TRUE;
+                    }
+                    always_false &= child_result == filter_propagate_result_t::ALWAYS_FALSE;
+                }
+                return always_false ? filter_propagate_result_t::ALWAYS_FALSE
+                                    : filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+            }
+            case expressions::compare_type::union_and: {
+                auto& conjunction_and = filter.cast<conjunction_and_filter_t>();
+                bool always_true = true;
+                for (auto& child_filter : conjunction_and.child_filters) {
+                    auto child_result = check_zonemap(*child_filter, start_row, count);
+                    if (child_result == filter_propagate_result_t::ALWAYS_FALSE) {
+                        return filter_propagate_result_t::ALWAYS_FALSE;
+                    }
+                    always_true &= child_result == filter_propagate_result_t::ALWAYS_TRUE;
+                }
+                return always_true ? filter_propagate_result_t::ALWAYS_TRUE
+                                   : filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+            }
+            case expressions::compare_type::invalid: {
+                throw std::logic_error("invalid type for filter selection");
+            }
+            default: {
+                auto& constant_filter = filter.cast<constant_filter_t>();
+                return get_column(constant_filter.table_index).check_zonemap(start_row, count, constant_filter);
+            }
+        }
+    }
+
+    bool row_group_t::check_zonemap_segments(collection_scan_state& state) {
+        auto* filter = state.filter();
+        if (!filter) {
+            return true;
+        }
+        uint64_t current_row = state.vector_index * vector::DEFAULT_VECTOR_CAPACITY;
+        auto max_count = std::min<uint64_t>(vector::DEFAULT_VECTOR_CAPACITY, state.max_row_group_row - current_row);
+        if (check_zonemap(*filter, start + current_row, max_count) != filter_propagate_result_t::ALWAYS_FALSE) {
+            return true;
+        }
+        // no row of this vector can pass the filter: skip it in every column without scanning
+        next_vector(state);
+        return false;
+    }
 
     void row_group_t::filter_indexing(std::pmr::memory_resource* resource,
                                       vector::indexing_vector_t& indexing,
                                       const table_filter_t* filter,
+                                      uint64_t vector_index,
                                       uint64_t& approved_tuple_count) {
-        vector::indexing_vector_t new_indexing(resource, approved_tuple_count);
-        uint64_t result_count = 0;
-        for (uint64_t i = 0; i < approved_tuple_count; i++) {
-            auto idx = indexing.get_index(i);
-            new_indexing.set_index(result_count, idx);
-            result_count += check_predicate(idx, filter);
+        switch (filter->filter_type) {
+            case expressions::compare_type::union_and: {
+                auto& conjunction_and = filter->cast<conjunction_and_filter_t>();
+                for (auto& child_filter : conjunction_and.child_filters) {
+                    if (approved_tuple_count == 0) {
+                        return;
+                    }
+                    filter_indexing(resource, indexing, child_filter.get(), vector_index, approved_tuple_count);
+                }
+                return;
+            }
+            case expressions::compare_type::union_or: {
+                // every child narrows its own copy of the selection, the union keeps the original order
+                auto& conjunction_or = filter->cast<conjunction_or_filter_t>();
+                std::array<bool, vector::DEFAULT_VECTOR_CAPACITY> matches{};
+                for (auto& child_filter : conjunction_or.child_filters) {
+                    vector::indexing_vector_t child_indexing(indexing);
+                    uint64_t child_count = approved_tuple_count;
+                    filter_indexing(resource, child_indexing, child_filter.get(), vector_index, child_count);
+                    for (uint64_t i = 0; i < child_count; i++) {
+                        matches[child_indexing.get_index(i)] = true;
+                    }
+                }
+                vector::indexing_vector_t new_indexing(resource, approved_tuple_count);
+                uint64_t result_count = 0;
+                for (uint64_t i = 0; i < approved_tuple_count; i++) {
+                    auto idx = indexing.get_index(i);
+                    new_indexing.set_index(result_count, idx);
+                    result_count += matches[idx];
+                }
+                indexing = new_indexing;
+                approved_tuple_count = result_count;
+                return;
+            }
+            case expressions::compare_type::invalid: {
+                throw std::logic_error("invalid type for filter selection");
+            }
+            default: {
+                // the filtered column is scanned on its own: it does not have to be projected
+                auto& constant_filter = filter->cast<constant_filter_t>();
+                auto& column = get_column(constant_filter.table_index);
+                column_scan_state column_state;
+                column_state.initialize(column.type());
+                column.initialize_scan_with_offset(column_state,
+                                                   start + vector_index * vector::DEFAULT_VECTOR_CAPACITY);
+                vector::vector_t result(resource, column.type());
+                column.filter(vector_index, column_state, result, indexing, approved_tuple_count, *filter);
+                return;
+            }
         }
-        indexing = new_indexing;
-        approved_tuple_count = result_count;
     }
 
     template<table_scan_type TYPE>
@@ -279,7 +389,11 @@ namespace components::table {
                 }
                 if (filter) {
                     assert(ALLOW_UPDATES);
-                    filter_indexing(collection_->resource(), indexing, filter, approved_tuple_count);
+                    filter_indexing(collection_->resource(),
+                                    indexing,
+                                    filter,
+                                    state.vector_index,
+                                    approved_tuple_count);
                 }
                 if (approved_tuple_count == 0) {
                     result.reset();
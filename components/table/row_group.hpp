@@ -50,7 +50,7 @@ namespace components::table {
 
         bool initialize_scan(collection_scan_state& state);
         bool initialize_scan_with_offset(collection_scan_state& state, uint64_t vector_offset);
-        bool check_zonemap(scan_filter_info& filters);
+        filter_propagate_result_t check_zonemap(const table_filter_t& filter, uint64_t start_row, uint64_t count);
         bool check_zonemap_segments(collection_scan_state& state);
         void scan(collection_scan_state& state, vector::data_chunk_t& result);
         void scan_committed(collection_scan_state& state, vector::data_chunk_t& result, table_scan_type type);
@@ -112,6 +112,7 @@ namespace components::table {
         void filter_indexing(std::pmr::memory_resource* resource,
                              vector::indexing_vector_t& indexing,
                              const table_filter_t* filter,
+                             uint64_t vector_index,
                              uint64_t& approved_tuple_count);
 
         template<table_scan_type TYPE>
@@ -0,0 +1,173 @@
+#include "segment_statistics.hpp"
+
+#include "column_state.hpp"
+
+namespace components::table {
+
+    namespace {
+
+        bool comparable(const types::logical_value_t& value, const types::logical_value_t& constant) {
+            if (constant.is_null()) {
+                return false;
+            }
+            if (value.type().type() == constant.type().type()) {
+                return true;
+            }
+            return types::is_numeric(value.type().type()) && types::is_numeric(constant.type().type());
+        }
+
+    } // namespace
+
+    segment_statistics_t::segment_statistics_t(const types::complex_logical_type& type, bool empty)
+        : supported_(is_supported(type))
+        , known_(empty && supported_) {}
+
+    segment_statistics_t::segment_statistics_t(segment_statistics_t&& other) noexcept {
+        std::lock_guard guard(other.lock_);
+        supported_ = other.supported_;
+        known_ = other.known_;
+        has_values_ = other.has_values_;
+        null_count_ = other.null_count_;
+        min_ = std::move(other.min_);
+        max_ = std::move(other.max_);
+    }
+
+    bool segment_statistics_t::is_supported(const types::complex_logical_type& type) {
+        switch (type.type()) {
+            case types::logical_type::TINYINT:
+            case types::logical_type::SMALLINT:
+            case types::logical_type::INTEGER:
+            case types::logical_type::BIGINT:
+            case types::logical_type::UTINYINT:
+            case types::logical_type::USMALLINT:
+            case types::logical_type::UINTEGER:
+            case types::logical_type::UBIGINT:
+            case types::logical_type::FLOAT:
+            case types::logical_type::DOUBLE:
+            case types::logical_type::STRING_LITERAL:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool segment_statistics_t::has_stats() const {
+        std::lock_guard guard(lock_);
+        return known_ && has_values_;
+    }
+
+    uint64_t segment_statistics_t::null_count() const {
+        std::lock_guard guard(lock_);
+        return null_count_;
+    }
+
+    types::logical_value_t segment_statistics_t::min() const {
+        std::lock_guard guard(lock_);
+        return min_;
+    }
+
+    types::logical_value_t segment_statistics_t::max() const {
+        std::lock_guard guard(lock_);
+        return max_;
+    }
+
+    void segment_statistics_t::update(const types::logical_value_t& value) {
+        if (value.is_null()) {
+            // updated nulls are not stored as placeholders, the range can not be trusted anymore
+            set_unknown();
+            return;
+        }
+        merge(value, value, 0);
+    }
+
+    void segment_statistics_t::set_unknown() {
+        std::lock_guard guard(lock_);
+        known_ = false;
+    }
+
+    void segment_statistics_t::merge(types::logical_value_t min, types::logical_value_t max, uint64_t null_count) {
+        std::lock_guard guard(lock_);
+        if (!known_) {
+            return;
+        }
+        null_count_ += null_count;
+        if (!has_values_) {
+            min_ = std::move(min);
+            max_ = std::move(max);
+            has_values_ = true;
+            return;
+        }
+        if (min < min_) {
+            min_ = std::move(min);
+        }
+        if (max_ < max) {
+            max_ = std::move(max);
+        }
+    }
+
+    filter_propagate_result_t segment_statistics_t::check_zonemap(const constant_filter_t& filter) const {
+        std::lock_guard guard(lock_);
+        if (!known_ || !has_values_ || !comparable(min_, filter.constant)) {
+            return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+        }
+        const auto& constant = filter.constant;
+        auto min_cmp = min_.compare(constant);
+        auto max_cmp = max_.compare(constant);
+        switch (filter.filter_type) {
+            case expressions::compare_type::eq:
+                if (min_cmp == types::compare_t::more || max_cmp == types::compare_t::less) {
+                    return filter_propagate_result_t::ALWAYS_FALSE;
+                }
+                if (min_cmp == types::compare_t::equals && max_cmp == types::compare_t::equals) {
+                    return filter_propagate_result_t::ALWAYS_TRUE;
+                }
+                break;
+            case expressions::compare_type::ne:
+                if (min_cmp == types::compare_t::equals && max_cmp == types::compare_t::equals) {
+                    return filter_propagate_result_t::ALWAYS_FALSE;
+                }
+                if (min_cmp == types::compare_t::more || max_cmp == types::compare_t::less) {
+                    return filter_propagate_result_t::ALWAYS_TRUE;
+                }
+                break;
+            case expressions::compare_type::lt:
+                if (min_cmp != types::compare_t::less) {
+                    return filter_propagate_result_t::ALWAYS_FALSE;
+                }
+                if (max_cmp == types::compare_t::less) {
+                    return filter_propagate_result_t::ALWAYS_TRUE;
+                }
+                break;
+            case expressions::compare_type::lte:
+                if (min_cmp == types::compare_t::more) {
+                    return filter_propagate_result_t::ALWAYS_FALSE;
+                }
+                if (max_cmp != types::compare_t::more) {
+                    return filter_propagate_result_t::ALWAYS_TRUE;
+                }
+                break;
+            case expressions::compare_type::gt:
+                if (max_cmp != types::compare_t::more) {
+                    return filter_propagate_result_t::ALWAYS_FALSE;
+                }
+                if (min_cmp == types::compare_t::more) {
+                    return filter_propagate_result_t::ALWAYS_TRUE;
+                }
+                break;
+            case expressions::compare_type::gte:
+                if (max_cmp == types::compare_t::less) {
+                    return filter_propagate_result_t::ALWAYS_FALSE;
+                }
+                if (min_cmp != types::compare_t::less) {
+                    return filter_propagate_result_t::ALWAYS_TRUE;
+                }
+                break;
+            case expressions::compare_type::all_true:
+                return filter_propagate_result_t::ALWAYS_TRUE;
+            default:
+                break;
+        }
+        return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
+    }
+
+} // namespace components::table
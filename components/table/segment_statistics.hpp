@@ -0,0 +1,96 @@
+#pragma once
+
+#include <components/types/logical_value.hpp>
+#include <components/vector/vector.hpp>
+
+#include <mutex>
+
+namespace components::table {
+    class constant_filter_t;
+
+    enum class filter_propagate_result_t : uint8_t
+    {
+        NO_PRUNING_POSSIBLE = 0,
+        ALWAYS_TRUE = 1,
+        ALWAYS_FALSE = 2,
+        TRUE_OR_NULL = 3,
+        FALSE_OR_NULL = 4
+    };
+
+    // min/max/null count of the values stored in a single column segment (zone map)
+    // null rows are stored as zero values (empty strings), they are kept in the [min, max] range
+    // so the range stays valid for readers of the raw segment data (check_predicate)
+    class segment_statistics_t {
+    public:
+        segment_statistics_t(const types::complex_logical_type& type, bool empty);
+        segment_statistics_t(segment_statistics_t&& other) noexcept;
+
+        static bool is_supported(const types::complex_logical_type& type);
+
+        bool has_stats() const;
+        uint64_t null_count() const;
+        types::logical_value_t min() const;
+        types::logical_value_t max() const;
+
+        template<typename T>
+        void update(vector::unified_vector_format& data, uint64_t offset, uint64_t count);
+        void update(const types::logical_value_t& value);
+        void set_unknown();
+
+        filter_propagate_result_t check_zonemap(const constant_filter_t& filter) const;
+
+    private:
+        void merge(types::logical_value_t min, types::logical_value_t max, uint64_t null_count);
+
+        mutable std::mutex lock_;
+        bool supported_;
+        // false if the segment content is not tracked (segment was not empty on creation, null updates)
+        bool known_;
+        bool has_values_ = false;
+        uint64_t null_count_ = 0;
+        types::logical_value_t min_;
+        types::logical_value_t max_;
+    };
+
+    template<typename T>
+    void segment_statistics_t::update(vector::unified_vector_format& data, uint64_t offset, uint64_t count) {
+        if (!supported_ || count == 0) {
+            return;
+        }
+        auto sdata = data.get_data<T>();
+        T min_value{};
+        T max_value{};
+        bool has_valid = false;
+        uint64_t null_count = 0;
+        for (uint64_t i = 0; i < count; i++) {
+            auto source_idx = data.referenced_indexing->get_index(offset + i);
+            if (!data.validity.row_is_valid(source_idx)) {
+                null_count++;
+                continue;
+            }
+            const auto& value = sdata[source_idx];
+            if (!has_valid) {
+                min_value = value;
+                max_value = value;
+                has_valid = true;
+            } else if (value < min_value) {
+                min_value = value;
+            } else if (max_value < value) {
+                max_value = value;
+            }
+        }
+        if (null_count > 0) {
+            // stored placeholder of a null row
+            if (!has_valid) {
+                min_value = T{};
+                max_value = T{};
+            } else if (T{} < min_value) {
+                min_value = T{};
+            } else if (max_value < T{}) {
+                max_value = T{};
+            }
+        }
+        merge(types::logical_value_t(min_value), types::logical_value_t(max_value), null_count);
+    }
+
+} // namespace components::table
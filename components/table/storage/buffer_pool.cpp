@@ -30,12 +30,16 @@ namespace components::table::storage {
     }
 
     bool eviction_queue_t::add_to_eviction_queue(buffer_eviction_node_t&& node) {
-        q.push(std::move(node));
+        {
+            std::lock_guard guard(queue_lock_);
+            q.push(std::move(node));
+        }
         return ++evict_queue_insertions_ % INSERT_INTERVAL == 0;
     }
 
     bool eviction_queue_t::try_dequeue_with_lock(buffer_eviction_node_t& node) {
         std::lock_guard lock(purge_lock_);
+        std::lock_guard guard(queue_lock_);
         if (q.empty()) {
             return false;
         }
@@ -51,7 +55,7 @@ namespace components::table::storage {
         std::lock_guard lock{purge_lock_, std::adopt_lock};
 
         uint64_t purge_size = INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER;
-        uint64_t approx_q_size = q.size();
+        uint64_t approx_q_size = queue_size();
 
         if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
             return;
@@ -61,7 +65,7 @@ namespace components::table::storage {
         while (max_purges != 0) {
             purge_iteration(purge_size);
 
-            approx_q_size = q.size();
+            approx_q_size = queue_size();
 
             if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
                 break;
@@ -79,12 +83,18 @@ namespace components::table::storage {
         }
     }
 
+    uint64_t eviction_queue_t::queue_size() {
+        std::lock_guard guard(queue_lock_);
+        return q.size();
+    }
+
     void eviction_queue_t::purge_iteration(uint64_t purge_size) {
         uint64_t previous_purge_size = purge_nodes_.size();
         if (purge_size < previous_purge_size / 2 || purge_size > previous_purge_size) {
             purge_nodes_.resize(purge_size);
         }
 
+        std::lock_guard guard(queue_lock_);
         uint64_t actually_dequeued = purge_size;
         auto it = purge_nodes_.begin();
         for (size_t i = 0; i < purge_size; i++) {
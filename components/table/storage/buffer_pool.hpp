@@ -38,6 +38,7 @@ namespace components::table::storage {
 
     private:
         void purge_iteration(uint64_t purge_size);
+        uint64_t queue_size();
 
     public:
         const file_buffer_type buffer_type;
@@ -52,6 +53,8 @@ namespace components::table::storage {
         std::atomic<uint64_t> evict_queue_insertions_;
         std::atomic<uint64_t> total_dead_nodes_;
         std::mutex purge_lock_;
+        // guards q: blocks are unpinned concurrently by parallel scans
+        std::mutex queue_lock_;
         std::vector<buffer_eviction_node_t> purge_nodes_;
     };
 
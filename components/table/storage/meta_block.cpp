@@ -0,0 +1,125 @@
+#include "meta_block.hpp"
+
+#include <cassert>
+#include <cstring>
+
+namespace components::table::storage {
+
+    namespace {
+        constexpr uint64_t NEXT_BLOCK_SIZE = sizeof(uint64_t);
+
+        uint64_t next_block_id(block_t& block) {
+            uint64_t next;
+            std::memcpy(&next, block.buffer(), sizeof(next));
+            return next;
+        }
+
+        void set_next_block_id(block_t& block, uint64_t next) { std::memcpy(block.buffer(), &next, sizeof(next)); }
+    } // namespace
+
+    metadata_writer_t::metadata_writer_t(block_manager_t& block_manager)
+        : block_manager_(block_manager)
+        , offset_(NEXT_BLOCK_SIZE) {
+        auto block_id = block_manager_.free_block_id();
+        block_ = block_manager_.create_block(block_id, nullptr);
+        set_next_block_id(*block_, INVALID_INDEX);
+        root_ = meta_block_pointer_t(block_id, 0);
+        written_blocks_.push_back(block_id);
+    }
+
+    void metadata_writer_t::write_data(const void* data, uint64_t size) {
+        assert(block_);
+        auto* source = static_cast<const std::byte*>(data);
+        while (size > 0) {
+            if (offset_ == block_->size()) {
+                next_block();
+            }
+            auto to_write = std::min<uint64_t>(size, block_->size() - offset_);
+            std::memcpy(block_->buffer() + offset_, source, to_write);
+            offset_ += to_write;
+            source += to_write;
+            size -= to_write;
+        }
+    }
+
+    void metadata_writer_t::write_string(std::string_view value) {
+        write<uint64_t>(value.size());
+        write_data(value.data(), value.size());
+    }
+
+    void metadata_writer_t::flush() {
+        if (!block_) {
+            return;
+        }
+        block_manager_.write(*block_);
+        block_.reset();
+    }
+
+    void metadata_writer_t::next_block() {
+        auto block_id = block_manager_.free_block_id();
+        set_next_block_id(*block_, block_id);
+        block_manager_.write(*block_);
+        block_ = block_manager_.create_block(block_id, block_.get());
+        set_next_block_id(*block_, INVALID_INDEX);
+        offset_ = NEXT_BLOCK_SIZE;
+        written_blocks_.push_back(block_id);
+    }
+
+    metadata_reader_t::metadata_reader_t(block_manager_t& block_manager, meta_block_pointer_t pointer)
+        : block_manager_(block_manager)
+        , offset_(NEXT_BLOCK_SIZE + pointer.offset) {
+        if (!pointer.is_valid()) {
+            throw std::runtime_error("metadata_reader_t: invalid meta block pointer");
+        }
+        read_block(pointer.block_pointer);
+    }
+
+    void metadata_reader_t::read_data(void* data, uint64_t size) {
+        auto* target = static_cast<std::byte*>(data);
+        while (size > 0) {
+            if (offset_ == block_->size()) {
+                auto next = next_block_id(*block_);
+                if (next == INVALID_INDEX) {
+                    throw std::runtime_error("metadata_reader_t: read past the end of metadata");
+                }
+                read_block(next);
+                offset_ = NEXT_BLOCK_SIZE;
+            }
+            auto to_read = std::min<uint64_t>(size, block_->size() - offset_);
+            std::memcpy(target, block_->buffer() + offset_, to_read);
+            offset_ += to_read;
+            target += to_read;
+            size -= to_read;
+        }
+    }
+
+    std::string metadata_reader_t::read_string() {
+        std::string result(read<uint64_t>(), '\0');
+        read_data(result.data(), result.size());
+        return result;
+    }
+
+    std::vector<uint32_t> metadata_reader_t::chain(block_manager_t& block_manager, meta_block_pointer_t root) {
+        std::vector<uint32_t> result;
+        if (!root.is_valid()) {
+            return result;
+        }
+        metadata_reader_t reader(block_manager, root);
+        result.push_back(static_cast<uint32_t>(root.block_pointer));
+        for (auto next = next_block_id(*reader.block_); next != INVALID_INDEX; next = next_block_id(*reader.block_)) {
+            result.push_back(static_cast<uint32_t>(next));
+            reader.read_block(next);
+        }
+        return result;
+    }
+
+    void metadata_reader_t::read_block(uint64_t block_id) {
+        if (block_) {
+            block_->id = block_id;
+        } else {
+            block_ = block_manager_.create_block(static_cast<uint32_t>(block_id), nullptr);
+        }
+        block_manager_.read(*block_);
+    }
+
+} // namespace components::table::storage
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "block_manager.hpp"
+
+namespace components::table::storage {
+
+    // Metadata is stored as a byte stream spread over a chain of blocks,
+    // every block starts with the id of the next one (INVALID_INDEX for the last block).
+    // Offsets of meta block pointers are counted from the end of that id.
+
+    class metadata_writer_t {
+    public:
+        explicit metadata_writer_t(block_manager_t& block_manager);
+
+        meta_block_pointer_t root() const { return root_; }
+        const std::vector<uint32_t>& written_blocks() const { return written_blocks_; }
+
+        void write_data(const void* data, uint64_t size);
+        void write_string(std::string_view value);
+        template<typename T>
+        void write(const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            write_data(&value, sizeof(T));
+        }
+
+        // writes the last block, nothing can be written afterwards
+        void flush();
+
+    private:
+        void next_block();
+
+        block_manager_t& block_manager_;
+        std::unique_ptr<block_t> block_;
+        uint64_t offset_;
+        meta_block_pointer_t root_;
+        std::vector<uint32_t> written_blocks_;
+    };
+
+    class metadata_reader_t {
+    public:
+        metadata_reader_t(block_manager_t& block_manager, meta_block_pointer_t pointer);
+
+        void read_data(void* data, uint64_t size);
+        std::string read_string();
+        template<typename T>
+        T read() {
+            static_assert(std::is_trivially_copyable_v<T>);
+            T value;
+            read_data(&value, sizeof(T));
+            return value;
+        }
+
+        // ids of all blocks in the chain starting at `root`
+        static std::vector<uint32_t> chain(block_manager_t& block_manager, meta_block_pointer_t root);
+
+    private:
+        void read_block(uint64_t block_id);
+
+        block_manager_t& block_manager_;
+        std::unique_ptr<block_t> block_;
+        uint64_t offset_;
+    };
+
+} // namespace components::table::storage
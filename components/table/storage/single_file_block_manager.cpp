@@ -0,0 +1,286 @@
+#include "single_file_block_manager.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+#include "meta_block.hpp"
+
+namespace components::table::storage {
+
+    namespace {
+        constexpr uint64_t MAGIC_NUMBER = 0x5842544f; // "OTBX"
+        constexpr uint64_t STORAGE_VERSION = 1;
+
+        uint64_t checksum(const std::byte* data, uint64_t size) {
+            uint64_t result = 5381;
+            uint64_t word;
+            uint64_t i = 0;
+            for (; i + sizeof(word) <= size; i += sizeof(word)) {
+                std::memcpy(&word, data + i, sizeof(word));
+                result = (result ^ word) * 0xbf58476d1ce4e5b9ULL;
+                result ^= result >> 31;
+            }
+            for (; i < size; i++) {
+                result = (result ^ static_cast<uint64_t>(data[i])) * 0x94d049bb133111ebULL;
+            }
+            return result;
+        }
+
+        void verify_checksum(const std::byte* internal_buffer, uint64_t size, uint64_t block_id) {
+            uint64_t stored;
+            std::memcpy(&stored, internal_buffer, sizeof(stored));
+            if (stored != checksum(internal_buffer + DEFAULT_BLOCK_HEADER_SIZE, size - DEFAULT_BLOCK_HEADER_SIZE)) {
+                throw std::runtime_error("corrupt database file: checksum mismatch in block " +
+                                         std::to_string(block_id));
+            }
+        }
+    } // namespace
+
+    single_file_block_manager_t::single_file_block_manager_t(buffer_manager_t& buffer_manager,
+                                                             core::filesystem::path_t path,
+                                                             uint64_t block_alloc_size)
+        : block_manager_t(buffer_manager, block_alloc_size)
+        , path_(std::move(path)) {}
+
+    void single_file_block_manager_t::create_new_database() {
+        using core::filesystem::file_flags;
+        handle_ = open_file(fs_, path_, file_flags::READ | file_flags::WRITE | file_flags::FILE_CREATE);
+        handle_->truncate(0);
+
+        std::byte main_header[FILE_HEADER_SIZE] = {};
+        std::memcpy(main_header, &MAGIC_NUMBER, sizeof(MAGIC_NUMBER));
+        std::memcpy(main_header + sizeof(MAGIC_NUMBER), &STORAGE_VERSION, sizeof(STORAGE_VERSION));
+        handle_->write(main_header, FILE_HEADER_SIZE, 0);
+
+        header_ = database_header_t{};
+        header_.block_alloc_size = block_allocation_size();
+        write_database_header(header_, 0);
+        write_database_header(header_, 1);
+        active_header_ = 0;
+        max_block_ = 0;
+        free_list_.clear();
+        checkpoint_blocks_.clear();
+        new_blocks_.clear();
+        modified_blocks_.clear();
+        multi_use_blocks_.clear();
+        file_sync();
+    }
+
+    void single_file_block_manager_t::load_existing_database() {
+        using core::filesystem::file_flags;
+        handle_ = open_file(fs_, path_, file_flags::READ | file_flags::WRITE);
+
+        uint64_t main_header[2];
+        if (handle_->file_size() < BLOCK_START || !handle_->read(main_header, sizeof(main_header), 0) ||
+            main_header[0] != MAGIC_NUMBER) {
+            throw std::runtime_error("file " + path_.string() + " is not a valid database file");
+        }
+        if (main_header[1] != STORAGE_VERSION) {
+            throw std::runtime_error("unsupported storage version " + std::to_string(main_header[1]) + " in " +
+                                     path_.string());
+        }
+
+        database_header_t headers[2];
+        bool valid[2] = {read_database_header(0, headers[0]), read_database_header(1, headers[1])};
+        if (!valid[0] && !valid[1]) {
+            throw std::runtime_error("both database headers of " + path_.string() + " are corrupt");
+        }
+        active_header_ = !valid[1] || (valid[0] && headers[0].iteration > headers[1].iteration) ? 0 : 1;
+        header_ = headers[active_header_];
+        if (header_.block_alloc_size != block_allocation_size()) {
+            throw std::runtime_error("database file " + path_.string() + " uses a different block allocation size");
+        }
+        max_block_ = header_.block_count;
+        load_free_list();
+    }
+
+    void single_file_block_manager_t::write_header(meta_block_pointer_t root, uint64_t wal_id) {
+        // the new checkpoint must be on disk before the header points at it
+        file_sync();
+
+        database_header_t header;
+        header.iteration = header_.iteration + 1;
+        header.meta_block = root.block_pointer;
+        header.block_count = max_block_;
+        header.block_alloc_size = block_allocation_size();
+        header.wal_id = wal_id;
+        auto slot = 1 - active_header_;
+        write_database_header(header, slot);
+        file_sync();
+
+        header_ = header;
+        active_header_ = slot;
+        for (auto block_id : checkpoint_blocks_) {
+            mark_as_modified(block_id);
+        }
+        checkpoint_blocks_ = std::move(new_blocks_);
+        new_blocks_.clear();
+        free_list_.insert(modified_blocks_.begin(), modified_blocks_.end());
+        modified_blocks_.clear();
+    }
+
+    std::unique_ptr<block_t> single_file_block_manager_t::convert_block(uint32_t block_id,
+                                                                        file_buffer_t& source_buffer) {
+        assert(source_buffer.allocation_size() == block_allocation_size());
+        return std::make_unique<block_t>(source_buffer, block_id);
+    }
+
+    std::unique_ptr<block_t> single_file_block_manager_t::create_block(uint32_t block_id,
+                                                                       file_buffer_t* source_buffer) {
+        if (source_buffer) {
+            return convert_block(block_id, *source_buffer);
+        }
+        return std::make_unique<block_t>(buffer_manager.resource(), block_id, block_size());
+    }
+
+    uint32_t single_file_block_manager_t::free_block_id() {
+        uint32_t block_id;
+        if (free_list_.empty()) {
+            block_id = static_cast<uint32_t>(max_block_++);
+        } else {
+            block_id = *free_list_.begin();
+            free_list_.erase(free_list_.begin());
+        }
+        new_blocks_.insert(block_id);
+        return block_id;
+    }
+
+    uint32_t single_file_block_manager_t::peek_free_block_id() {
+        return free_list_.empty() ? static_cast<uint32_t>(max_block_) : *free_list_.begin();
+    }
+
+    bool single_file_block_manager_t::is_root_block(meta_block_pointer_t root) {
+        return root.block_pointer == header_.meta_block;
+    }
+
+    void single_file_block_manager_t::mark_as_free(uint32_t block_id) {
+        assert(block_id < max_block_);
+        multi_use_blocks_.erase(block_id);
+        checkpoint_blocks_.erase(block_id);
+        new_blocks_.erase(block_id);
+        free_list_.insert(block_id);
+    }
+
+    void single_file_block_manager_t::mark_as_used(uint32_t block_id) {
+        if (block_id >= max_block_) {
+            for (auto id = max_block_; id < block_id; id++) {
+                free_list_.insert(static_cast<uint32_t>(id));
+            }
+            max_block_ = block_id + 1;
+        } else if (free_list_.erase(block_id) == 0) {
+            increase_block_ref_count(block_id);
+            return;
+        }
+        checkpoint_blocks_.insert(block_id);
+    }
+
+    void single_file_block_manager_t::mark_as_modified(uint32_t block_id) {
+        auto it = multi_use_blocks_.find(block_id);
+        if (it != multi_use_blocks_.end()) {
+            if (--it->second <= 1) {
+                multi_use_blocks_.erase(it);
+            }
+            return;
+        }
+        // the block still belongs to the last written checkpoint, it is reused only after the next header
+        modified_blocks_.insert(block_id);
+    }
+
+    void single_file_block_manager_t::increase_block_ref_count(uint32_t block_id) {
+        auto it = multi_use_blocks_.find(block_id);
+        if (it == multi_use_blocks_.end()) {
+            multi_use_blocks_.emplace(block_id, 2);
+        } else {
+            it->second++;
+        }
+    }
+
+    uint64_t single_file_block_manager_t::meta_block() { return header_.meta_block; }
+
+    void single_file_block_manager_t::read(block_t& block) {
+        assert(block.id < max_block_);
+        block.read(*handle_, block_location(block.id));
+        verify_checksum(block.internal_buffer(), block.allocation_size(), block.id);
+    }
+
+    void single_file_block_manager_t::read_blocks(file_buffer_t& buffer, uint32_t start_block, uint64_t block_count) {
+        auto alloc_size = block_allocation_size();
+        assert(buffer.allocation_size() == block_count * alloc_size);
+        handle_->read(buffer.internal_buffer(), block_count * alloc_size, block_location(start_block));
+        for (uint64_t i = 0; i < block_count; i++) {
+            verify_checksum(buffer.internal_buffer() + i * alloc_size, alloc_size, start_block + i);
+        }
+    }
+
+    void single_file_block_manager_t::write(file_buffer_t& block, uint32_t block_id) {
+        assert(block_id < max_block_);
+        assert(block.allocation_size() == block_allocation_size());
+        auto sum = checksum(block.buffer(), block.allocation_size() - DEFAULT_BLOCK_HEADER_SIZE);
+        std::memcpy(block.internal_buffer(), &sum, sizeof(sum));
+        block.write(*handle_, block_location(block_id));
+    }
+
+    uint64_t single_file_block_manager_t::total_blocks() { return max_block_; }
+
+    uint64_t single_file_block_manager_t::free_blocks() { return free_list_.size(); }
+
+    void single_file_block_manager_t::file_sync() {
+        if (!handle_->sync()) {
+            throw std::runtime_error("failed to sync database file " + path_.string());
+        }
+    }
+
+    void single_file_block_manager_t::truncate() {
+        auto max_block = max_block_;
+        while (max_block > 0 && free_list_.count(static_cast<uint32_t>(max_block - 1))) {
+            free_list_.erase(static_cast<uint32_t>(--max_block));
+        }
+        if (max_block == max_block_) {
+            return;
+        }
+        max_block_ = max_block;
+        handle_->truncate(static_cast<int64_t>(block_location(max_block_)));
+    }
+
+    uint64_t single_file_block_manager_t::block_location(uint64_t block_id) const {
+        return BLOCK_START + block_id * block_allocation_size();
+    }
+
+    void single_file_block_manager_t::write_database_header(const database_header_t& header, uint64_t slot) {
+        std::byte buffer[FILE_HEADER_SIZE] = {};
+        std::memcpy(buffer + sizeof(uint64_t), &header, sizeof(header));
+        auto sum = checksum(buffer + sizeof(uint64_t), sizeof(header));
+        std::memcpy(buffer, &sum, sizeof(sum));
+        handle_->write(buffer, FILE_HEADER_SIZE, FILE_HEADER_SIZE * (slot + 1));
+    }
+
+    bool single_file_block_manager_t::read_database_header(uint64_t slot, database_header_t& header) {
+        std::byte buffer[sizeof(uint64_t) + sizeof(database_header_t)];
+        if (!handle_->read(buffer, sizeof(buffer), FILE_HEADER_SIZE * (slot + 1))) {
+            return false;
+        }
+        uint64_t sum;
+        std::memcpy(&sum, buffer, sizeof(sum));
+        if (sum != checksum(buffer + sizeof(uint64_t), sizeof(header))) {
+            return false;
+        }
+        std::memcpy(&header, buffer + sizeof(uint64_t), sizeof(header));
+        return true;
+    }
+
+    void single_file_block_manager_t::load_free_list() {
+        free_list_.clear();
+        checkpoint_blocks_.clear();
+        new_blocks_.clear();
+        modified_blocks_.clear();
+        multi_use_blocks_.clear();
+        auto used = metadata_reader_t::chain(*this, meta_block_pointer_t(header_.meta_block, 0));
+        checkpoint_blocks_.insert(used.begin(), used.end());
+        for (uint64_t block_id = 0; block_id < max_block_; block_id++) {
+            if (!checkpoint_blocks_.count(static_cast<uint32_t>(block_id))) {
+                free_list_.insert(static_cast<uint32_t>(block_id));
+            }
+        }
+    }
+
+} // namespace components::table::storage
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <core/file/local_file_system.hpp>
+#include <set>
+#include <unordered_map>
+
+#include "block_manager.hpp"
+#include "buffer_manager.hpp"
+
+namespace components::table::storage {
+
+    struct database_header_t {
+        uint64_t iteration = 0;
+        uint64_t meta_block = INVALID_INDEX;
+        uint64_t block_count = 0;
+        uint64_t block_alloc_size = 0;
+        uint64_t wal_id = 0;
+    };
+
+    // Keeps all blocks of a database in a single file: a main header, two database headers and the blocks.
+    // Database headers are written in turn, so a crash during a checkpoint leaves the previous one readable.
+    class single_file_block_manager_t : public block_manager_t {
+    public:
+        static constexpr uint64_t FILE_HEADER_SIZE = SECTOR_SIZE;
+        static constexpr uint64_t BLOCK_START = FILE_HEADER_SIZE * 3;
+
+        single_file_block_manager_t(buffer_manager_t& buffer_manager,
+                                    core::filesystem::path_t path,
+                                    uint64_t block_alloc_size = DEFAULT_BLOCK_ALLOC_SIZE);
+
+        void create_new_database();
+        // only the chain starting at meta_block() is marked as used, other chains have to be passed to mark_as_used()
+        void load_existing_database();
+        // makes `root` the current checkpoint, blocks of the previous one become free afterwards
+        void write_header(meta_block_pointer_t root, uint64_t wal_id);
+
+        uint64_t wal_id() const { return header_.wal_id; }
+        const core::filesystem::path_t& path() const { return path_; }
+
+        std::unique_ptr<block_t> convert_block(uint32_t block_id, file_buffer_t& source_buffer) override;
+        std::unique_ptr<block_t> create_block(uint32_t block_id, file_buffer_t* source_buffer) override;
+
+        uint32_t free_block_id() override;
+        uint32_t peek_free_block_id() override;
+        bool is_root_block(meta_block_pointer_t root) override;
+        void mark_as_free(uint32_t block_id) override;
+        void mark_as_used(uint32_t block_id) override;
+        void mark_as_modified(uint32_t block_id) override;
+        void increase_block_ref_count(uint32_t block_id) override;
+        uint64_t meta_block() override;
+        void read(block_t& block) override;
+        void read_blocks(file_buffer_t& buffer, uint32_t start_block, uint64_t block_count) override;
+        void write(file_buffer_t& block, uint32_t block_id) override;
+        using block_manager_t::write;
+
+        uint64_t total_blocks() override;
+        uint64_t free_blocks() override;
+        bool in_memory() override { return false; }
+        void file_sync() override;
+        void truncate() override;
+
+    private:
+        uint64_t block_location(uint64_t block_id) const;
+        void write_database_header(const database_header_t& header, uint64_t slot);
+        bool read_database_header(uint64_t slot, database_header_t& header);
+        void load_free_list();
+
+        core::filesystem::local_file_system_t fs_;
+        core::filesystem::path_t path_;
+        std::unique_ptr<core::filesystem::file_handle_t> handle_;
+        database_header_t header_;
+        uint64_t active_header_ = 0;
+        uint64_t max_block_ = 0;
+        std::set<uint32_t> free_list_;
+        // blocks of the current checkpoint and blocks allocated for the next one
+        std::set<uint32_t> checkpoint_blocks_;
+        std::set<uint32_t> new_blocks_;
+        std::set<uint32_t> modified_blocks_;
+        std::unordered_map<uint32_t, uint32_t> multi_use_blocks_;
+    };
+
+} // namespace components::table::storage
@@ -198,6 +198,13 @@ namespace components::table {
         std::vector<storage_index_t> column_ids_;
     };
 
+    // shared by the workers of a morsel-driven scan, every morsel is a single row group
+    struct parallel_table_scan_state {
+        std::atomic<uint64_t> next_row_group{0};
+        // rows appended after the scan has started are not visited
+        uint64_t max_row = 0;
+    };
+
     class create_index_scan_state : public table_scan_state {
     public:
         create_index_scan_state(std::pmr::memory_resource* resource)
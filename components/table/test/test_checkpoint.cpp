@@ -0,0 +1,264 @@
+#include <catch2/catch.hpp>
+#include <components/table/data_table.hpp>
+#include <components/table/storage/buffer_pool.hpp>
+#include <components/table/storage/in_memory_block_manager.hpp>
+#include <components/table/storage/meta_block.hpp>
+#include <components/table/storage/single_file_block_manager.hpp>
+#include <components/table/storage/standard_buffer_manager.hpp>
+#include <core/file/local_file_system.hpp>
+#include <filesystem>
+
+TEST_CASE("data_table_t::checkpoint") {
+    using namespace components::types;
+    using namespace components::vector;
+    using namespace components::table;
+
+    constexpr size_t test_size = DEFAULT_VECTOR_CAPACITY * 3 + 100;
+    auto generate_string = [](size_t i) { return "long_string_with_index_" + std::to_string(i); };
+    auto is_deleted = [](size_t i) { return i % 7 == 3; };
+
+    std::filesystem::path path = std::filesystem::current_path() / "test_checkpoint.otbx";
+    std::filesystem::remove(path);
+
+    core::filesystem::local_file_system_t fs;
+    auto buffer_pool =
+        storage::buffer_pool_t(std::pmr::get_default_resource(), uint64_t(1) << 32, false, uint64_t(1) << 24);
+    auto buffer_manager = storage::standard_buffer_manager_t(std::pmr::get_default_resource(), fs, buffer_pool);
+    auto block_manager = storage::in_memory_block_manager_t(buffer_manager, storage::DEFAULT_BLOCK_ALLOC_SIZE);
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("number", logical_type::BIGINT);
+    columns.emplace_back("name", logical_type::STRING_LITERAL);
+    columns.emplace_back("value", logical_type::DOUBLE);
+    auto data_table =
+        std::make_unique<data_table_t>(std::pmr::get_default_resource(), block_manager, std::move(columns));
+
+    {
+        data_chunk_t chunk(std::pmr::get_default_resource(), data_table->copy_types(), test_size);
+        chunk.set_cardinality(test_size);
+        for (size_t i = 0; i < test_size; i++) {
+            chunk.set_value(0, i, logical_value_t{int64_t(i)});
+            chunk.set_value(1, i, logical_value_t{generate_string(i)});
+            chunk.set_value(2, i, logical_value_t{double(i) / 2});
+        }
+        chunk.data[2].validity().set_invalid(2);
+        table_append_state state(std::pmr::get_default_resource());
+        data_table->append_lock(state);
+        data_table->initialize_append(state);
+        data_table->append(chunk, state);
+        data_table->finalize_append(state);
+
+        vector_t ids(std::pmr::get_default_resource(), logical_type::BIGINT, test_size);
+        uint64_t count = 0;
+        for (size_t i = 0; i < test_size; i++) {
+            if (is_deleted(i)) {
+                ids.data<int64_t>()[count++] = int64_t(i);
+            }
+        }
+        auto delete_state = data_table->initialize_delete({});
+        data_table->delete_rows(*delete_state, ids, count);
+    }
+
+    INFO("write checkpoints") {
+        storage::single_file_block_manager_t file(buffer_manager, path);
+        file.create_new_database();
+        for (uint64_t wal_id = 1; wal_id <= 2; wal_id++) {
+            storage::metadata_writer_t writer(file);
+            data_table->checkpoint(writer);
+            writer.flush();
+            file.write_header(writer.root(), wal_id);
+        }
+        // blocks of the first checkpoint are free again
+        REQUIRE(file.free_blocks() > 0);
+    }
+
+    INFO("load checkpoint") {
+        storage::single_file_block_manager_t file(buffer_manager, path);
+        file.load_existing_database();
+        REQUIRE(file.wal_id() == 2);
+        storage::metadata_reader_t reader(file, storage::meta_block_pointer_t(file.meta_block(), 0));
+        auto loaded = data_table_t::load(std::pmr::get_default_resource(), block_manager, reader);
+        REQUIRE(loaded->column_count() == 3);
+        REQUIRE(loaded->columns()[1].name() == "name");
+
+        std::vector<storage_index_t> column_indices{storage_index_t(0), storage_index_t(1), storage_index_t(2)};
+        table_scan_state expected_state(std::pmr::get_default_resource());
+        table_scan_state state(std::pmr::get_default_resource());
+        data_chunk_t expected(std::pmr::get_default_resource(), data_table->copy_types());
+        data_chunk_t result(std::pmr::get_default_resource(), loaded->copy_types());
+        data_table->initialize_scan(expected_state, column_indices);
+        loaded->initialize_scan(state, column_indices);
+        size_t total = 0;
+        while (true) {
+            expected.reset();
+            result.reset();
+            data_table->scan(expected, expected_state);
+            loaded->scan(result, state);
+            REQUIRE(result.size() == expected.size());
+            if (result.size() == 0) {
+                break;
+            }
+            for (size_t i = 0; i < result.size(); i++) {
+                REQUIRE(result.data[0].value(i).value<int64_t>() == expected.data[0].value(i).value<int64_t>());
+                REQUIRE(*result.data[1].value(i).value<std::string*>() ==
+                        *expected.data[1].value(i).value<std::string*>());
+                REQUIRE(result.data[2].validity().row_is_valid(i) == expected.data[2].validity().row_is_valid(i));
+            }
+            total += result.size();
+        }
+        size_t deleted = 0;
+        for (size_t i = 0; i < test_size; i++) {
+            deleted += is_deleted(i);
+        }
+        REQUIRE(total == test_size - deleted);
+
+        column_fetch_state fetch_state;
+        vector_t rows(std::pmr::get_default_resource(), logical_type::BIGINT);
+        rows.set_value(0, logical_value_t(int64_t(test_size - 1)));
+        data_chunk_t fetched(std::pmr::get_default_resource(), loaded->copy_types());
+        loaded->fetch(fetched, column_indices, rows, 1, fetch_state);
+        REQUIRE(fetched.data[0].value(0).value<int64_t>() == int64_t(test_size - 1));
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("data_table_t::checkpoint nested types") {
+    using namespace components::types;
+    using namespace components::vector;
+    using namespace components::table;
+
+    constexpr size_t test_size = DEFAULT_VECTOR_CAPACITY + 100;
+    constexpr size_t array_size = 3;
+    auto list_length = [](size_t i) { return i % 4; };
+
+    core::filesystem::local_file_system_t fs;
+    auto buffer_pool =
+        storage::buffer_pool_t(std::pmr::get_default_resource(), uint64_t(1) << 32, false, uint64_t(1) << 24);
+    auto buffer_manager = storage::standard_buffer_manager_t(std::pmr::get_default_resource(), fs, buffer_pool);
+    auto block_manager = storage::in_memory_block_manager_t(buffer_manager, storage::DEFAULT_BLOCK_ALLOC_SIZE);
+
+    std::vector<complex_logical_type> fields;
+    fields.emplace_back(logical_type::BIGINT, "id");
+    fields.emplace_back(complex_logical_type::create_list(logical_type::USMALLINT, "numbers"));
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("price", complex_logical_type::create_decimal(18, 3));
+    columns.emplace_back("tags", complex_logical_type::create_list(logical_type::STRING_LITERAL));
+    columns.emplace_back("meta", complex_logical_type::create_struct(fields, "meta_struct"));
+    columns.emplace_back("triple", complex_logical_type::create_array(logical_type::UBIGINT, array_size));
+    auto data_table =
+        std::make_unique<data_table_t>(std::pmr::get_default_resource(), block_manager, std::move(columns));
+
+    {
+        data_chunk_t chunk(std::pmr::get_default_resource(), data_table->copy_types(), test_size);
+        chunk.set_cardinality(test_size);
+        for (size_t i = 0; i < test_size; i++) {
+            // decimals are stored as their unscaled integer
+            chunk.data[0].data<int64_t>()[i] = int64_t(i) * 1000 + 5;
+            std::vector<logical_value_t> tags;
+            std::vector<logical_value_t> numbers;
+            for (size_t j = 0; j < list_length(i); j++) {
+                tags.emplace_back("tag_" + std::to_string(i + j));
+                numbers.emplace_back(uint16_t(j));
+            }
+            chunk.set_value(1, i, logical_value_t::create_list(logical_type::STRING_LITERAL, tags));
+            std::vector<logical_value_t> meta;
+            meta.emplace_back(int64_t(i));
+            meta.emplace_back(logical_value_t::create_list(logical_type::USMALLINT, numbers));
+            chunk.set_value(2, i, logical_value_t::create_struct(data_table->columns()[2].type(), meta));
+            std::vector<logical_value_t> triple;
+            for (size_t j = 0; j < array_size; j++) {
+                triple.emplace_back(uint64_t(i * array_size + j));
+            }
+            chunk.set_value(3, i, logical_value_t::create_array(logical_type::UBIGINT, triple));
+        }
+        chunk.data[1].validity().set_invalid(5);
+        table_append_state state(std::pmr::get_default_resource());
+        data_table->append_lock(state);
+        data_table->initialize_append(state);
+        data_table->append(chunk, state);
+        data_table->finalize_append(state);
+    }
+
+    std::filesystem::path path = std::filesystem::current_path() / "test_checkpoint_nested.otbx";
+    std::filesystem::remove(path);
+    storage::single_file_block_manager_t checkpoint_blocks(buffer_manager, path);
+    checkpoint_blocks.create_new_database();
+    storage::metadata_writer_t writer(checkpoint_blocks);
+    data_table->checkpoint(writer);
+    writer.flush();
+
+    storage::metadata_reader_t reader(checkpoint_blocks, writer.root());
+    auto loaded = data_table_t::load(std::pmr::get_default_resource(), block_manager, reader);
+    REQUIRE(loaded->column_count() == 4);
+    REQUIRE(loaded->columns()[0].type().type() == logical_type::DECIMAL);
+    REQUIRE(static_cast<decimal_logical_type_extension*>(loaded->columns()[0].type().extension())->scale() == 3);
+    REQUIRE(loaded->columns()[2].type().child_types()[1].type() == logical_type::LIST);
+    REQUIRE(loaded->columns()[2].type().child_name(0) == "id");
+
+    std::vector<storage_index_t> column_indices;
+    for (uint64_t i = 0; i < 4; i++) {
+        column_indices.emplace_back(i);
+    }
+    table_scan_state expected_state(std::pmr::get_default_resource());
+    table_scan_state state(std::pmr::get_default_resource());
+    data_chunk_t expected(std::pmr::get_default_resource(), data_table->copy_types());
+    data_chunk_t result(std::pmr::get_default_resource(), loaded->copy_types());
+    data_table->initialize_scan(expected_state, column_indices);
+    loaded->initialize_scan(state, column_indices);
+    size_t total = 0;
+    while (true) {
+        expected.reset();
+        result.reset();
+        data_table->scan(expected, expected_state);
+        loaded->scan(result, state);
+        REQUIRE(result.size() == expected.size());
+        if (result.size() == 0) {
+            break;
+        }
+        result.data[0].flatten(result.size());
+        expected.data[0].flatten(expected.size());
+        for (size_t i = 0; i < result.size(); i++) {
+            REQUIRE(result.data[0].data<int64_t>()[i] == expected.data[0].data<int64_t>()[i]);
+            REQUIRE(result.data[1].validity().row_is_valid(i) == expected.data[1].validity().row_is_valid(i));
+            if (expected.data[1].validity().row_is_valid(i)) {
+                auto tags = result.data[1].value(i);
+                auto expected_tags = expected.data[1].value(i);
+                REQUIRE(tags.children().size() == expected_tags.children().size());
+                for (size_t j = 0; j < tags.children().size(); j++) {
+                    REQUIRE(*tags.children()[j].value<std::string*>() ==
+                            *expected_tags.children()[j].value<std::string*>());
+                }
+            }
+            auto meta = result.data[2].value(i);
+            auto expected_meta = expected.data[2].value(i);
+            REQUIRE(meta.children()[0].value<int64_t>() == expected_meta.children()[0].value<int64_t>());
+            REQUIRE(meta.children()[1].children().size() == expected_meta.children()[1].children().size());
+            for (size_t j = 0; j < meta.children()[1].children().size(); j++) {
+                REQUIRE(meta.children()[1].children()[j].value<uint16_t>() ==
+                        expected_meta.children()[1].children()[j].value<uint16_t>());
+            }
+            auto triple = result.data[3].value(i);
+            for (size_t j = 0; j < array_size; j++) {
+                REQUIRE(triple.children()[j].value<uint64_t>() ==
+                        expected.data[3].value(i).children()[j].value<uint64_t>());
+            }
+        }
+        total += result.size();
+    }
+    REQUIRE(total == test_size);
+
+    // 128-bit columns have no segments yet, an empty table still has to go through a checkpoint
+    std::vector<column_definition_t> wide_columns;
+    wide_columns.emplace_back("big", logical_type::HUGEINT);
+    wide_columns.emplace_back("id", logical_type::UUID);
+    data_table_t wide(std::pmr::get_default_resource(), block_manager, std::move(wide_columns));
+    storage::metadata_writer_t wide_writer(checkpoint_blocks);
+    wide.checkpoint(wide_writer);
+    wide_writer.flush();
+    storage::metadata_reader_t wide_reader(checkpoint_blocks, wide_writer.root());
+    auto wide_loaded = data_table_t::load(std::pmr::get_default_resource(), block_manager, wide_reader);
+    REQUIRE(wide_loaded->columns()[1].type().type() == logical_type::UUID);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,166 @@
+#include <catch2/catch.hpp>
+#include <components/table/data_table.hpp>
+#include <components/table/storage/buffer_pool.hpp>
+#include <components/table/storage/in_memory_block_manager.hpp>
+#include <components/table/storage/standard_buffer_manager.hpp>
+#include <core/file/local_file_system.hpp>
+
+TEST_CASE("data_table_t::filter") {
+    using namespace components::types;
+    using namespace components::vector;
+    using namespace components::table;
+    using components::expressions::compare_type;
+
+    constexpr size_t test_size = DEFAULT_VECTOR_CAPACITY * 3 + 100;
+    auto generate_string = [](size_t i) {
+        auto number = std::to_string(i);
+        while (number.size() < 10) {
+            number.insert(number.begin(), '0');
+        }
+        return "string_with_index_" + number;
+    };
+    auto number = [](size_t i) { return int32_t(i % 100); };
+    auto is_null = [](size_t i) { return i % 7 == 3; };
+
+    core::filesystem::local_file_system_t fs;
+    auto buffer_pool =
+        storage::buffer_pool_t(std::pmr::get_default_resource(), uint64_t(1) << 32, false, uint64_t(1) << 24);
+    auto buffer_manager = storage::standard_buffer_manager_t(std::pmr::get_default_resource(), fs, buffer_pool);
+    auto block_manager = storage::in_memory_block_manager_t(buffer_manager, storage::DEFAULT_BLOCK_ALLOC_SIZE);
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("number", logical_type::INTEGER);
+    columns.emplace_back("value", logical_type::DOUBLE);
+    columns.emplace_back("name", logical_type::STRING_LITERAL);
+    auto data_table =
+        std::make_unique<data_table_t>(std::pmr::get_default_resource(), block_manager, std::move(columns));
+
+    {
+        data_chunk_t chunk(std::pmr::get_default_resource(), data_table->copy_types(), test_size);
+        chunk.set_cardinality(test_size);
+        for (size_t i = 0; i < test_size; i++) {
+            chunk.set_value(0, i, logical_value_t{number(i)});
+            chunk.set_value(1, i, logical_value_t{double(i) / 4});
+            chunk.set_value(2, i, logical_value_t{generate_string(i)});
+            if (is_null(i)) {
+                chunk.data[0].validity().set_invalid(i);
+            }
+        }
+        table_append_state state(std::pmr::get_default_resource());
+        data_table->append_lock(state);
+        data_table->initialize_append(state);
+        data_table->append(chunk, state);
+        data_table->finalize_append(state);
+    }
+
+    // returns row ids of the rows passing the filter
+    auto scan = [&](const table_filter_t* filter) {
+        std::vector<int64_t> rows;
+        table_scan_state state(std::pmr::get_default_resource());
+        data_table->initialize_scan(state, {storage_index_t(2), storage_index_t(0)}, filter);
+        while (true) {
+            data_chunk_t result(std::pmr::get_default_resource(),
+                                {complex_logical_type(logical_type::STRING_LITERAL),
+                                 complex_logical_type(logical_type::INTEGER)});
+            data_table->scan(result, state);
+            if (result.size() == 0) {
+                break;
+            }
+            for (size_t i = 0; i < result.size(); i++) {
+                std::string name = *result.data[0].value(i).value<std::string*>();
+                rows.push_back(std::stoll(name.substr(name.size() - 10)));
+            }
+        }
+        return rows;
+    };
+    auto expected = [&](auto predicate) {
+        std::vector<int64_t> rows;
+        for (size_t i = 0; i < test_size; i++) {
+            if (predicate(i)) {
+                rows.push_back(int64_t(i));
+            }
+        }
+        return rows;
+    };
+
+    INFO("comparisons") {
+        constant_filter_t eq(compare_type::eq, logical_value_t{int32_t(42)}, 0);
+        REQUIRE(scan(&eq) == expected([&](size_t i) { return !is_null(i) && number(i) == 42; }));
+        constant_filter_t ne(compare_type::ne, logical_value_t{int32_t(42)}, 0);
+        REQUIRE(scan(&ne) == expected([&](size_t i) { return !is_null(i) && number(i) != 42; }));
+        constant_filter_t lt(compare_type::lt, logical_value_t{int32_t(10)}, 0);
+        REQUIRE(scan(&lt) == expected([&](size_t i) { return !is_null(i) && number(i) < 10; }));
+        constant_filter_t lte(compare_type::lte, logical_value_t{int32_t(10)}, 0);
+        REQUIRE(scan(&lte) == expected([&](size_t i) { return !is_null(i) && number(i) <= 10; }));
+        constant_filter_t gt(compare_type::gt, logical_value_t{int32_t(90)}, 0);
+        REQUIRE(scan(&gt) == expected([&](size_t i) { return !is_null(i) && number(i) > 90; }));
+        constant_filter_t gte(compare_type::gte, logical_value_t{int32_t(90)}, 0);
+        REQUIRE(scan(&gte) == expected([&](size_t i) { return !is_null(i) && number(i) >= 90; }));
+
+        constant_filter_t value(compare_type::lt, logical_value_t{double(100)}, 1);
+        REQUIRE(scan(&value) == expected([&](size_t i) { return double(i) / 4 < 100; }));
+        constant_filter_t value_eq(compare_type::eq, logical_value_t{double(2.5)}, 1);
+        REQUIRE(scan(&value_eq) == std::vector<int64_t>{10});
+        constant_filter_t name(compare_type::gte, logical_value_t{generate_string(test_size - 5)}, 2);
+        REQUIRE(scan(&name) == expected([&](size_t i) { return i >= test_size - 5; }));
+    }
+
+    INFO("constant of another type") {
+        constant_filter_t wide(compare_type::eq, logical_value_t{int64_t(42)}, 0);
+        REQUIRE(scan(&wide) == expected([&](size_t i) { return !is_null(i) && number(i) == 42; }));
+        // can not be represented as INTEGER, compared through logical values
+        constant_filter_t fraction(compare_type::gte, logical_value_t{double(89.5)}, 0);
+        REQUIRE(scan(&fraction) == expected([&](size_t i) { return !is_null(i) && number(i) >= 90; }));
+        constant_filter_t overflow(compare_type::lt, logical_value_t{int64_t(1) << 40}, 0);
+        REQUIRE(scan(&overflow) == expected([&](size_t i) { return !is_null(i); }));
+    }
+
+    INFO("regex") {
+        constant_filter_t contains(compare_type::regex, logical_value_t{std::string("00042")}, 2);
+        REQUIRE(scan(&contains) ==
+                expected([&](size_t i) { return generate_string(i).find("00042") != std::string::npos; }));
+        constant_filter_t suffix(compare_type::regex, logical_value_t{std::string("[13]7$")}, 2);
+        REQUIRE(scan(&suffix) == expected([&](size_t i) { return i % 100 == 17 || i % 100 == 37; }));
+        auto copy = suffix.copy();
+        REQUIRE(scan(copy.get()) == scan(&suffix));
+        constant_filter_t not_string(compare_type::regex, logical_value_t{std::string("4")}, 0);
+        REQUIRE(scan(&not_string).empty());
+    }
+
+    INFO("conjunctions") {
+        auto conj_or = std::make_unique<conjunction_or_filter_t>();
+        conj_or->child_filters.emplace_back(
+            std::make_unique<constant_filter_t>(compare_type::lt, logical_value_t{int32_t(5)}, 0));
+        conj_or->child_filters.emplace_back(
+            std::make_unique<constant_filter_t>(compare_type::gt, logical_value_t{double(800)}, 1));
+        auto or_rows = expected([&](size_t i) { return (!is_null(i) && number(i) < 5) || double(i) / 4 > 800; });
+        REQUIRE(scan(conj_or.get()) == or_rows);
+
+        conjunction_and_filter_t conj_and;
+        conj_and.child_filters.emplace_back(conj_or->copy());
+        conj_and.child_filters.emplace_back(
+            std::make_unique<constant_filter_t>(compare_type::ne, logical_value_t{int32_t(2)}, 0));
+        REQUIRE(scan(&conj_and) == expected([&](size_t i) {
+                    return ((!is_null(i) && number(i) < 5) || double(i) / 4 > 800) && !is_null(i) && number(i) != 2;
+                }));
+    }
+
+    INFO("deleted and updated rows") {
+        vector_t ids(std::pmr::get_default_resource(), logical_type::BIGINT, 1);
+        ids.data<int64_t>()[0] = 42;
+        auto state = data_table->initialize_delete({});
+        REQUIRE(data_table->delete_rows(*state, ids, 1) == 1);
+
+        data_chunk_t chunk(std::pmr::get_default_resource(), {complex_logical_type(logical_type::INTEGER)}, 1);
+        chunk.set_cardinality(1);
+        chunk.set_value(0, 0, logical_value_t{int32_t(-1)});
+        vector_t update_ids(std::pmr::get_default_resource(), logical_type::BIGINT, 1);
+        update_ids.data<int64_t>()[0] = 142;
+        data_table->update_column(update_ids, {0}, chunk);
+
+        constant_filter_t eq(compare_type::eq, logical_value_t{int32_t(42)}, 0);
+        REQUIRE(scan(&eq) == expected([&](size_t i) { return !is_null(i) && number(i) == 42 && i != 42 && i != 142; }));
+        constant_filter_t updated(compare_type::lt, logical_value_t{int32_t(0)}, 0);
+        REQUIRE(scan(&updated) == std::vector<int64_t>{142});
+    }
+}
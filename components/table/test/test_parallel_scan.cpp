@@ -0,0 +1,144 @@
+#include <catch2/catch.hpp>
+#include <components/table/data_table.hpp>
+#include <components/table/storage/buffer_pool.hpp>
+#include <components/table/storage/in_memory_block_manager.hpp>
+#include <components/table/storage/standard_buffer_manager.hpp>
+#include <core/file/local_file_system.hpp>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <thread>
+
+TEST_CASE("data_table_t::parallel_scan") {
+    using namespace components::types;
+    using namespace components::vector;
+    using namespace components::table;
+    using components::expressions::compare_type;
+
+    constexpr size_t vector_count = 6;
+    constexpr size_t test_size = DEFAULT_VECTOR_CAPACITY * (vector_count - 1) + 100;
+    constexpr size_t worker_count = 4;
+
+    core::filesystem::local_file_system_t fs;
+    auto buffer_pool =
+        storage::buffer_pool_t(std::pmr::get_default_resource(), uint64_t(1) << 32, false, uint64_t(1) << 24);
+    auto buffer_manager = storage::standard_buffer_manager_t(std::pmr::get_default_resource(), fs, buffer_pool);
+    auto block_manager = storage::in_memory_block_manager_t(buffer_manager, storage::DEFAULT_BLOCK_ALLOC_SIZE);
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("number", logical_type::BIGINT);
+    columns.emplace_back("name", logical_type::STRING_LITERAL);
+    auto data_table =
+        std::make_unique<data_table_t>(std::pmr::get_default_resource(), block_manager, std::move(columns));
+
+    {
+        data_chunk_t chunk(std::pmr::get_default_resource(), data_table->copy_types(), test_size);
+        chunk.set_cardinality(test_size);
+        for (size_t i = 0; i < test_size; i++) {
+            chunk.set_value(0, i, logical_value_t{int64_t(i)});
+            chunk.set_value(1, i, logical_value_t{"name_" + std::to_string(i)});
+        }
+        table_append_state state(std::pmr::get_default_resource());
+        data_table->append_lock(state);
+        data_table->initialize_append(state);
+        data_table->append(chunk, state);
+        data_table->finalize_append(state);
+    }
+
+    // numbers read by every morsel, keyed by the morsel number
+    // catch assertions are not thread safe, workers only collect the results
+    auto scan = [&](const table_filter_t* filter) {
+        std::map<uint64_t, std::vector<int64_t>> morsels;
+        std::mutex lock;
+        bool names_match = true;
+        bool unique_morsels = true;
+        parallel_table_scan_state parallel_state;
+        data_table->initialize_parallel_scan(parallel_state);
+        std::vector<std::thread> workers;
+        for (size_t worker = 0; worker < worker_count; worker++) {
+            workers.emplace_back([&] {
+                table_scan_state state(std::pmr::get_default_resource());
+                std::vector<storage_index_t> column_ids{storage_index_t(0), storage_index_t(1)};
+                while (data_table->next_parallel_scan(parallel_state, state, column_ids, filter)) {
+                    std::vector<int64_t> numbers;
+                    while (true) {
+                        data_chunk_t result(std::pmr::get_default_resource(), data_table->copy_types());
+                        data_table->scan(result, state);
+                        if (result.size() == 0) {
+                            break;
+                        }
+                        for (size_t i = 0; i < result.size(); i++) {
+                            auto number = result.data[0].value(i).value<int64_t>();
+                            auto name = *result.data[1].value(i).value<std::string*>();
+                            numbers.push_back(number);
+                            if (name != "name_" + std::to_string(number)) {
+                                std::lock_guard guard(lock);
+                                names_match = false;
+                            }
+                        }
+                    }
+                    std::lock_guard guard(lock);
+                    unique_morsels &= morsels.emplace(state.table_state.batch_index, std::move(numbers)).second;
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        REQUIRE(names_match);
+        REQUIRE(unique_morsels);
+        return morsels;
+    };
+    auto merge = [](const std::map<uint64_t, std::vector<int64_t>>& morsels) {
+        std::vector<int64_t> numbers;
+        for (const auto& [index, morsel] : morsels) {
+            numbers.insert(numbers.end(), morsel.begin(), morsel.end());
+        }
+        return numbers;
+    };
+
+    INFO("every row group is a morsel") {
+        REQUIRE(data_table->max_threads() == vector_count);
+        auto morsels = scan(nullptr);
+        REQUIRE(morsels.size() == vector_count);
+        for (const auto& [index, morsel] : morsels) {
+            auto rows = std::min<size_t>(DEFAULT_VECTOR_CAPACITY, test_size - index * DEFAULT_VECTOR_CAPACITY);
+            REQUIRE(morsel.size() == rows);
+        }
+        auto numbers = merge(morsels);
+        REQUIRE(numbers.size() == test_size);
+        for (size_t i = 0; i < test_size; i++) {
+            REQUIRE(numbers[i] == int64_t(i));
+        }
+    }
+
+    INFO("filters and zone maps") {
+        int64_t bound = DEFAULT_VECTOR_CAPACITY * 2 + 10;
+        constant_filter_t filter(compare_type::gte, logical_value_t{bound}, 0);
+        auto morsels = scan(&filter);
+        // the first two row groups are pruned before they are scanned
+        REQUIRE(morsels.size() == vector_count - 2);
+        REQUIRE(morsels.begin()->first == 2);
+        auto numbers = merge(morsels);
+        REQUIRE(numbers.size() == test_size - size_t(bound));
+        for (size_t i = 0; i < numbers.size(); i++) {
+            REQUIRE(numbers[i] == bound + int64_t(i));
+        }
+
+        constant_filter_t none(compare_type::lt, logical_value_t{int64_t(0)}, 0);
+        REQUIRE(scan(&none).empty());
+    }
+
+    INFO("deleted rows") {
+        vector_t ids(std::pmr::get_default_resource(), logical_type::BIGINT, 2);
+        ids.data<int64_t>()[0] = 5;
+        ids.data<int64_t>()[1] = int64_t(DEFAULT_VECTOR_CAPACITY * 3);
+        auto state = data_table->initialize_delete({});
+        REQUIRE(data_table->delete_rows(*state, ids, 2) == 2);
+        auto numbers = merge(scan(nullptr));
+        REQUIRE(numbers.size() == test_size - 2);
+        REQUIRE(std::find(numbers.begin(), numbers.end(), 5) == numbers.end());
+        REQUIRE(std::find(numbers.begin(), numbers.end(), int64_t(DEFAULT_VECTOR_CAPACITY * 3)) == numbers.end());
+    }
+}
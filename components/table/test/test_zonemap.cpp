@@ -0,0 +1,191 @@
+#include <catch2/catch.hpp>
+#include <components/table/data_table.hpp>
+#include <components/table/row_group.hpp>
+#include <components/table/storage/buffer_pool.hpp>
+#include <components/table/storage/in_memory_block_manager.hpp>
+#include <components/table/storage/standard_buffer_manager.hpp>
+#include <core/file/local_file_system.hpp>
+
+TEST_CASE("data_table_t::zonemap") {
+    using namespace components::types;
+    using namespace components::vector;
+    using namespace components::table;
+    using components::expressions::compare_type;
+
+    constexpr size_t vector_count = 8;
+    constexpr size_t test_size = DEFAULT_VECTOR_CAPACITY * vector_count;
+    auto generate_string = [](size_t i) {
+        auto number = std::to_string(i);
+        while (number.size() < 10) {
+            number.insert(number.begin(), '0');
+        }
+        return "string_with_index_" + number;
+    };
+    // every 5th row of the last vector is null
+    auto is_null = [](size_t i) { return i >= DEFAULT_VECTOR_CAPACITY * (vector_count - 1) && i % 5 == 0; };
+
+    core::filesystem::local_file_system_t fs;
+    auto buffer_pool =
+        storage::buffer_pool_t(std::pmr::get_default_resource(), uint64_t(1) << 32, false, uint64_t(1) << 24);
+    auto buffer_manager = storage::standard_buffer_manager_t(std::pmr::get_default_resource(), fs, buffer_pool);
+    auto block_manager = storage::in_memory_block_manager_t(buffer_manager, storage::DEFAULT_BLOCK_ALLOC_SIZE);
+
+    std::vector<column_definition_t> columns;
+    columns.emplace_back("number", logical_type::BIGINT);
+    columns.emplace_back("name", logical_type::STRING_LITERAL);
+    auto data_table =
+        std::make_unique<data_table_t>(std::pmr::get_default_resource(), block_manager, std::move(columns));
+
+    {
+        data_chunk_t chunk(std::pmr::get_default_resource(), data_table->copy_types(), test_size);
+        chunk.set_cardinality(test_size);
+        for (size_t i = 0; i < test_size; i++) {
+            chunk.set_value(0, i, logical_value_t{int64_t(i) + 1});
+            chunk.set_value(1, i, logical_value_t{generate_string(i)});
+            if (is_null(i)) {
+                chunk.data[0].validity().set_invalid(i);
+            }
+        }
+        table_append_state state(std::pmr::get_default_resource());
+        data_table->append_lock(state);
+        data_table->initialize_append(state);
+        data_table->append(chunk, state);
+        data_table->finalize_append(state);
+    }
+
+    auto scan = [&](const table_filter_t* filter) {
+        std::vector<int64_t> numbers;
+        table_scan_state state(std::pmr::get_default_resource());
+        data_table->initialize_scan(state, {storage_index_t(0), storage_index_t(1)}, filter);
+        while (true) {
+            data_chunk_t result(std::pmr::get_default_resource(), data_table->copy_types());
+            data_table->scan(result, state);
+            if (result.size() == 0) {
+                break;
+            }
+            for (size_t i = 0; i < result.size(); i++) {
+                auto value = result.data[0].value(i);
+                numbers.push_back(value.is_null() ? 0 : value.value<int64_t>());
+            }
+        }
+        return numbers;
+    };
+
+    INFO("segment statistics") {
+        vector_t data(std::pmr::get_default_resource(), logical_type::BIGINT, DEFAULT_VECTOR_CAPACITY);
+        for (size_t i = 0; i < DEFAULT_VECTOR_CAPACITY; i++) {
+            data.data<int64_t>()[i] = int64_t(i) + 10;
+        }
+        data.validity().set_invalid(3);
+        unified_vector_format uvf(std::pmr::get_default_resource(), DEFAULT_VECTOR_CAPACITY);
+        data.to_unified_format(DEFAULT_VECTOR_CAPACITY, uvf);
+
+        segment_statistics_t stats(logical_type::BIGINT, true);
+        REQUIRE_FALSE(stats.has_stats());
+        stats.update<int64_t>(uvf, 4, 10);
+        REQUIRE(stats.has_stats());
+        REQUIRE(stats.min().value<int64_t>() == 14);
+        REQUIRE(stats.max().value<int64_t>() == 23);
+        REQUIRE(stats.null_count() == 0);
+        stats.update<int64_t>(uvf, 0, 4);
+        REQUIRE(stats.min().value<int64_t>() == 0);
+        REQUIRE(stats.max().value<int64_t>() == 23);
+        REQUIRE(stats.null_count() == 1);
+
+        REQUIRE(stats.check_zonemap(constant_filter_t(compare_type::gt, logical_value_t{int64_t(23)}, 0)) ==
+                filter_propagate_result_t::ALWAYS_FALSE);
+        REQUIRE(stats.check_zonemap(constant_filter_t(compare_type::lte, logical_value_t{int64_t(23)}, 0)) ==
+                filter_propagate_result_t::ALWAYS_TRUE);
+        REQUIRE(stats.check_zonemap(constant_filter_t(compare_type::eq, logical_value_t{int64_t(5)}, 0)) ==
+                filter_propagate_result_t::NO_PRUNING_POSSIBLE);
+
+        segment_statistics_t loaded(logical_type::BIGINT, false);
+        loaded.update<int64_t>(uvf, 4, 10);
+        REQUIRE_FALSE(loaded.has_stats());
+        REQUIRE(loaded.check_zonemap(constant_filter_t(compare_type::gt, logical_value_t{int64_t(23)}, 0)) ==
+                filter_propagate_result_t::NO_PRUNING_POSSIBLE);
+    }
+
+    INFO("row group pruning") {
+        auto* row_group = data_table->row_group()->row_group(0);
+        auto rows = row_group->count.load();
+        constant_filter_t gt_filter(compare_type::gt, logical_value_t{int64_t(test_size)}, 0);
+        REQUIRE(row_group->check_zonemap(gt_filter, row_group->start, rows) ==
+                filter_propagate_result_t::ALWAYS_FALSE);
+        constant_filter_t gte_filter(compare_type::gte, logical_value_t{int64_t(1)}, 0);
+        REQUIRE(row_group->check_zonemap(gte_filter, row_group->start, rows) ==
+                filter_propagate_result_t::ALWAYS_TRUE);
+        constant_filter_t eq_filter(compare_type::eq, logical_value_t{int64_t(2)}, 0);
+        REQUIRE(row_group->check_zonemap(eq_filter, row_group->start, rows) ==
+                filter_propagate_result_t::NO_PRUNING_POSSIBLE);
+        constant_filter_t str_filter(compare_type::lt, logical_value_t{generate_string(0)}, 1);
+        REQUIRE(row_group->check_zonemap(str_filter, row_group->start, rows) ==
+                filter_propagate_result_t::ALWAYS_FALSE);
+
+        conjunction_or_filter_t conj_or;
+        conj_or.child_filters.emplace_back(gt_filter.copy());
+        conj_or.child_filters.emplace_back(str_filter.copy());
+        REQUIRE(row_group->check_zonemap(conj_or, row_group->start, rows) == filter_propagate_result_t::ALWAYS_FALSE);
+        conj_or.child_filters.emplace_back(eq_filter.copy());
+        REQUIRE(row_group->check_zonemap(conj_or, row_group->start, rows) ==
+                filter_propagate_result_t::NO_PRUNING_POSSIBLE);
+
+        conjunction_and_filter_t conj_and;
+        conj_and.child_filters.emplace_back(eq_filter.copy());
+        conj_and.child_filters.emplace_back(gt_filter.copy());
+        REQUIRE(row_group->check_zonemap(conj_and, row_group->start, rows) == filter_propagate_result_t::ALWAYS_FALSE);
+    }
+
+    INFO("scan with pruned row groups") {
+        int64_t bound = DEFAULT_VECTOR_CAPACITY * 3 + 10;
+        auto conj_and = std::make_unique<conjunction_and_filter_t>();
+        conj_and->child_filters.emplace_back(
+            std::make_unique<constant_filter_t>(compare_type::gt, logical_value_t{bound}, 0));
+        conj_and->child_filters.emplace_back(
+            std::make_unique<constant_filter_t>(compare_type::lte, logical_value_t{bound + 5}, 0));
+        auto numbers = scan(conj_and.get());
+        REQUIRE(numbers.size() == 5);
+        for (size_t i = 0; i < numbers.size(); i++) {
+            REQUIRE(numbers[i] == bound + 1 + int64_t(i));
+        }
+
+        constant_filter_t none(compare_type::gt, logical_value_t{int64_t(test_size)}, 0);
+        REQUIRE(scan(&none).empty());
+
+        constant_filter_t last(compare_type::gte, logical_value_t{generate_string(test_size - 3)}, 1);
+        numbers = scan(&last);
+        REQUIRE(numbers.size() == 3);
+        REQUIRE(numbers.back() == int64_t(test_size));
+    }
+
+    INFO("nulls are part of the range") {
+        // null rows are stored as zero: the range covers them, but they never pass a filter
+        auto* row_group = data_table->row_group()->row_group(vector_count - 1);
+        constant_filter_t zero(compare_type::eq, logical_value_t{int64_t(0)}, 0);
+        REQUIRE(row_group->check_zonemap(zero, row_group->start, row_group->count) !=
+                filter_propagate_result_t::ALWAYS_FALSE);
+        REQUIRE(scan(&zero).empty());
+        size_t nulls = 0;
+        for (size_t i = 0; i < test_size; i++) {
+            nulls += is_null(i);
+        }
+        constant_filter_t positive(compare_type::gt, logical_value_t{int64_t(0)}, 0);
+        REQUIRE(scan(&positive).size() == test_size - nulls);
+    }
+
+    INFO("updates widen the range") {
+        constant_filter_t updated(compare_type::eq, logical_value_t{int64_t(test_size * 10)}, 0);
+        REQUIRE(scan(&updated).empty());
+
+        data_chunk_t chunk(std::pmr::get_default_resource(), {complex_logical_type(logical_type::BIGINT)}, 1);
+        chunk.set_cardinality(1);
+        chunk.set_value(0, 0, logical_value_t{int64_t(test_size * 10)});
+        vector_t ids(std::pmr::get_default_resource(), logical_type::BIGINT, 1);
+        ids.data<int64_t>()[0] = 7;
+        data_table->update_column(ids, {0}, chunk);
+
+        auto* row_group = data_table->row_group()->row_group(0);
+        REQUIRE(row_group->check_zonemap(updated, row_group->start, row_group->count) !=
+                filter_propagate_result_t::ALWAYS_FALSE);
+    }
+}
@@ -14,7 +14,8 @@ namespace components::table {
                         types::complex_logical_type(types::logical_type::VALIDITY),
                         &parent) {}
 
-    filter_propagate_result_t validity_column_data_t::check_zonemap(column_scan_state& state, table_filter_t& filter) {
+    filter_propagate_result_t
+    validity_column_data_t::check_zonemap(uint64_t start_row, uint64_t count, const constant_filter_t& filter) {
         return filter_propagate_result_t::NO_PRUNING_POSSIBLE;
     }
 
@@ -11,7 +11,8 @@ namespace components::table {
                                uint64_t start_row,
                                column_data_t& parent);
 
-        filter_propagate_result_t check_zonemap(column_scan_state& state, table_filter_t& filter) override;
+        filter_propagate_result_t
+        check_zonemap(uint64_t start_row, uint64_t count, const constant_filter_t& filter) override;
         void append_data(column_append_state& state, vector::unified_vector_format& uvf, uint64_t count) override;
     };
 
@@ -140,6 +140,7 @@ namespace components::types {
             case logical_type::TIMESTAMP_MS:
             case logical_type::TIMESTAMP_US:
             case logical_type::TIMESTAMP_NS:
+            case logical_type::DECIMAL:
                 return sizeof(int64_t);
             case logical_type::FLOAT:
                 return sizeof(float);
@@ -153,6 +154,11 @@ namespace components::types {
                 return sizeof(uint32_t);
             case logical_type::UBIGINT:
                 return sizeof(uint64_t);
+            case logical_type::HUGEINT:
+            case logical_type::UUID:
+                return sizeof(int128_t);
+            case logical_type::UHUGEINT:
+                return sizeof(uint128_t);
             case logical_type::STRING_LITERAL:
                 return sizeof(std::string_view);
             case logical_type::POINTER:
@@ -185,6 +191,7 @@ namespace components::types {
             case logical_type::TIMESTAMP_MS:
             case logical_type::TIMESTAMP_US:
             case logical_type::TIMESTAMP_NS:
+            case logical_type::DECIMAL:
                 return alignof(int64_t);
             case logical_type::FLOAT:
                 return alignof(float);
@@ -199,6 +206,11 @@ namespace components::types {
             case logical_type::UBIGINT:
             case logical_type::VALIDITY:
                 return alignof(uint64_t);
+            case logical_type::HUGEINT:
+            case logical_type::UUID:
+                return alignof(int128_t);
+            case logical_type::UHUGEINT:
+                return alignof(uint128_t);
             case logical_type::STRING_LITERAL:
                 return alignof(std::string_view);
             case logical_type::POINTER:
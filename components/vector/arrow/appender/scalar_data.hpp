@@ -23,6 +23,20 @@ namespace components::vector::arrow::appender {
         static void set_null(TGT& value) {}
     };
 
+    // decimal256 value of arrow, little endian like the buffers
+    struct arrow_decimal256_t {
+        absl::uint128 lower;
+        absl::uint128 upper;
+    };
+
+    // unsigned 128 bit integers do not fit decimal128, they are written as decimal256 with a zero upper half
+    struct arrow_uhugeint_converter_t : arrow_scalar_converter_t {
+        template<class TGT, class SRC>
+        static TGT operation(SRC input) {
+            return TGT{input, 0};
+        }
+    };
+
     template<class TGT, class SRC = TGT, class OP = arrow_scalar_converter_t>
     struct arrow_scalar_base_data_t {
         static void
@@ -144,7 +144,10 @@ namespace components::vector::arrow {
                 initialize_appender_templated<appender::arrow_scala_data<absl::int128>>(append_data);
                 break;
             case logical_type::UHUGEINT:
-                initialize_appender_templated<appender::arrow_scala_data<absl::uint128>>(append_data);
+                initialize_appender_templated<appender::arrow_scala_data<appender::arrow_decimal256_t,
+                                                                         absl::uint128,
+                                                                         appender::arrow_uhugeint_converter_t>>(
+                    append_data);
                 break;
             case logical_type::UTINYINT:
                 initialize_appender_templated<appender::arrow_scala_data<uint8_t>>(append_data);
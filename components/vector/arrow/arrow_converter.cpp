@@ -7,6 +7,7 @@
 #include <components/types/types.hpp>
 #include <components/vector/data_chunk.hpp>
 
+#include <array>
 #include <cassert>
 #include <list>
 #include <memory>
@@ -19,14 +20,151 @@ namespace components::vector::arrow {
     using types::complex_logical_type;
     using types::logical_type;
 
+    namespace {
+
+        // arrow layout of these types matches a flat vector: values in one buffer and a little endian bitmap
+        bool is_zero_copy_column(const vector_t& column) {
+            if (column.get_vector_type() != vector_type::FLAT) {
+                return false;
+            }
+            switch (column.type().type()) {
+                case logical_type::TINYINT:
+                case logical_type::SMALLINT:
+                case logical_type::INTEGER:
+                case logical_type::BIGINT:
+                case logical_type::UTINYINT:
+                case logical_type::USMALLINT:
+                case logical_type::UINTEGER:
+                case logical_type::UBIGINT:
+                case logical_type::FLOAT:
+                case logical_type::DOUBLE:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        // keeps the buffers of an exported column alive
+        struct column_holder_t {
+            explicit column_holder_t(const vector_t& column)
+                : vector(column) {}
+
+            vector_t vector;
+            std::array<const void*, 2> buffers{};
+        };
+
+        struct chunk_holder_t {
+            // columns converted by the appender, not released if all columns are referenced
+            ArrowArray copied{};
+            std::vector<ArrowArray> referenced;
+            std::vector<ArrowArray*> children;
+            std::array<const void*, 1> buffers{};
+        };
+
+        void release_column(ArrowArray* array) {
+            if (!array || !array->release) {
+                return;
+            }
+            array->release = nullptr;
+            delete static_cast<column_holder_t*>(array->private_data);
+        }
+
+        void release_chunk(ArrowArray* array) {
+            if (!array || !array->release) {
+                return;
+            }
+            auto holder = static_cast<chunk_holder_t*>(array->private_data);
+            for (auto* child : holder->children) {
+                // children moved out by the consumer are already released
+                if (child->release) {
+                    child->release(child);
+                }
+            }
+            if (holder->copied.release) {
+                holder->copied.release(&holder->copied);
+            }
+            array->release = nullptr;
+            delete holder;
+        }
+
+        void reference_column(const vector_t& column, uint64_t count, ArrowArray& out) {
+            auto holder = std::make_unique<column_holder_t>(column);
+            const auto& validity = holder->vector.validity();
+            holder->buffers[0] = validity.all_valid() ? nullptr : validity.data();
+            holder->buffers[1] = holder->vector.data();
+            out.length = static_cast<int64_t>(count);
+            out.null_count = validity.all_valid() ? 0 : static_cast<int64_t>(count - validity.count_valid(count));
+            out.offset = 0;
+            out.n_buffers = 2;
+            out.n_children = 0;
+            out.buffers = holder->buffers.data();
+            out.children = nullptr;
+            out.dictionary = nullptr;
+            out.private_data = holder.release();
+            out.release = release_column;
+        }
+
+    } // namespace
+
     void to_arrow_array(data_chunk_t& input, ArrowArray* out_array) {
-        arrow_appender_t appender(input.types(), input.size());
-        appender.append(input, 0, input.size(), input.size());
-        *out_array = appender.finalize();
+        const auto count = input.size();
+        std::vector<size_t> copied_columns;
+        for (size_t i = 0; i < input.column_count(); i++) {
+            if (!is_zero_copy_column(input.data[i])) {
+                copied_columns.push_back(i);
+            }
+        }
+        if (copied_columns.size() == input.column_count()) {
+            arrow_appender_t appender(input.types(), count);
+            appender.append(input, 0, count, count);
+            *out_array = appender.finalize();
+            return;
+        }
+
+        // fixed width columns share their buffers with the chunk, the rest is converted by the appender
+        auto holder = std::make_unique<chunk_holder_t>();
+        holder->referenced.resize(input.column_count());
+        holder->children.resize(input.column_count());
+        for (size_t i = 0; i < input.column_count(); i++) {
+            holder->children[i] = &holder->referenced[i];
+        }
+        if (!copied_columns.empty()) {
+            std::pmr::vector<complex_logical_type> types(input.resource());
+            for (auto i : copied_columns) {
+                types.push_back(input.data[i].type());
+            }
+            data_chunk_t copied(input.resource(), types, count);
+            for (size_t j = 0; j < copied_columns.size(); j++) {
+                copied.data[j].reference(input.data[copied_columns[j]]);
+            }
+            copied.set_cardinality(count);
+            arrow_appender_t appender(copied.types(), count);
+            appender.append(copied, 0, count, count);
+            holder->copied = appender.finalize();
+            for (size_t j = 0; j < copied_columns.size(); j++) {
+                holder->children[copied_columns[j]] = holder->copied.children[j];
+            }
+        }
+        for (size_t i = 0; i < input.column_count(); i++) {
+            if (is_zero_copy_column(input.data[i])) {
+                reference_column(input.data[i], count, holder->referenced[i]);
+            }
+        }
+
+        out_array->length = static_cast<int64_t>(count);
+        out_array->null_count = 0;
+        out_array->offset = 0;
+        out_array->n_buffers = 1;
+        out_array->n_children = static_cast<int64_t>(input.column_count());
+        out_array->buffers = holder->buffers.data();
+        out_array->children = holder->children.data();
+        out_array->dictionary = nullptr;
+        out_array->private_data = holder.release();
+        out_array->release = release_chunk;
     }
 
-    std::unique_ptr<char> add_name(const std::string& name) {
-        auto name_ptr = std::make_unique<char>(name.size() + 1);
+    std::unique_ptr<char[]> add_name(const std::string& name) {
+        auto name_ptr = std::make_unique<char[]>(name.size() + 1);
         for (size_t i = 0; i < name.size(); i++) {
             name_ptr.get()[i] = name[i];
         }
@@ -39,9 +177,9 @@ namespace components::vector::arrow {
         std::vector<ArrowSchema*> children_ptrs;
         std::list<std::vector<ArrowSchema>> nested_children;
         std::list<std::vector<ArrowSchema*>> nested_children_ptr;
-        std::vector<std::unique_ptr<char>> owned_type_names;
-        std::vector<std::unique_ptr<char>> owned_column_names;
-        std::vector<std::unique_ptr<char>> metadata_info;
+        std::vector<std::unique_ptr<char[]>> owned_type_names;
+        std::vector<std::unique_ptr<char[]>> owned_column_names;
+        std::vector<std::unique_ptr<char[]>> metadata_info;
     };
 
     static void release_otterbrix_arrow_schema(ArrowSchema* schema) {
@@ -118,6 +256,14 @@ namespace components::vector::arrow {
             case logical_type::UBIGINT:
                 child.format = "L";
                 break;
+            case logical_type::HUGEINT:
+                // arrow has no 128 bit integers, decimal128 of scale 0 has the same layout
+                child.format = "d:38,0";
+                break;
+            case logical_type::UHUGEINT:
+                // decimal128 is signed, an unsigned value is widened to decimal256
+                child.format = "d:39,0,256";
+                break;
             case logical_type::FLOAT:
                 child.format = "f";
                 break;
@@ -301,15 +447,17 @@ namespace components::vector::arrow {
 
         auto& arrow_types = converted_schema.get_columns();
         dchunk.set_cardinality(static_cast<uint64_t>(arrow_array->length));
+        // every column referencing the arrow buffers keeps the whole array alive
+        auto owned_data = std::make_shared<arrow_array_wrapper_t>();
+        owned_data->arrow_array = *arrow_array;
+        arrow_array->release = nullptr;
         for (uint64_t i = 0; i < dchunk.column_count(); i++) {
-            auto& parent_array = *arrow_array;
+            auto& parent_array = owned_data->arrow_array;
             auto& array = parent_array.children[i];
             auto arrow_type = arrow_types.at(i);
             auto array_physical_type = arrow_type->get_physical_type();
             auto array_state = std::make_unique<arrow_array_scan_state>();
-            array_state->owned_data = std::make_shared<arrow_array_wrapper_t>();
-            array_state->owned_data->arrow_array = *arrow_array;
-            arrow_array->release = nullptr;
+            array_state->owned_data = owned_data;
             switch (array_physical_type) {
                 case arrow_array_physical_type::DICTIONARY_ENCODED:
                     scaner::arrow_column_to_dictionary(dchunk.data[i],
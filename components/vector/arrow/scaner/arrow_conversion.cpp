@@ -40,6 +40,8 @@ namespace components::vector::arrow::scaner {
         if (array.null_count != 0 && array.n_buffers > 0 && array.buffers[0]) {
             auto bit_offset = get_effective_offset(array, parent_offset, chunk_offset, nested_offset);
             auto n_bitmask_bytes = (size + 8 - 1) / 8;
+            // an all valid mask has no buffer to copy the bits into
+            mask.resize(mask.resource(), std::max<uint64_t>(mask.count(), size));
             if (bit_offset % 8 == 0) {
                 memcpy(mask.data(), arrow_buffer_data<std::byte>(array, 0) + bit_offset / 8, n_bitmask_bytes);
             } else {
@@ -29,6 +29,12 @@ namespace components::vector {
             return;
         }
         capacity_ = DEFAULT_VECTOR_CAPACITY;
+        for (auto& vec : data) {
+            // scans write into flat buffers: drop dictionaries and constants left by the previous use
+            if (vec.get_vector_type() != vector_type::FLAT) {
+                vec = vector_t(resource_, vec.type(), capacity_);
+            }
+        }
         set_cardinality(0);
     }
 
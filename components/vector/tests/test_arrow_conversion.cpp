@@ -106,6 +106,10 @@ TEST_CASE("data_chunk to arrow") {
     ArrowArray arrow_array;
     to_arrow_schema(&schema, types);
     to_arrow_array(chunk, &arrow_array);
+    // fixed width columns share their values with the chunk
+    REQUIRE(arrow_array.children[0]->buffers[1] == chunk.data[0].data());
+    REQUIRE(arrow_array.children[2]->buffers[1] == chunk.data[2].data());
+    REQUIRE(arrow_array.children[1]->buffers[1] != nullptr);
     auto res = data_chunk_from_arrow(&resource, &arrow_array, schema_from_arrow(&schema));
     REQUIRE(chunk.column_count() == res.column_count());
     REQUIRE(chunk.size() == res.size());
@@ -114,4 +118,31 @@ TEST_CASE("data_chunk to arrow") {
             REQUIRE(chunk.value(i, j) == res.value(i, j));
         }
     }
-}
\ No newline at end of file
+}
+TEST_CASE("uhugeint to arrow") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    std::pmr::vector<complex_logical_type> types(&resource);
+    types.emplace_back(logical_type::UHUGEINT, "sum");
+
+    // above the range of a signed 128 bit integer
+    const uint128_t big = absl::MakeUint128(uint64_t(1) << 63, 5);
+    data_chunk_t chunk(&resource, types, 2);
+    chunk.set_cardinality(2);
+    chunk.set_value(0, 0, logical_value_t{big});
+    chunk.set_value(0, 1, logical_value_t{uint128_t(7)});
+
+    ArrowSchema schema;
+    ArrowArray arrow_array;
+    to_arrow_schema(&schema, types);
+    to_arrow_array(chunk, &arrow_array);
+    REQUIRE(std::string(schema.children[0]->format) == "d:39,0,256");
+    auto words = static_cast<const uint64_t*>(arrow_array.children[0]->buffers[1]);
+    REQUIRE(words[0] == 5);
+    REQUIRE(words[1] == uint64_t(1) << 63);
+    REQUIRE(words[2] == 0);
+    REQUIRE(words[3] == 0);
+    REQUIRE(words[4] == 7);
+    REQUIRE(words[5] == 0);
+    arrow_array.release(&arrow_array);
+    schema.release(&schema);
+}
@@ -448,9 +448,9 @@ namespace components::vector {
             case types::logical_type::BIGINT:
                 reinterpret_cast<int64_t*>(data_)[index] = val.value<int64_t>();
                 break;
-            //case types::logical_type::HUGEINT:
-            //	reinterpret_cast<int128_t*>(data_)[index] = val.value<int128_t>();
-            //	break;
+            case types::logical_type::HUGEINT:
+                reinterpret_cast<types::int128_t*>(data_)[index] = val.value<types::int128_t>();
+                break;
             case types::logical_type::UTINYINT:
                 reinterpret_cast<uint8_t*>(data_)[index] = val.value<uint8_t>();
                 break;
@@ -463,9 +463,9 @@ namespace components::vector {
             case types::logical_type::UBIGINT:
                 reinterpret_cast<uint64_t*>(data_)[index] = val.value<uint64_t>();
                 break;
-            //case types::logical_type::UHUGEINT:
-            //	reinterpret_cast<uint128_t*>(data_)[index] = val.value<uint128_t>();
-            //	break;
+            case types::logical_type::UHUGEINT:
+                reinterpret_cast<types::uint128_t*>(data_)[index] = val.value<types::uint128_t>();
+                break;
             case types::logical_type::FLOAT:
                 reinterpret_cast<float*>(data_)[index] = val.value<float>();
                 break;
@@ -601,10 +601,10 @@ namespace components::vector {
                 return types::logical_value_t(reinterpret_cast<uint32_t*>(data_)[index]);
             case types::logical_type::UBIGINT:
                 return types::logical_value_t(reinterpret_cast<uint64_t*>(data_)[index]);
-            // case types::logical_type::HUGEINT:
-            // return types::logical_value_t(reinterpret_cast<int128_t*>(data_)[index]);
-            // case types::logical_type::UHUGEINT:
-            // return types::logical_value_t::UHUGEINT(reinterpret_cast<uint128_t*>(data_)[index]);
+            case types::logical_type::HUGEINT:
+                return types::logical_value_t(reinterpret_cast<types::int128_t*>(data_)[index]);
+            case types::logical_type::UHUGEINT:
+                return types::logical_value_t(reinterpret_cast<types::uint128_t*>(data_)[index]);
             case types::logical_type::DECIMAL: {
                 assert(type_.extension()->type() == types::logical_type_extension::extension_type::DECIMAL);
                 auto width = static_cast<types::decimal_logical_type_extension*>(type_.extension())->width();
@@ -262,6 +262,7 @@ namespace core::b_plus_tree {
     size_t btree_t::leaf_node_t::count() const { return segment_tree_->count(); }
     size_t btree_t::leaf_node_t::unique_entry_count() const { return segment_tree_->unique_indices_count(); }
     uint64_t btree_t::leaf_node_t::segment_tree_id() const { return segment_tree_id_; }
+    bool btree_t::leaf_node_t::is_modified() const { return segment_tree_->is_modified(); }
     void btree_t::leaf_node_t::flush() const { segment_tree_->flush(); }
     void btree_t::leaf_node_t::load() { segment_tree_->lazy_load(); }
 
@@ -746,8 +747,6 @@ namespace core::b_plus_tree {
             return;
         }
 
-        std::filesystem::path file_name = storage_directory_;
-        file_name /= std::filesystem::path(metadata_file_name_);
         tree_mutex_.lock();
 
         // got root mutex, no need to lock nodes or save parent node
@@ -756,29 +755,44 @@ namespace core::b_plus_tree {
             current_node = static_cast<inner_node_t*>(current_node)->find_node(std::numeric_limits<index_t>::min());
         }
 
-        leaf_node_t* first_leaf = static_cast<leaf_node_t*>(current_node);
-        leaf_node_t* node = first_leaf;
+        leaf_node_t* node = static_cast<leaf_node_t*>(current_node);
 
-        size_t* buffer = static_cast<size_t*>(resource_->allocate(METADATA_SIZE));
-        *buffer = item_count_;
-        *(buffer + 1) = leaf_nodes_count_;
-        uint64_t* buffer_writer = reinterpret_cast<uint64_t*>(buffer + 2);
-
-        size_t i = 0;
-        // save each segment tree
+        std::vector<uint64_t> metadata;
+        metadata.reserve(leaf_nodes_count_ + 2);
+        metadata.push_back(item_count_);
+        metadata.push_back(leaf_nodes_count_);
+        // save only segment trees changed since the last flush
         while (node) {
-            node->flush();
-            *buffer_writer = node->segment_tree_id();
-            buffer_writer++;
+            if (node->is_modified()) {
+                node->flush();
+            }
+            metadata.push_back(node->segment_tree_id());
             node = static_cast<leaf_node_t*>(node->right_node_);
-            i++;
         }
-        std::unique_ptr<core::filesystem::file_handle_t> file =
-            open_file(fs_, file_name, file_flags::WRITE | file_flags::FILE_CREATE);
-        file->write(static_cast<void*>(buffer), METADATA_SIZE, 0);
+
+        if (metadata != flushed_metadata_) {
+            // write a new copy and rename it, so metadata on disk is never partially written
+            std::filesystem::path file_name = storage_directory_ / std::filesystem::path(metadata_file_name_);
+            std::filesystem::path tmp_file_name = storage_directory_ / std::filesystem::path(metadata_tmp_file_name_);
+            size_t* buffer = static_cast<size_t*>(resource_->allocate(METADATA_SIZE));
+            std::memset(buffer, 0, METADATA_SIZE);
+            std::memcpy(buffer, metadata.data(), metadata.size() * sizeof(uint64_t));
+            {
+                std::unique_ptr<core::filesystem::file_handle_t> file =
+                    open_file(fs_, tmp_file_name, file_flags::WRITE | file_flags::FILE_CREATE);
+                file->write(static_cast<void*>(buffer), METADATA_SIZE, 0);
+                file->sync();
+            }
+            resource_->deallocate(static_cast<void*>(buffer), METADATA_SIZE);
+            if (!move_files(fs_, tmp_file_name, file_name)) {
+                // some platforms do not replace existing file on rename
+                remove_file(fs_, file_name);
+                move_files(fs_, tmp_file_name, file_name);
+            }
+            flushed_metadata_ = std::move(metadata);
+        }
 
         tree_mutex_.unlock();
-        resource_->deallocate(static_cast<void*>(buffer), METADATA_SIZE);
     }
 
     void btree_t::load() {
@@ -799,6 +813,7 @@ namespace core::b_plus_tree {
         item_count_ = *buffer;
         leaf_nodes_count_ = *(buffer + 1);
         uint64_t* buffer_reader = reinterpret_cast<uint64_t*>(buffer + 2);
+        flushed_metadata_.assign(reinterpret_cast<uint64_t*>(buffer), buffer_reader + leaf_nodes_count_);
 
         // with some index manipulations, all could be done in one layer
         base_node_t** nodes_layer =
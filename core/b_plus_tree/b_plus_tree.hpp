@@ -89,6 +89,7 @@ namespace core::b_plus_tree {
             size_t count() const override;
             size_t unique_entry_count() const override;
             uint64_t segment_tree_id() const;
+            bool is_modified() const;
             void flush() const;
             void load();
 
@@ -196,8 +197,8 @@ namespace core::b_plus_tree {
         // unreliable for now, because physical_value does not own string buffer
         void list_indices(std::vector<index_t>& result);
 
-        // full flush and load for now
-        // TODO: flush and load only modified leaves
+        // writes only modified leaves, metadata file is replaced atomically and only if it has changed
+        // TODO: load only required leaves
         void flush();
         void load();
 
@@ -228,7 +229,10 @@ namespace core::b_plus_tree {
         std::atomic<size_t> item_count_{0};
         std::atomic<size_t> leaf_nodes_count_{0};
         std::queue<uint64_t> missed_ids_;
+        // content of the metadata file as of the last flush or load
+        std::vector<uint64_t> flushed_metadata_;
         static constexpr std::string_view metadata_file_name_ = "metadata";
+        static constexpr std::string_view metadata_tmp_file_name_ = "metadata.tmp";
     };
 
     template<typename T, typename Deserializer>
@@ -724,7 +724,15 @@ namespace core::b_plus_tree {
 
     size_t segment_tree_t::unique_indices_count() const { return *unique_id_count_; }
 
+    bool segment_tree_t::is_modified() const {
+        return header_modified_ ||
+               std::any_of(segments_.begin(), segments_.end(), [](const node_t& node) { return node.modified; });
+    }
+
     void segment_tree_t::flush() {
+        if (!is_modified()) {
+            return;
+        }
         close_gaps_();
 
         /*  header_  */
@@ -746,6 +754,7 @@ namespace core::b_plus_tree {
         }
         file_->truncate(static_cast<int64_t>(gap_tracker_.empty_spaces().front().offset));
         file_->sync();
+        header_modified_ = false;
     }
 
     void segment_tree_t::clean_load() {
@@ -756,6 +765,7 @@ namespace core::b_plus_tree {
         file_->read(static_cast<void*>(header_), header_size);
         metadata_end_ = metadata_begin_ + *header_;
         gap_tracker_.init(file_->file_size(), INVALID_SIZE);
+        header_modified_ = false;
 
         segments_.reserve(*header_);
         string_storage_.reserve(*header_);
@@ -791,6 +801,7 @@ namespace core::b_plus_tree {
         file_->read(static_cast<void*>(header_), header_size);
         metadata_end_ = metadata_begin_ + *header_;
         gap_tracker_.init(file_->file_size(), std::numeric_limits<size_t>::max());
+        header_modified_ = false;
 
         segments_.reserve(*header_);
         string_storage_.reserve(*header_);
@@ -840,6 +851,7 @@ namespace core::b_plus_tree {
         string_storage_.erase(string_storage_.begin() + (range.begin - metadata_begin_),
                               string_storage_.begin() + (range.end - metadata_begin_));
         *header_ = segments_.size();
+        header_modified_ = true;
     }
 
     segment_tree_t::node_t segment_tree_t::construct_new_node_(const index_t& index, item_data item) {
@@ -921,6 +933,7 @@ namespace core::b_plus_tree {
         update_metadata_(pos, metadata);
         metadata_end_++;
         *header_ = segments_.size();
+        header_modified_ = true;
     }
 
     void segment_tree_t::remove_segment_(it pos) {
@@ -933,10 +946,12 @@ namespace core::b_plus_tree {
         segments_.erase(pos);
         string_storage_.erase(string_storage_.begin() + index);
         *header_ = segments_.size();
+        header_modified_ = true;
     }
 
     void segment_tree_t::update_metadata_(it pos, block_metadata* metadata) {
         using components::types::physical_type;
+        header_modified_ = true;
         index_t min_index = pos->block->min_index();
         auto index_storage = string_storage_.begin() + (pos - segments_.begin());
         if (min_index.type() == physical_type::STRING) {
@@ -964,6 +979,7 @@ namespace core::b_plus_tree {
                 if (it->file_offset > gaps.front().offset) {
                     it->file_offset -= gaps.front().size;
                     segments_[i].modified = true;
+                    header_modified_ = true;
                 }
             }
             for (size_t i = 1; i < gaps.size(); i++) {
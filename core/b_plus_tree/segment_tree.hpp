@@ -296,7 +296,9 @@ namespace core::b_plus_tree {
         size_t blocks_count() const;
         size_t count() const;
         size_t unique_indices_count() const;
-        // flush to disk
+        // true if header or any block changed since the last flush or load
+        bool is_modified() const;
+        // flush header and modified blocks to disk, does nothing if tree is not modified
         void flush();
         // load all tree segment at once from scratch
         void clean_load();
@@ -335,6 +337,8 @@ namespace core::b_plus_tree {
         block_metadata* metadata_end_;
         // keep track of gaps in block record and try to fill them when creating new blocks
         gap_tracker_t gap_tracker_{header_size, INVALID_SIZE};
+        // header (counters or block metadata) differs from the one stored on disk
+        bool header_modified_ = false;
 
         std::unique_ptr<filesystem::file_handle_t> file_;
         std::vector<std::pair<std::pmr::string, std::pmr::string>> string_storage_;
@@ -450,8 +450,10 @@ TEST_CASE("segment_tree") {
         }
 
         REQUIRE(tree.count() == 500);
+        REQUIRE(tree.is_modified());
 
         tree.flush();
+        REQUIRE_FALSE(tree.is_modified());
         tree.clean_load();
 
         REQUIRE(tree.count() == 500);
@@ -947,6 +949,50 @@ TEST_CASE("b+tree") {
             resource.deallocate(test_data[i].buffer, test_data[i].size);
         }
     }
+    INFO("b+tree: incremental flush") {
+        size_t key_num = 10'000;
+        local_file_system_t fs = local_file_system_t();
+        auto dname = testing_directory;
+        dname /= "btree_test_flush";
+
+        auto key_getter = [](const block_t::item_data& data) -> block_t::index_t {
+            return block_t::index_t(*reinterpret_cast<uint64_t*>(data.data));
+        };
+
+        btree_t tree(&resource, fs, dname, key_getter, 128);
+
+        std::vector<uint64_t> keys;
+        for (uint64_t i = 0; i < key_num; i++) {
+            keys.emplace_back(i);
+        }
+        for (uint64_t i = 0; i < key_num; i++) {
+            REQUIRE(tree.append({reinterpret_cast<data_ptr_t>(&keys[i]), sizeof(uint64_t)}));
+        }
+        tree.flush();
+        REQUIRE(file_exists(fs, dname / "metadata"));
+        REQUIRE_FALSE(file_exists(fs, dname / "metadata.tmp"));
+        // nothing changed, second flush does not touch any file
+        tree.flush();
+
+        // change a single leaf
+        REQUIRE(tree.remove_index(btree_t::index_t(uint64_t(42))));
+        tree.flush();
+        REQUIRE_FALSE(file_exists(fs, dname / "metadata.tmp"));
+
+        // changes after the last flush are discarded by load
+        REQUIRE(tree.remove_index(btree_t::index_t(uint64_t(4242))));
+        tree.load();
+        REQUIRE(tree.size() == key_num - 1);
+        for (uint64_t i = 0; i < key_num; i++) {
+            REQUIRE(tree.contains_index(btree_t::index_t(i)) == (i != 42));
+        }
+
+        // load restores flushed state, so nothing has to be written
+        tree.flush();
+        tree.load();
+        REQUIRE(tree.size() == key_num - 1);
+        REQUIRE(tree.contains_index(btree_t::index_t(uint64_t(4242))));
+    }
     INFO("b+tree: big item count; random order") {
         size_t key_num = 100'000;
         local_file_system_t fs = local_file_system_t();
@@ -83,6 +83,8 @@ namespace core::filesystem {
 
     bool file_handle_t::sync() { return ::core::filesystem::file_sync(fs_, *this); }
 
+    bool file_handle_t::data_sync() { return ::core::filesystem::file_data_sync(fs_, *this); }
+
     bool file_handle_t::truncate(int64_t new_size) { return ::core::filesystem::truncate(fs_, *this, new_size); }
 
     bool file_handle_t::trim(uint64_t offset_bytes, uint64_t length_bytes) {
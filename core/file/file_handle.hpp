@@ -48,6 +48,7 @@ namespace core::filesystem {
         void reset();
         uint64_t seek_position();
         bool sync();
+        bool data_sync();
         bool truncate(int64_t new_size);
         bool trim(uint64_t offset_bytes, uint64_t length_bytes);
         std::string read_line();
@@ -111,6 +111,11 @@ namespace core::filesystem {
         return file_sync(fs, std::forward<Args>(args)...);
     }
 
+    template<class FSC, class... Args>
+    bool file_data_sync(file_system<FSC>& fs, Args&&... args) {
+        return file_data_sync(fs, std::forward<Args>(args)...);
+    }
+
     template<class FSC, class... Args>
     std::vector<path_t> glob_files(file_system<FSC>& fs, Args&&... args) {
         return glob_files(fs, std::forward<Args>(args)...);
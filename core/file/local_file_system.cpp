@@ -604,6 +604,15 @@ namespace core::filesystem {
         return true;
     }
 
+    bool file_data_sync(local_file_system_t&, file_handle_t& handle) {
+        int fd = reinterpret_cast<unix_file_handle_t&>(handle).fd;
+#if defined(__linux__)
+        return fdatasync(fd) == 0;
+#else
+        return fsync(fd) == 0;
+#endif
+    }
+
     bool move_files(local_file_system_t&, const path_t& source, const path_t& target) {
         if (rename(source.c_str(), target.c_str()) != 0) {
             return false;
@@ -935,6 +944,8 @@ namespace core::filesystem {
         return true;
     }
 
+    bool file_data_sync(local_file_system_t& fs, file_handle_t& handle) { return file_sync(fs, handle); }
+
     bool move_files(local_file_system_t&, const path_t& source, const path_t& target) {
         auto source_unicode = path_utils::UTF8_to_Unicode(source.c_str());
         auto target_unicode = path_utils::UTF8_to_Unicode(target.c_str());
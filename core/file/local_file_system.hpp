@@ -66,6 +66,8 @@ namespace core::filesystem {
     bool is_pipe(local_file_system_t&, const path_t& filename);
     bool remove_file(local_file_system_t&, const path_t& filename);
     bool file_sync(local_file_system_t&, file_handle_t& handle);
+    // flushes file data and only the metadata needed to read it back (fdatasync)
+    bool file_data_sync(local_file_system_t&, file_handle_t& handle);
 
     std::vector<path_t> glob_files(local_file_system_t&, const std::string& path);
 
@@ -118,6 +118,10 @@ namespace core::filesystem {
         return file_sync(vfs.default_file_system(), handle);
     }
 
+    bool file_data_sync(virtual_file_system_t& vfs, file_handle_t& handle) {
+        return file_data_sync(vfs.default_file_system(), handle);
+    }
+
     bool directory_exists(virtual_file_system_t& vfs, const path_t& directory) {
         return directory_exists(vfs.find_file_system(directory), directory);
     }
@@ -53,6 +53,7 @@ namespace core::filesystem {
     bool is_pipe(virtual_file_system_t&, const path_t& filename);
     bool remove_file(virtual_file_system_t&, const path_t& filename);
     bool file_sync(virtual_file_system_t&, file_handle_t& handle);
+    bool file_data_sync(virtual_file_system_t&, file_handle_t& handle);
     std::vector<path_t> glob_files(virtual_file_system_t&, const std::string& path);
 
 } // namespace core::filesystem
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <memory_resource>
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 
 namespace core::pmr::hash_map {
@@ -11,4 +12,12 @@ namespace core::pmr::hash_map {
              class Eq = absl::container_internal::hash_default_eq<Key>>
     using hash_map =
         absl::node_hash_map<Key, Value, Hash, Eq, std::pmr::polymorphic_allocator<std::pair<const Key, Value>>>;
+
+    // open addressing, values are not pointer stable
+    template<class Key,
+             class Value,
+             class Hash = absl::container_internal::hash_default_hash<Key>,
+             class Eq = absl::container_internal::hash_default_eq<Key>>
+    using flat_hash_map =
+        absl::flat_hash_map<Key, Value, Hash, Eq, std::pmr::polymorphic_allocator<std::pair<const Key, Value>>>;
 }
\ No newline at end of file
@@ -0,0 +1,736 @@
+#include "string_matcher.hpp"
+
+#include <cstring>
+#include <limits>
+
+namespace core {
+
+    namespace {
+
+        constexpr uint32_t unbounded = std::numeric_limits<uint32_t>::max();
+        // counted repetitions are unrolled, larger programs are left to std::regex
+        constexpr std::size_t max_program_size = 1 << 16;
+        constexpr uint32_t max_repeat = 1000;
+
+        bool is_word(unsigned char c) {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        }
+
+        std::bitset<256> class_set(char name) {
+            std::bitset<256> set;
+            for (int c = 0; c < 256; ++c) {
+                switch (name) {
+                    case 'd':
+                    case 'D':
+                        set[c] = c >= '0' && c <= '9';
+                        break;
+                    case 'w':
+                    case 'W':
+                        set[c] = is_word(static_cast<unsigned char>(c));
+                        break;
+                    default:
+                        set[c] = c == ' ' || (c >= '\t' && c <= '\r');
+                        break;
+                }
+            }
+            // upper case names are the complements
+            return name >= 'A' && name <= 'Z' ? ~set : set;
+        }
+
+        // exactly the zero bytes of `x` get their high bit set
+        uint64_t zero_bytes(uint64_t x) {
+            constexpr uint64_t low7 = 0x7F7F7F7F7F7F7F7Full;
+            return ~(((x & low7) + low7) | x | low7);
+        }
+
+        struct scratch_t {
+            std::vector<uint32_t> current;
+            std::vector<uint32_t> next;
+            std::vector<uint32_t> stack;
+            std::vector<uint64_t> marks;
+            uint64_t generation = 0;
+        };
+
+    } // namespace
+
+    std::size_t find_substring(std::string_view haystack, std::string_view needle) {
+        const auto n = needle.size();
+        if (n == 0) {
+            return 0;
+        }
+        if (haystack.size() < n) {
+            return std::string_view::npos;
+        }
+        const char* data = haystack.data();
+        if (n == 1) {
+            const auto* found = static_cast<const char*>(std::memchr(data, needle.front(), haystack.size()));
+            return found ? static_cast<std::size_t>(found - data) : std::string_view::npos;
+        }
+        const uint64_t first = 0x0101010101010101ull * static_cast<unsigned char>(needle.front());
+        const uint64_t last = 0x0101010101010101ull * static_cast<unsigned char>(needle.back());
+        // a needle can start at [0, end)
+        const auto end = haystack.size() - n + 1;
+        std::size_t i = 0;
+        for (; i + 8 <= end; i += 8) {
+            uint64_t block_first;
+            uint64_t block_last;
+            std::memcpy(&block_first, data + i, 8);
+            std::memcpy(&block_last, data + i + n - 1, 8);
+            if (zero_bytes(block_first ^ first) & zero_bytes(block_last ^ last)) {
+                for (std::size_t j = i; j < i + 8; ++j) {
+                    if (std::memcmp(data + j, needle.data(), n) == 0) {
+                        return j;
+                    }
+                }
+            }
+        }
+        for (; i < end; ++i) {
+            if (data[i] == needle.front() && std::memcmp(data + i, needle.data(), n) == 0) {
+                return i;
+            }
+        }
+        return std::string_view::npos;
+    }
+
+    struct string_matcher_t::node_t {
+        enum class type_t : uint8_t
+        {
+            empty,
+            byte,
+            any,
+            set,
+            concat,
+            alternation,
+            repeat,
+            line_begin,
+            line_end,
+            word_boundary,
+            not_word_boundary
+        };
+
+        explicit node_t(type_t type)
+            : type(type) {}
+
+        bool is_assertion() const {
+            return type == type_t::line_begin || type == type_t::line_end || type == type_t::word_boundary ||
+                   type == type_t::not_word_boundary;
+        }
+
+        // `.*`
+        bool is_any_string() const {
+            return type == type_t::repeat && min == 0 && max == unbounded && children.front()->type == type_t::any;
+        }
+
+        type_t type;
+        unsigned char byte = 0;
+        uint32_t set = 0;
+        uint32_t min = 0;
+        uint32_t max = 0;
+        std::vector<std::unique_ptr<node_t>> children;
+    };
+
+    // recursive descent over the ECMAScript grammar, nullptr for a pattern it does not handle
+    class string_matcher_t::parser_t {
+    public:
+        using node_ptr = std::unique_ptr<node_t>;
+        using type_t = node_t::type_t;
+
+        parser_t(std::string_view pattern, std::vector<std::bitset<256>>& sets)
+            : pattern_(pattern)
+            , sets_(sets) {}
+
+        node_ptr parse() {
+            auto root = alternation_();
+            return pos_ == pattern_.size() ? std::move(root) : nullptr;
+        }
+
+    private:
+        bool at_end_() const { return pos_ >= pattern_.size(); }
+        char peek_() const { return pattern_[pos_]; }
+
+        static node_ptr make_(type_t type) { return std::make_unique<node_t>(type); }
+
+        node_ptr make_byte_(unsigned char byte) {
+            auto node = make_(type_t::byte);
+            node->byte = byte;
+            return node;
+        }
+
+        node_ptr make_set_(const std::bitset<256>& set) {
+            auto node = make_(type_t::set);
+            node->set = static_cast<uint32_t>(sets_.size());
+            sets_.push_back(set);
+            return node;
+        }
+
+        node_ptr alternation_() {
+            auto first = concat_();
+            if (!first || at_end_() || peek_() != '|') {
+                return first;
+            }
+            auto node = make_(type_t::alternation);
+            node->children.push_back(std::move(first));
+            while (!at_end_() && peek_() == '|') {
+                ++pos_;
+                auto branch = concat_();
+                if (!branch) {
+                    return nullptr;
+                }
+                node->children.push_back(std::move(branch));
+            }
+            return node;
+        }
+
+        node_ptr concat_() {
+            auto node = make_(type_t::concat);
+            while (!at_end_() && peek_() != '|' && peek_() != ')') {
+                auto item = quantified_();
+                if (!item) {
+                    return nullptr;
+                }
+                node->children.push_back(std::move(item));
+            }
+            if (node->children.empty()) {
+                return make_(type_t::empty);
+            }
+            if (node->children.size() == 1) {
+                return std::move(node->children.front());
+            }
+            return node;
+        }
+
+        bool number_(uint32_t& value) {
+            const auto begin = pos_;
+            value = 0;
+            while (!at_end_() && peek_() >= '0' && peek_() <= '9') {
+                value = value * 10 + static_cast<uint32_t>(peek_() - '0');
+                if (value > max_repeat) {
+                    return false;
+                }
+                ++pos_;
+            }
+            return pos_ != begin;
+        }
+
+        node_ptr quantified_() {
+            auto atom = atom_();
+            if (!atom || at_end_()) {
+                return atom;
+            }
+            uint32_t min = 0;
+            uint32_t max = 0;
+            switch (peek_()) {
+                case '*':
+                    max = unbounded;
+                    break;
+                case '+':
+                    min = 1;
+                    max = unbounded;
+                    break;
+                case '?':
+                    max = 1;
+                    break;
+                case '{':
+                    ++pos_;
+                    if (!number_(min)) {
+                        return nullptr;
+                    }
+                    max = min;
+                    if (!at_end_() && peek_() == ',') {
+                        ++pos_;
+                        max = unbounded;
+                        if (!at_end_() && peek_() != '}' && (!number_(max) || max < min)) {
+                            return nullptr;
+                        }
+                    }
+                    if (at_end_() || peek_() != '}') {
+                        return nullptr;
+                    }
+                    break;
+                default:
+                    return atom;
+            }
+            ++pos_;
+            // lazy quantifiers match the same strings
+            if (!at_end_() && peek_() == '?') {
+                ++pos_;
+            }
+            if (atom->is_assertion() || (!at_end_() && (peek_() == '*' || peek_() == '+' || peek_() == '{'))) {
+                return nullptr;
+            }
+            auto node = make_(type_t::repeat);
+            node->min = min;
+            node->max = max;
+            node->children.push_back(std::move(atom));
+            return node;
+        }
+
+        node_ptr atom_() {
+            const char c = pattern_[pos_++];
+            switch (c) {
+                case '.':
+                    return make_(type_t::any);
+                case '^':
+                    return make_(type_t::line_begin);
+                case '$':
+                    return make_(type_t::line_end);
+                case '(': {
+                    if (!at_end_() && peek_() == '?') {
+                        // only non-capturing groups, lookarounds are left to std::regex
+                        if (pos_ + 1 >= pattern_.size() || pattern_[pos_ + 1] != ':') {
+                            return nullptr;
+                        }
+                        pos_ += 2;
+                    }
+                    auto inner = alternation_();
+                    if (!inner || at_end_() || peek_() != ')') {
+                        return nullptr;
+                    }
+                    ++pos_;
+                    return inner;
+                }
+                case '[':
+                    return set_();
+                case '\\':
+                    return escape_();
+                case '*':
+                case '+':
+                case '?':
+                case '{':
+                case ')':
+                    return nullptr;
+                default:
+                    return make_byte_(static_cast<unsigned char>(c));
+            }
+        }
+
+        // escaped byte, false for escapes without a single byte meaning
+        bool escaped_byte_(char c, unsigned char& byte) {
+            switch (c) {
+                case 'n':
+                    byte = '\n';
+                    return true;
+                case 't':
+                    byte = '\t';
+                    return true;
+                case 'r':
+                    byte = '\r';
+                    return true;
+                case 'f':
+                    byte = '\f';
+                    return true;
+                case 'v':
+                    byte = '\v';
+                    return true;
+                case '0':
+                    byte = '\0';
+                    return at_end_() || peek_() < '0' || peek_() > '9';
+                case 'x': {
+                    if (pos_ + 2 > pattern_.size()) {
+                        return false;
+                    }
+                    unsigned value = 0;
+                    for (int i = 0; i < 2; ++i) {
+                        const char h = pattern_[pos_++];
+                        value <<= 4;
+                        if (h >= '0' && h <= '9') {
+                            value |= static_cast<unsigned>(h - '0');
+                        } else if (h >= 'a' && h <= 'f') {
+                            value |= static_cast<unsigned>(h - 'a' + 10);
+                        } else if (h >= 'A' && h <= 'F') {
+                            value |= static_cast<unsigned>(h - 'A' + 10);
+                        } else {
+                            return false;
+                        }
+                    }
+                    byte = static_cast<unsigned char>(value);
+                    return true;
+                }
+                default:
+                    // letters and digits are back references, unicode and control escapes
+                    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) {
+                        return false;
+                    }
+                    byte = static_cast<unsigned char>(c);
+                    return true;
+            }
+        }
+
+        static bool is_class_name(char c) {
+            return c == 'd' || c == 'D' || c == 'w' || c == 'W' || c == 's' || c == 'S';
+        }
+
+        node_ptr escape_() {
+            if (at_end_()) {
+                return nullptr;
+            }
+            const char c = pattern_[pos_++];
+            if (is_class_name(c)) {
+                return make_set_(class_set(c));
+            }
+            if (c == 'b') {
+                return make_(type_t::word_boundary);
+            }
+            if (c == 'B') {
+                return make_(type_t::not_word_boundary);
+            }
+            unsigned char byte;
+            if (!escaped_byte_(c, byte)) {
+                return nullptr;
+            }
+            return make_byte_(byte);
+        }
+
+        // a byte or a class escape of a set, false for what is left to std::regex
+        bool set_item_(std::bitset<256>& set, int& byte) {
+            const char c = pattern_[pos_++];
+            byte = -1;
+            if (c == '[' && !at_end_() && (peek_() == ':' || peek_() == '.' || peek_() == '=')) {
+                return false;
+            }
+            if (c != '\\') {
+                byte = static_cast<unsigned char>(c);
+                return true;
+            }
+            if (at_end_()) {
+                return false;
+            }
+            const char e = pattern_[pos_++];
+            if (is_class_name(e)) {
+                set |= class_set(e);
+                return true;
+            }
+            unsigned char escaped;
+            if (e == 'b') {
+                escaped = '\b';
+            } else if (e == '-') {
+                escaped = '-';
+            } else if (!escaped_byte_(e, escaped)) {
+                return false;
+            }
+            byte = escaped;
+            return true;
+        }
+
+        node_ptr set_() {
+            std::bitset<256> set;
+            bool negated = false;
+            if (!at_end_() && peek_() == '^') {
+                negated = true;
+                ++pos_;
+            }
+            if (at_end_() || peek_() == ']') {
+                return nullptr;
+            }
+            while (!at_end_() && peek_() != ']') {
+                int low;
+                if (!set_item_(set, low)) {
+                    return nullptr;
+                }
+                if (low >= 0 && pos_ + 1 < pattern_.size() && peek_() == '-' && pattern_[pos_ + 1] != ']') {
+                    ++pos_;
+                    int high;
+                    if (!set_item_(set, high) || high < low) {
+                        return nullptr;
+                    }
+                    for (int b = low; b <= high; ++b) {
+                        set[static_cast<std::size_t>(b)] = true;
+                    }
+                } else if (low >= 0) {
+                    set[static_cast<std::size_t>(low)] = true;
+                }
+            }
+            if (at_end_()) {
+                return nullptr;
+            }
+            ++pos_;
+            return make_set_(negated ? ~set : set);
+        }
+
+        std::string_view pattern_;
+        std::size_t pos_ = 0;
+        std::vector<std::bitset<256>>& sets_;
+    };
+
+    string_matcher_t::string_matcher_t(std::string_view pattern)
+        : pattern_(pattern)
+        , kind_(kind_t::fallback) {
+        auto root = parser_t(pattern_, sets_).parse();
+        if (root) {
+            if (take_literal_(*root)) {
+                sets_.clear();
+                return;
+            }
+            compile_(*root);
+            emit_(op_t::match);
+            if (program_.size() <= max_program_size) {
+                kind_ = kind_t::nfa;
+                anchored_ = root->type == node_t::type_t::line_begin ||
+                            (root->type == node_t::type_t::concat &&
+                             root->children.front()->type == node_t::type_t::line_begin);
+                return;
+            }
+        }
+        program_.clear();
+        sets_.clear();
+        fallback_ = std::make_unique<std::regex>(pattern_, std::regex::ECMAScript);
+    }
+
+    bool string_matcher_t::take_literal_(const node_t& root) {
+        using type_t = node_t::type_t;
+        std::vector<const node_t*> items;
+        if (root.type == type_t::concat) {
+            for (const auto& child : root.children) {
+                items.push_back(child.get());
+            }
+        } else if (root.type != type_t::empty) {
+            items.push_back(&root);
+        }
+        std::size_t begin = 0;
+        std::size_t end = items.size();
+        bool anchored_begin = false;
+        bool anchored_end = false;
+        // `.*` next to an unanchored end matches nothing more than the empty string does
+        if (begin < end && items[begin]->type == type_t::line_begin) {
+            anchored_begin = true;
+            ++begin;
+        } else if (begin < end && items[begin]->is_any_string()) {
+            ++begin;
+        }
+        if (begin < end && items[end - 1]->type == type_t::line_end) {
+            anchored_end = true;
+            --end;
+        } else if (begin < end && items[end - 1]->is_any_string()) {
+            --end;
+        }
+        std::string literal;
+        for (auto i = begin; i < end; ++i) {
+            if (items[i]->type != type_t::byte) {
+                return false;
+            }
+            literal.push_back(static_cast<char>(items[i]->byte));
+        }
+        literal_ = std::move(literal);
+        if (anchored_begin && anchored_end) {
+            kind_ = kind_t::exact;
+        } else if (literal_.empty()) {
+            kind_ = kind_t::everything;
+        } else if (anchored_begin) {
+            kind_ = kind_t::prefix;
+        } else if (anchored_end) {
+            kind_ = kind_t::suffix;
+        } else {
+            kind_ = kind_t::contains;
+        }
+        return true;
+    }
+
+    uint32_t string_matcher_t::emit_(op_t op, unsigned char byte, uint32_t x, uint32_t y) {
+        program_.push_back(instruction_t{op, byte, x, y});
+        return static_cast<uint32_t>(program_.size() - 1);
+    }
+
+    void string_matcher_t::compile_(const node_t& node) {
+        using type_t = node_t::type_t;
+        if (program_.size() > max_program_size) {
+            return;
+        }
+        switch (node.type) {
+            case type_t::empty:
+                break;
+            case type_t::byte:
+                emit_(op_t::byte, node.byte);
+                break;
+            case type_t::any:
+                emit_(op_t::any);
+                break;
+            case type_t::set:
+                emit_(op_t::set, 0, node.set);
+                break;
+            case type_t::line_begin:
+                emit_(op_t::line_begin);
+                break;
+            case type_t::line_end:
+                emit_(op_t::line_end);
+                break;
+            case type_t::word_boundary:
+                emit_(op_t::word_boundary);
+                break;
+            case type_t::not_word_boundary:
+                emit_(op_t::not_word_boundary);
+                break;
+            case type_t::concat:
+                for (const auto& child : node.children) {
+                    compile_(*child);
+                }
+                break;
+            case type_t::alternation: {
+                std::vector<uint32_t> jumps;
+                for (std::size_t i = 0; i < node.children.size(); ++i) {
+                    if (i + 1 == node.children.size()) {
+                        compile_(*node.children[i]);
+                        break;
+                    }
+                    const auto split = emit_(op_t::split);
+                    program_[split].x = split + 1;
+                    compile_(*node.children[i]);
+                    jumps.push_back(emit_(op_t::jump));
+                    program_[split].y = static_cast<uint32_t>(program_.size());
+                }
+                for (auto jump : jumps) {
+                    program_[jump].x = static_cast<uint32_t>(program_.size());
+                }
+                break;
+            }
+            case type_t::repeat: {
+                const auto& child = *node.children.front();
+                for (uint32_t i = 0; i < node.min; ++i) {
+                    compile_(child);
+                }
+                if (node.max == unbounded) {
+                    const auto split = emit_(op_t::split);
+                    program_[split].x = split + 1;
+                    compile_(child);
+                    emit_(op_t::jump, 0, split);
+                    program_[split].y = static_cast<uint32_t>(program_.size());
+                } else {
+                    std::vector<uint32_t> splits;
+                    for (uint32_t i = node.min; i < node.max; ++i) {
+                        const auto split = emit_(op_t::split);
+                        program_[split].x = split + 1;
+                        splits.push_back(split);
+                        compile_(child);
+                    }
+                    for (auto split : splits) {
+                        program_[split].y = static_cast<uint32_t>(program_.size());
+                    }
+                }
+                break;
+            }
+        }
+    }
+
+    // Pike VM: all threads step over the string together, a state is kept once per position
+    bool string_matcher_t::run_(std::string_view str) const {
+        thread_local scratch_t scratch;
+        if (scratch.marks.size() < program_.size()) {
+            scratch.marks.resize(program_.size(), 0);
+        }
+        const auto size = str.size();
+        auto at = [&str](std::size_t pos) { return static_cast<unsigned char>(str[pos]); };
+        auto word_at = [&](std::size_t pos) { return pos < size && is_word(at(pos)); };
+
+        auto add = [&](std::vector<uint32_t>& list, uint32_t start, std::size_t pos) {
+            auto& stack = scratch.stack;
+            stack.push_back(start);
+            while (!stack.empty()) {
+                const auto pc = stack.back();
+                stack.pop_back();
+                if (scratch.marks[pc] == scratch.generation) {
+                    continue;
+                }
+                scratch.marks[pc] = scratch.generation;
+                const auto& instruction = program_[pc];
+                switch (instruction.op) {
+                    case op_t::jump:
+                        stack.push_back(instruction.x);
+                        break;
+                    case op_t::split:
+                        stack.push_back(instruction.y);
+                        stack.push_back(instruction.x);
+                        break;
+                    case op_t::line_begin:
+                        if (pos == 0) {
+                            stack.push_back(pc + 1);
+                        }
+                        break;
+                    case op_t::line_end:
+                        if (pos == size) {
+                            stack.push_back(pc + 1);
+                        }
+                        break;
+                    case op_t::word_boundary:
+                    case op_t::not_word_boundary: {
+                        const bool boundary = (pos > 0 && word_at(pos - 1)) != word_at(pos);
+                        if (boundary == (instruction.op == op_t::word_boundary)) {
+                            stack.push_back(pc + 1);
+                        }
+                        break;
+                    }
+                    default:
+                        list.push_back(pc);
+                        break;
+                }
+            }
+        };
+
+        auto& current = scratch.current;
+        auto& next = scratch.next;
+        current.clear();
+        ++scratch.generation;
+        add(current, 0, 0);
+        for (std::size_t pos = 0;; ++pos) {
+            next.clear();
+            ++scratch.generation;
+            for (auto pc : current) {
+                const auto& instruction = program_[pc];
+                bool step = false;
+                switch (instruction.op) {
+                    case op_t::match:
+                        return true;
+                    case op_t::byte:
+                        step = pos < size && at(pos) == instruction.byte;
+                        break;
+                    case op_t::any:
+                        step = pos < size && at(pos) != '\n' && at(pos) != '\r';
+                        break;
+                    case op_t::set:
+                        step = pos < size && sets_[instruction.x][at(pos)];
+                        break;
+                    default:
+                        break;
+                }
+                if (step) {
+                    add(next, pc + 1, pos + 1);
+                }
+            }
+            if (pos == size) {
+                return false;
+            }
+            if (!anchored_) {
+                add(next, 0, pos + 1);
+            } else if (next.empty()) {
+                return false;
+            }
+            std::swap(current, next);
+        }
+    }
+
+    bool string_matcher_t::match(std::string_view str) const {
+        switch (kind_) {
+            case kind_t::everything:
+                return true;
+            case kind_t::contains:
+                return find_substring(str, literal_) != std::string_view::npos;
+            case kind_t::prefix:
+                return str.size() >= literal_.size() && str.compare(0, literal_.size(), literal_) == 0;
+            case kind_t::suffix:
+                return str.size() >= literal_.size() &&
+                       str.compare(str.size() - literal_.size(), literal_.size(), literal_) == 0;
+            case kind_t::exact:
+                return str == literal_;
+            case kind_t::nfa:
+                return run_(str);
+            default:
+                return std::regex_search(str.begin(), str.end(), *fallback_);
+        }
+    }
+
+    const string_matcher_t& string_matcher_cache_t::get(std::string_view pattern) {
+        if (!matcher_ || matcher_->pattern() != pattern) {
+            matcher_ = std::make_unique<string_matcher_t>(pattern);
+        }
+        return *matcher_;
+    }
+
+} // namespace core
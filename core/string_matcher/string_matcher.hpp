@@ -0,0 +1,88 @@
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace core {
+
+    // position of `needle` in `haystack` or std::string_view::npos
+    // candidates are found 8 bytes at a time by the first and the last byte of the needle
+    std::size_t find_substring(std::string_view haystack, std::string_view needle);
+
+    // regex compiled once and searched anywhere in a string, like std::regex_search with the ECMAScript grammar
+    // literals with optional ^ and $ anchors are found by a substring search, other patterns run on an NFA
+    // in time linear in the length of the string; back references and lookarounds fall back to std::regex
+    class string_matcher_t final {
+    public:
+        explicit string_matcher_t(std::string_view pattern);
+
+        bool match(std::string_view str) const;
+
+        const std::string& pattern() const noexcept { return pattern_; }
+
+    private:
+        enum class kind_t : uint8_t
+        {
+            everything,
+            contains,
+            prefix,
+            suffix,
+            exact,
+            nfa,
+            fallback
+        };
+
+        enum class op_t : uint8_t
+        {
+            byte,
+            any,
+            set,
+            split,
+            jump,
+            line_begin,
+            line_end,
+            word_boundary,
+            not_word_boundary,
+            match
+        };
+
+        struct instruction_t {
+            op_t op;
+            unsigned char byte = 0;
+            uint32_t x = 0;
+            uint32_t y = 0;
+        };
+
+        struct node_t;
+        class parser_t;
+
+        bool take_literal_(const node_t& root);
+        void compile_(const node_t& node);
+        uint32_t emit_(op_t op, unsigned char byte = 0, uint32_t x = 0, uint32_t y = 0);
+        bool run_(std::string_view str) const;
+
+        std::string pattern_;
+        kind_t kind_;
+        std::string literal_;
+        std::vector<instruction_t> program_;
+        std::vector<std::bitset<256>> sets_;
+        // threads are started at position 0 only
+        bool anchored_ = false;
+        std::unique_ptr<std::regex> fallback_;
+    };
+
+    // the last compiled matcher, compiled again only when the pattern changes
+    class string_matcher_cache_t final {
+    public:
+        const string_matcher_t& get(std::string_view pattern);
+
+    private:
+        std::unique_ptr<string_matcher_t> matcher_;
+    };
+
+} // namespace core
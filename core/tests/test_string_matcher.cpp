@@ -0,0 +1,117 @@
+#include <catch2/catch.hpp>
+
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "core/string_matcher/string_matcher.hpp"
+
+TEST_CASE("string_matcher::find_substring") {
+    const std::string haystack = "the quick brown fox jumps over the lazy dog, the end";
+    for (std::size_t begin = 0; begin < haystack.size(); ++begin) {
+        for (std::size_t size = 1; begin + size <= haystack.size() && size < 12; ++size) {
+            const auto needle = haystack.substr(begin, size);
+            REQUIRE(core::find_substring(haystack, needle) == haystack.find(needle));
+        }
+    }
+    REQUIRE(core::find_substring(haystack, "") == 0);
+    REQUIRE(core::find_substring(haystack, "cat") == std::string_view::npos);
+    REQUIRE(core::find_substring("ab", "abc") == std::string_view::npos);
+    // the first and the last byte match in every block, the middle does not
+    REQUIRE(core::find_substring(std::string(64, 'a') + "aba", "aba") == 64);
+    REQUIRE(core::find_substring(std::string(64, 'a'), "aba") == std::string_view::npos);
+}
+
+TEST_CASE("string_matcher::match") {
+    const std::vector<std::string> patterns = {"",
+                                               "9",
+                                               "9$",
+                                               "^9",
+                                               "^9$",
+                                               "^$",
+                                               "abc",
+                                               ".*abc.*",
+                                               "^abc.*",
+                                               "^.*abc",
+                                               "a.c",
+                                               "^[5]{1,2}",
+                                               "[^5][5]{1}",
+                                               "N*",
+                                               "a|bc|",
+                                               "(ab)+c",
+                                               "(?:ab|cd){2,3}$",
+                                               "\\d+\\.\\d*",
+                                               "\\bfox\\b",
+                                               "\\Bo\\B",
+                                               "[a-c\\d-]x",
+                                               "x?y*?z+",
+                                               "colou?r",
+                                               "\\x41\\t",
+                                               "(a*)*b",
+                                               "a{0}b",
+                                               "a{3,}",
+                                               "(\\w+)\\s\\1",
+                                               "(?=a)ab"};
+    const std::vector<std::string> values = {"",
+                                             "9",
+                                             "19",
+                                             "91",
+                                             "5",
+                                             "55",
+                                             "555",
+                                             "155",
+                                             "abc",
+                                             "xxabcxx",
+                                             "a\nc",
+                                             "ab\nabc",
+                                             "ac",
+                                             "bc",
+                                             "ababc",
+                                             "abcdab",
+                                             "cdabcd",
+                                             "12.5",
+                                             "12.",
+                                             "the fox jumps",
+                                             "firefox",
+                                             "foo bar",
+                                             "b-x",
+                                             "3x",
+                                             "zz",
+                                             "xyyz",
+                                             "color",
+                                             "colour",
+                                             "A\t",
+                                             "aaab",
+                                             "aaa",
+                                             "word word",
+                                             "Name 9"};
+    for (const auto& pattern : patterns) {
+        core::string_matcher_t matcher(pattern);
+        const std::regex expected(pattern, std::regex::ECMAScript);
+        for (const auto& value : values) {
+            INFO(pattern << " ~ " << value);
+            REQUIRE(matcher.match(value) == std::regex_search(value, expected));
+        }
+    }
+}
+
+TEST_CASE("string_matcher::linear_time") {
+    // exponential for a backtracking engine
+    core::string_matcher_t matcher("^(a|a)*(a|a)*(a|a)*b$");
+    REQUIRE_FALSE(matcher.match(std::string(5000, 'a')));
+    REQUIRE(matcher.match(std::string(5000, 'a') + "b"));
+}
+
+TEST_CASE("string_matcher::invalid_pattern") {
+    REQUIRE_THROWS_AS(core::string_matcher_t("(ab"), std::regex_error);
+    REQUIRE_THROWS_AS(core::string_matcher_t("[ab"), std::regex_error);
+}
+
+TEST_CASE("string_matcher::cache") {
+    core::string_matcher_cache_t cache;
+    const auto* first = &cache.get("abc");
+    REQUIRE(&cache.get("abc") == first);
+    REQUIRE(cache.get("abc").match("xabcx"));
+    REQUIRE(cache.get("^x").match("xabc"));
+    REQUIRE_FALSE(cache.get("^x").match("abc"));
+}
@@ -0,0 +1,66 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <set>
+#include <stdexcept>
+
+#include "core/thread_pool/thread_pool.hpp"
+
+TEST_CASE("thread_pool::parallel_for") {
+    INFO("every task runs once") {
+        core::thread_pool_t pool(4);
+        REQUIRE(pool.concurrency() == 4);
+        constexpr uint64_t count = 1000;
+        std::vector<std::atomic<uint64_t>> calls(count);
+        pool.parallel_for(count, [&](uint64_t i) { calls[i]++; });
+        for (const auto& call : calls) {
+            REQUIRE(call == 1);
+        }
+    }
+
+    INFO("tasks run on several threads") {
+        core::thread_pool_t pool(4);
+        std::mutex lock;
+        std::set<std::thread::id> threads;
+        std::atomic<uint64_t> waiting{0};
+        pool.parallel_for(4, [&](uint64_t) {
+            {
+                std::lock_guard guard(lock);
+                threads.insert(std::this_thread::get_id());
+            }
+            // every task holds its thread until all of them have started
+            waiting++;
+            while (waiting < 4) {
+                std::this_thread::yield();
+            }
+        });
+        REQUIRE(threads.size() == 4);
+        REQUIRE(threads.count(std::this_thread::get_id()) == 1);
+    }
+
+    INFO("without workers") {
+        core::thread_pool_t pool(1);
+        REQUIRE(pool.concurrency() == 1);
+        const auto caller = std::this_thread::get_id();
+        uint64_t sum = 0;
+        pool.parallel_for(10, [&](uint64_t i) {
+            REQUIRE(std::this_thread::get_id() == caller);
+            sum += i;
+        });
+        REQUIRE(sum == 45);
+    }
+
+    INFO("exception is rethrown") {
+        core::thread_pool_t pool(3);
+        REQUIRE_THROWS_AS(pool.parallel_for(100,
+                                            [](uint64_t i) {
+                                                if (i == 42) {
+                                                    throw std::runtime_error("task failed");
+                                                }
+                                            }),
+                          std::runtime_error);
+        std::atomic<uint64_t> calls{0};
+        pool.parallel_for(100, [&](uint64_t) { calls++; });
+        REQUIRE(calls == 100);
+    }
+}
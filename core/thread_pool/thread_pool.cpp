@@ -0,0 +1,96 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace core {
+
+    thread_pool_t::thread_pool_t(uint64_t threads) {
+        for (uint64_t i = 1; i < threads; i++) {
+            workers_.emplace_back([this] { work_(); });
+        }
+    }
+
+    thread_pool_t::~thread_pool_t() {
+        {
+            std::lock_guard guard(lock_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    void thread_pool_t::parallel_for(uint64_t count, const std::function<void(uint64_t)>& task) {
+        if (workers_.empty() || count <= 1) {
+            for (uint64_t i = 0; i < count; i++) {
+                task(i);
+            }
+            return;
+        }
+
+        struct job_state_t {
+            std::atomic<uint64_t> next{0};
+            std::mutex lock;
+            std::condition_variable finished;
+            uint64_t running = 0;
+            std::exception_ptr error;
+        } state;
+
+        auto run = [&state, &task, count] {
+            for (auto i = state.next++; i < count; i = state.next++) {
+                try {
+                    task(i);
+                } catch (...) {
+                    std::lock_guard guard(state.lock);
+                    if (!state.error) {
+                        state.error = std::current_exception();
+                    }
+                    state.next = count;
+                }
+            }
+        };
+
+        const auto helpers = std::min<uint64_t>(workers_.size(), count - 1);
+        state.running = helpers;
+        {
+            std::lock_guard guard(lock_);
+            for (uint64_t i = 0; i < helpers; i++) {
+                jobs_.emplace([&state, &run] {
+                    run();
+                    // notified under the lock: the caller owns `state` and may return as soon as it is released
+                    std::lock_guard guard(state.lock);
+                    --state.running;
+                    state.finished.notify_one();
+                });
+            }
+        }
+        wake_.notify_all();
+
+        run();
+        std::unique_lock guard(state.lock);
+        state.finished.wait(guard, [&state] { return state.running == 0; });
+        if (state.error) {
+            std::rethrow_exception(state.error);
+        }
+    }
+
+    void thread_pool_t::work_() {
+        while (true) {
+            std::function<void()> job;
+            {
+                std::unique_lock guard(lock_);
+                wake_.wait(guard, [this] { return stop_ || !jobs_.empty(); });
+                if (jobs_.empty()) {
+                    return;
+                }
+                job = std::move(jobs_.front());
+                jobs_.pop();
+            }
+            job();
+        }
+    }
+
+} // namespace core
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace core {
+
+    // fixed set of worker threads for intra-query parallelism
+    // a job is split into tasks, the calling thread runs tasks as well and returns when all of them are finished
+    class thread_pool_t final {
+    public:
+        // `threads` includes the calling thread, 0 and 1 run every task on the calling thread
+        explicit thread_pool_t(uint64_t threads);
+        thread_pool_t(const thread_pool_t&) = delete;
+        thread_pool_t& operator=(const thread_pool_t&) = delete;
+        ~thread_pool_t();
+
+        uint64_t concurrency() const noexcept { return workers_.size() + 1; }
+
+        // calls task(i) for every i in [0, count), the first exception thrown by a task is rethrown
+        void parallel_for(uint64_t count, const std::function<void(uint64_t)>& task);
+
+    private:
+        void work_();
+
+        std::vector<std::thread> workers_;
+        std::mutex lock_;
+        std::condition_variable wake_;
+        std::queue<std::function<void()>> jobs_;
+        bool stop_ = false;
+    };
+
+} // namespace core
@@ -1,5 +1,6 @@
 #include "otterbrix.h"
 
+#include <components/cursor/arrow_stream.hpp>
 #include <integration/cpp/base_spaces.hpp>
 
 using document_ptr = components::document::document_ptr;
@@ -53,6 +54,10 @@ namespace {
         assert(doc_storage->state == state_t::created);
         return doc_storage;
     }
+
+    hugeint_t to_hugeint(absl::int128 value) {
+        return hugeint_t{absl::Int128Low64(value), absl::Int128High64(value)};
+    }
 } // namespace
 
 extern "C" otterbrix_ptr otterbrix_create(config_t cfg) {
@@ -91,6 +96,21 @@ extern "C" cursor_ptr execute_sql(otterbrix_ptr ptr, string_view_t query_raw) {
     return reinterpret_cast<void*>(cursor_storage.release());
 }
 
+extern "C" void
+execute_sql_async(otterbrix_ptr ptr, string_view_t query_raw, execute_callback_t callback, void* user_data) {
+    auto pod_space = convert_otterbrix(ptr);
+    assert(query_raw.data != nullptr);
+    assert(callback != nullptr);
+    auto session = otterbrix::session_id_t();
+    std::string query(query_raw.data, query_raw.size);
+    pod_space->space->dispatcher()->execute_sql_async(session, query, [callback, user_data](auto cursor) {
+        auto cursor_storage = std::make_unique<cursor_storage_t>();
+        cursor_storage->cursor = std::move(cursor);
+        cursor_storage->state = state_t::created;
+        callback(reinterpret_cast<void*>(cursor_storage.release()), user_data);
+    });
+}
+
 extern "C" cursor_ptr create_database(otterbrix_ptr ptr, string_view_t database_name) {
     auto pod_space = convert_otterbrix(ptr);
     assert(database_name.data != nullptr);
@@ -116,6 +136,23 @@ extern "C" cursor_ptr create_collection(otterbrix_ptr ptr, string_view_t databas
     return reinterpret_cast<void*>(cursor_storage.release());
 }
 
+extern "C" cursor_ptr append_arrow_stream(otterbrix_ptr ptr,
+                                          string_view_t database_name,
+                                          string_view_t collection_name,
+                                          ArrowArrayStream* stream) {
+    auto pod_space = convert_otterbrix(ptr);
+    assert(database_name.data != nullptr);
+    assert(stream != nullptr);
+    auto session = otterbrix::session_id_t();
+    std::string database(database_name.data, database_name.size);
+    std::string collection(collection_name.data, collection_name.size);
+    auto cursor = pod_space->space->dispatcher()->append_arrow(session, database, collection, stream);
+    auto cursor_storage = std::make_unique<cursor_storage_t>();
+    cursor_storage->cursor = cursor;
+    cursor_storage->state = state_t::created;
+    return reinterpret_cast<void*>(cursor_storage.release());
+}
+
 extern "C" void release_cursor(cursor_ptr ptr) {
     auto storage = convert_cursor(ptr);
     storage->state = state_t::destroyed;
@@ -124,16 +161,24 @@ extern "C" void release_cursor(cursor_ptr ptr) {
 
 extern "C" int32_t cursor_size(cursor_ptr ptr) {
     auto storage = convert_cursor(ptr);
+    // a streamed table result holds only its first batch, the size of the whole result needs all of them
+    storage->cursor->fetch_all();
     return static_cast<int32_t>(storage->cursor->size());
 }
 
 extern "C" bool cursor_has_next(cursor_ptr ptr) {
     auto storage = convert_cursor(ptr);
-    return storage->cursor->has_next();
+    auto& cursor = storage->cursor;
+    // the next batch of a streamed result is pulled once the current one is read
+    return cursor->has_next() || cursor->seek_batch(cursor->batch_offset() + cursor->size());
 }
 
 extern "C" doc_ptr cursor_next(cursor_ptr ptr) {
     auto storage = convert_cursor(ptr);
+    auto& cursor = storage->cursor;
+    if (!cursor->has_next()) {
+        cursor->seek_batch(cursor->batch_offset() + cursor->size());
+    }
     auto doc_storage = std::make_unique<document_storage_t>();
     doc_storage->state = state_t::created;
     doc_storage->document = storage->cursor->next_document();
@@ -150,9 +195,13 @@ extern "C" doc_ptr cursor_get(cursor_ptr ptr) {
 
 extern "C" doc_ptr cursor_get_by_index(cursor_ptr ptr, int index) {
     auto storage = convert_cursor(ptr);
+    auto& cursor = storage->cursor;
     auto doc_storage = std::make_unique<document_storage_t>();
     doc_storage->state = state_t::created;
-    doc_storage->document = storage->cursor->get_document(static_cast<size_t>(index));
+    // index of the whole result, batches before the one holding it are released
+    if (cursor->seek_batch(static_cast<size_t>(index))) {
+        doc_storage->document = cursor->get_document(static_cast<size_t>(index) - cursor->batch_offset());
+    }
     return reinterpret_cast<void*>(doc_storage.release());
 }
 
@@ -177,6 +226,15 @@ extern "C" error_message cursor_get_error(cursor_ptr ptr) {
     return msg;
 }
 
+extern "C" bool cursor_to_arrow_stream(cursor_ptr ptr, ArrowArrayStream* out) {
+    auto storage = convert_cursor(ptr);
+    if (!storage->cursor->uses_table_data()) {
+        return false;
+    }
+    components::cursor::to_arrow_stream(storage->cursor, out);
+    return true;
+}
+
 extern "C" void release_document(doc_ptr ptr) {
     auto doc_storage = convert_document(ptr);
     doc_storage->state = state_t::destroyed;
@@ -266,6 +324,17 @@ extern "C" bool document_is_long_by_index(doc_ptr ptr, int32_t index) {
     return doc_storage->document->is_long(std::to_string(static_cast<uint32_t>(index)));
 }
 
+extern "C" bool document_is_hugeint_by_key(doc_ptr ptr, string_view_t key_raw) {
+    auto doc_storage = convert_document(ptr);
+    std::pmr::string key(key_raw.data, key_raw.size);
+    return doc_storage->document->is_hugeint(key);
+}
+
+extern "C" bool document_is_hugeint_by_index(doc_ptr ptr, int32_t index) {
+    auto doc_storage = convert_document(ptr);
+    return doc_storage->document->is_hugeint(std::to_string(static_cast<uint32_t>(index)));
+}
+
 extern "C" bool document_is_double_by_key(doc_ptr ptr, string_view_t key_raw) {
     auto doc_storage = convert_document(ptr);
     std::pmr::string key(key_raw.data, key_raw.size);
@@ -343,6 +412,17 @@ extern "C" int64_t document_get_long_by_index(doc_ptr ptr, int32_t index) {
     return doc_storage->document->get_as<int64_t>(std::to_string(static_cast<uint32_t>(index)));
 }
 
+extern "C" hugeint_t document_get_hugeint_by_key(doc_ptr ptr, string_view_t key_raw) {
+    auto doc_storage = convert_document(ptr);
+    std::pmr::string key(key_raw.data, key_raw.size);
+    return to_hugeint(doc_storage->document->get_hugeint(key));
+}
+
+extern "C" hugeint_t document_get_hugeint_by_index(doc_ptr ptr, int32_t index) {
+    auto doc_storage = convert_document(ptr);
+    return to_hugeint(doc_storage->document->get_hugeint(std::to_string(static_cast<uint32_t>(index))));
+}
+
 extern "C" double document_get_double_by_key(doc_ptr ptr, string_view_t key_raw) {
     auto doc_storage = convert_document(ptr);
     std::pmr::string key(key_raw.data, key_raw.size);
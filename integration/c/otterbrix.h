@@ -2,6 +2,7 @@
 #define otterbrix_otterbrix_H
 
 #include <components/cursor/cursor.hpp>
+#include <components/vector/arrow/arrow.hpp>
 #include <cstdint>
 #include <cstdlib>
 
@@ -32,6 +33,12 @@ typedef enum state_t
     destroyed
 } state_t;
 
+// 128 bit integer of sums over BIGINT columns, the value is upper * 2^64 + lower
+typedef struct hugeint_t {
+    uint64_t lower;
+    int64_t upper;
+} hugeint_t;
+
 typedef void* otterbrix_ptr;
 typedef void* cursor_ptr;
 typedef void* doc_ptr;
@@ -47,10 +54,24 @@ void otterbrix_destroy(otterbrix_ptr);
 
 cursor_ptr execute_sql(otterbrix_ptr ptr, string_view_t query);
 
+// called with the result of execute_sql_async, the callee owns the cursor and releases it
+typedef void (*execute_callback_t)(cursor_ptr cursor, void* user_data);
+
+// returns without waiting for the result, the callback is called from a database thread
+// and must not call the other functions of the otterbrix instance
+void execute_sql_async(otterbrix_ptr ptr, string_view_t query, execute_callback_t callback, void* user_data);
+
 cursor_ptr create_database(otterbrix_ptr ptr, string_view_t database_name);
 
 cursor_ptr create_collection(otterbrix_ptr ptr, string_view_t database_name, string_view_t collection_name);
 
+// appends the record batches of the stream to the table and releases the stream
+// cursor_size of the result is the number of appended rows
+cursor_ptr append_arrow_stream(otterbrix_ptr ptr,
+                               string_view_t database_name,
+                               string_view_t collection_name,
+                               struct ArrowArrayStream* stream);
+
 void release_cursor(cursor_ptr ptr);
 
 int32_t cursor_size(cursor_ptr ptr);
@@ -69,6 +90,10 @@ bool cursor_is_error(cursor_ptr ptr);
 
 error_message cursor_get_error(cursor_ptr ptr);
 
+// exports table rows of the cursor as an arrow stream, fixed width columns are not copied
+// the stream keeps the cursor alive until it is released, false if the cursor holds no table data
+bool cursor_to_arrow_stream(cursor_ptr ptr, struct ArrowArrayStream* out);
+
 void release_document(doc_ptr ptr);
 
 char* document_id(doc_ptr ptr);
@@ -101,6 +126,10 @@ bool document_is_long_by_key(doc_ptr ptr, string_view_t key_raw);
 
 bool document_is_long_by_index(doc_ptr ptr, int32_t index);
 
+bool document_is_hugeint_by_key(doc_ptr ptr, string_view_t key_raw);
+
+bool document_is_hugeint_by_index(doc_ptr ptr, int32_t index);
+
 bool document_is_double_by_key(doc_ptr ptr, string_view_t key_raw);
 
 bool document_is_double_by_index(doc_ptr ptr, int32_t index);
@@ -129,6 +158,10 @@ int64_t document_get_long_by_key(doc_ptr ptr, string_view_t key_raw);
 
 int64_t document_get_long_by_index(doc_ptr ptr, int32_t index);
 
+hugeint_t document_get_hugeint_by_key(doc_ptr ptr, string_view_t key_raw);
+
+hugeint_t document_get_hugeint_by_index(doc_ptr ptr, int32_t index);
+
 double document_get_double_by_key(doc_ptr ptr, string_view_t key_raw);
 
 double document_get_double_by_index(doc_ptr ptr, int32_t index);
@@ -1,6 +1,7 @@
 #include "base_spaces.hpp"
 #include "route.hpp"
 #include <actor-zeta.hpp>
+#include <algorithm>
 #include <core/system_command.hpp>
 #include <memory>
 #include <services/disk/manager_disk.hpp>
@@ -12,11 +13,19 @@ namespace otterbrix {
 
     using services::dispatcher::manager_dispatcher_t;
 
+    namespace {
+
+        actor_zeta::shared_work* make_scheduler(std::uint64_t workers, std::uint64_t max_throughput) {
+            return new actor_zeta::shared_work(std::max<std::uint64_t>(1, workers), max_throughput);
+        }
+
+    } // namespace
+
     base_otterbrix_t::base_otterbrix_t(const configuration::config& config)
         : main_path_(config.main_path)
         , resource(std::pmr::synchronized_pool_resource())
-        , scheduler_(new actor_zeta::shared_work(1, 1000))
-        , scheduler_dispatcher_(new actor_zeta::shared_work(1, 1000))
+        , scheduler_(make_scheduler(config.scheduler.workers, config.scheduler.max_throughput))
+        , scheduler_dispatcher_(make_scheduler(config.scheduler.dispatcher_workers, config.scheduler.max_throughput))
         , manager_dispatcher_(nullptr, actor_zeta::pmr::deleter_t(&resource))
         , manager_disk_()
         , manager_wal_()
@@ -74,7 +83,10 @@ namespace otterbrix {
         trace(log_, "spaces::manager_disk finish");
 
         trace(log_, "spaces::memory_storage start");
-        memory_storage_ = actor_zeta::spawn_supervisor<services::memory_storage_t>(&resource, scheduler_.get(), log_);
+        memory_storage_ = actor_zeta::spawn_supervisor<services::memory_storage_t>(&resource,
+                                                                                   scheduler_.get(),
+                                                                                   log_,
+                                                                                   config.executor);
         trace(log_, "spaces::memory_storage finish");
 
         trace(log_, "spaces::manager_dispatcher start");
@@ -84,10 +96,6 @@ namespace otterbrix {
                                                                                      log_);
         trace(log_, "spaces::manager_dispatcher finish");
 
-        wrapper_dispatcher_ =
-            actor_zeta::spawn_supervisor<wrapper_dispatcher_t>(&resource, manager_dispatcher_->address(), log_);
-        trace(log_, "spaces::manager_dispatcher create dispatcher");
-
         actor_zeta::send(manager_dispatcher_->address(),
                          actor_zeta::address_t::empty_address(),
                          core::handler_id(core::route::sync),
@@ -103,7 +111,7 @@ namespace otterbrix {
         actor_zeta::send(manager_disk_address,
                          actor_zeta::address_t::empty_address(),
                          core::handler_id(core::route::sync),
-                         std::make_tuple(manager_dispatcher_->address()));
+                         std::make_tuple(actor_zeta::address_t(manager_wal_address), memory_storage_->address()));
 
         // TODO maybe an error
         actor_zeta::send(memory_storage_,
@@ -120,6 +128,12 @@ namespace otterbrix {
                          disk::handler_id(disk::route::create_agent));
 
         manager_dispatcher_->create_dispatcher();
+        // the dispatcher is created in place, its catalog outlives the wrapper
+        wrapper_dispatcher_ = actor_zeta::spawn_supervisor<wrapper_dispatcher_t>(&resource,
+                                                                                 manager_dispatcher_->address(),
+                                                                                 manager_dispatcher_->current_catalog(),
+                                                                                 log_);
+        trace(log_, "spaces::manager_dispatcher create dispatcher");
         scheduler_dispatcher_->start();
         scheduler_->start();
         trace(log_, "spaces::spaces() final");
@@ -0,0 +1,115 @@
+#include "../classes.hpp"
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <thread>
+
+constexpr int max_clients = 16;
+constexpr int client_collection_size = 1000;
+constexpr int queries = 200;
+
+// every client works with a collection of its own, so the sharded instance serves them in parallel
+template<bool sharded>
+class multi_client_spaces final : public otterbrix::base_otterbrix_t {
+public:
+    static multi_client_spaces& get() {
+        static multi_client_spaces<sharded> spaces_;
+        return spaces_;
+    }
+
+private:
+    multi_client_spaces()
+        : otterbrix::base_otterbrix_t(make_config()) {}
+
+    static configuration::config make_config() {
+        auto config = configuration::config::create_config(std::filesystem::current_path() /
+                                                           (sharded ? "sharded" : "single"));
+        config.log.level = log_t::level::off;
+        config.disk.on = false;
+        config.wal.on = false;
+        config.wal.sync_to_disk = false;
+        // parallelism comes from the clients, not from the scans of a single query
+        config.executor.scan_threads = 1;
+        if constexpr (sharded) {
+            const auto threads = std::max(1u, std::thread::hardware_concurrency());
+            config.scheduler.workers = threads;
+            config.executor.executors = threads;
+        }
+        return config;
+    }
+};
+
+collection_name_t client_collection(int client) { return "client_collection_" + std::to_string(client); }
+
+template<bool sharded>
+void init_clients() {
+    auto* dispatcher = multi_client_spaces<sharded>::get().dispatcher();
+    dispatcher->create_database(otterbrix::session_id_t(), database_name);
+    for (int client = 0; client < max_clients; ++client) {
+        dispatcher->create_collection(otterbrix::session_id_t(), database_name, client_collection(client));
+        std::pmr::vector<document_ptr> docs(dispatcher->resource());
+        for (int i = 1; i <= client_collection_size; ++i) {
+            docs.push_back(gen_doc(i, dispatcher->resource()));
+        }
+        dispatcher->insert_many(otterbrix::session_id_t(), database_name, client_collection(client), docs);
+    }
+}
+
+template<bool sharded, typename Query>
+void run_clients(benchmark::State& state, Query&& query) {
+    auto* dispatcher = multi_client_spaces<sharded>::get().dispatcher();
+    const auto clients = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        std::vector<std::thread> threads;
+        threads.reserve(clients);
+        for (int client = 0; client < clients; ++client) {
+            threads.emplace_back([&query, dispatcher, client] {
+                for (int i = 0; i < queries; ++i) {
+                    query(dispatcher, client, i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * clients * queries);
+}
+
+template<bool sharded>
+void find_eq(benchmark::State& state) {
+    run_clients<sharded>(state, [](otterbrix::wrapper_dispatcher_t* dispatcher, int client, int i) {
+        auto p = create_aggregate(database_name,
+                                  client_collection(client),
+                                  compare_type::eq,
+                                  "count",
+                                  i % client_collection_size + 1);
+        benchmark::DoNotOptimize(dispatcher->execute_plan(otterbrix::session_id_t(), p.first, p.second));
+    });
+}
+BENCHMARK_TEMPLATE(find_eq, false)->RangeMultiplier(2)->Range(1, max_clients)->UseRealTime();
+BENCHMARK_TEMPLATE(find_eq, true)->RangeMultiplier(2)->Range(1, max_clients)->UseRealTime();
+
+template<bool sharded>
+void insert_one(benchmark::State& state) {
+    static std::atomic<int> next_id{client_collection_size + 1};
+    run_clients<sharded>(state, [](otterbrix::wrapper_dispatcher_t* dispatcher, int client, int) {
+        auto doc = gen_doc(next_id++, dispatcher->resource());
+        benchmark::DoNotOptimize(
+            dispatcher->insert_one(otterbrix::session_id_t(), database_name, client_collection(client), doc));
+    });
+}
+BENCHMARK_TEMPLATE(insert_one, false)->RangeMultiplier(2)->Range(1, max_clients)->UseRealTime();
+BENCHMARK_TEMPLATE(insert_one, true)->RangeMultiplier(2)->Range(1, max_clients)->UseRealTime();
+
+int main(int argc, char** argv) {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    init_clients<false>();
+    init_clients<true>();
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
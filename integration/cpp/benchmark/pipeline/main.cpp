@@ -0,0 +1,60 @@
+#include "../classes.hpp"
+#include <benchmark/benchmark.h>
+
+#include <deque>
+
+constexpr bool wal_off = false;
+constexpr bool disk_off = false;
+constexpr int queries = 1000;
+
+// one thread keeps up to state.range(0) queries in flight, the first one is awaited when the window is full
+void find_eq_pipelined(benchmark::State& state) {
+    state.PauseTiming();
+    auto* dispatcher = wr_dispatcher<wal_off, disk_off>();
+    auto session = otterbrix::session_id_t();
+    const auto depth = static_cast<std::size_t>(state.range(0));
+    state.ResumeTiming();
+    for (auto _ : state) {
+        std::deque<std::future<components::cursor::cursor_t_ptr>> in_flight;
+        for (int i = 0; i < queries; ++i) {
+            if (in_flight.size() == depth) {
+                benchmark::DoNotOptimize(in_flight.front().get());
+                in_flight.pop_front();
+            }
+            auto p = create_aggregate(database_name, collection_name_with_index, compare_type::eq, "count", i);
+            in_flight.push_back(dispatcher->execute_plan_async(session, p.first, p.second));
+        }
+        for (auto& future : in_flight) {
+            benchmark::DoNotOptimize(future.get());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * queries);
+}
+BENCHMARK(find_eq_pipelined)->RangeMultiplier(2)->Range(1, 64);
+
+// blocking calls for comparison, one query in flight
+void find_eq_blocking(benchmark::State& state) {
+    state.PauseTiming();
+    auto* dispatcher = wr_dispatcher<wal_off, disk_off>();
+    auto session = otterbrix::session_id_t();
+    state.ResumeTiming();
+    for (auto _ : state) {
+        for (int i = 0; i < queries; ++i) {
+            auto p = create_aggregate(database_name, collection_name_with_index, compare_type::eq, "count", i);
+            benchmark::DoNotOptimize(dispatcher->execute_plan(session, p.first, p.second));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * queries);
+}
+BENCHMARK(find_eq_blocking);
+
+int main(int argc, char** argv) {
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    init_spaces<wal_off, disk_off>();
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
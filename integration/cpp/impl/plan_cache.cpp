@@ -0,0 +1,90 @@
+#include "plan_cache.hpp"
+
+#include <cctype>
+
+namespace otterbrix::impl {
+
+    plan_cache_t::plan_cache_t(std::pmr::memory_resource* resource, size_t capacity)
+        : capacity_(capacity)
+        , order_(resource)
+        , statements_(resource) {}
+
+    std::string plan_cache_t::normalize(const std::string& query) {
+        std::string result;
+        result.reserve(query.size());
+        char quote = 0;
+        bool is_space = false;
+        for (char c : query) {
+            if (quote) {
+                result.push_back(c);
+                if (c == quote) {
+                    quote = 0;
+                }
+                continue;
+            }
+            if (std::isspace(static_cast<unsigned char>(c))) {
+                is_space = !result.empty();
+                continue;
+            }
+            if (is_space) {
+                result.push_back(' ');
+                is_space = false;
+            }
+            if (c == '\'' || c == '"') {
+                quote = c;
+            }
+            result.push_back(c);
+        }
+        if (!result.empty() && result.back() == ';' && !quote) {
+            result.pop_back();
+            if (!result.empty() && result.back() == ' ') {
+                result.pop_back();
+            }
+        }
+        return result;
+    }
+
+    std::optional<plan_cache_t::statement_t> plan_cache_t::find(const std::string& key, uint64_t schema_version) {
+        std::lock_guard lock(mutex_);
+        auto it = statements_.find(key);
+        if (it == statements_.end()) {
+            return std::nullopt;
+        }
+        if (it->second.statement.schema_version != schema_version) {
+            order_.erase(it->second.position);
+            statements_.erase(it);
+            return std::nullopt;
+        }
+        order_.splice(order_.end(), order_, it->second.position);
+        return it->second.statement;
+    }
+
+    void plan_cache_t::put(const std::string& key, statement_t statement) {
+        std::lock_guard lock(mutex_);
+        auto it = statements_.find(key);
+        if (it != statements_.end()) {
+            // the same text was transformed concurrently, the latest plan is kept
+            it->second.statement = std::move(statement);
+            order_.splice(order_.end(), order_, it->second.position);
+            return;
+        }
+        if (statements_.size() >= capacity_ && !order_.empty()) {
+            statements_.erase(order_.front());
+            order_.pop_front();
+        }
+        order_.push_back(key);
+        statements_.emplace(key, entry_t{std::move(statement), std::prev(order_.end())});
+    }
+
+    void plan_cache_t::clear() {
+        std::lock_guard lock(mutex_);
+        statements_.clear();
+        order_.clear();
+    }
+
+    size_t plan_cache_t::size() {
+        std::lock_guard lock(mutex_);
+        return statements_.size();
+    }
+
+} // namespace otterbrix::impl
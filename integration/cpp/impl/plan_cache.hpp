@@ -0,0 +1,52 @@
+#pragma once
+
+#include <components/logical_plan/node.hpp>
+#include <components/logical_plan/param_storage.hpp>
+
+#include <list>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace otterbrix::impl {
+
+    // transformed sql statements keyed by normalized query text, least recently used ones are evicted
+    // cached plans are never executed: the dispatcher rewrites plans in place, every execution sends a copy
+    class plan_cache_t {
+    public:
+        struct statement_t {
+            components::logical_plan::node_ptr plan;
+            // values of the constants of the query, placeholders are null
+            components::logical_plan::parameter_node_ptr params;
+            // catalog schema version the query was transformed at
+            uint64_t schema_version{0};
+        };
+
+        static constexpr size_t default_capacity = 1024;
+
+        explicit plan_cache_t(std::pmr::memory_resource* resource, size_t capacity = default_capacity);
+
+        // whitespace outside of literals is collapsed to a single space, a trailing ';' is dropped
+        static std::string normalize(const std::string& query);
+
+        // a statement of an older schema version is dropped and not found
+        std::optional<statement_t> find(const std::string& key, uint64_t schema_version);
+        void put(const std::string& key, statement_t statement);
+        void clear();
+        size_t size();
+
+    private:
+        struct entry_t {
+            statement_t statement;
+            std::pmr::list<std::string>::iterator position;
+        };
+
+        std::mutex mutex_;
+        const size_t capacity_;
+        std::pmr::list<std::string> order_; // from the least recently used
+        std::pmr::unordered_map<std::string, entry_t> statements_;
+    };
+
+} // namespace otterbrix::impl
@@ -16,6 +16,14 @@ namespace {
         return ptr->dispatcher()->execute_sql(session, query);
     }
 
+    auto base_execute_sql_async(otterbrix::base_otterbrix_t* ptr, const std::string& query)
+        -> std::future<components::cursor::cursor_t_ptr> {
+        assert(ptr != nullptr);
+        assert(!query.empty());
+        auto session = otterbrix::session_id_t();
+        return ptr->dispatcher()->execute_sql_async(session, query);
+    }
+
 } // namespace
 
 namespace otterbrix {
@@ -27,4 +35,9 @@ namespace otterbrix {
     auto execute_sql(const otterbrix_ptr& ptr, const std::string& query) -> components::cursor::cursor_t_ptr {
         return base_execute_sql(ptr.get(), query);
     }
+
+    auto execute_sql_async(const otterbrix_ptr& ptr, const std::string& query)
+        -> std::future<components::cursor::cursor_t_ptr> {
+        return base_execute_sql_async(ptr.get(), query);
+    }
 } // namespace otterbrix
\ No newline at end of file
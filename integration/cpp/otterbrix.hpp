@@ -2,6 +2,7 @@
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 #include <boost/smart_ptr/intrusive_ref_counter.hpp>
+#include <future>
 #include <memory>
 
 #include <integration/cpp/base_spaces.hpp>
@@ -21,4 +22,7 @@ namespace otterbrix {
     auto make_otterbrix() -> otterbrix_ptr;
     auto make_otterbrix(configuration::config) -> otterbrix_ptr;
     auto execute_sql(const otterbrix_ptr& otterbrix, const std::string& query) -> components::cursor::cursor_t_ptr;
+    // returns without waiting, many queries of one thread can be executed at once
+    auto execute_sql_async(const otterbrix_ptr& otterbrix, const std::string& query)
+        -> std::future<components::cursor::cursor_t_ptr>;
 } // namespace otterbrix
\ No newline at end of file
@@ -1088,7 +1088,7 @@ TEST_CASE("integration::cpp::test_collection::logical_plan") {
 
                 REQUIRE(cur->chunk_data().data[1].type().type() == logical_type::UBIGINT);
                 REQUIRE(cur->chunk_data().data[1].type().alias() == "count");
-                REQUIRE(cur->chunk_data().data[2].type().type() == logical_type::BIGINT);
+                REQUIRE(cur->chunk_data().data[2].type().type() == logical_type::HUGEINT);
                 REQUIRE(cur->chunk_data().data[2].type().alias() == "sum");
                 REQUIRE(cur->chunk_data().data[3].type().type() == logical_type::DOUBLE);
                 REQUIRE(cur->chunk_data().data[3].type().alias() == "avg");
@@ -1099,7 +1099,7 @@ TEST_CASE("integration::cpp::test_collection::logical_plan") {
 
                 for (int num = 12; num >= 0; --num) {
                     REQUIRE(cur->chunk_data().value(1, num).value<uint64_t>() == 1);
-                    REQUIRE(cur->chunk_data().value(2, num).value<int64_t>() == (num + 25) * 2 * 10);
+                    REQUIRE(cur->chunk_data().value(2, num).value<types::int128_t>() == (num + 25) * 2 * 10);
                     REQUIRE(cur->chunk_data().value(3, num).value<double>() == (num + 25) * 2);
                     REQUIRE(cur->chunk_data().value(4, num).value<int64_t>() == (num + 25) * 2 * 10);
                     REQUIRE(cur->chunk_data().value(5, num).value<int64_t>() == (num + 25) * 2 * 10);
@@ -1122,3 +1122,100 @@ TEST_CASE("integration::cpp::test_collection::logical_plan") {
         }
     }
 }
+
+TEST_CASE("integration::cpp::test_collection::logical_plan::stream") {
+    auto config = test_create_config("/tmp/test_collection_logical_plan_stream");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+    auto tape = std::make_unique<impl::base_document>(dispatcher->resource());
+    auto new_value = [&](auto value) { return value_t{tape.get(), value}; };
+
+    constexpr size_t num_rows = vector::DEFAULT_VECTOR_CAPACITY * 3 + 10;
+
+    INFO("initialization") {
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_database(session, table_database_name);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            auto types = gen_data_chunk(0, dispatcher->resource()).types();
+            dispatcher->create_collection(session, table_database_name, table_collection_name, types);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            auto ins = logical_plan::make_node_insert(dispatcher->resource(),
+                                                      {table_database_name, table_collection_name},
+                                                      gen_data_chunk(num_rows, dispatcher->resource()));
+            auto cur = dispatcher->execute_plan(session, ins);
+            REQUIRE(cur->is_success());
+        }
+    }
+
+    INFO("all batches") {
+        auto session = otterbrix::session_id_t();
+        auto agg =
+            logical_plan::make_node_aggregate(dispatcher->resource(), {table_database_name, table_collection_name});
+        auto cur = dispatcher->execute_plan(session, agg);
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == vector::DEFAULT_VECTOR_CAPACITY);
+        REQUIRE(cur->has_next_chunk());
+        size_t rows = 0;
+        size_t batches = 0;
+        do {
+            ++batches;
+            REQUIRE(cur->size() <= vector::DEFAULT_VECTOR_CAPACITY);
+            for (size_t i = 0; i < cur->size(); i++) {
+                REQUIRE(cur->chunk_data().value(0, i).value<int64_t>() == static_cast<int64_t>(rows + i + 1));
+            }
+            rows += cur->size();
+        } while (cur->next_chunk());
+        REQUIRE(cur->is_success());
+        REQUIRE(rows == num_rows);
+        REQUIRE(batches == 4);
+    }
+
+    INFO("filtered batches") {
+        auto session = otterbrix::session_id_t();
+        auto agg =
+            logical_plan::make_node_aggregate(dispatcher->resource(), {table_database_name, table_collection_name});
+        auto expr = components::expressions::make_compare_expression(dispatcher->resource(),
+                                                                     compare_type::gt,
+                                                                     key{"count"},
+                                                                     id_par{1});
+        agg->append_child(logical_plan::make_node_match(dispatcher->resource(),
+                                                        {table_database_name, table_collection_name},
+                                                        std::move(expr)));
+        auto params = logical_plan::make_parameter_node(dispatcher->resource());
+        params->add_parameter(id_par{1}, new_value(100));
+        auto cur = dispatcher->execute_plan(session, agg, params);
+        REQUIRE(cur->is_success());
+        size_t rows = 0;
+        do {
+            for (size_t i = 0; i < cur->size(); i++) {
+                REQUIRE(cur->chunk_data().value(0, i).value<int64_t>() == static_cast<int64_t>(rows + i + 101));
+            }
+            rows += cur->size();
+        } while (cur->next_chunk());
+        REQUIRE(rows == num_rows - 100);
+    }
+
+    INFO("cursor closed before the end") {
+        {
+            auto session = otterbrix::session_id_t();
+            auto agg = logical_plan::make_node_aggregate(dispatcher->resource(),
+                                                         {table_database_name, table_collection_name});
+            auto cur = dispatcher->execute_plan(session, agg);
+            REQUIRE(cur->has_next_chunk());
+            REQUIRE(cur->next_chunk());
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            REQUIRE(dispatcher->size(session, table_database_name, table_collection_name) == num_rows);
+        }
+    }
+}
@@ -1,5 +1,6 @@
 #include "test_config.hpp"
 #include <catch2/catch.hpp>
+#include <thread>
 #include <variant>
 
 static const database_name_t database_name = "testdatabase";
@@ -320,6 +321,361 @@ TEST_CASE("integration::cpp::test_collection::sql::invalid_queries") {
     }
 }
 
+TEST_CASE("integration::cpp::test_collection::sql::prepared") {
+    auto config = test_create_config("/tmp/test_collection_sql/prepared");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    INFO("initialization") {
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_database(session, database_name);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_collection(session, database_name, collection_name);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            std::stringstream query;
+            query << "INSERT INTO TestDatabase.TestCollection (_id, name, count) VALUES ";
+            for (int num = 0; num < 100; ++num) {
+                query << "('" << gen_id(num + 1, dispatcher->resource()) << "', "
+                      << "'Name " << num << "', " << num << ")" << (num == 99 ? ";" : ", ");
+            }
+            auto cur = dispatcher->execute_sql(session, query.str());
+            REQUIRE(cur->is_success());
+        }
+    }
+
+    INFO("select") {
+        dispatcher->prepare("SELECT * FROM TestDatabase.TestCollection WHERE count > $1;");
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_prepared(session,
+                                                    "SELECT * FROM TestDatabase.TestCollection WHERE count > $1;",
+                                                    int64_t(90));
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 9);
+        }
+        {
+            // the same statement with other whitespace and another value
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_prepared(session,
+                                                    "SELECT *  FROM TestDatabase.TestCollection\n WHERE count > $1",
+                                                    int64_t(50));
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 49);
+        }
+    }
+
+    INFO("update") {
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_prepared(session,
+                                                    "UPDATE TestDatabase.TestCollection SET count = $1 "
+                                                    "WHERE count < $2 AND name = $3;",
+                                                    int64_t(1000),
+                                                    int64_t(20),
+                                                    std::string("Name 10"));
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 1);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_prepared(session,
+                                                    "SELECT * FROM TestDatabase.TestCollection WHERE count > $1;",
+                                                    int64_t(900));
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 1);
+        }
+    }
+
+    INFO("schema change") {
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_sql(session, "DROP TABLE TestDatabase.TestCollection;");
+            REQUIRE(cur->is_success());
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_prepared(session,
+                                                    "SELECT * FROM TestDatabase.TestCollection WHERE count > $1;",
+                                                    int64_t(90));
+            REQUIRE(cur->is_error());
+            REQUIRE(cur->get_error().type == cursor::error_code_t::collection_not_exists);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_collection(session, database_name, collection_name);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            std::stringstream query;
+            query << "INSERT INTO TestDatabase.TestCollection (_id, name, count) VALUES ('"
+                  << gen_id(1, dispatcher->resource()) << "', 'Name', 95);";
+            auto cur = dispatcher->execute_sql(session, query.str());
+            REQUIRE(cur->is_success());
+        }
+        {
+            // the statement cached before the drop belongs to an older schema version
+            auto session = otterbrix::session_id_t();
+            auto cur = dispatcher->execute_prepared(session,
+                                                    "SELECT * FROM TestDatabase.TestCollection WHERE count > $1;",
+                                                    int64_t(90));
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 1);
+        }
+    }
+}
+
+TEST_CASE("integration::cpp::test_collection::sql::async") {
+    auto config = test_create_config("/tmp/test_collection_sql/async");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+
+    INFO("initialization") {
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_database(session, database_name);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            dispatcher->create_collection(session, database_name, collection_name);
+        }
+        {
+            auto session = otterbrix::session_id_t();
+            std::stringstream query;
+            query << "INSERT INTO TestDatabase.TestCollection (_id, name, count) VALUES ";
+            for (int num = 0; num < 100; ++num) {
+                query << "('" << gen_id(num + 1, dispatcher->resource()) << "', "
+                      << "'Name " << num << "', " << num << ")" << (num == 99 ? ";" : ", ");
+            }
+            auto future = dispatcher->execute_sql_async(session, query.str());
+            REQUIRE(future.get()->size() == 100);
+        }
+    }
+
+    INFO("pipelined futures") {
+        // the same session is reused, every request gets a session of its own
+        auto session = otterbrix::session_id_t();
+        std::vector<std::future<components::cursor::cursor_t_ptr>> futures;
+        for (int num = 0; num < 10; ++num) {
+            futures.push_back(dispatcher->execute_sql_async(
+                session,
+                "SELECT * FROM TestDatabase.TestCollection WHERE count >= " + std::to_string(num * 10) + ";"));
+        }
+        for (int num = 0; num < 10; ++num) {
+            auto cur = futures[static_cast<std::size_t>(num)].get();
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == static_cast<std::size_t>(100 - num * 10));
+        }
+    }
+
+    INFO("callbacks") {
+        constexpr int count = 10;
+        std::atomic_int completed = 0;
+        std::atomic_size_t total = 0;
+        std::promise<void> all_completed;
+        for (int num = 0; num < count; ++num) {
+            auto session = otterbrix::session_id_t();
+            dispatcher->execute_sql_async(session,
+                                          "SELECT * FROM TestDatabase.TestCollection WHERE count < " +
+                                              std::to_string(num + 1) + ";",
+                                          [&](components::cursor::cursor_t_ptr cur) {
+                                              total += cur->size();
+                                              if (++completed == count) {
+                                                  all_completed.set_value();
+                                              }
+                                          });
+        }
+        all_completed.get_future().wait();
+        REQUIRE(total == 55);
+    }
+
+    INFO("error") {
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql_async(session, "SELECT * FROM TestDatabase.OtherCollection;").get();
+        REQUIRE(cur->is_error());
+        REQUIRE(cur->get_error().type == cursor::error_code_t::collection_not_exists);
+    }
+}
+
+TEST_CASE("integration::cpp::test_collection::sql::sharded_executors") {
+    auto config = test_create_config("/tmp/test_collection_sql/sharded_executors");
+    test_clear_directory(config);
+    config.disk.on = false;
+    config.wal.on = false;
+    config.scheduler.workers = 4;
+    config.executor.executors = 4;
+    test_spaces space(config);
+    auto* dispatcher = space.dispatcher();
+    constexpr int clients = 8;
+    constexpr int batches = 10;
+    auto table = [](int client) { return "TestDatabase.TestCollection" + std::to_string(client); };
+
+    INFO("initialization") {
+        auto session = otterbrix::session_id_t();
+        dispatcher->create_database(session, database_name);
+        for (int client = 0; client < clients; ++client) {
+            auto cur = dispatcher->execute_sql(otterbrix::session_id_t(), "CREATE TABLE " + table(client) + "();");
+            REQUIRE(cur->is_success());
+        }
+    }
+
+    INFO("parallel clients") {
+        // every client sees its own inserts in order
+        std::atomic_int failures = 0;
+        std::vector<std::thread> threads;
+        for (int client = 0; client < clients; ++client) {
+            threads.emplace_back([&, client] {
+                for (int batch = 0; batch < batches; ++batch) {
+                    std::stringstream query;
+                    query << "INSERT INTO " << table(client) << " (_id, count) VALUES ";
+                    for (int num = 0; num < 10; ++num) {
+                        const int id = client * 1000 + batch * 10 + num;
+                        query << "('" << gen_id(id + 1, dispatcher->resource()) << "', " << batch * 10 + num << ")"
+                              << (num == 9 ? ";" : ", ");
+                    }
+                    auto inserted = dispatcher->execute_sql(otterbrix::session_id_t(), query.str());
+                    auto selected =
+                        dispatcher->execute_sql(otterbrix::session_id_t(), "SELECT * FROM " + table(client) + ";");
+                    if (!inserted->is_success() || selected->size() != static_cast<std::size_t>((batch + 1) * 10)) {
+                        ++failures;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        REQUIRE(failures == 0);
+    }
+
+    INFO("plans of several collections") {
+        // collections of different executors are joined after the plans queued before
+        std::vector<std::future<components::cursor::cursor_t_ptr>> futures;
+        for (int client = 1; client < clients; ++client) {
+            futures.push_back(dispatcher->execute_sql_async(
+                otterbrix::session_id_t(),
+                "SELECT * FROM " + table(0) + " INNER JOIN " + table(client) + " ON " + table(0) +
+                    ".count = " + table(client) + ".count;"));
+            futures.push_back(
+                dispatcher->execute_sql_async(otterbrix::session_id_t(), "SELECT * FROM " + table(client) + ";"));
+        }
+        for (auto& future : futures) {
+            auto cur = future.get();
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == static_cast<std::size_t>(batches * 10));
+        }
+    }
+}
+
+TEST_CASE("integration::cpp::test_collection::sql::sharded_executors_drop") {
+    auto config = test_create_config("/tmp/test_collection_sql/sharded_executors_drop");
+    test_clear_directory(config);
+    config.scheduler.workers = 4;
+    config.executor.executors = 4;
+    // tables are checkpointed after almost every insert
+    config.disk.checkpoint_wal_records = 1;
+    constexpr int clients = 8;
+    constexpr int batches = 10;
+    auto table = [](int client) { return "TestDatabase.TestCollection" + std::to_string(client); };
+    auto collection = [](int client) { return collection_name_t("TestCollection" + std::to_string(client)); };
+
+    {
+        test_spaces space(config);
+        auto* dispatcher = space.dispatcher();
+
+        INFO("initialization") {
+            auto cur = dispatcher->execute_sql(otterbrix::session_id_t(), "CREATE DATABASE TestDatabase;");
+            REQUIRE(cur->is_success());
+            for (int client = 0; client < clients; ++client) {
+                cur = dispatcher->execute_sql(otterbrix::session_id_t(),
+                                              "CREATE TABLE " + table(client) + "(name string, count int);");
+                REQUIRE(cur->is_success());
+            }
+        }
+
+        INFO("drop, size and checkpoint of parallel clients") {
+            // odd clients drop and recreate their tables while even ones insert and count, checkpoints run in between
+            std::atomic_int failures = 0;
+            std::vector<std::thread> threads;
+            for (int client = 0; client < clients; ++client) {
+                threads.emplace_back([&, client] {
+                    for (int batch = 0; batch < batches; ++batch) {
+                        std::stringstream query;
+                        query << "INSERT INTO " << table(client) << " (name, count) VALUES ";
+                        for (int num = 0; num < 10; ++num) {
+                            query << "('Name " << batch * 10 + num << "', " << batch * 10 + num << ")"
+                                  << (num == 9 ? ";" : ", ");
+                        }
+                        auto inserted = dispatcher->execute_sql(otterbrix::session_id_t(), query.str());
+                        auto size = dispatcher->size(otterbrix::session_id_t(), database_name, collection(client));
+                        if (!inserted->is_success() || size != static_cast<std::size_t>((batch + 1) * 10)) {
+                            ++failures;
+                        }
+                        if (client % 2 == 1 && batch == batches / 2) {
+                            auto dropped =
+                                dispatcher->execute_sql(otterbrix::session_id_t(), "DROP TABLE " + table(client) + ";");
+                            // the new table must not be dropped by the drop queued before it
+                            auto created = dispatcher->execute_sql(otterbrix::session_id_t(),
+                                                                   "CREATE TABLE " + table(client) +
+                                                                       "(name string, count int);");
+                            auto refilled = dispatcher->execute_sql(otterbrix::session_id_t(), query.str());
+                            if (!dropped->is_success() || !created->is_success() || !refilled->is_success() ||
+                                dispatcher->size(otterbrix::session_id_t(), database_name, collection(client)) != 10) {
+                                ++failures;
+                            }
+                            break;
+                        }
+                    }
+                });
+            }
+            // counts tables of all clients, the dropped ones included, while they are written
+            std::atomic_bool done = false;
+            std::thread observer([&] {
+                while (!done) {
+                    for (int client = 0; client < clients; ++client) {
+                        if (dispatcher->size(otterbrix::session_id_t(), database_name, collection(client)) >
+                            static_cast<std::size_t>(batches * 10)) {
+                            ++failures;
+                        }
+                    }
+                }
+            });
+            for (auto& thread : threads) {
+                thread.join();
+            }
+            done = true;
+            observer.join();
+            REQUIRE(failures == 0);
+        }
+    }
+
+    INFO("load") {
+        test_spaces space(config);
+        auto* dispatcher = space.dispatcher();
+        dispatcher->load();
+        for (int client = 0; client < clients; client += 2) {
+            auto cur = dispatcher->execute_sql(otterbrix::session_id_t(), "SELECT * FROM " + table(client) + ";");
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == static_cast<std::size_t>(batches * 10));
+        }
+        for (int client = 1; client < clients; client += 2) {
+            auto cur = dispatcher->execute_sql(otterbrix::session_id_t(), "SELECT * FROM " + table(client) + ";");
+            REQUIRE(cur->is_success());
+            REQUIRE(cur->size() == 10);
+        }
+    }
+}
+
 TEST_CASE("integration::cpp::test_collection::sql::index") {
     auto config = test_create_config("/tmp/test_collection_sql/base");
     test_clear_directory(config);
@@ -1,10 +1,12 @@
 #include "test_config.hpp"
 #include <catch2/catch.hpp>
+#include <components/cursor/arrow_stream.hpp>
 #include <components/expressions/compare_expression.hpp>
 #include <components/logical_plan/node_insert.hpp>
 #include <services/disk/disk.hpp>
 #include <services/wal/manager_wal_replicate.hpp>
 #include <services/wal/wal.hpp>
+#include <thread>
 
 constexpr uint count_databases = 2;
 constexpr uint count_collections = 4;
@@ -256,3 +258,125 @@ TEST_CASE("integration::cpp::test_save_load::disk+wal") {
         }
     }
 }
+
+TEST_CASE("integration::cpp::test_save_load::append_arrow") {
+    auto config = test_create_config("/tmp/test_save_load/append_arrow");
+    constexpr uint64_t count_rows = 5000;
+
+    SECTION("initialization") {
+        test_clear_directory(config);
+        test_spaces space(config);
+        auto* dispatcher = space.dispatcher();
+        auto session = otterbrix::session_id_t();
+        auto cur = dispatcher->execute_sql(session, "CREATE DATABASE " + database_name + ";");
+        REQUIRE(cur->is_success());
+        auto table_name = database_name + "." + collection_name;
+        cur = dispatcher->execute_sql(session, "CREATE TABLE " + table_name + "(name string, count int);");
+        REQUIRE(cur->is_success());
+
+        // columns of the stream are in another order than the ones of the table
+        std::pmr::vector<components::types::complex_logical_type> types(dispatcher->resource());
+        types.emplace_back(components::types::logical_type::INTEGER, "count");
+        types.emplace_back(components::types::logical_type::STRING_LITERAL, "name");
+        components::vector::data_chunk_t chunk(dispatcher->resource(), types, count_rows);
+        chunk.set_cardinality(count_rows);
+        for (uint64_t num = 0; num < count_rows; ++num) {
+            chunk.set_value(0, num, components::types::logical_value_t{int32_t(num)});
+            chunk.set_value(1, num, components::types::logical_value_t{"Name " + std::to_string(num)});
+        }
+        ArrowArrayStream stream;
+        components::cursor::to_arrow_stream(make_cursor(dispatcher->resource(), std::move(chunk)), &stream);
+        cur = dispatcher->append_arrow(session, database_name, collection_name, &stream);
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == count_rows);
+        REQUIRE(dispatcher->size(session, database_name, collection_name) == count_rows);
+
+        ArrowArrayStream missing;
+        components::vector::data_chunk_t empty(dispatcher->resource(), types, 0);
+        components::cursor::to_arrow_stream(make_cursor(dispatcher->resource(), std::move(empty)), &missing);
+        cur = dispatcher->append_arrow(session, database_name, "missing", &missing);
+        REQUIRE(cur->is_error());
+        REQUIRE(cur->get_error().type == error_code_t::collection_not_exists);
+    }
+
+    SECTION("load") {
+        test_spaces space(config);
+        auto* dispatcher = space.dispatcher();
+        dispatcher->load();
+        auto session = otterbrix::session_id_t();
+        REQUIRE(dispatcher->size(session, database_name, collection_name) == count_rows);
+        auto table_name = database_name + "." + collection_name;
+        auto cur = dispatcher->execute_sql(session, "SELECT * FROM " + table_name + " WHERE count = 4321;");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == 1);
+        REQUIRE(cur->chunk_data().value(0, 0).value<std::string_view>() == "Name 4321");
+    }
+}
+
+TEST_CASE("integration::cpp::test_save_load::checkpoint") {
+    auto config = test_create_config("/tmp/test_save_load/checkpoint");
+    // tables are checkpointed after almost every insert, the wal is truncated behind the checkpoints
+    config.disk.checkpoint_wal_records = 1;
+    config.wal.segment_size = 4096;
+    config.scheduler.workers = 4;
+    config.executor.executors = 4;
+    constexpr int clients = 4;
+    constexpr int batches = 20;
+    auto table_name = database_name + "." + collection_name;
+    auto documents_name = database_name + ".documents";
+
+    SECTION("initialization") {
+        test_clear_directory(config);
+        test_spaces space(config);
+        auto* dispatcher = space.dispatcher();
+        auto cur = dispatcher->execute_sql(otterbrix::session_id_t(), "CREATE DATABASE " + database_name + ";");
+        REQUIRE(cur->is_success());
+        cur = dispatcher->execute_sql(otterbrix::session_id_t(),
+                                      "CREATE TABLE " + table_name + "(name string, count int);");
+        REQUIRE(cur->is_success());
+        cur = dispatcher->execute_sql(otterbrix::session_id_t(), "CREATE TABLE " + documents_name + "();");
+        REQUIRE(cur->is_success());
+
+        // rows of the table and documents are written in parallel with the checkpoints
+        std::atomic_int failures = 0;
+        std::vector<std::thread> threads;
+        for (int client = 0; client < clients; ++client) {
+            threads.emplace_back([&, client] {
+                for (int batch = 0; batch < batches; ++batch) {
+                    const int number = client * batches + batch;
+                    std::stringstream query;
+                    query << "INSERT INTO " << table_name << " (name, count) VALUES ";
+                    for (int num = 0; num < 10; ++num) {
+                        query << "('Name " << number * 10 + num << "', " << number * 10 + num << ")"
+                              << (num == 9 ? ";" : ", ");
+                    }
+                    auto rows = dispatcher->execute_sql(otterbrix::session_id_t(), query.str());
+                    std::stringstream document_query;
+                    document_query << "INSERT INTO " << documents_name << " (_id, count) VALUES ('"
+                                   << gen_id(number + 1, dispatcher->resource()) << "', " << number << ");";
+                    auto document = dispatcher->execute_sql(otterbrix::session_id_t(), document_query.str());
+                    if (!rows->is_success() || !document->is_success()) {
+                        ++failures;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        REQUIRE(failures == 0);
+    }
+
+    SECTION("load") {
+        // every record is restored once: from the checkpoint, the disk or the rest of the wal
+        test_spaces space(config);
+        auto* dispatcher = space.dispatcher();
+        dispatcher->load();
+        auto cur = dispatcher->execute_sql(otterbrix::session_id_t(), "SELECT * FROM " + table_name + ";");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == static_cast<std::size_t>(clients * batches * 10));
+        cur = dispatcher->execute_sql(otterbrix::session_id_t(), "SELECT * FROM " + documents_name + ";");
+        REQUIRE(cur->is_success());
+        REQUIRE(cur->size() == static_cast<std::size_t>(clients * batches));
+    }
+}
@@ -7,16 +7,106 @@
 #include <components/logical_plan/node_drop_database.hpp>
 #include <components/logical_plan/node_insert.hpp>
 #include <components/logical_plan/node_update.hpp>
+#include <components/serialization/serializer.hpp>
 #include <components/sql/parser/parser.h>
 #include <components/sql/transformer/utils.hpp>
+#include <components/vector/arrow/arrow_converter.hpp>
 #include <core/system_command.hpp>
 
+#include <algorithm>
+#include <numeric>
+
 using namespace components::cursor;
 
 namespace otterbrix {
 
+    namespace {
+
+        struct stream_guard_t {
+            ArrowArrayStream* stream;
+            ArrowSchema schema{};
+
+            ~stream_guard_t() {
+                if (schema.release) {
+                    schema.release(&schema);
+                }
+                if (stream->release) {
+                    stream->release(stream);
+                }
+            }
+        };
+
+        std::string stream_error(ArrowArrayStream* stream, int code) {
+            const char* error = stream->get_last_error ? stream->get_last_error(stream) : nullptr;
+            return error ? std::string(error) : "arrow stream error " + std::to_string(code);
+        }
+
+        // order[i] is the stream column of the i-th table column, an empty string if the columns match
+        std::string match_columns(const components::types::complex_logical_type& table,
+                                  components::vector::arrow::arrow_table_schema_t& schema,
+                                  std::vector<size_t>& order) {
+            auto& types = schema.get_types();
+            const auto& names = schema.get_names();
+            for (size_t i = 0; i < types.size(); i++) {
+                types[i].set_alias(names[i]);
+                if (!components::serializer::is_serializable_column(types[i])) {
+                    return "append_arrow: type of column \"" + names[i] + "\" is not supported";
+                }
+            }
+            const auto& columns = table.child_types();
+            if (columns.empty()) {
+                // a table without columns yet takes the ones of the stream
+                order.resize(types.size());
+                std::iota(order.begin(), order.end(), size_t(0));
+                return {};
+            }
+            if (columns.size() != types.size()) {
+                return "append_arrow: the stream has " + std::to_string(types.size()) + " columns, the table has " +
+                       std::to_string(columns.size());
+            }
+            for (const auto& column : columns) {
+                auto it = std::find(names.begin(), names.end(), column.alias());
+                if (it == names.end()) {
+                    return "append_arrow: column \"" + column.alias() + "\" is missing in the stream";
+                }
+                auto index = size_t(it - names.begin());
+                if (types[index].type() != column.type()) {
+                    return "append_arrow: column \"" + column.alias() + "\" has a different type in the stream";
+                }
+                order.push_back(index);
+            }
+            return {};
+        }
+
+    } // namespace
+
+    class wrapper_dispatcher_t::stream_source_t final : public chunk_source_t {
+    public:
+        stream_source_t(std::shared_ptr<handle_t> handle, const session_id_t& session)
+            : handle_(std::move(handle))
+            , session_(session) {}
+
+        // without the dispatcher the cursor reports the stream as closed
+        cursor_t_ptr fetch() final {
+            std::lock_guard lock(handle_->mutex);
+            return handle_->dispatcher ? handle_->dispatcher->fetch_chunk(session_) : nullptr;
+        }
+
+        void close() final {
+            std::lock_guard lock(handle_->mutex);
+            if (handle_->dispatcher) {
+                handle_->dispatcher->close_cursor(session_);
+            }
+        }
+
+    private:
+        std::shared_ptr<handle_t> handle_;
+        session_id_t session_;
+    };
+
     wrapper_dispatcher_t::wrapper_dispatcher_t(std::pmr::memory_resource* mr,
                                                actor_zeta::address_t manager_dispatcher,
+                                               const components::catalog::catalog& catalog,
                                                log_t& log)
         : actor_zeta::cooperative_supervisor<wrapper_dispatcher_t>(mr)
         , load_finish_(actor_zeta::make_behavior(resource(),
@@ -37,10 +127,21 @@ namespace otterbrix {
                                                    &wrapper_dispatcher_t::schema_finish))
         , manager_dispatcher_(manager_dispatcher)
         , transformer_(mr)
+        , catalog_(catalog)
+        , plan_cache_(mr)
         , log_(log.clone())
-        , blocker_(mr) {}
+        , blocker_(mr)
+        , callbacks_(mr)
+        , cursor_store_(mr)
+        , size_store_(mr)
+        , handle_(std::make_shared<handle_t>(this)) {}
 
-    wrapper_dispatcher_t::~wrapper_dispatcher_t() { trace(log_, "delete wrapper_dispatcher_t"); }
+    wrapper_dispatcher_t::~wrapper_dispatcher_t() {
+        trace(log_, "delete wrapper_dispatcher_t");
+        // waits for a fetch in progress, later ones do not reach the dispatcher
+        std::lock_guard lock(handle_->mutex);
+        handle_->dispatcher = nullptr;
+    }
 
     actor_zeta::behavior_t wrapper_dispatcher_t::behavior() {
         return actor_zeta::make_behavior(resource(), [this](actor_zeta::message* msg) -> void {
@@ -291,11 +392,55 @@ namespace otterbrix {
     cursor_t_ptr wrapper_dispatcher_t::execute_sql(const components::session::session_id_t& session,
                                                    const std::string& query) {
         trace(log_, "wrapper_dispatcher_t::execute sql session: {}", session.data());
-        auto params = components::logical_plan::make_parameter_node(resource());
-        auto parse_result = raw_parser(query.c_str())->lst.front().data;
-        auto node =
-            transformer_.transform(components::sql::transform::pg_cell_to_node_cast(parse_result), params.get());
-        return execute_plan(session, node, params);
+        auto statement = transform(query);
+        return execute_plan(session, std::move(statement.plan), std::move(statement.params));
+    }
+
+    auto wrapper_dispatcher_t::prepare(const std::string& query) -> void {
+        trace(log_, "wrapper_dispatcher_t::prepare: {}", query);
+        find_statement(query);
+    }
+
+    auto wrapper_dispatcher_t::execute_plan_async(const session_id_t& session,
+                                                  components::logical_plan::node_ptr plan,
+                                                  components::logical_plan::parameter_node_ptr params,
+                                                  result_callback_t callback) -> void {
+        trace(log_, "wrapper_dispatcher_t::execute_plan_async session: {}", session.data());
+        if (!params) {
+            params = components::logical_plan::make_parameter_node(resource());
+        }
+        session_id_t approved_session = init(session);
+        {
+            std::unique_lock<std::mutex> lk(output_mtx_);
+            callbacks_.insert_or_assign(approved_session, std::move(callback));
+        }
+        post_plan(approved_session, std::move(plan), std::move(params));
+    }
+
+    auto wrapper_dispatcher_t::execute_sql_async(const session_id_t& session,
+                                                 const std::string& query,
+                                                 result_callback_t callback) -> void {
+        trace(log_, "wrapper_dispatcher_t::execute_sql_async session: {}", session.data());
+        auto statement = transform(query);
+        execute_plan_async(session, std::move(statement.plan), std::move(statement.params), std::move(callback));
+    }
+
+    auto wrapper_dispatcher_t::execute_plan_async(const session_id_t& session,
+                                                  components::logical_plan::node_ptr plan,
+                                                  components::logical_plan::parameter_node_ptr params)
+        -> std::future<cursor_t_ptr> {
+        auto promise = std::make_shared<std::promise<cursor_t_ptr>>();
+        auto result = promise->get_future();
+        execute_plan_async(session, std::move(plan), std::move(params), [promise](cursor_t_ptr cursor) {
+            promise->set_value(std::move(cursor));
+        });
+        return result;
+    }
+
+    auto wrapper_dispatcher_t::execute_sql_async(const session_id_t& session, const std::string& query)
+        -> std::future<cursor_t_ptr> {
+        auto statement = transform(query);
+        return execute_plan_async(session, std::move(statement.plan), std::move(statement.params));
     }
 
     auto wrapper_dispatcher_t::get_schema(const components::session::session_id_t& session,
@@ -311,6 +456,71 @@ namespace otterbrix {
         return wait_result(approved_session);
     }
 
+    auto wrapper_dispatcher_t::append_arrow(const session_id_t& session,
+                                            const database_name_t& database,
+                                            const collection_name_t& collection,
+                                            ArrowArrayStream* stream) -> cursor_t_ptr {
+        using namespace components::vector;
+        trace(log_, "wrapper_dispatcher_t::append_arrow session: {}, collection name: {} ", session.data(), collection);
+        stream_guard_t guard{stream};
+        auto table = get_schema(session, {{database, collection}});
+        if (table->is_error()) {
+            return table;
+        }
+        if (table->type_data().front().type() == components::types::logical_type::INVALID) {
+            return make_cursor(resource(), error_code_t::collection_not_exists, "collection not exists");
+        }
+        if (auto code = stream->get_schema(stream, &guard.schema); code != 0) {
+            return make_cursor(resource(), error_code_t::other_error, stream_error(stream, code));
+        }
+
+        uint64_t appended = 0;
+        try {
+            auto schema = arrow::schema_from_arrow(&guard.schema);
+            std::vector<size_t> order;
+            if (auto error = match_columns(table->type_data().front(), schema, order); !error.empty()) {
+                return make_cursor(resource(), error_code_t::schema_error, error);
+            }
+            while (true) {
+                ArrowArray array{};
+                if (auto code = stream->get_next(stream, &array); code != 0) {
+                    return make_cursor(resource(), error_code_t::other_error, stream_error(stream, code));
+                }
+                if (!array.release) {
+                    break;
+                }
+                if (array.length == 0) {
+                    array.release(&array);
+                    continue;
+                }
+                // the chunk takes the array over, its columns are moved into the order of the table
+                auto chunk = arrow::data_chunk_from_arrow(resource(), &array, schema);
+                std::vector<vector_t> columns;
+                columns.reserve(order.size());
+                for (auto index : order) {
+                    columns.emplace_back(std::move(chunk.data[index]));
+                }
+                chunk.data = std::move(columns);
+                auto size = chunk.size();
+                auto result = execute_plan(session,
+                                           components::logical_plan::make_node_insert(resource(),
+                                                                                      {database, collection},
+                                                                                      std::move(chunk)));
+                if (result->is_error()) {
+                    return result;
+                }
+                appended += size;
+            }
+        } catch (const std::exception& e) {
+            return make_cursor(resource(), error_code_t::schema_error, e.what());
+        }
+
+        data_chunk_t result(resource(), {});
+        result.set_capacity(appended);
+        result.set_cardinality(appended);
+        return make_cursor(resource(), std::move(result));
+    }
+
     auto wrapper_dispatcher_t::make_scheduler() noexcept -> actor_zeta::scheduler_abstract_t* {
         assert("wrapper_dispatcher_t::executor_impl");
         return nullptr;
@@ -331,14 +541,26 @@ namespace otterbrix {
     void wrapper_dispatcher_t::execute_plan_finish(const session_id_t& session, cursor_t_ptr cursor) {
         trace(log_, "wrapper_dispatcher_t::execute_plan_finish session: {} {}", session.data(), cursor->is_success());
         std::unique_lock<std::mutex> lk(output_mtx_);
-        cursor_store_ = std::move(cursor);
+        auto it = callbacks_.find(session);
+        if (it != callbacks_.end()) {
+            auto callback = std::move(it->second);
+            callbacks_.erase(it);
+            lk.unlock();
+            blocker_.remove_session(session);
+            if (cursor->has_next_chunk()) {
+                cursor->set_chunk_source(std::make_unique<stream_source_t>(handle_, session));
+            }
+            callback(std::move(cursor));
+            return;
+        }
+        cursor_store_.insert_or_assign(session, std::move(cursor));
         notify(session);
     }
 
     auto wrapper_dispatcher_t::size_finish(const session_id_t& session, size_t size) -> void {
         trace(log_, "wrapper_dispatcher_t::size_finish session: {} {}", session.data(), size);
         std::unique_lock<std::mutex> lk(output_mtx_);
-        size_store_ = size;
+        size_store_.insert_or_assign(session, size);
         notify(session);
     }
 
@@ -346,7 +568,7 @@ namespace otterbrix {
                                              components::cursor::cursor_t_ptr cursor) -> void {
         trace(log_, "wrapper_dispatcher_t::schema_finish session: {} {}", session.data(), cursor->is_success());
         std::unique_lock<std::mutex> lk(output_mtx_);
-        cursor_store_ = std::move(cursor);
+        cursor_store_.insert_or_assign(session, std::move(cursor));
         notify(session);
     }
 
@@ -363,20 +585,26 @@ namespace otterbrix {
         std::unique_lock<std::mutex> lk(output_mtx_);
         cv_.wait(lk, [this, &session]() { return blocker_.value(session); });
         blocker_.remove_session(session);
+        auto it = cursor_store_.find(session);
+        auto result = std::move(it->second);
+        cursor_store_.erase(it);
 
-        if (cursor_store_->is_error()) {
+        if (result->is_error()) {
             //todo: handling error
-            std::cerr << cursor_store_->get_error().what << std::endl;
+            std::cerr << result->get_error().what << std::endl;
         }
 
-        return std::move(cursor_store_);
+        return result;
     }
 
     size_t wrapper_dispatcher_t::wait_size(const session_id_t& session) {
         std::unique_lock<std::mutex> lk(output_mtx_);
         cv_.wait(lk, [this, &session]() { return blocker_.value(session); });
         blocker_.remove_session(session);
-        return std::move(size_store_);
+        auto it = size_store_.find(session);
+        auto result = it->second;
+        size_store_.erase(it);
+        return result;
     }
 
     void wrapper_dispatcher_t::wait(const session_id_t& session) {
@@ -396,14 +624,67 @@ namespace otterbrix {
                                                  components::logical_plan::parameter_node_ptr params) {
         trace(log_, "wrapper_dispatcher_t::send_plan session: {}, {} ", session.data(), node->to_string());
         session_id_t approved_session = init(session);
+        post_plan(approved_session, std::move(node), std::move(params));
+        auto result = wait_result(approved_session);
+        if (result->has_next_chunk()) {
+            result->set_chunk_source(std::make_unique<stream_source_t>(handle_, approved_session));
+        }
+        return result;
+    }
+
+    void wrapper_dispatcher_t::post_plan(const session_id_t& session,
+                                         components::logical_plan::node_ptr node,
+                                         components::logical_plan::parameter_node_ptr params) {
         assert(params);
         actor_zeta::send(manager_dispatcher_,
                          address(),
                          dispatcher::handler_id(dispatcher::route::execute_plan),
-                         approved_session,
+                         session,
                          std::move(node),
                          std::move(params));
-        return wait_result(approved_session);
+    }
+
+    auto wrapper_dispatcher_t::transform(const std::string& query) -> impl::plan_cache_t::statement_t {
+        auto params = components::logical_plan::make_parameter_node(resource());
+        auto parse_result = raw_parser(query.c_str())->lst.front().data;
+        auto node =
+            transformer_.transform(components::sql::transform::pg_cell_to_node_cast(parse_result), params.get());
+        return {std::move(node), std::move(params)};
+    }
+
+    auto wrapper_dispatcher_t::find_statement(const std::string& query) -> impl::plan_cache_t::statement_t {
+        auto key = impl::plan_cache_t::normalize(query);
+        // read before the transform, so a schema change during it makes the new entry outdated at once
+        auto schema_version = catalog_.schema_version();
+        if (auto statement = plan_cache_.find(key, schema_version)) {
+            return std::move(*statement);
+        }
+        trace(log_, "wrapper_dispatcher_t::find_statement: transform {}", key);
+        auto statement = transform(query);
+        statement.schema_version = schema_version;
+        plan_cache_.put(key, statement);
+        return statement;
+    }
+
+    cursor_t_ptr wrapper_dispatcher_t::fetch_chunk(const session_id_t& session) {
+        trace(log_, "wrapper_dispatcher_t::fetch_chunk session: {}", session.data());
+        // the stream is kept under the session of its query, nobody else waits on it
+        if (!blocker_.set_value(session, false)) {
+            return make_cursor(resource(), error_code_t::other_error, "cursor is already fetching");
+        }
+        actor_zeta::send(manager_dispatcher_,
+                         address(),
+                         collection::handler_id(collection::route::fetch_chunk),
+                         session);
+        return wait_result(session);
+    }
+
+    void wrapper_dispatcher_t::close_cursor(const session_id_t& session) {
+        trace(log_, "wrapper_dispatcher_t::close_cursor session: {}", session.data());
+        actor_zeta::send(manager_dispatcher_,
+                         address(),
+                         collection::handler_id(collection::route::close_cursor),
+                         session);
     }
 
 } // namespace otterbrix
@@ -3,6 +3,8 @@
 #include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <future>
+#include <memory>
 #include <mutex>
 #include <variant>
 
@@ -10,6 +12,7 @@
 
 #include <core/spinlock/spinlock.hpp>
 
+#include <components/catalog/catalog.hpp>
 #include <components/catalog/table_id.hpp>
 #include <components/cursor/cursor.hpp>
 #include <components/document/document.hpp>
@@ -21,6 +24,8 @@
 #include <components/logical_plan/node_match.hpp>
 #include <components/session/session.hpp>
 #include <components/sql/transformer/transformer.hpp>
+#include <components/vector/arrow/arrow.hpp>
+#include <integration/cpp/impl/plan_cache.hpp>
 #include <integration/cpp/impl/session_blocker.hpp>
 
 namespace otterbrix {
@@ -30,8 +35,13 @@ namespace otterbrix {
 
     class wrapper_dispatcher_t final : public actor_zeta::cooperative_supervisor<wrapper_dispatcher_t> {
     public:
+        using result_callback_t = std::function<void(components::cursor::cursor_t_ptr)>;
+
         /// blocking method
-        wrapper_dispatcher_t(std::pmr::memory_resource*, actor_zeta::address_t, log_t& log);
+        wrapper_dispatcher_t(std::pmr::memory_resource*,
+                             actor_zeta::address_t,
+                             const components::catalog::catalog& catalog,
+                             log_t& log);
         ~wrapper_dispatcher_t();
         auto load() -> void;
         [[deprecated]] auto create_database(const session_id_t& session, const database_name_t& database)
@@ -93,10 +103,45 @@ namespace otterbrix {
                           components::logical_plan::parameter_node_ptr params = nullptr)
             -> components::cursor::cursor_t_ptr;
         auto execute_sql(const session_id_t& session, const std::string& query) -> components::cursor::cursor_t_ptr;
+        /// parses and transforms the query into the plan cache, `$1`, `$2`... are placeholders for values
+        auto prepare(const std::string& query) -> void;
+        /// executes the cached statement of the query, it is prepared by the first call
+        /// values are bound to the placeholders in order: the first one to `$1`
+        template<class... Values>
+        auto execute_prepared(const session_id_t& session, const std::string& query, Values... values)
+            -> components::cursor::cursor_t_ptr {
+            auto statement = find_statement(query);
+            auto params = statement.params->copy(resource());
+            uint16_t number = 0;
+            (params->bind(++number, std::move(values)), ...);
+            return send_plan(session, statement.plan->copy(), std::move(params));
+        }
+
+        /// non-blocking methods: a thread can have many requests in flight
+        /// the callback is called by the thread delivering the result, it must not call blocking methods
+        auto execute_plan_async(const session_id_t& session,
+                                components::logical_plan::node_ptr plan,
+                                components::logical_plan::parameter_node_ptr params,
+                                result_callback_t callback) -> void;
+        auto execute_sql_async(const session_id_t& session, const std::string& query, result_callback_t callback)
+            -> void;
+        auto execute_plan_async(const session_id_t& session,
+                                components::logical_plan::node_ptr plan,
+                                components::logical_plan::parameter_node_ptr params = nullptr)
+            -> std::future<components::cursor::cursor_t_ptr>;
+        auto execute_sql_async(const session_id_t& session, const std::string& query)
+            -> std::future<components::cursor::cursor_t_ptr>;
 
         auto get_schema(const session_id_t& session,
                         const std::pmr::vector<std::pair<database_name_t, collection_name_t>>& ids)
             -> components::cursor::cursor_t_ptr;
+        /// appends the record batches of the stream to the table, an insert and a wal record per batch
+        /// columns are matched to the table columns by name and must have their types, the stream is released
+        /// the cursor holds the number of appended rows, batches before a failed one stay appended
+        auto append_arrow(const session_id_t& session,
+                          const database_name_t& database,
+                          const collection_name_t& collection,
+                          ArrowArrayStream* stream) -> components::cursor::cursor_t_ptr;
 
         actor_zeta::behavior_t behavior();
         auto make_scheduler() noexcept -> actor_zeta::scheduler_abstract_t*;
@@ -106,6 +151,18 @@ namespace otterbrix {
         auto enqueue_impl(actor_zeta::message_ptr msg, actor_zeta::execution_unit*) -> void final;
 
     private:
+        class stream_source_t;
+
+        // streams of cursors reach the dispatcher through it, a cursor can outlive the dispatcher
+        struct handle_t {
+            explicit handle_t(wrapper_dispatcher_t* dispatcher)
+                : dispatcher(dispatcher) {}
+
+            std::mutex mutex;
+            // cleared by the destructor of the dispatcher
+            wrapper_dispatcher_t* dispatcher;
+        };
+
         // Behaviors
         actor_zeta::behavior_t load_finish_;
         actor_zeta::behavior_t execute_plan_finish_;
@@ -127,17 +184,35 @@ namespace otterbrix {
         auto send_plan(const session_id_t& session,
                        components::logical_plan::node_ptr node,
                        components::logical_plan::parameter_node_ptr params) -> components::cursor::cursor_t_ptr;
+        // sends the plan under an approved session without waiting for the result
+        void post_plan(const session_id_t& session,
+                       components::logical_plan::node_ptr node,
+                       components::logical_plan::parameter_node_ptr params);
+        auto transform(const std::string& query) -> impl::plan_cache_t::statement_t;
+        // cached statement of the normalized query for the current schema, a new one is transformed and cached
+        // on a miss; the plan is shared with the cache and is copied to be executed
+        auto find_statement(const std::string& query) -> impl::plan_cache_t::statement_t;
+        // batches of a streamed table result, pulled by the cursor
+        auto fetch_chunk(const session_id_t& session) -> components::cursor::cursor_t_ptr;
+        void close_cursor(const session_id_t& session);
 
         actor_zeta::address_t manager_dispatcher_;
         components::sql::transform::transformer transformer_;
+        // only the schema version is read, it is changed by the dispatcher thread
+        const components::catalog::catalog& catalog_;
+        impl::plan_cache_t plan_cache_;
         log_t log_;
         std::atomic_int i = 0;
         std::mutex output_mtx_;
         spin_lock input_mtx_;
         std::condition_variable cv_;
         impl::session_block_t blocker_;
-        components::cursor::cursor_t_ptr cursor_store_;
-        size_t size_store_;
+        // completions of non-blocking requests, results of the other sessions go to cursor_store_
+        std::pmr::unordered_map<session_id_t, result_callback_t> callbacks_;
+        // results of blocking requests, each taken by the thread waiting for its session
+        std::pmr::unordered_map<session_id_t, components::cursor::cursor_t_ptr> cursor_store_;
+        std::pmr::unordered_map<session_id_t, size_t> size_store_;
         bool bool_store_;
+        std::shared_ptr<handle_t> handle_;
     };
 } // namespace otterbrix
\ No newline at end of file
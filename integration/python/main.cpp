@@ -6,6 +6,7 @@
 #include "sql/wrapper_database.hpp"
 #include "sql/wrapper_document.hpp"
 #include "sql/wrapper_document_id.hpp"
+#include "sql/wrapper_future.hpp"
 
 #include <boost/uuid/uuid.hpp>            // uuid class
 #include <boost/uuid/uuid_generators.hpp> // generators
@@ -28,7 +29,8 @@ PYBIND11_MODULE(otterbrix, m) {
         .def(py::init([](const py::str& s) { return new wrapper_client(spaces::get_instance(std::string(s))); }))
         .def("__getitem__", &wrapper_client::get_or_create)
         .def("database_names", &wrapper_client::database_names)
-        .def("execute", &wrapper_client::execute, py::arg("query"));
+        .def("execute", &wrapper_client::execute, py::arg("query"))
+        .def("execute_async", &wrapper_client::execute_async, py::arg("query"));
 
     py::class_<wrapper_connection>(m, "Connection")
         .def(py::init([](wrapper_client* client) { return new wrapper_connection(client); }))
@@ -56,6 +58,7 @@ PYBIND11_MODULE(otterbrix, m) {
         .def("insert", &wrapper_collection::insert, py::arg("documents"))
         .def("insert_one", &wrapper_collection::insert_one, py::arg("document"))
         .def("insert_many", &wrapper_collection::insert_many, py::arg("documents"))
+        .def("append_arrow", &wrapper_collection::append_arrow, py::arg("data"))
         .def("update_one",
              &wrapper_collection::update_one,
              py::arg("filter"),
@@ -107,7 +110,13 @@ PYBIND11_MODULE(otterbrix, m) {
         //.def("paginate", &wrapper_cursor::paginate)
         //.def("_order", &wrapper_cursor::_order)
         .def("sort", &wrapper_cursor::sort, py::arg("key_or_list"), py::arg("direction") = py::none())
-        .def("execute", &wrapper_cursor::execute, py::arg("querry"));
+        .def("execute", &wrapper_cursor::execute, py::arg("querry"))
+        .def("to_arrow", &wrapper_cursor::to_arrow)
+        .def("__arrow_c_stream__", &wrapper_cursor::arrow_c_stream, py::arg("requested_schema") = py::none());
+
+    py::class_<wrapper_future, boost::intrusive_ptr<wrapper_future>>(m, "Future")
+        .def("done", &wrapper_future::done)
+        .def("result", &wrapper_future::result);
 
     m.def("to_aggregate", &test_to_statement);
 }
@@ -112,6 +112,13 @@ auto from_document(const element* value) -> py::object {
         case logical_type::INTEGER:
         case logical_type::BIGINT:
             return py::int_(value->get_int64().value());
+        case logical_type::HUGEINT:
+        case logical_type::UHUGEINT: {
+            // python ints are unbounded, the value goes through its decimal form
+            std::ostringstream stream;
+            stream << value->get_int128().value();
+            return py::int_(py::str(stream.str()));
+        }
         case logical_type::FLOAT:
         case logical_type::DOUBLE:
             return py::float_(value->get_double().value());
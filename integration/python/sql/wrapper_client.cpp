@@ -48,4 +48,11 @@ namespace otterbrix {
         return wrapper_cursor_ptr(
             new wrapper_cursor{ptr_->dispatcher()->execute_sql(session, query), ptr_->dispatcher()});
     }
+
+    wrapper_future_ptr wrapper_client::execute_async(const std::string& query) {
+        debug(log_, "wrapper_client::execute_async");
+        auto session = otterbrix::session_id_t();
+        return wrapper_future_ptr(
+            new wrapper_future{ptr_->dispatcher()->execute_sql_async(session, query), ptr_->dispatcher()});
+    }
 } // namespace otterbrix
@@ -18,6 +18,7 @@
 #include "integration/cpp/wrapper_dispatcher.hpp"
 #include "spaces.hpp"
 #include "wrapper_cursor.hpp"
+#include "wrapper_future.hpp"
 
 namespace py = pybind11;
 namespace otterbrix {
@@ -28,6 +29,7 @@ namespace otterbrix {
         wrapper_database_ptr get_or_create(const std::string& name);
         auto database_names() -> py::list;
         auto execute(const std::string& query) -> wrapper_cursor_ptr;
+        auto execute_async(const std::string& query) -> wrapper_future_ptr;
 
     private:
         friend class wrapper_connection;
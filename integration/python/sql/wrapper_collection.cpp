@@ -102,6 +102,32 @@ namespace otterbrix {
         return py::list();
     }
 
+    std::size_t wrapper_collection::append_arrow(const py::handle& data) {
+        trace(log_, "wrapper_collection::append_arrow");
+        if (!py::hasattr(data, "__arrow_c_stream__")) {
+            throw py::type_error("wrapper_collection::append_arrow: object does not export an arrow stream");
+        }
+        auto capsule = data.attr("__arrow_c_stream__")().cast<py::capsule>();
+        auto exported = static_cast<ArrowArrayStream*>(PyCapsule_GetPointer(capsule.ptr(), "arrow_array_stream"));
+        if (!exported) {
+            throw py::error_already_set();
+        }
+        // the stream is moved out, the capsule releases nothing then
+        ArrowArrayStream stream = *exported;
+        exported->release = nullptr;
+        components::cursor::cursor_t_ptr cur;
+        {
+            py::gil_scoped_release release;
+            cur = ptr_->append_arrow(otterbrix::session_id_t(), database_, name_, &stream);
+        }
+        if (cur->is_error()) {
+            debug(log_, "wrapper_collection::append_arrow has result error: {}", cur->get_error().what);
+            throw std::runtime_error("wrapper_collection::append_arrow: " + cur->get_error().what);
+        }
+        debug(log_, "wrapper_collection::append_arrow {} appended", cur->size());
+        return cur->size();
+    }
+
     wrapper_cursor_ptr wrapper_collection::update_one(py::object cond, py::object fields, bool upsert) {
         trace(log_, "wrapper_collection::update_one");
         if (py::isinstance<py::dict>(cond) && py::isinstance<py::dict>(fields)) {
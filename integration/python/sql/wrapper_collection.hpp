@@ -31,6 +31,8 @@ namespace otterbrix {
         py::list insert(const py::handle& documents);
         std::string insert_one(const py::handle& document);
         py::list insert_many(const py::handle& documents);
+        /// appends an object exporting an arrow stream (__arrow_c_stream__), e.g. a pyarrow table
+        std::size_t append_arrow(const py::handle& data);
         wrapper_cursor_ptr update_one(py::object cond, py::object fields, bool upsert = false);
         wrapper_cursor_ptr update_many(py::object cond, py::object fields, bool upsert = false);
         auto find(py::object cond) -> wrapper_cursor_ptr;
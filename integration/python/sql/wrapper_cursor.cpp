@@ -1,6 +1,10 @@
 #include "wrapper_cursor.hpp"
 #include "convert.hpp"
 
+#include <components/cursor/arrow_stream.hpp>
+
+#include <cstdint>
+
 // The bug related to the use of RTTI by the pybind11 library has been fixed: a
 // declaration should be in each translation unit.
 PYBIND11_DECLARE_HOLDER_TYPE(T, boost::intrusive_ptr<T>)
@@ -10,10 +14,11 @@ wrapper_cursor::wrapper_cursor(pointer cursor, otterbrix::wrapper_dispatcher_t*
     , dispatcher_(dispatcher) {}
 void wrapper_cursor::close() { close_ = true; }
 
-bool wrapper_cursor::has_next() { return ptr_->has_next(); }
+// a streamed table result holds only its current batch, the next one is pulled once it is read
+bool wrapper_cursor::has_next() { return ptr_->has_next() || ptr_->seek_batch(ptr_->batch_offset() + ptr_->size()); }
 
 wrapper_cursor& wrapper_cursor::next() {
-    if (!ptr_->next_document()) {
+    if (!has_next() || !ptr_->next_document()) {
         throw py::stop_iteration();
     }
     return *this;
@@ -21,7 +26,11 @@ wrapper_cursor& wrapper_cursor::next() {
 
 wrapper_cursor& wrapper_cursor::iter() { return *this; }
 
-std::size_t wrapper_cursor::size() { return ptr_->size(); }
+// the size of the whole result needs all of its batches
+std::size_t wrapper_cursor::size() {
+    ptr_->fetch_all();
+    return ptr_->size();
+}
 
 py::object wrapper_cursor::get(py::object key) {
     if (py::isinstance<py::str>(key)) {
@@ -99,6 +108,35 @@ void wrapper_cursor::execute(std::string& query) {
     ptr_ = dispatcher_->execute_sql(components::session::session_id_t(), query);
 }
 
+py::object wrapper_cursor::to_arrow() {
+    auto pyarrow = py::module_::import("pyarrow");
+    ArrowArrayStream stream;
+    components::cursor::to_arrow_stream(ptr_, &stream);
+    // the reader moves the stream out and releases it
+    auto reader = pyarrow.attr("RecordBatchReader").attr("_import_from_c")(reinterpret_cast<std::uintptr_t>(&stream));
+    return reader.attr("read_all")();
+}
+
+py::capsule wrapper_cursor::arrow_c_stream(py::object) {
+    auto stream = std::make_unique<ArrowArrayStream>();
+    components::cursor::to_arrow_stream(ptr_, stream.get());
+    return py::capsule(stream.release(), "arrow_array_stream", [](PyObject* capsule) {
+        auto stream = static_cast<ArrowArrayStream*>(PyCapsule_GetPointer(capsule, "arrow_array_stream"));
+        // a consumer that imported the stream has released it already
+        if (stream->release) {
+            stream->release(stream);
+        }
+        delete stream;
+    });
+}
+
 py::object wrapper_cursor::get_(const std::string& key) const { return from_object(ptr_->get_document(), key); }
 
-py::object wrapper_cursor::get_(std::size_t index) const { return from_document(ptr_->get_document(index)); }
+// index of the whole result, batches before the one holding it are released
+py::object wrapper_cursor::get_(std::size_t index) const {
+    if (!ptr_->seek_batch(index)) {
+        return py::none();
+    }
+    auto document = ptr_->get_document(index - ptr_->batch_offset());
+    return document ? from_document(document) : py::none();
+}
@@ -31,6 +31,10 @@ public:
     std::string print();
     wrapper_cursor& sort(py::object sorter, py::object order);
     void execute(std::string& query);
+    // table rows as a pyarrow.Table, batches are read through the arrow c stream interface
+    py::object to_arrow();
+    // arrow pycapsule protocol, the requested schema is ignored
+    py::capsule arrow_c_stream(py::object requested_schema);
 
     //paginate();
     //_order();
@@ -0,0 +1,29 @@
+#include "wrapper_future.hpp"
+
+#include <chrono>
+
+// The bug related to the use of RTTI by the pybind11 library has been fixed: a
+// declaration should be in each translation unit.
+PYBIND11_DECLARE_HOLDER_TYPE(T, boost::intrusive_ptr<T>)
+
+wrapper_future::wrapper_future(std::future<components::cursor::cursor_t_ptr> future,
+                               otterbrix::wrapper_dispatcher_t* dispatcher)
+    : future_(std::move(future))
+    , dispatcher_(dispatcher) {}
+
+bool wrapper_future::done() const {
+    return !future_.valid() || future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+wrapper_cursor_ptr wrapper_future::result() {
+    if (!future_.valid()) {
+        throw std::runtime_error("result is already taken");
+    }
+    components::cursor::cursor_t_ptr cursor;
+    {
+        // other python threads can run while the query is executed
+        py::gil_scoped_release release;
+        cursor = future_.get();
+    }
+    return wrapper_cursor_ptr(new wrapper_cursor(std::move(cursor), dispatcher_));
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <components/cursor/cursor.hpp>
+
+#include <future>
+
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+#include <boost/smart_ptr/intrusive_ref_counter.hpp>
+
+#include <pybind11/pybind11.h>
+
+#include "wrapper_cursor.hpp"
+#include <integration/cpp/wrapper_dispatcher.hpp>
+
+namespace py = pybind11;
+
+// result of a query executed without waiting, the cursor is taken once
+class PYBIND11_EXPORT wrapper_future final : public boost::intrusive_ref_counter<wrapper_future> {
+public:
+    wrapper_future(std::future<components::cursor::cursor_t_ptr> future, otterbrix::wrapper_dispatcher_t* dispatcher);
+
+    bool done() const;
+    wrapper_cursor_ptr result();
+
+private:
+    std::future<components::cursor::cursor_t_ptr> future_;
+    otterbrix::wrapper_dispatcher_t* dispatcher_;
+};
+
+using wrapper_future_ptr = boost::intrusive_ptr<wrapper_future>;
@@ -0,0 +1,68 @@
+import os
+import pytest
+from otterbrix import Client
+
+pa = pytest.importorskip("pyarrow")
+
+client = Client(os.getcwd() + "/test_arrow")
+client["schema"]
+
+
+def gen_id(num):
+    res = str(num)
+    while (len(res) < 24):
+        res = '0' + res
+    return res
+
+def test_cursor_to_arrow():
+    c = client.execute("CREATE TABLE schema.arrow_table();")
+    assert c.is_success()
+    c.close()
+
+    query = "INSERT INTO schema.arrow_table (_id, name, count) VALUES "
+    for num in range(0, 100):
+        query += "('" + gen_id(num + 1) + "', 'Name " + str(num) + "', " + str(num) + ")"
+        if num == 99:
+            query += ";"
+        else:
+            query += ", "
+    c = client.execute(query)
+    assert len(c) == 100
+    c.close()
+
+    c = client.execute("SELECT * FROM schema.arrow_table WHERE count > 89;")
+    table = c.to_arrow()
+    assert table.num_rows == 10
+    assert sorted(table.column("count").to_pylist()) == list(range(90, 100))
+    c.close()
+
+    # any consumer of the arrow pycapsule stream protocol
+    c = client.execute("SELECT * FROM schema.arrow_table;")
+    table = pa.RecordBatchReader.from_stream(c).read_all()
+    assert table.num_rows == 100
+    assert set(table.column_names) == {"_id", "name", "count"}
+    c.close()
+
+def test_append_arrow():
+    c = client.execute("CREATE TABLE schema.arrow_append(name string, count int);")
+    assert c.is_success()
+    c.close()
+
+    # columns are matched by name, batches are larger than a vector
+    batches = []
+    for start in range(0, 15000, 5000):
+        counts = list(range(start, start + 5000))
+        batches.append(pa.record_batch([pa.array(counts, pa.int32()),
+                                        pa.array(["Name " + str(num) for num in counts])],
+                                       names=["count", "name"]))
+    appended = client["schema"]["arrow_append"].append_arrow(pa.Table.from_batches(batches))
+    assert appended == 15000
+
+    c = client.execute("SELECT * FROM schema.arrow_append WHERE count > 14989;")
+    table = c.to_arrow()
+    assert table.num_rows == 10
+    assert sorted(table.column("name").to_pylist()) == sorted("Name " + str(num) for num in range(14990, 15000))
+    c.close()
+
+    with pytest.raises(RuntimeError):
+        client["schema"]["arrow_append"].append_arrow(pa.table({"other": pa.array([1, 2, 3], pa.int32())}))
@@ -70,4 +70,18 @@ def test_collection_sql():
 
     c = client.execute("SELECT * FROM schema.table WHERE count = 1000;")
     assert len(c) == 20
-    c.close()
\ No newline at end of file
+    c.close()
+
+def test_collection_sql_async():
+    futures = [
+        client.execute_async("SELECT * FROM schema.table WHERE count > 50;"),
+        client.execute_async("SELECT * FROM schema.table WHERE count = 1000;"),
+        client.execute_async("SELECT * FROM schema.table WHERE count < 30;"),
+    ]
+    sizes = []
+    for f in futures:
+        c = f.result()
+        assert f.done()
+        sizes.append(len(c))
+        c.close()
+    assert sizes == [40, 20, 10]
@@ -5,6 +5,7 @@
 
 #include <core/btree/btree.hpp>
 #include <core/pmr.hpp>
+#include <core/thread_pool/thread_pool.hpp>
 
 #include <components/context/context.hpp>
 #include <components/cursor/cursor.hpp>
@@ -16,6 +17,7 @@
 #include <components/table/data_table.hpp>
 #include <components/table/storage/buffer_pool.hpp>
 #include <components/table/storage/in_memory_block_manager.hpp>
+#include <components/table/storage/meta_block.hpp>
 #include <components/table/storage/standard_buffer_manager.hpp>
 
 #include <utility>
@@ -53,6 +55,17 @@ namespace services::collection {
             , block_manager_(buffer_manager_, components::table::storage::DEFAULT_BLOCK_ALLOC_SIZE)
             , table_(std::make_unique<components::table::data_table_t>(resource, block_manager_, std::move(columns))) {}
 
+        // restores the table written by data_table_t::checkpoint() at `root` of `checkpoint`
+        explicit table_storage_t(std::pmr::memory_resource* resource,
+                                 components::table::storage::block_manager_t& checkpoint,
+                                 components::table::storage::meta_block_pointer_t root)
+            : buffer_pool_(resource, uint64_t(1) << 32, false, uint64_t(1) << 24)
+            , buffer_manager_(resource, fs_, buffer_pool_)
+            , block_manager_(buffer_manager_, components::table::storage::DEFAULT_BLOCK_ALLOC_SIZE) {
+            components::table::storage::metadata_reader_t reader(checkpoint, root);
+            table_ = components::table::data_table_t::load(resource, block_manager_, reader);
+        }
+
         components::table::data_table_t& table() { return *table_; }
 
     private:
@@ -72,7 +85,8 @@ namespace services::collection {
         explicit context_collection_t(std::pmr::memory_resource* resource,
                                       const collection_full_name_t& name,
                                       const actor_zeta::address_t& mdisk,
-                                      const log_t& log)
+                                      const log_t& log,
+                                      core::thread_pool_t* scan_pool = nullptr)
             : resource_(resource)
             , document_storage_(resource_)
             , table_storage_(resource_)
@@ -80,6 +94,7 @@ namespace services::collection {
             , name_(name)
             , mdisk_(mdisk)
             , log_(log)
+            , scan_pool_(scan_pool)
             , uses_datatable_(false) {
             assert(resource != nullptr);
         }
@@ -88,7 +103,8 @@ namespace services::collection {
                                       const collection_full_name_t& name,
                                       std::vector<components::table::column_definition_t> columns,
                                       const actor_zeta::address_t& mdisk,
-                                      const log_t& log)
+                                      const log_t& log,
+                                      core::thread_pool_t* scan_pool = nullptr)
             : resource_(resource)
             , document_storage_(resource_)
             , table_storage_(resource_, std::move(columns))
@@ -96,6 +112,26 @@ namespace services::collection {
             , name_(name)
             , mdisk_(mdisk)
             , log_(log)
+            , scan_pool_(scan_pool)
+            , uses_datatable_(true) {
+            assert(resource != nullptr);
+        }
+
+        explicit context_collection_t(std::pmr::memory_resource* resource,
+                                      const collection_full_name_t& name,
+                                      components::table::storage::block_manager_t& checkpoint,
+                                      components::table::storage::meta_block_pointer_t root,
+                                      const actor_zeta::address_t& mdisk,
+                                      const log_t& log,
+                                      core::thread_pool_t* scan_pool = nullptr)
+            : resource_(resource)
+            , document_storage_(resource_)
+            , table_storage_(resource_, checkpoint, root)
+            , index_engine_(core::pmr::make_unique<components::index::index_engine_t>(resource_))
+            , name_(name)
+            , mdisk_(mdisk)
+            , log_(log)
+            , scan_pool_(scan_pool)
             , uses_datatable_(true) {
             assert(resource != nullptr);
         }
@@ -111,6 +147,9 @@ namespace services::collection {
 
         log_t& log() noexcept { return log_; }
 
+        // workers of morsel-driven scans and aggregations, null runs them on the executor thread
+        core::thread_pool_t* scan_pool() const noexcept { return scan_pool_; }
+
         const collection_full_name_t& name() const noexcept { return name_; }
 
         sessions::sessions_storage_t& sessions() noexcept { return sessions_; }
@@ -142,6 +181,7 @@ namespace services::collection {
         sessions::sessions_storage_t sessions_;
         actor_zeta::address_t mdisk_;
         log_t log_;
+        core::thread_pool_t* scan_pool_;
 
         bool uses_datatable_;
         bool dropped_{false};
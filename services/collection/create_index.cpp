@@ -35,11 +35,15 @@ namespace services::collection::executor {
                                          context_collection_t* collection) {
         debug(log_, "collection::create_index_finish");
         auto& create_index = sessions::find(collection->sessions(), session, name).get<sessions::create_index_t>();
-        components::index::set_disk_agent(collection->index_engine(), create_index.id_index, index_address);
+        auto* index = components::index::search_index(collection->index_engine(), create_index.id_index);
+        // composite indexes are memory only, they are rebuilt from documents
+        const bool is_memory_only = index->type() == index_type::composite || index->type() == index_type::multikey;
+        if (!is_memory_only) {
+            components::index::set_disk_agent(collection->index_engine(), create_index.id_index, index_address);
+        }
         components::index::insert(collection->index_engine(), create_index.id_index, collection->document_storage());
         // TODO: revisit filling index_disk
-        if (index_address != actor_zeta::address_t::empty_address()) {
-            auto* index = components::index::search_index(collection->index_engine(), create_index.id_index);
+        if (!is_memory_only && index_address != actor_zeta::address_t::empty_address()) {
             auto range = index->keys();
             std::vector<std::pair<components::document::value_t, document_id_t>> values;
             values.reserve(collection->document_storage().size());
@@ -48,7 +48,10 @@ namespace services::collection::executor {
         , index_find_finish_(actor_zeta::make_behavior(resource(),
                                                        handler_id(index::route::success_find),
                                                        this,
-                                                       &executor_t::index_find_finish)) {}
+                                                       &executor_t::index_find_finish))
+        , fetch_chunk_(
+              actor_zeta::make_behavior(resource(), handler_id(route::fetch_chunk), this, &executor_t::fetch_chunk)) {
+    }
 
     actor_zeta::behavior_t executor_t::behavior() {
         return actor_zeta::make_behavior(resource(), [this](actor_zeta::message* msg) -> void {
@@ -77,6 +80,10 @@ namespace services::collection::executor {
                     index_find_finish_(msg);
                     break;
                 }
+                case handler_id(route::fetch_chunk): {
+                    fetch_chunk_(msg);
+                    break;
+                }
             }
         });
     }
@@ -95,11 +102,13 @@ namespace services::collection::executor {
         if (data_format == components::catalog::used_format_t::documents) {
             plan = collection::planner::create_plan(context_storage,
                                                     logical_plan,
-                                                    components::logical_plan::limit_t::unlimit());
+                                                    components::logical_plan::limit_t::unlimit(),
+                                                    &parameters);
         } else if (data_format == components::catalog::used_format_t::columns) {
             plan = table::planner::create_plan(context_storage,
                                                logical_plan,
-                                               components::logical_plan::limit_t::unlimit());
+                                               components::logical_plan::limit_t::unlimit(),
+                                               &parameters);
         }
 
         if (!plan) {
@@ -111,6 +120,11 @@ namespace services::collection::executor {
             return;
         }
         plan->set_as_root();
+        if (data_format == components::catalog::used_format_t::columns &&
+            plan->type() == components::collection::operators::operator_type::aggregate) {
+            // table results are sent by batches, the rest is fetched by the cursor on demand
+            plan->set_streaming();
+        }
         traverse_plan_(session, std::move(plan), std::move(parameters), std::move(context_storage));
     }
 
@@ -130,6 +144,32 @@ namespace services::collection::executor {
         actor_zeta::send(current_message()->sender(), address(), handler_id(route::create_documents_finish), session);
     }
 
+    void executor_t::fetch_chunk(const components::session::session_id_t& session, context_collection_t* collection) {
+        trace(log_, "executor_t::fetch_chunk, session: {}", session.data());
+        auto it = collection->sessions().find(sessions::session_key_t{session, sessions::stream_session_name});
+        if (it == collection->sessions().end()) {
+            actor_zeta::send(current_message()->sender(),
+                             address(),
+                             handler_id(route::fetch_chunk_finish),
+                             session,
+                             make_cursor(resource(), error_code_t::other_error, "cursor is closed"));
+            return;
+        }
+        auto& stream = it->second.get<sessions::stream_plan_t>();
+        components::pipeline::context_t pipeline_context{session, address(), memory_storage_, stream.parameters};
+        stream.plan->next_chunk(&pipeline_context);
+        auto cursor = make_cursor(resource(), std::move(stream.plan->output()->data_chunk()));
+        cursor->set_has_next_chunk(stream.plan->has_next_chunk());
+        if (!cursor->has_next_chunk()) {
+            collection->sessions().erase(it);
+        }
+        actor_zeta::send(current_message()->sender(),
+                         address(),
+                         handler_id(route::fetch_chunk_finish),
+                         session,
+                         std::move(cursor));
+    }
+
     void executor_t::traverse_plan_(const components::session::session_id_t& session,
                                     components::collection::operators::operator_ptr&& plan,
                                     components::logical_plan::storage_parameters&& parameters,
@@ -279,7 +319,15 @@ namespace services::collection::executor {
                 if (plan->output()) {
                     chunk = std::move(plan->output()->data_chunk());
                 }
-                execute_sub_plan_finish_(session, make_cursor(resource(), std::move(chunk)));
+                auto cursor = make_cursor(resource(), std::move(chunk));
+                if (plan->has_next_chunk()) {
+                    cursor->set_has_next_chunk(true);
+                    sessions::make_session(collection->sessions(),
+                                           session,
+                                           sessions::stream_session_name,
+                                           sessions::stream_plan_t{std::move(plan), plans_.at(session).parameters});
+                }
+                execute_sub_plan_finish_(session, std::move(cursor));
             } else {
                 std::pmr::vector<document_ptr> docs;
                 if (plan->output()) {
@@ -45,6 +45,7 @@ namespace services::collection::executor {
         void index_find_finish(const session_id_t& session,
                                const std::pmr::vector<document_id_t>& result,
                                context_collection_t* collection);
+        void fetch_chunk(const session_id_t& session, context_collection_t* collection);
 
         auto make_type() const noexcept -> const char* const;
         actor_zeta::behavior_t behavior();
@@ -93,6 +94,7 @@ namespace services::collection::executor {
         actor_zeta::behavior_t create_index_finish_index_exist_;
         actor_zeta::behavior_t index_modify_finish_;
         actor_zeta::behavior_t index_find_finish_;
+        actor_zeta::behavior_t fetch_chunk_;
     };
 
     using executor_ptr = std::unique_ptr<executor_t, actor_zeta::pmr::deleter_t>;
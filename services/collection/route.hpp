@@ -14,12 +14,14 @@ namespace services::collection {
         close_cursor,
         drop_collection,
         drop_index,
+        fetch_chunk,
         create_documents_finish,
         execute_plan_finish,
         size_finish,
         schema_finish,
         create_index_finish,
         drop_collection_finish,
+        fetch_chunk_finish,
     };
 
     constexpr uint64_t handler_id(route type) { return handler_id(group_id_t::collection, type); }
@@ -2,6 +2,7 @@
 
 #include "create_index.hpp"
 #include "session_type.hpp"
+#include "stream_plan.hpp"
 #include "suspend_plan.hpp"
 #include <components/session/session.hpp>
 #include <variant>
@@ -25,7 +26,7 @@ namespace services::collection::sessions {
     private:
         type_t type_;
 
-        std::variant<create_index_t, suspend_plan_t> data_;
+        std::variant<create_index_t, suspend_plan_t, stream_plan_t> data_;
     };
 
     struct session_key_t {
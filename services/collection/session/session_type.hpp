@@ -6,6 +6,7 @@ namespace services::collection::sessions {
     {
         create_index,
         suspend_plan,
+        stream_plan,
     };
 
     template<typename T>
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "session_type.hpp"
+#include <components/logical_plan/param_storage.hpp>
+#include <components/physical_plan/base/operators/operator.hpp>
+
+namespace services::collection::sessions {
+
+    // executed plan with the rest of its output not sent to the client yet
+    struct stream_plan_t : public session_base_t<stream_plan_t> {
+        components::collection::operators::operator_ptr plan;
+        components::logical_plan::storage_parameters parameters;
+
+        stream_plan_t(components::collection::operators::operator_ptr&& plan,
+                      components::logical_plan::storage_parameters parameters)
+            : plan(std::move(plan))
+            , parameters(std::move(parameters)) {}
+
+        static type_t type_impl() { return type_t::stream_plan; }
+    };
+
+    constexpr const char* stream_session_name = "stream";
+
+} // namespace services::collection::sessions
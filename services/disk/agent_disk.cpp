@@ -91,6 +91,7 @@ namespace services::disk {
                 disk_.load_documents(database.name, collection.name, collection.documents);
             }
         }
+        disk_.load_tables(result);
         actor_zeta::send(dispatcher, address(), handler_id(route::load_finish), session, result);
     }
 
@@ -2,12 +2,14 @@
 #include <components/document/msgpack/msgpack_encoder.hpp>
 
 #include "core/b_plus_tree/msgpack_reader/msgpack_reader.hpp"
+#include <components/table/storage/meta_block.hpp>
 
 namespace services::disk {
 
     using namespace core::filesystem;
 
     constexpr static std::string_view base_index_name = "base_index";
+    constexpr static std::string_view tables_file_name = "TABLES";
 
     auto key_getter = [](const core::b_plus_tree::btree_t::item_data& item) -> core::b_plus_tree::btree_t::index_t {
         msgpack::unpacked msg;
@@ -23,7 +25,9 @@ namespace services::disk {
         , fs_(core::filesystem::local_file_system_t())
         , db_(resource_)
         , metadata_(nullptr)
-        , file_wal_id_(nullptr) {
+        , file_wal_id_(nullptr)
+        , tables_buffer_pool_(resource, uint64_t(1) << 32, false, uint64_t(1) << 24)
+        , tables_buffer_manager_(resource, fs_, tables_buffer_pool_) {
         create_directories(storage_directory);
         metadata_ = metadata_t::open(fs_, storage_directory / "METADATA");
         file_wal_id_ = open_file(fs_,
@@ -39,6 +43,16 @@ namespace services::disk {
                 db_[{database, collection}]->load();
             }
         }
+
+        tables_ = std::make_unique<components::table::storage::single_file_block_manager_t>(
+            tables_buffer_manager_,
+            storage_directory / tables_file_name);
+        if (file_exists(fs_, storage_directory / tables_file_name)) {
+            tables_->load_existing_database();
+            read_tables_directory();
+        } else {
+            tables_->create_new_database();
+        }
     }
 
     void disk_t::save_document(const database_name_t& database,
@@ -142,4 +156,71 @@ namespace services::disk {
 
     wal::id_t disk_t::wal_id() const { return wal::id_from_string(file_wal_id_->read_line()); }
 
+    void disk_t::load_tables(result_load_t& result) {
+        for (const auto& entry : table_entries_) {
+            auto database = std::find_if((*result).begin(), (*result).end(), [&entry](const auto& database) {
+                return database.name == entry.name.database;
+            });
+            if (database == (*result).end()) {
+                continue;
+            }
+            components::table::storage::metadata_reader_t reader(*tables_, entry.root);
+            result_collection_t collection{entry.name.collection,
+                                           std::pmr::vector<document_ptr>(resource_),
+                                           {},
+                                           entry.root};
+            for (auto& column : components::table::data_table_t::load_columns(reader)) {
+                collection.schema.emplace_back(column.type());
+            }
+            database->collections.emplace_back(std::move(collection));
+        }
+        result.set_tables(tables_.get(), tables_->wal_id());
+    }
+
+    void disk_t::checkpoint_tables(components::table::storage::single_file_block_manager_t& block_manager,
+                                   const checkpoint_tables_t& tables,
+                                   wal::id_t wal_id) {
+        std::vector<table_entry_t> entries;
+        entries.reserve(tables.size());
+        for (const auto& [name, table] : tables) {
+            components::table::storage::metadata_writer_t writer(block_manager);
+            table->checkpoint(writer);
+            writer.flush();
+            entries.push_back({name, writer.root()});
+        }
+
+        components::table::storage::metadata_writer_t directory(block_manager);
+        directory.write<uint64_t>(entries.size());
+        for (const auto& entry : entries) {
+            directory.write_string(entry.name.database);
+            directory.write_string(entry.name.collection);
+            directory.write(entry.root);
+        }
+        directory.flush();
+        block_manager.write_header(directory.root(), wal_id);
+        block_manager.truncate();
+    }
+
+    void disk_t::read_tables_directory() {
+        table_entries_.clear();
+        if (tables_->meta_block() == components::table::storage::INVALID_INDEX) {
+            return;
+        }
+        components::table::storage::metadata_reader_t directory(
+            *tables_,
+            components::table::storage::meta_block_pointer_t(tables_->meta_block(), 0));
+        auto count = directory.read<uint64_t>();
+        table_entries_.reserve(count);
+        for (uint64_t i = 0; i < count; i++) {
+            table_entry_t entry;
+            entry.name.database = directory.read_string();
+            entry.name.collection = directory.read_string();
+            entry.root = directory.read<components::table::storage::meta_block_pointer_t>();
+            for (auto block_id : components::table::storage::metadata_reader_t::chain(*tables_, entry.root)) {
+                tables_->mark_as_used(block_id);
+            }
+            table_entries_.emplace_back(std::move(entry));
+        }
+    }
+
 } //namespace services::disk
\ No newline at end of file
@@ -1,11 +1,16 @@
 #pragma once
 #include <components/document/document.hpp>
 #include <components/document/document_id.hpp>
+#include <components/table/data_table.hpp>
+#include <components/table/storage/buffer_pool.hpp>
+#include <components/table/storage/single_file_block_manager.hpp>
+#include <components/table/storage/standard_buffer_manager.hpp>
 #include <core/b_plus_tree/b_plus_tree.hpp>
 #include <filesystem>
 #include <wal/base.hpp>
 
 #include "metadata.hpp"
+#include "result.hpp"
 
 #include <components/base/collection_full_name.hpp>
 
@@ -17,6 +22,7 @@ namespace services::disk {
     using components::document::document_ptr;
     using file_ptr = std::unique_ptr<core::filesystem::file_handle_t>;
     using btree_ptr = std::unique_ptr<core::b_plus_tree::btree_t>;
+    using checkpoint_tables_t = std::vector<std::pair<collection_full_name_t, components::table::data_table_t*>>;
 
     // TODO: add checkpoints to avoid flushing b+tree after each call
     class disk_t {
@@ -50,13 +56,31 @@ namespace services::disk {
         void fix_wal_id(wal::id_t wal_id);
         wal::id_t wal_id() const;
 
+        // adds table collections of the last checkpoint to `result`, after that the block manager
+        // belongs to the owner of the tables and is only written through checkpoint_tables()
+        void load_tables(result_load_t& result);
+        static void checkpoint_tables(components::table::storage::single_file_block_manager_t& block_manager,
+                                      const checkpoint_tables_t& tables,
+                                      wal::id_t wal_id);
+
     private:
+        struct table_entry_t {
+            collection_full_name_t name;
+            components::table::storage::meta_block_pointer_t root;
+        };
+
+        void read_tables_directory();
+
         path_t path_;
         std::pmr::memory_resource* resource_;
         core::filesystem::local_file_system_t fs_;
         std::pmr::unordered_map<collection_full_name_t, btree_ptr, collection_name_hash> db_;
         metadata_ptr metadata_;
         file_ptr file_wal_id_;
+        components::table::storage::buffer_pool_t tables_buffer_pool_;
+        components::table::storage::standard_buffer_manager_t tables_buffer_manager_;
+        std::unique_ptr<components::table::storage::single_file_block_manager_t> tables_;
+        std::vector<table_entry_t> table_entries_;
     };
 
 } //namespace services::disk
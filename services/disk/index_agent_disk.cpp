@@ -16,10 +16,16 @@ namespace services::disk {
                                             handler_id(index::route::insert),
                                             this,
                                             &index_agent_disk_t::insert))
+        , insert_many_(actor_zeta::make_behavior(resource(),
+                                                 handler_id(index::route::insert_many),
+                                                 this,
+                                                 &index_agent_disk_t::insert_many))
         , remove_(actor_zeta::make_behavior(resource(),
                                             handler_id(index::route::remove),
                                             this,
                                             &index_agent_disk_t::remove))
+        , flush_(
+              actor_zeta::make_behavior(resource(), handler_id(index::route::flush), this, &index_agent_disk_t::flush))
         , find_(actor_zeta::make_behavior(resource(), handler_id(index::route::find), this, &index_agent_disk_t::find))
         , drop_(actor_zeta::make_behavior(resource(), handler_id(index::route::drop), this, &index_agent_disk_t::drop))
         , log_(log.clone())
@@ -39,10 +45,18 @@ namespace services::disk {
                     insert_(msg);
                     break;
                 }
+                case handler_id(index::route::insert_many): {
+                    insert_many_(msg);
+                    break;
+                }
                 case handler_id(index::route::remove): {
                     remove_(msg);
                     break;
                 }
+                case handler_id(index::route::flush): {
+                    flush_(msg);
+                    break;
+                }
                 case handler_id(index::route::find): {
                     find_(msg);
                     break;
@@ -86,9 +100,7 @@ namespace services::disk {
     void index_agent_disk_t::insert_many(const session_id_t& session,
                                          const std::vector<std::pair<value_t, document_id_t>>& values) {
         trace(log_, "index_agent_disk_t::insert_many: {}, session: {}", values.size(), session.data());
-        for (const auto& [key, value] : values) {
-            index_disk_->insert(key, value);
-        }
+        index_disk_->insert_many(values);
         actor_zeta::send(current_message()->sender(),
                          address(),
                          index::handler_id(index::route::success),
@@ -106,6 +118,13 @@ namespace services::disk {
                          collection_);
     }
 
+    void index_agent_disk_t::flush() {
+        trace(log_, "index_agent_disk_t::flush");
+        if (!is_dropped_) {
+            index_disk_->flush();
+        }
+    }
+
     void index_agent_disk_t::find(const session_id_t& session,
                                   const value_t& value,
                                   components::expressions::compare_type compare) {
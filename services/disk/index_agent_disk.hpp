@@ -43,6 +43,7 @@ namespace services::disk {
         void insert(const session_id_t& session, const value_t& key, const document_id_t& value);
         void insert_many(const session_id_t& session, const std::vector<std::pair<value_t, document_id_t>>& values);
         void remove(const session_id_t& session, const value_t& key, const document_id_t& value);
+        void flush();
         void find(const session_id_t& session, const value_t& value, components::expressions::compare_type compare);
 
         auto make_type() const noexcept -> const char* const;
@@ -51,7 +52,9 @@ namespace services::disk {
     private:
         // Behaviors
         actor_zeta::behavior_t insert_;
+        actor_zeta::behavior_t insert_many_;
         actor_zeta::behavior_t remove_;
+        actor_zeta::behavior_t flush_;
         actor_zeta::behavior_t find_;
         actor_zeta::behavior_t drop_;
 
@@ -2,6 +2,8 @@
 
 #include <msgpack/msgpack_encoder.hpp>
 
+#include <algorithm>
+
 #include "core/b_plus_tree/msgpack_reader/msgpack_reader.hpp"
 
 namespace services::disk {
@@ -61,50 +63,88 @@ namespace services::disk {
         }
     }
 
-    index_disk_t::index_disk_t(const path_t& path, std::pmr::memory_resource* resource)
+    index_disk_t::index_disk_t(const path_t& path, std::pmr::memory_resource* resource, size_t batch_size)
         : path_(path)
         , resource_(resource)
         , fs_(core::filesystem::local_file_system_t())
-        , db_(std::make_unique<btree_t>(resource, fs_, path, item_key_getter)) {
+        , db_(std::make_unique<btree_t>(resource, fs_, path, item_key_getter))
+        , batch_size_(batch_size) {
         db_->load();
     }
 
-    index_disk_t::~index_disk_t() = default;
+    index_disk_t::~index_disk_t() {
+        if (db_) {
+            flush();
+        }
+    }
 
     void index_disk_t::insert(const value_t& key, const document_id_t& value) {
-        auto values = find(key);
-        if (std::find(values.begin(), values.end(), value) == values.end()) {
-            values.push_back(value);
-            msgpack::sbuffer sbuf;
-            msgpack::packer packer(sbuf);
-            packer.pack_array(2);
-            packer.pack(key);
-            packer.pack(value.to_string());
-            db_->append(data_ptr_t(sbuf.data()), sbuf.size());
-            db_->flush();
+        append_mutation(key, value, true);
+        if (mutations_.size() >= batch_size_) {
+            flush();
         }
     }
 
+    void index_disk_t::insert_many(const std::vector<std::pair<value_t, document_id_t>>& values) {
+        mutations_.reserve(mutations_.size() + values.size());
+        for (const auto& [key, value] : values) {
+            append_mutation(key, value, true);
+        }
+        flush();
+    }
+
     void index_disk_t::remove(value_t key) {
+        apply_mutations();
         db_->remove_index(convert(key));
-        db_->flush();
+        dirty_ = true;
     }
 
     void index_disk_t::remove(const value_t& key, const document_id_t& doc) {
-        auto values = find(key);
-        if (!values.empty()) {
-            values.erase(std::remove(values.begin(), values.end(), doc), values.end());
-            msgpack::sbuffer sbuf;
-            msgpack::packer packer(sbuf);
-            packer.pack_array(2);
-            packer.pack(key);
-            packer.pack(doc.to_string());
-            db_->remove(data_ptr_t(sbuf.data()), sbuf.size());
+        append_mutation(key, doc, false);
+        if (mutations_.size() >= batch_size_) {
+            flush();
+        }
+    }
+
+    void index_disk_t::flush() {
+        apply_mutations();
+        if (dirty_) {
             db_->flush();
+            dirty_ = false;
+        }
+    }
+
+    void index_disk_t::append_mutation(const value_t& key, const document_id_t& doc, bool is_insert) {
+        msgpack::sbuffer sbuf;
+        msgpack::packer packer(sbuf);
+        packer.pack_array(2);
+        packer.pack(key);
+        packer.pack(doc.to_string());
+        mutations_.push_back({convert(key), std::string(sbuf.data(), sbuf.size()), is_insert});
+    }
+
+    void index_disk_t::apply_mutations() const {
+        if (mutations_.empty()) {
+            return;
+        }
+        // neighbouring keys land in the same leaves, mutations of a single key keep their order;
+        // the tree itself ignores duplicates and removal of missing items
+        std::stable_sort(mutations_.begin(), mutations_.end(), [](const mutation_t& lhs, const mutation_t& rhs) {
+            return lhs.index < rhs.index;
+        });
+        for (auto& mutation : mutations_) {
+            if (mutation.is_insert) {
+                db_->append(data_ptr_t(mutation.item.data()), mutation.item.size());
+            } else {
+                db_->remove(data_ptr_t(mutation.item.data()), mutation.item.size());
+            }
         }
+        mutations_.clear();
+        dirty_ = true;
     }
 
     void index_disk_t::find(const value_t& value, result& res) const {
+        apply_mutations();
         auto index = convert(value);
         size_t count = db_->item_count(index);
         res.reserve(count);
@@ -120,6 +160,7 @@ namespace services::disk {
     }
 
     void index_disk_t::lower_bound(const value_t& value, result& res) const {
+        apply_mutations();
         auto max_index = convert(value);
         db_->scan_ascending(
             std::numeric_limits<btree_t::index_t>::min(),
@@ -140,6 +181,7 @@ namespace services::disk {
     }
 
     void index_disk_t::upper_bound(const value_t& value, result& res) const {
+        apply_mutations();
         auto min_index = convert(value);
         db_->scan_decending(
             convert(value),
@@ -160,6 +202,7 @@ namespace services::disk {
     }
 
     void index_disk_t::drop() {
+        mutations_.clear();
         db_.reset();
         core::filesystem::remove_directory(fs_, path_);
     }
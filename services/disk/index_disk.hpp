@@ -7,10 +7,13 @@
 
 #include <filesystem>
 #include <memory_resource>
+#include <vector>
 
 namespace services::disk {
 
-    // TODO: add checkpoints to avoid flushing b+tree after each call
+    // mutations are buffered and applied to the b+tree sorted by key in one pass, the tree is flushed once per
+    // applied batch, on flush() and on destruction; a disk index is refilled from its collection on load,
+    // so buffered mutations are not lost on a crash (documents themselves are recovered from the wal)
     class index_disk_t {
         using document_id_t = components::document::document_id_t;
         using value_t = components::types::logical_value_t;
@@ -19,10 +22,15 @@ namespace services::disk {
     public:
         using result = std::pmr::vector<document_id_t>;
 
-        index_disk_t(const path_t& path, std::pmr::memory_resource* resource);
+        static constexpr size_t DEFAULT_BATCH_SIZE = 4096;
+
+        index_disk_t(const path_t& path,
+                     std::pmr::memory_resource* resource,
+                     size_t batch_size = DEFAULT_BATCH_SIZE);
         ~index_disk_t();
 
         void insert(const value_t& key, const document_id_t& value);
+        void insert_many(const std::vector<std::pair<value_t, document_id_t>>& values);
         void remove(value_t key);
         void remove(const value_t& key, const document_id_t& doc);
         void find(const value_t& value, result& res) const;
@@ -32,13 +40,27 @@ namespace services::disk {
         void upper_bound(const value_t& value, result& res) const;
         result upper_bound(const value_t& value) const;
 
+        void flush();
         void drop();
 
     private:
+        struct mutation_t {
+            core::b_plus_tree::btree_t::index_t index;
+            std::string item;
+            bool is_insert;
+        };
+
+        void append_mutation(const value_t& key, const document_id_t& doc, bool is_insert);
+        void apply_mutations() const;
+
         std::filesystem::path path_;
         std::pmr::memory_resource* resource_;
         core::filesystem::local_file_system_t fs_;
         std::unique_ptr<core::b_plus_tree::btree_t> db_;
+        size_t batch_size_;
+        // reads apply pending mutations first
+        mutable std::vector<mutation_t> mutations_;
+        mutable bool dirty_{false};
     };
 
 } // namespace services::disk
@@ -69,6 +69,8 @@ namespace services::disk {
                                                       this,
                                                       &manager_disk_t::remove_documents))
         , flush_(actor_zeta::make_behavior(resource(), handler_id(route::flush), this, &manager_disk_t::flush))
+        , checkpoint_(
+              actor_zeta::make_behavior(resource(), handler_id(route::checkpoint), this, &manager_disk_t::checkpoint))
         , create_(actor_zeta::make_behavior(resource(),
                                             handler_id(index::route::create),
                                             this,
@@ -147,6 +149,10 @@ namespace services::disk {
                     flush_(msg);
                     break;
                 }
+                case handler_id(route::checkpoint): {
+                    checkpoint_(msg);
+                    break;
+                }
                 case index::handler_id(index::route::create): {
                     create_(msg);
                     break;
@@ -286,9 +292,32 @@ namespace services::disk {
             }
             commands_.erase(session);
         }
+        fixed_wal_id_ = wal_id;
         actor_zeta::send(agent(), address(), handler_id(route::fix_wal_id), wal_id);
     }
 
+    auto manager_disk_t::checkpoint(wal::id_t wal_id) -> void {
+        if (config_.checkpoint_wal_records == 0 || !memory_storage_) {
+            return;
+        }
+        // the first id seen after start is the baseline, tables loaded from the last checkpoint are not written again
+        if (!last_checkpoint_wal_id_) {
+            last_checkpoint_wal_id_ = wal_id;
+        } else if (wal_id >= *last_checkpoint_wal_id_ + config_.checkpoint_wal_records) {
+            trace(log_, "manager_disk_t::checkpoint , wal_id : {}", wal_id);
+            last_checkpoint_wal_id_ = wal_id;
+            for (const auto& index : index_agents_) {
+                actor_zeta::send(index.second->address(), address(), index::handler_id(index::route::flush));
+            }
+            // the dispatcher starts the checkpoint of the tables once no plan waits for the wal,
+            // the wal is truncated up to the records stored both on disk and in the checkpoint
+            actor_zeta::send(current_message()->sender(),
+                             address(),
+                             handler_id(route::checkpoint_ready),
+                             fixed_wal_id_);
+        }
+    }
+
     void manager_disk_t::create_index_agent(const session_id_t& session,
                                             const components::logical_plan::node_create_index_ptr& index,
                                             services::collection::context_collection_t* collection) {
@@ -507,6 +536,7 @@ namespace services::disk {
                 case handler_id(route::write_documents):
                 case handler_id(route::remove_documents):
                 case handler_id(route::flush):
+                case handler_id(route::checkpoint):
                 case index::handler_id(index::route::drop):
                 case index::handler_id(index::route::success):
                 default: {
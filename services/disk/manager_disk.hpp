@@ -5,6 +5,7 @@
 #include <components/configuration/configuration.hpp>
 #include <components/log/log.hpp>
 #include <core/excutor.hpp>
+#include <optional>
 
 namespace services::collection {
     class context_collection_t;
@@ -21,10 +22,12 @@ namespace services::disk {
         enum class unpack_rules : uint64_t
         {
             manager_wal = 0,
+            memory_storage = 1,
         };
 
         void sync(address_pack& pack) {
             manager_wal_ = std::get<static_cast<uint64_t>(unpack_rules::manager_wal)>(pack);
+            memory_storage_ = std::get<static_cast<uint64_t>(unpack_rules::memory_storage)>(pack);
         }
 
         manager_disk_t(std::pmr::memory_resource*,
@@ -64,6 +67,8 @@ namespace services::disk {
 
         auto flush(const session_id_t& session, wal::id_t wal_id) -> void;
 
+        auto checkpoint(wal::id_t wal_id) -> void;
+
         void create_index_agent(const session_id_t& session,
                                 const components::logical_plan::node_create_index_ptr& index,
                                 services::collection::context_collection_t* collection);
@@ -85,6 +90,7 @@ namespace services::disk {
         actor_zeta::behavior_t write_documents_;
         actor_zeta::behavior_t remove_documents_;
         actor_zeta::behavior_t flush_;
+        actor_zeta::behavior_t checkpoint_;
         actor_zeta::behavior_t create_;
         actor_zeta::behavior_t drop_;
         actor_zeta::behavior_t success_;
@@ -93,6 +99,7 @@ namespace services::disk {
         spin_lock lock_;
 
         actor_zeta::address_t manager_wal_ = actor_zeta::address_t::empty_address();
+        actor_zeta::address_t memory_storage_ = actor_zeta::address_t::empty_address();
         log_t log_;
         core::filesystem::local_file_system_t fs_;
         configuration::config_disk config_;
@@ -101,6 +108,9 @@ namespace services::disk {
         command_storage_t commands_;
         file_ptr metafile_indexes_;
         session_id_t load_session_;
+        std::optional<wal::id_t> last_checkpoint_wal_id_;
+        // the last id sent to the agent by flush, wal records up to it are stored on disk
+        wal::id_t fixed_wal_id_{0};
 
         struct removed_index_t {
             std::size_t size;
@@ -15,7 +15,7 @@ namespace services::disk {
         collections.resize(names.size());
         std::size_t i = 0;
         for (const auto& name : names) {
-            collections[i++] = {name, {}};
+            collections[i++] = {name, {}, {}, {}};
         }
     }
 
@@ -50,10 +50,21 @@ namespace services::disk {
     void result_load_t::clear() {
         databases_.clear();
         wal_id_ = 0;
+        tables_ = nullptr;
+        tables_wal_id_ = 0;
     }
 
     wal::id_t result_load_t::wal_id() const { return wal_id_; }
 
+    components::table::storage::single_file_block_manager_t* result_load_t::tables() const { return tables_; }
+
+    wal::id_t result_load_t::tables_wal_id() const { return tables_wal_id_; }
+
+    void result_load_t::set_tables(components::table::storage::single_file_block_manager_t* tables, wal::id_t wal_id) {
+        tables_ = tables;
+        tables_wal_id_ = wal_id;
+    }
+
     result_load_t::result_t& result_load_t::operator*() { return databases_; }
 
     result_load_t result_load_t::empty() {
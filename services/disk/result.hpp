@@ -2,6 +2,8 @@
 
 #include <components/base/collection_full_name.hpp>
 #include <components/document/document.hpp>
+#include <components/table/storage/single_file_block_manager.hpp>
+#include <components/types/types.hpp>
 #include <services/wal/base.hpp>
 #include <vector>
 
@@ -10,6 +12,9 @@ namespace services::disk {
     struct result_collection_t {
         collection_name_t name;
         std::pmr::vector<components::document::document_ptr> documents;
+        // set for table collections restored from the last checkpoint
+        std::vector<components::types::complex_logical_type> schema;
+        components::table::storage::meta_block_pointer_t table_root;
     };
 
     struct result_database_t {
@@ -34,11 +39,18 @@ namespace services::disk {
 
         wal::id_t wal_id() const;
 
+        // checkpointed tables are read and written through this block manager, it is owned by the disk agent
+        components::table::storage::single_file_block_manager_t* tables() const;
+        wal::id_t tables_wal_id() const;
+        void set_tables(components::table::storage::single_file_block_manager_t* tables, wal::id_t wal_id);
+
         static result_load_t empty();
 
     private:
         result_t databases_;
         wal::id_t wal_id_{0};
+        components::table::storage::single_file_block_manager_t* tables_{nullptr};
+        wal::id_t tables_wal_id_{0};
     };
 
 } // namespace services::disk
@@ -21,7 +21,10 @@ namespace services::disk {
         remove_documents,
 
         flush,
-        fix_wal_id
+        fix_wal_id,
+
+        checkpoint,
+        checkpoint_ready
     };
 
     constexpr auto handler_id(route type) { return handler_id(group_id_t::disk, type); }
@@ -187,3 +187,38 @@ TEST_CASE("index_disk::multi_values::int32") {
     REQUIRE(index.lower_bound(logical_value_t(10l)).size() == 70);
     REQUIRE(index.upper_bound(logical_value_t(90l)).size() == 75);
 }
+
+TEST_CASE("index_disk::batches") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto tape = std::make_unique<impl::base_document>(&resource);
+
+    std::filesystem::path path{"/tmp/index_disk/batches"};
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+
+    {
+        auto index = index_disk_t(path, &resource, 16);
+        std::vector<std::pair<logical_value_t, document_id_t>> values;
+        for (int i = 100; i > 0; --i) {
+            values.emplace_back(logical_value_t(int64_t(i % 10)), document_id_t{gen_id(i, &resource)});
+        }
+        index.insert_many(values);
+        REQUIRE(index.find(logical_value_t(1l)).size() == 10);
+
+        // pending mutations are visible to reads and keep their order
+        index.insert(logical_value_t(int64_t(20)), document_id_t{gen_id(200, &resource)});
+        index.insert(logical_value_t(int64_t(20)), document_id_t{gen_id(201, &resource)});
+        index.remove(logical_value_t(int64_t(20)), document_id_t{gen_id(200, &resource)});
+        index.insert(logical_value_t(int64_t(1)), document_id_t{gen_id(1, &resource)});
+        REQUIRE(index.find(logical_value_t(20l)).size() == 1);
+        REQUIRE(index.find(logical_value_t(20l)).front() == document_id_t{gen_id(201, &resource)});
+        REQUIRE(index.find(logical_value_t(1l)).size() == 10);
+
+        index.remove(logical_value_t(int64_t(3)), document_id_t{gen_id(3, &resource)});
+    }
+
+    auto index = index_disk_t(path, &resource);
+    REQUIRE(index.find(logical_value_t(3l)).size() == 9);
+    REQUIRE(index.find(logical_value_t(20l)).size() == 1);
+    REQUIRE(index.lower_bound(logical_value_t(5l)).size() == 49);
+}
@@ -4,7 +4,9 @@
 #include <core/tracy/tracy.hpp>
 
 #include <components/document/document.hpp>
+#include <components/logical_plan/node_data.hpp>
 #include <components/planner/planner.hpp>
+#include <components/serialization/serializer.hpp>
 
 #include <services/collection/route.hpp>
 #include <services/disk/manager_disk.hpp>
@@ -20,6 +22,34 @@ using namespace components::types;
 
 namespace services::dispatcher {
 
+    namespace {
+
+        // inserted rows are written to the wal as raw column buffers, the other column types are rejected up front
+        cursor_t_ptr check_wal_columns(std::pmr::memory_resource* resource, const node_ptr& plan) {
+            if (plan->type() != node_type::insert_t) {
+                return nullptr;
+            }
+            for (const auto& child : plan->children()) {
+                if (child->type() != node_type::data_t) {
+                    continue;
+                }
+                const auto& data = reinterpret_cast<const node_data_ptr&>(child);
+                if (!data->uses_data_chunk()) {
+                    continue;
+                }
+                for (const auto& column : data->data_chunk().data) {
+                    if (!components::serializer::is_serializable_column(column.type())) {
+                        return make_cursor(resource,
+                                           error_code_t::schema_error,
+                                           "insert: type of column \"" + column.type().alias() + "\" is not supported");
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+    } // namespace
+
     dispatcher_t::dispatcher_t(manager_dispatcher_t* manager_dispatcher,
                                actor_zeta::address_t& mstorage,
                                actor_zeta::address_t& mwal,
@@ -60,6 +90,14 @@ namespace services::dispatcher {
                                                  collection::handler_id(collection::route::size_finish),
                                                  this,
                                                  &dispatcher_t::size_finish))
+        , fetch_chunk_(actor_zeta::make_behavior(resource(),
+                                                 collection::handler_id(collection::route::fetch_chunk),
+                                                 this,
+                                                 &dispatcher_t::fetch_chunk))
+        , fetch_chunk_finish_(actor_zeta::make_behavior(resource(),
+                                                        collection::handler_id(collection::route::fetch_chunk_finish),
+                                                        this,
+                                                        &dispatcher_t::fetch_chunk_finish))
         , close_cursor_(actor_zeta::make_behavior(resource(),
                                                   collection::handler_id(collection::route::close_cursor),
                                                   this,
@@ -68,8 +106,22 @@ namespace services::dispatcher {
                                                  wal::handler_id(wal::route::success),
                                                  this,
                                                  &dispatcher_t::wal_success))
+        , wal_error_(actor_zeta::make_behavior(resource(),
+                                               wal::handler_id(wal::route::error),
+                                               this,
+                                               &dispatcher_t::wal_error))
+        , checkpoint_ready_(actor_zeta::make_behavior(resource(),
+                                                      disk::handler_id(disk::route::checkpoint_ready),
+                                                      this,
+                                                      &dispatcher_t::checkpoint_ready))
+        , checkpoint_finish_(
+              actor_zeta::make_behavior(resource(),
+                                        memory_storage::handler_id(memory_storage::route::checkpoint_finish),
+                                        this,
+                                        &dispatcher_t::checkpoint_finish))
         , log_(log.clone())
         , catalog_(resource())
+        , statistics_(resource(), catalog_)
         , manager_dispatcher_(manager_dispatcher->address())
         , memory_storage_(mstorage)
         , manager_wal_(mwal)
@@ -121,6 +173,14 @@ namespace services::dispatcher {
                     size_finish_(msg);
                     break;
                 }
+                case collection::handler_id(collection::route::fetch_chunk): {
+                    fetch_chunk_(msg);
+                    break;
+                }
+                case collection::handler_id(collection::route::fetch_chunk_finish): {
+                    fetch_chunk_finish_(msg);
+                    break;
+                }
                 case collection::handler_id(collection::route::close_cursor): {
                     close_cursor_(msg);
                     break;
@@ -129,6 +189,18 @@ namespace services::dispatcher {
                     wal_success_(msg);
                     break;
                 }
+                case wal::handler_id(wal::route::error): {
+                    wal_error_(msg);
+                    break;
+                }
+                case disk::handler_id(disk::route::checkpoint_ready): {
+                    checkpoint_ready_(msg);
+                    break;
+                }
+                case memory_storage::handler_id(memory_storage::route::checkpoint_finish): {
+                    checkpoint_finish_(msg);
+                    break;
+                }
             }
         });
     }
@@ -163,14 +235,26 @@ namespace services::dispatcher {
     void dispatcher_t::load_from_memory_storage_result(const components::session::session_id_t& session) {
         trace(log_, "dispatcher_t::load_from_memory_storage_result, session: {}", session.data());
         actor_zeta::send(manager_disk_, address(), disk::handler_id(disk::route::load_indexes), session);
-        actor_zeta::send(manager_wal_, address(), wal::handler_id(wal::route::load), session, load_result_.wal_id());
+        load_disk_wal_id_ = load_result_.wal_id();
+        load_tables_wal_id_ = load_result_.tables() ? load_result_.tables_wal_id() : load_disk_wal_id_;
+        actor_zeta::send(manager_wal_,
+                         address(),
+                         wal::handler_id(wal::route::load),
+                         session,
+                         std::min(load_disk_wal_id_, load_tables_wal_id_));
         for (const auto& database : (*load_result_)) {
             collection_full_name_t name;
             name.database = database.name;
             catalog_.create_namespace({database.name.c_str()});
             for (const auto& collection : database.collections) {
-                auto err = catalog_.create_computing_table({resource(), {database.name, collection.name}});
-                assert(!err);
+                if (collection.schema.empty()) {
+                    auto err = catalog_.create_computing_table({resource(), {database.name, collection.name}});
+                    assert(!err);
+                    statistics_.set_cardinality({database.name, collection.name}, collection.documents.size());
+                } else {
+                    load_tables_.emplace(database.name, collection.name);
+                    create_catalog_table({resource(), {database.name, collection.name}}, collection.schema);
+                }
             }
         }
         load_result_.clear();
@@ -179,7 +263,16 @@ namespace services::dispatcher {
     void dispatcher_t::load_from_wal_result(const components::session::session_id_t& session,
                                             std::vector<services::wal::record_t>& in_records) {
         // TODO think what to do with records
-        records_ = std::move(in_records);
+        if (!in_records.empty()) {
+            last_wal_id_ = in_records.back().id;
+        }
+        records_.clear();
+        for (auto& record : in_records) {
+            if (replay_record(record)) {
+                records_.emplace_back(std::move(record));
+            }
+        }
+        load_tables_.clear();
         load_count_answers_ = records_.size();
         trace(log_,
               "dispatcher_t::load_from_wal_result, session: {}, count commands: {}",
@@ -194,7 +287,6 @@ namespace services::dispatcher {
             remove_session(session_to_address_, session);
             return;
         }
-        last_wal_id_ = records_[load_count_answers_ - 1].id;
         for (auto& record : records_) {
             switch (record.data->type()) {
                 case node_type::create_database_t: {
@@ -244,6 +336,20 @@ namespace services::dispatcher {
         }
     }
 
+    bool dispatcher_t::replay_record(const services::wal::record_t& record) {
+        // table collections are restored from the checkpoint, documents from the disk,
+        // so the records of each kind are replayed only past their own watermark
+        auto name = record.data->collection_full_name();
+        if (record.data->type() == node_type::create_collection_t &&
+            !reinterpret_cast<const node_create_collection_ptr&>(record.data)->schema().empty()) {
+            load_tables_.emplace(name.database, name.collection);
+        }
+        if (load_tables_.count({name.database, name.collection})) {
+            return record.id > load_tables_wal_id_;
+        }
+        return record.id > load_disk_wal_id_;
+    }
+
     void dispatcher_t::execute_plan(const components::session::session_id_t& session,
                                     components::logical_plan::node_ptr plan,
                                     parameter_node_ptr params,
@@ -277,6 +383,8 @@ namespace services::dispatcher {
                 auto check_result = check_collections_format_(plan);
                 if (check_result->is_error()) {
                     error = std::move(check_result);
+                } else if (auto columns_error = check_wal_columns(resource(), plan); columns_error) {
+                    error = std::move(columns_error);
                 } else {
                     used_format = check_result->uses_table_data() ? used_format_t::columns : used_format_t::documents;
                 }
@@ -334,17 +442,22 @@ namespace services::dispatcher {
                 case node_type::drop_database_t: {
                     trace(log_, "dispatcher_t::execute_plan_finish: {}", to_string(plan->type()));
                     catalog_.drop_namespace(table_id(resource(), plan->collection_full_name()).get_namespace());
+                    statistics_.drop_database(plan->database_name());
                     break;
                 }
 
                 case node_type::create_collection_t: {
                     trace(log_, "dispatcher_t::execute_plan_finish: {}", to_string(plan->type()));
-                    actor_zeta::send(manager_disk_,
-                                     dispatcher_t::address(),
-                                     disk::handler_id(disk::route::append_collection),
-                                     session,
-                                     plan->database_name(),
-                                     plan->collection_name());
+                    statistics_.set_cardinality(plan->collection_full_name(), 0);
+                    // table collections are stored by checkpoints, not as documents
+                    if (reinterpret_cast<node_create_collection_ptr&>(plan)->schema().empty()) {
+                        actor_zeta::send(manager_disk_,
+                                         dispatcher_t::address(),
+                                         disk::handler_id(disk::route::append_collection),
+                                         session,
+                                         plan->database_name(),
+                                         plan->collection_name());
+                    }
                     if (find_session(session_to_address_, session).address().get() == manager_wal_.get()) {
                         wal_success(session, last_wal_id_);
                     } else {
@@ -360,6 +473,7 @@ namespace services::dispatcher {
 
                 case node_type::insert_t: {
                     trace(log_, "dispatcher_t::execute_plan_finish: {}", to_string(plan->type()));
+                    statistics_.add_documents(plan->collection_full_name(), result->size());
                     if (s.address().get() == manager_wal_.get()) {
                         wal_success(session, last_wal_id_);
                     } else {
@@ -393,6 +507,7 @@ namespace services::dispatcher {
 
                 case node_type::delete_t: {
                     trace(log_, "dispatcher_t::execute_plan_finish: {}", to_string(plan->type()));
+                    statistics_.remove_documents(plan->collection_full_name(), result->size());
                     if (s.address().get() == manager_wal_.get()) {
                         wal_success(session, last_wal_id_);
                     } else {
@@ -411,6 +526,7 @@ namespace services::dispatcher {
                 case node_type::drop_collection_t: {
                     trace(log_, "dispatcher_t::execute_plan_finish: {}", to_string(plan->type()));
                     collection_full_name_t name(plan->database_name(), plan->collection_name());
+                    statistics_.drop_collection(name);
                     actor_zeta::send(manager_disk_,
                                      dispatcher_t::address(),
                                      disk::handler_id(disk::route::remove_collection),
@@ -483,6 +599,7 @@ namespace services::dispatcher {
         auto error = check_collectction_exists({resource(), {database_name, collection}});
         if (error) {
             size_finish(session, std::move(error));
+            return;
         }
         actor_zeta::send(memory_storage_,
                          dispatcher_t::address(),
@@ -501,15 +618,42 @@ namespace services::dispatcher {
         remove_session(session_to_address_, session);
     }
 
+    void dispatcher_t::fetch_chunk(const components::session::session_id_t& session,
+                                   actor_zeta::base::address_t sender) {
+        trace(log_, "dispatcher_t::fetch_chunk session: {}", session.data());
+        make_session(session_to_address_, session, session_t(std::move(sender)));
+        actor_zeta::send(memory_storage_,
+                         dispatcher_t::address(),
+                         collection::handler_id(collection::route::fetch_chunk),
+                         session);
+    }
+
+    void dispatcher_t::fetch_chunk_finish(const components::session::session_id_t& session, cursor_t_ptr result) {
+        trace(log_,
+              "dispatcher_t::fetch_chunk_finish session: {}, size: {}, has next: {}",
+              session.data(),
+              result->size(),
+              result->has_next_chunk());
+        actor_zeta::send(find_session(session_to_address_, session).address(),
+                         dispatcher_t::address(),
+                         handler_id(route::execute_plan_finish),
+                         session,
+                         std::move(result));
+        remove_session(session_to_address_, session);
+    }
+
     void dispatcher_t::close_cursor(const components::session::session_id_t& session) {
         trace(log_, " dispatcher_t::close_cursor ");
         trace(log_, "Session : {}", session.data());
         auto it = cursor_.find(session);
         if (it != cursor_.end()) {
             cursor_.erase(it);
-        } else {
-            error(log_, "Not find session : {}", session.data());
         }
+        // releases batches of a streamed result left in the storage
+        actor_zeta::send(memory_storage_,
+                         dispatcher_t::address(),
+                         collection::handler_id(collection::route::close_cursor),
+                         session);
     }
 
     void dispatcher_t::wal_success(const components::session::session_id_t& session, services::wal::id_t wal_id) {
@@ -527,6 +671,14 @@ namespace services::dispatcher {
         auto session_obj = find_session(session_to_address_, session);
         update_catalog(session_obj.node());
         actor_zeta::send(manager_disk_, dispatcher_t::address(), disk::handler_id(disk::route::flush), session, wal_id);
+        last_wal_id_ = std::max(last_wal_id_, wal_id);
+        // a checkpoint must not contain changes of plans which are not in the wal yet
+        if (!has_pending_plans(session)) {
+            actor_zeta::send(manager_disk_, dispatcher_t::address(), disk::handler_id(disk::route::checkpoint), wal_id);
+            if (checkpoint_pending_) {
+                start_checkpoint();
+            }
+        }
 
         const bool is_from_wal = session_obj.address().get() == manager_wal_.get();
         if (is_from_wal) {
@@ -544,6 +696,63 @@ namespace services::dispatcher {
         result_storage_.erase(session);
     }
 
+    void dispatcher_t::wal_error(const components::session::session_id_t& session, services::wal::id_t wal_id) {
+        trace(log_, "dispatcher_t::wal_error session : {}, wal id: {}", session.data(), wal_id);
+        // the change stays in memory and in the catalog like after a success, only the answer differs
+        if (is_session_exist(session_to_address_, session)) {
+            result_storage_[session] =
+                make_cursor(resource(), error_code_t::other_error, "wal: the record could not be synced to disk");
+        }
+        wal_success(session, wal_id);
+    }
+
+    void dispatcher_t::checkpoint_ready(services::wal::id_t disk_wal_id) {
+        trace(log_, "dispatcher_t::checkpoint_ready disk wal id: {}", disk_wal_id);
+        disk_wal_id_ = std::max(disk_wal_id_, disk_wal_id);
+        checkpoint_pending_ = true;
+        // plans sent before are applied, otherwise the checkpoint waits for the next wal_success without them
+        if (!has_pending_plans(components::session::session_id_t())) {
+            start_checkpoint();
+        }
+    }
+
+    void dispatcher_t::start_checkpoint() {
+        // records replayed from the wal are not all applied yet
+        if (load_count_answers_ > 0) {
+            return;
+        }
+        // plans reach the storage in the order they are sent, so the tables are written with the plans
+        // up to last_wal_id_ and without the later ones
+        checkpoint_pending_ = false;
+        actor_zeta::send(memory_storage_,
+                         dispatcher_t::address(),
+                         memory_storage::handler_id(memory_storage::route::checkpoint),
+                         dispatcher_t::address(),
+                         last_wal_id_);
+    }
+
+    void dispatcher_t::checkpoint_finish(services::wal::id_t wal_id) {
+        trace(log_, "dispatcher_t::checkpoint_finish wal id: {}, disk wal id: {}", wal_id, disk_wal_id_);
+        // records of document collections are needed until the disk stores them
+        actor_zeta::send(manager_wal_,
+                         dispatcher_t::address(),
+                         wal::handler_id(wal::route::truncate),
+                         std::min(wal_id, disk_wal_id_));
+    }
+
+    bool dispatcher_t::has_pending_plans(const components::session::session_id_t& session) {
+        for (auto& [key, s] : session_to_address_) {
+            if (key.id == session) {
+                continue;
+            }
+            // sessions of replayed records stay here after wal_success
+            if (s.node() && s.address().get() != manager_wal_.get()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     // TODO separate change logic and condition check
     bool dispatcher_t::load_from_wal_in_progress(const components::session::session_id_t& session) {
         if (find_session(session_to_address_, session).address().get() == manager_wal_.get()) {
@@ -657,10 +866,21 @@ namespace services::dispatcher {
 
     components::logical_plan::node_ptr dispatcher_t::create_logic_plan(components::logical_plan::node_ptr plan) {
         //todo: cache logical plans
-        components::planner::planner_t planner;
+        components::planner::planner_t planner(&statistics_);
         return planner.create_plan(resource(), std::move(plan));
     }
 
+    void dispatcher_t::create_catalog_table(const table_id& id, std::vector<complex_logical_type> columns) {
+        std::vector<components::types::field_description> desc;
+        desc.reserve(columns.size());
+        for (size_t i = 0; i < columns.size(); desc.push_back(components::types::field_description(i++)))
+            ;
+
+        auto sch = schema(resource(), components::catalog::create_struct(std::move(columns), std::move(desc)));
+        auto err = catalog_.create_table(id, table_metadata(resource(), std::move(sch)));
+        assert(!err);
+    }
+
     void dispatcher_t::update_catalog(components::logical_plan::node_ptr node) {
         table_id id(resource(), node->collection_full_name());
         switch (node->type()) {
@@ -676,19 +896,9 @@ namespace services::dispatcher {
                     auto err = catalog_.create_computing_table(id);
                     assert(!err);
                 } else {
-                    std::vector<components::types::field_description> desc;
-                    desc.reserve(node_info->schema().size());
-                    for (size_t i = 0; i < node_info->schema().size();
-                         desc.push_back(components::types::field_description(i++)))
-                        ;
-
-                    auto sch = schema(
-                        resource(),
-                        components::catalog::create_struct(
-                            std::vector<complex_logical_type>(node_info->schema().begin(), node_info->schema().end()),
-                            std::move(desc)));
-                    auto err = catalog_.create_table(id, table_metadata(resource(), std::move(sch)));
-                    assert(!err);
+                    create_catalog_table(
+                        id,
+                        std::vector<complex_logical_type>(node_info->schema().begin(), node_info->schema().end()));
                 }
                 break;
             }
@@ -774,6 +984,10 @@ namespace services::dispatcher {
                                             collection::handler_id(collection::route::schema),
                                             this,
                                             &manager_dispatcher_t::get_schema))
+        , fetch_chunk_(actor_zeta::make_behavior(resource(),
+                                                 collection::handler_id(collection::route::fetch_chunk),
+                                                 this,
+                                                 &manager_dispatcher_t::fetch_chunk))
         , close_cursor_(actor_zeta::make_behavior(resource(),
                                                   collection::handler_id(collection::route::close_cursor),
                                                   this,
@@ -820,6 +1034,10 @@ namespace services::dispatcher {
                     schema_(msg);
                     break;
                 }
+                case collection::handler_id(collection::route::fetch_chunk): {
+                    fetch_chunk_(msg);
+                    break;
+                }
                 case collection::handler_id(collection::route::close_cursor): {
                     close_cursor_(msg);
                     break;
@@ -920,7 +1138,19 @@ namespace services::dispatcher {
                          make_cursor(resource(), std::move(schemas)));
     }
 
-    void manager_dispatcher_t::close_cursor(const components::session::session_id_t&) {}
+    void manager_dispatcher_t::fetch_chunk(const components::session::session_id_t& session) {
+        trace(log_, "manager_dispatcher_t::fetch_chunk session: {}", session.data());
+        actor_zeta::send(dispatcher(),
+                         address(),
+                         collection::handler_id(collection::route::fetch_chunk),
+                         session,
+                         current_message()->sender());
+    }
+
+    void manager_dispatcher_t::close_cursor(const components::session::session_id_t& session) {
+        trace(log_, "manager_dispatcher_t::close_cursor session: {}", session.data());
+        actor_zeta::send(dispatcher(), address(), collection::handler_id(collection::route::close_cursor), session);
+    }
 
     const components::catalog::catalog& manager_dispatcher_t::current_catalog() {
         return dispatchers_[0]->current_catalog();
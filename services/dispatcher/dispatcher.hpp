@@ -1,6 +1,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <unordered_set>
 #include <variant>
 
 #include <actor-zeta.hpp>
@@ -22,6 +23,7 @@
 
 #include "route.hpp"
 #include "session.hpp"
+#include "statistics.hpp"
 
 namespace services::dispatcher {
 
@@ -62,8 +64,16 @@ namespace services::dispatcher {
                   std::string& collection,
                   actor_zeta::base::address_t sender);
         void size_finish(const components::session::session_id_t&, components::cursor::cursor_t_ptr&& cursor);
+        void fetch_chunk(const components::session::session_id_t& session, actor_zeta::base::address_t sender);
+        void fetch_chunk_finish(const components::session::session_id_t& session,
+                                components::cursor::cursor_t_ptr cursor);
         void close_cursor(const components::session::session_id_t& session);
         void wal_success(const components::session::session_id_t& session, services::wal::id_t wal_id);
+        // the plan is applied but its wal record was not synced, the sender gets an error instead of the result
+        void wal_error(const components::session::session_id_t& session, services::wal::id_t wal_id);
+        // the disk asks for a checkpoint of the tables, wal records up to `disk_wal_id` are stored on disk
+        void checkpoint_ready(services::wal::id_t disk_wal_id);
+        void checkpoint_finish(services::wal::id_t wal_id);
         bool load_from_wal_in_progress(const components::session::session_id_t& session);
 
         const components::catalog::catalog& current_catalog();
@@ -79,11 +89,17 @@ namespace services::dispatcher {
         actor_zeta::behavior_t execute_plan_delete_finish_;
         actor_zeta::behavior_t size_;
         actor_zeta::behavior_t size_finish_;
+        actor_zeta::behavior_t fetch_chunk_;
+        actor_zeta::behavior_t fetch_chunk_finish_;
         actor_zeta::behavior_t close_cursor_;
         actor_zeta::behavior_t wal_success_;
+        actor_zeta::behavior_t wal_error_;
+        actor_zeta::behavior_t checkpoint_ready_;
+        actor_zeta::behavior_t checkpoint_finish_;
 
         log_t log_;
         components::catalog::catalog catalog_;
+        catalog_statistics_t statistics_;
         actor_zeta::address_t manager_dispatcher_;
         actor_zeta::address_t memory_storage_;
         actor_zeta::address_t manager_wal_;
@@ -97,6 +113,13 @@ namespace services::dispatcher {
         components::session::session_id_t load_session_;
         services::wal::id_t last_wal_id_{0};
         std::size_t load_count_answers_{0};
+        // wal records up to these ids are already stored on disk / in the tables checkpoint
+        services::wal::id_t load_disk_wal_id_{0};
+        services::wal::id_t load_tables_wal_id_{0};
+        // reported by the disk with a due checkpoint, the wal is truncated no further than it
+        services::wal::id_t disk_wal_id_{0};
+        bool checkpoint_pending_{false};
+        std::unordered_set<collection_full_name_t, collection_name_hash> load_tables_;
 
         components::cursor::cursor_t_ptr check_namespace_exists(const components::catalog::table_id id);
         components::cursor::cursor_t_ptr check_collectction_exists(const components::catalog::table_id id);
@@ -105,6 +128,11 @@ namespace services::dispatcher {
 
         components::logical_plan::node_ptr create_logic_plan(components::logical_plan::node_ptr plan);
         void update_catalog(components::logical_plan::node_ptr node);
+        void create_catalog_table(const components::catalog::table_id& id,
+                                  std::vector<components::types::complex_logical_type> columns);
+        bool replay_record(const services::wal::record_t& record);
+        bool has_pending_plans(const components::session::session_id_t& session);
+        void start_checkpoint();
         // TODO figure out what to do with records
         std::vector<services::wal::record_t> records_;
     };
@@ -150,6 +178,7 @@ namespace services::dispatcher {
                           components::logical_plan::parameter_node_ptr params);
         void
         size(const components::session::session_id_t& session, std::string& database_name, std::string& collection);
+        void fetch_chunk(const components::session::session_id_t& session);
         void close_cursor(const components::session::session_id_t& session);
 
         const components::catalog::catalog& current_catalog();
@@ -167,6 +196,7 @@ namespace services::dispatcher {
         actor_zeta::behavior_t execute_plan_;
         actor_zeta::behavior_t size_;
         actor_zeta::behavior_t schema_;
+        actor_zeta::behavior_t fetch_chunk_;
         actor_zeta::behavior_t close_cursor_;
         actor_zeta::behavior_t sync_;
 
@@ -0,0 +1,73 @@
+#include "statistics.hpp"
+
+#include <algorithm>
+
+namespace services::dispatcher {
+
+    namespace {
+
+        collection_full_name_t normalize(const collection_full_name_t& collection) {
+            return {collection.database, collection.collection};
+        }
+
+    } // namespace
+
+    catalog_statistics_t::catalog_statistics_t(std::pmr::memory_resource* resource,
+                                               components::catalog::catalog& catalog)
+        : resource_(resource)
+        , catalog_(catalog) {}
+
+    std::optional<uint64_t> catalog_statistics_t::cardinality(const collection_full_name_t& collection) const {
+        auto it = cardinalities_.find(normalize(collection));
+        if (it == cardinalities_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    std::optional<bool> catalog_statistics_t::has_field(const collection_full_name_t& collection,
+                                                        const std::string& field) const {
+        components::catalog::table_id id(resource_, normalize(collection));
+        std::pmr::string name(field, resource_);
+        if (catalog_.table_computes(id)) {
+            return !catalog_.get_computing_table_schema(id).find_field_versions(name).empty();
+        }
+        if (catalog_.table_exists(id)) {
+            return catalog_.get_table_schema(id).get_field_description(name).has_value();
+        }
+        return std::nullopt;
+    }
+
+    void catalog_statistics_t::set_cardinality(const collection_full_name_t& collection, uint64_t count) {
+        cardinalities_[normalize(collection)] = count;
+    }
+
+    void catalog_statistics_t::add_documents(const collection_full_name_t& collection, uint64_t count) {
+        auto it = cardinalities_.find(normalize(collection));
+        if (it != cardinalities_.end()) {
+            it->second += count;
+        }
+    }
+
+    void catalog_statistics_t::remove_documents(const collection_full_name_t& collection, uint64_t count) {
+        auto it = cardinalities_.find(normalize(collection));
+        if (it != cardinalities_.end()) {
+            it->second -= std::min(it->second, count);
+        }
+    }
+
+    void catalog_statistics_t::drop_collection(const collection_full_name_t& collection) {
+        cardinalities_.erase(normalize(collection));
+    }
+
+    void catalog_statistics_t::drop_database(const database_name_t& database) {
+        for (auto it = cardinalities_.begin(); it != cardinalities_.end();) {
+            if (it->first.database == database) {
+                it = cardinalities_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+} // namespace services::dispatcher
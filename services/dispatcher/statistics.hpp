@@ -0,0 +1,31 @@
+#pragma once
+
+#include <unordered_map>
+
+#include <components/catalog/catalog.hpp>
+#include <components/planner/statistics.hpp>
+
+namespace services::dispatcher {
+
+    // planner statistics backed by the dispatcher catalog and document counts of executed writes
+    class catalog_statistics_t final : public components::planner::statistics_t {
+    public:
+        catalog_statistics_t(std::pmr::memory_resource* resource, components::catalog::catalog& catalog);
+
+        std::optional<uint64_t> cardinality(const collection_full_name_t& collection) const override;
+        std::optional<bool> has_field(const collection_full_name_t& collection,
+                                      const std::string& field) const override;
+
+        void set_cardinality(const collection_full_name_t& collection, uint64_t count);
+        void add_documents(const collection_full_name_t& collection, uint64_t count);
+        void remove_documents(const collection_full_name_t& collection, uint64_t count);
+        void drop_collection(const collection_full_name_t& collection);
+        void drop_database(const database_name_t& database);
+
+    private:
+        std::pmr::memory_resource* resource_;
+        components::catalog::catalog& catalog_;
+        std::unordered_map<collection_full_name_t, uint64_t, collection_name_hash> cardinalities_;
+    };
+
+} // namespace services::dispatcher
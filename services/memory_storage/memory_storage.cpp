@@ -1,5 +1,6 @@
 #include "memory_storage.hpp"
 #include "route.hpp"
+#include <algorithm>
 #include <cassert>
 #include <components/logical_plan/node_create_collection.hpp>
 #include <components/logical_plan/node_data.hpp>
@@ -7,6 +8,7 @@
 #include <core/system_command.hpp>
 #include <core/tracy/tracy.hpp>
 #include <services/collection/collection.hpp>
+#include <services/disk/disk.hpp>
 #include <utility>
 
 using namespace components::cursor;
@@ -20,15 +22,21 @@ namespace services {
         : collections(resource) {}
     memory_storage_t::memory_storage_t(std::pmr::memory_resource* o_resource,
                                        actor_zeta::scheduler_raw scheduler,
-                                       log_t& log)
+                                       log_t& log,
+                                       const configuration::config_executor& config)
         : actor_zeta::cooperative_supervisor<memory_storage_t>(o_resource)
         , e_(scheduler)
         , databases_(resource())
         , collections_(resource())
         , log_(log.clone())
+        , scan_pool_(config.scan_threads)
         , sync_(
               actor_zeta::make_behavior(resource(), core::handler_id(core::route::sync), this, &memory_storage_t::sync))
         , load_(actor_zeta::make_behavior(resource(), handler_id(route::load), this, &memory_storage_t::load))
+        , checkpoint_(actor_zeta::make_behavior(resource(),
+                                                handler_id(route::checkpoint),
+                                                this,
+                                                &memory_storage_t::checkpoint))
         , size_(actor_zeta::make_behavior(resource(),
                                           collection::handler_id(collection::route::size),
                                           this,
@@ -50,16 +58,35 @@ namespace services {
                                                                 handler_id(route::execute_plan_delete_finish),
                                                                 this,
                                                                 &memory_storage_t::execute_plan_delete_finish))
-
-    {
+        , fetch_chunk_(actor_zeta::make_behavior(resource(),
+                                                 collection::handler_id(collection::route::fetch_chunk),
+                                                 this,
+                                                 &memory_storage_t::fetch_chunk))
+        , fetch_chunk_finish_(actor_zeta::make_behavior(resource(),
+                                                        collection::handler_id(collection::route::fetch_chunk_finish),
+                                                        this,
+                                                        &memory_storage_t::fetch_chunk_finish))
+        , close_cursor_(actor_zeta::make_behavior(resource(),
+                                                  collection::handler_id(collection::route::close_cursor),
+                                                  this,
+                                                  &memory_storage_t::close_cursor))
+        , executors_(resource())
+        , executor_addresses_(resource())
+        , executor_plans_(resource())
+        , pending_plans_(resource()) {
         ZoneScoped;
         trace(log_, "memory_storage start thread pool");
-        //TODO MIGHT BE CHANGED
-        executor_address_ = (spawn_actor(
-            [this](services::collection::executor::executor_t* ptr) {
-                executor_ = collection::executor::executor_ptr(ptr, actor_zeta::pmr::deleter_t(resource()));
-            },
-            std::move(log_.clone())));
+        const auto executors = std::max<std::uint64_t>(1, config.executors);
+        executors_.reserve(executors);
+        executor_addresses_.reserve(executors);
+        for (std::uint64_t i = 0; i < executors; ++i) {
+            executor_addresses_.emplace_back(spawn_actor(
+                [this](services::collection::executor::executor_t* ptr) {
+                    executors_.emplace_back(ptr, actor_zeta::pmr::deleter_t(resource()));
+                },
+                std::move(log_.clone())));
+        }
+        executor_plans_.resize(executors, 0);
     }
 
     memory_storage_t::~memory_storage_t() {
@@ -82,6 +109,10 @@ namespace services {
                     load_(msg);
                     break;
                 }
+                case handler_id(route::checkpoint): {
+                    checkpoint_(msg);
+                    break;
+                }
                 case collection::handler_id(collection::route::size): {
                     size_(msg);
                     break;
@@ -102,6 +133,18 @@ namespace services {
                     execute_plan_delete_finish_(msg);
                     break;
                 }
+                case collection::handler_id(collection::route::fetch_chunk): {
+                    fetch_chunk_(msg);
+                    break;
+                }
+                case collection::handler_id(collection::route::fetch_chunk_finish): {
+                    fetch_chunk_finish_(msg);
+                    break;
+                }
+                case collection::handler_id(collection::route::close_cursor): {
+                    close_cursor_(msg);
+                    break;
+                }
             }
         });
     }
@@ -138,44 +181,146 @@ namespace services {
 
     void memory_storage_t::size(const components::session::session_id_t& session, collection_full_name_t&& name) {
         trace(log_, "collection {}::{}::size", name.database, name.collection);
-        auto collection = collections_.at(name).get();
-        if (collection->dropped()) {
-            actor_zeta::send(current_message()->sender(),
+        // only the plans of its executor can change the collection
+        const auto executor = executor_index_(name);
+        schedule_(executor, true, [this, session, name = std::move(name), sender = current_message()->sender()] {
+            size_impl(session, name, sender);
+        });
+    }
+
+    void memory_storage_t::size_impl(const components::session::session_id_t& session,
+                                     const collection_full_name_t& name,
+                                     const actor_zeta::address_t& sender) {
+        auto it = collections_.find(name);
+        if (it == collections_.end() || it->second->dropped()) {
+            actor_zeta::send(sender,
                              address(),
                              handler_id(collection::route::size_finish),
                              session,
                              make_cursor(resource(), error_code_t::collection_dropped));
+            return;
+        }
+        auto collection = it->second.get();
+        if (collection->uses_datatable()) {
+            components::vector::data_chunk_t chunk(resource(), collection->table_storage().table().copy_types());
+            chunk.set_cardinality(collection->table_storage().table().calculate_size());
+            actor_zeta::send(sender,
+                             address(),
+                             handler_id(collection::route::size_finish),
+                             session,
+                             make_cursor(resource(), std::move(chunk)));
         } else {
-            if (collection->uses_datatable()) {
-                components::vector::data_chunk_t chunk(resource(), collection->table_storage().table().copy_types());
-                chunk.set_cardinality(collection->table_storage().table().calculate_size());
-                actor_zeta::send(current_message()->sender(),
-                                 address(),
-                                 handler_id(collection::route::size_finish),
-                                 session,
-                                 make_cursor(resource(), std::move(chunk)));
-            } else {
-                std::pmr::vector<document_ptr> documents(resource());
-                for (const auto& doc : collection->document_storage()) {
-                    documents.emplace_back(doc.second);
-                }
-                actor_zeta::send(current_message()->sender(),
-                                 address(),
-                                 handler_id(collection::route::size_finish),
-                                 session,
-                                 make_cursor(resource(), std::move(documents)));
+            std::pmr::vector<document_ptr> documents(resource());
+            for (const auto& doc : collection->document_storage()) {
+                documents.emplace_back(doc.second);
             }
+            actor_zeta::send(sender,
+                             address(),
+                             handler_id(collection::route::size_finish),
+                             session,
+                             make_cursor(resource(), std::move(documents)));
+        }
+    }
+
+    void memory_storage_t::fetch_chunk(const components::session::session_id_t& session) {
+        trace(log_, "memory_storage_t::fetch_chunk, session: {}", session.data());
+        schedule_(stream_executor_(session), false, [this, session, sender = current_message()->sender()] {
+            fetch_chunk_impl(session, sender);
+        });
+    }
+
+    void memory_storage_t::fetch_chunk_impl(const components::session::session_id_t& session,
+                                            const actor_zeta::address_t& sender) {
+        auto stream = streams_.find(session);
+        if (stream == streams_.end()) {
+            actor_zeta::send(sender,
+                             address(),
+                             handler_id(collection::route::fetch_chunk_finish),
+                             session,
+                             make_cursor(resource(), error_code_t::other_error, "cursor is closed"));
+            return;
+        }
+        auto collection = collections_.find(stream->second);
+        if (collection == collections_.end() || collection->second->dropped()) {
+            // batches left in a dropped collection are released with its context
+            streams_.erase(stream);
+            actor_zeta::send(sender,
+                             address(),
+                             handler_id(collection::route::fetch_chunk_finish),
+                             session,
+                             make_cursor(resource(), error_code_t::collection_dropped, "collection dropped"));
+            return;
+        }
+        const auto executor = executor_index_(stream->second);
+        sessions_.emplace(session, session_t{nullptr, sender, 1, executor});
+        ++running_plans_;
+        ++executor_plans_[executor];
+        actor_zeta::send(executor_addresses_[executor],
+                         address(),
+                         collection::handler_id(collection::route::fetch_chunk),
+                         session,
+                         collection->second.get());
+    }
+
+    void memory_storage_t::fetch_chunk_finish(const components::session::session_id_t& session, cursor_t_ptr cursor) {
+        auto& s = sessions_.at(session);
+        debug(log_,
+              "memory_storage_t:fetch_chunk_finish: session: {}, size: {}, has next: {}",
+              session.data(),
+              cursor->size(),
+              cursor->has_next_chunk());
+        if (!cursor->has_next_chunk()) {
+            streams_.erase(session);
+        }
+        actor_zeta::send(s.sender,
+                         address(),
+                         handler_id(collection::route::fetch_chunk_finish),
+                         session,
+                         std::move(cursor));
+        const auto executor = s.executor;
+        sessions_.erase(session);
+        finish_plan_(executor);
+    }
+
+    void memory_storage_t::close_cursor(const components::session::session_id_t& session) {
+        trace(log_, "memory_storage_t::close_cursor, session: {}", session.data());
+        if (!streams_.contains(session)) {
+            return;
         }
+        schedule_(stream_executor_(session), true, [this, session] { close_cursor_impl(session); });
+    }
+
+    void memory_storage_t::close_cursor_impl(const components::session::session_id_t& session) {
+        auto stream = streams_.find(session);
+        if (stream == streams_.end()) {
+            return;
+        }
+        // no plan runs on the executor of the collection now, so the batches are released here
+        auto collection = collections_.find(stream->second);
+        if (collection != collections_.end()) {
+            collection::sessions::remove(collection->second->sessions(),
+                                         session,
+                                         collection::sessions::stream_session_name);
+        }
+        streams_.erase(stream);
     }
 
     void memory_storage_t::load(const components::session::session_id_t& session, const disk::result_load_t& result) {
         trace(log_, "memory_storage_t:load");
         load_buffer_ = std::make_unique<load_buffer_t>(resource());
-        auto count_collections = std::accumulate(
-            (*result).begin(),
-            (*result).end(),
-            0ul,
-            [](size_t sum, const disk::result_database_t& database) { return sum + database.collections.size(); });
+        tables_ = result.tables();
+        // table collections are restored from the checkpoint right away, only documents are sent to the executor
+        auto count_collections =
+            std::accumulate((*result).begin(),
+                            (*result).end(),
+                            0ul,
+                            [](size_t sum, const disk::result_database_t& database) {
+                                return sum + std::count_if(database.collections.begin(),
+                                                           database.collections.end(),
+                                                           [](const disk::result_collection_t& collection) {
+                                                               return collection.schema.empty();
+                                                           });
+                            });
         if (count_collections > 0) {
             sessions_.emplace(session, session_t{nullptr, current_message()->sender(), count_collections});
         }
@@ -185,11 +330,24 @@ namespace services {
             for (const auto& collection : database.collections) {
                 debug(log_, "memory_storage_t:load:create_collection: {}", collection.name);
                 collection_full_name_t name(database.name, collection.name);
-                auto context = new collection::context_collection_t(resource(), name, manager_disk_, log_.clone());
+                if (!collection.schema.empty()) {
+                    debug(log_, "memory_storage_t:load:checkpoint: {}", collection.name);
+                    collections_.emplace(name,
+                                         new collection::context_collection_t(resource(),
+                                                                              name,
+                                                                              *result.tables(),
+                                                                              collection.table_root,
+                                                                              manager_disk_,
+                                                                              log_.clone(),
+                                                                              &scan_pool_));
+                    continue;
+                }
+                auto context =
+                    new collection::context_collection_t(resource(), name, manager_disk_, log_.clone(), &scan_pool_);
                 collections_.emplace(name, context);
                 load_buffer_->collections.emplace_back(name);
                 debug(log_, "memory_storage_t:load:fill_documents: {}", collection.documents.size());
-                actor_zeta::send(executor_address_,
+                actor_zeta::send(executor_addresses_[executor_index_(name)],
                                  address(),
                                  collection::handler_id(collection::route::create_documents),
                                  session,
@@ -203,6 +361,31 @@ namespace services {
         }
     }
 
+    void memory_storage_t::checkpoint(const actor_zeta::address_t& dispatcher, services::wal::id_t wal_id) {
+        trace(log_, "memory_storage_t:checkpoint, wal_id: {}", wal_id);
+        // taken once no plan runs: the tables hold the plans received before and none of the later ones
+        schedule_(all_executors, true, [this, dispatcher, wal_id] { checkpoint_impl(dispatcher, wal_id); });
+    }
+
+    void memory_storage_t::checkpoint_impl(const actor_zeta::address_t& dispatcher, services::wal::id_t wal_id) {
+        if (!tables_) {
+            return;
+        }
+        disk::checkpoint_tables_t tables;
+        for (const auto& [name, collection] : collections_) {
+            if (collection->uses_datatable() && !collection->dropped()) {
+                tables.emplace_back(name, &collection->table_storage().table());
+            }
+        }
+        try {
+            disk::disk_t::checkpoint_tables(*tables_, tables, wal_id);
+        } catch (const std::exception& e) {
+            error(log_, "memory_storage_t:checkpoint: {}", e.what());
+            return;
+        }
+        actor_zeta::send(dispatcher, address(), handler_id(route::checkpoint_finish), wal_id);
+    }
+
     void memory_storage_t::enqueue_impl(actor_zeta::message_ptr msg, actor_zeta::execution_unit*) {
         ZoneScoped;
         std::unique_lock<spin_lock> _(lock_);
@@ -213,8 +396,18 @@ namespace services {
     void memory_storage_t::create_database_(const components::session::session_id_t& session,
                                             components::logical_plan::node_ptr logical_plan) {
         trace(log_, "memory_storage_t:create_database {}", logical_plan->database_name());
+        schedule_(all_executors,
+                  true,
+                  [this, session, logical_plan = std::move(logical_plan), sender = current_message()->sender()] {
+                      create_database_impl(session, logical_plan, sender);
+                  });
+    }
+
+    void memory_storage_t::create_database_impl(const components::session::session_id_t& session,
+                                                const components::logical_plan::node_ptr& logical_plan,
+                                                const actor_zeta::address_t& sender) {
         databases_.insert(logical_plan->database_name());
-        actor_zeta::send(current_message()->sender(),
+        actor_zeta::send(sender,
                          this->address(),
                          handler_id(route::execute_plan_finish),
                          session,
@@ -224,8 +417,18 @@ namespace services {
     void memory_storage_t::drop_database_(const components::session::session_id_t& session,
                                           components::logical_plan::node_ptr logical_plan) {
         trace(log_, "memory_storage_t:drop_database {}", logical_plan->database_name());
+        schedule_(all_executors,
+                  true,
+                  [this, session, logical_plan = std::move(logical_plan), sender = current_message()->sender()] {
+                      drop_database_impl(session, logical_plan, sender);
+                  });
+    }
+
+    void memory_storage_t::drop_database_impl(const components::session::session_id_t& session,
+                                              const components::logical_plan::node_ptr& logical_plan,
+                                              const actor_zeta::address_t& sender) {
         databases_.erase(logical_plan->database_name());
-        actor_zeta::send(current_message()->sender(),
+        actor_zeta::send(sender,
                          this->address(),
                          handler_id(route::execute_plan_finish),
                          session,
@@ -235,6 +438,18 @@ namespace services {
     void memory_storage_t::create_collection_(const components::session::session_id_t& session,
                                               components::logical_plan::node_ptr logical_plan) {
         trace(log_, "memory_storage_t:create_collection {}", logical_plan->collection_full_name().to_string());
+        // a drop of the same name queued before has to run first
+        const auto executor = executor_index_(logical_plan->collection_full_name());
+        schedule_(executor,
+                  true,
+                  [this, session, logical_plan = std::move(logical_plan), sender = current_message()->sender()] {
+                      create_collection_impl(session, logical_plan, sender);
+                  });
+    }
+
+    void memory_storage_t::create_collection_impl(const components::session::session_id_t& session,
+                                                  const components::logical_plan::node_ptr& logical_plan,
+                                                  const actor_zeta::address_t& sender) {
         auto create_collection_plan =
             reinterpret_cast<const components::logical_plan::node_create_collection_ptr&>(logical_plan);
         if (create_collection_plan->schema().empty()) {
@@ -242,7 +457,8 @@ namespace services {
                                  new collection::context_collection_t(resource(),
                                                                       logical_plan->collection_full_name(),
                                                                       manager_disk_,
-                                                                      log_.clone()));
+                                                                      log_.clone(),
+                                                                      &scan_pool_));
         } else {
             std::vector<components::table::column_definition_t> columns;
             columns.reserve(create_collection_plan->schema().size());
@@ -254,29 +470,39 @@ namespace services {
                                                                       logical_plan->collection_full_name(),
                                                                       std::move(columns),
                                                                       manager_disk_,
-                                                                      log_.clone()));
+                                                                      log_.clone(),
+                                                                      &scan_pool_));
         }
         auto cursor = make_cursor(resource(), operation_status_t::success);
-        actor_zeta::send(current_message()->sender(),
-                         this->address(),
-                         handler_id(route::execute_plan_finish),
-                         session,
-                         cursor);
+        actor_zeta::send(sender, this->address(), handler_id(route::execute_plan_finish), session, cursor);
     }
 
     void memory_storage_t::drop_collection_(const components::session::session_id_t& session,
                                             components::logical_plan::node_ptr logical_plan) {
         trace(log_, "memory_storage_t:drop_collection {}", logical_plan->collection_full_name().to_string());
-        sessions_.emplace(session, session_t{logical_plan, current_message()->sender(), 1});
-        actor_zeta::send(current_message()->sender(),
+        // executors may hold the context until their plans finish
+        const auto executor = executor_index_(logical_plan->collection_full_name());
+        schedule_(executor,
+                  true,
+                  [this, session, logical_plan = std::move(logical_plan), sender = current_message()->sender()] {
+                      drop_collection_impl(session, logical_plan, sender);
+                  });
+    }
+
+    void memory_storage_t::drop_collection_impl(const components::session::session_id_t& session,
+                                                const components::logical_plan::node_ptr& logical_plan,
+                                                const actor_zeta::address_t& sender) {
+        auto collection = collections_.find(logical_plan->collection_full_name());
+        actor_zeta::send(sender,
                          address(),
                          handler_id(route::execute_plan_finish),
                          session,
-                         collections_.at(logical_plan->collection_full_name())->drop()
+                         collection != collections_.end() && collection->second->drop()
                              ? make_cursor(resource(), operation_status_t::success)
                              : make_cursor(resource(), error_code_t::other_error, "collection not dropped"));
-        sessions_.erase(session);
-        collections_.erase(logical_plan->collection_full_name());
+        if (collection != collections_.end()) {
+            collections_.erase(logical_plan->collection_full_name());
+        }
         trace(log_, "memory_storage_t:drop_collection_finish {}", logical_plan->collection_full_name().to_string());
     }
 
@@ -290,6 +516,8 @@ namespace services {
               session.data());
         if (used_format != components::catalog::used_format_t::undefined) {
             auto dependency_tree_collections_names = logical_plan->collection_dependencies();
+            const auto executor = executor_index_(logical_plan->collection_full_name());
+            bool exclusive = false;
             context_storage_t collections_context_storage;
             while (!dependency_tree_collections_names.empty()) {
                 collection_full_name_t name =
@@ -299,17 +527,108 @@ namespace services {
                     collections_context_storage.emplace(std::move(name), nullptr);
                     continue;
                 }
-                collections_context_storage.emplace(std::move(name), collections_.at(name).get());
+                exclusive = exclusive || executor_index_(name) != executor;
+                collections_context_storage.emplace(std::move(name), nullptr);
             }
             sessions_.emplace(session, session_t{logical_plan, current_message()->sender(), 1});
-            actor_zeta::send(executor_address_,
-                             address(),
-                             collection::handler_id(collection::route::execute_plan),
-                             session,
-                             logical_plan,
-                             parameters,
-                             std::move(collections_context_storage),
-                             used_format);
+            pending_plans_.emplace_back(pending_plan_t{session,
+                                                       std::move(logical_plan),
+                                                       std::move(parameters),
+                                                       std::move(collections_context_storage),
+                                                       used_format,
+                                                       exclusive ? all_executors : executor,
+                                                       exclusive});
+            run_pending_();
+        }
+    }
+
+    std::size_t memory_storage_t::executor_index_(const collection_full_name_t& name) const {
+        return collection_name_hash{}(name) % executor_addresses_.size();
+    }
+
+    std::size_t memory_storage_t::stream_executor_(const components::session::session_id_t& session) const {
+        auto stream = streams_.find(session);
+        return stream == streams_.end() ? 0 : executor_index_(stream->second);
+    }
+
+    void memory_storage_t::schedule_(std::size_t executor, bool exclusive, std::function<void()> command) {
+        pending_plans_.emplace_back(pending_plan_t{components::session::session_id_t(),
+                                                   nullptr,
+                                                   components::logical_plan::storage_parameters(resource()),
+                                                   {},
+                                                   components::catalog::used_format_t::undefined,
+                                                   executor,
+                                                   exclusive,
+                                                   std::move(command)});
+        run_pending_();
+    }
+
+    void memory_storage_t::send_plan_(pending_plan_t&& plan) {
+        auto& s = sessions_.at(plan.session);
+        for (auto& [name, context] : plan.context_storage) {
+            if (name.empty()) {
+                continue;
+            }
+            auto collection = collections_.find(name);
+            if (collection == collections_.end()) {
+                actor_zeta::send(s.sender,
+                                 address(),
+                                 handler_id(route::execute_plan_finish),
+                                 plan.session,
+                                 make_cursor(resource(), error_code_t::collection_dropped, "collection dropped"));
+                sessions_.erase(plan.session);
+                return;
+            }
+            context = collection->second.get();
+        }
+        s.executor = executor_index_(plan.logical_plan->collection_full_name());
+        ++running_plans_;
+        ++executor_plans_[s.executor];
+        exclusive_plan_running_ = plan.executor == all_executors;
+        actor_zeta::send(executor_addresses_[s.executor],
+                         address(),
+                         collection::handler_id(collection::route::execute_plan),
+                         plan.session,
+                         std::move(plan.logical_plan),
+                         std::move(plan.parameters),
+                         std::move(plan.context_storage),
+                         plan.used_format);
+    }
+
+    void memory_storage_t::finish_plan_(std::size_t executor) {
+        --running_plans_;
+        --executor_plans_[executor];
+        if (running_plans_ == 0) {
+            exclusive_plan_running_ = false;
+        }
+        run_pending_();
+    }
+
+    void memory_storage_t::run_pending_() {
+        // executors with a waiting entry, their later entries wait behind it
+        std::pmr::vector<bool> waiting(executor_addresses_.size(), false, resource());
+        bool any_waiting = false;
+        auto it = pending_plans_.begin();
+        while (it != pending_plans_.end() && !exclusive_plan_running_) {
+            bool ready = it->executor == all_executors
+                             ? !any_waiting && running_plans_ == 0
+                             : !waiting[it->executor] && (!it->exclusive || executor_plans_[it->executor] == 0);
+            if (!ready) {
+                if (it->executor == all_executors) {
+                    break;
+                }
+                waiting[it->executor] = true;
+                any_waiting = true;
+                ++it;
+                continue;
+            }
+            auto plan = std::move(*it);
+            it = pending_plans_.erase(it);
+            if (plan.command) {
+                plan.command();
+            } else {
+                send_plan_(std::move(plan));
+            }
         }
     }
 
@@ -319,8 +638,13 @@ namespace services {
               "memory_storage_t:execute_plan_finish: session: {}, success: {}",
               session.data(),
               result->is_success());
+        if (result->has_next_chunk()) {
+            streams_.emplace(session, s.logical_plan->collection_full_name());
+        }
         actor_zeta::send(s.sender, address(), handler_id(route::execute_plan_finish), session, std::move(result));
+        const auto executor = s.executor;
         sessions_.erase(session);
+        finish_plan_(executor);
     }
 
     void memory_storage_t::execute_plan_delete_finish(
@@ -338,7 +662,9 @@ namespace services {
                          session,
                          std::move(result),
                          std::move(updates));
+        const auto executor = s.executor;
         sessions_.erase(session);
+        finish_plan_(executor);
     }
 
     void memory_storage_t::create_documents_finish(const components::session::session_id_t& session) {
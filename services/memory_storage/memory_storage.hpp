@@ -1,5 +1,6 @@
 #pragma once
 
+#include <components/configuration/configuration.hpp>
 #include <components/cursor/cursor.hpp>
 #include <components/log/log.hpp>
 #include <components/logical_plan/node.hpp>
@@ -9,9 +10,13 @@
 #include <core/btree/btree.hpp>
 #include <core/excutor.hpp>
 #include <core/spinlock/spinlock.hpp>
+#include <core/thread_pool/thread_pool.hpp>
 #include <memory_resource>
 #include <services/collection/executor.hpp>
 #include <services/disk/result.hpp>
+#include <deque>
+#include <functional>
+#include <limits>
 #include <stack>
 
 #include "context_storage.hpp"
@@ -23,6 +28,23 @@ namespace services {
             components::logical_plan::node_ptr logical_plan;
             actor_zeta::address_t sender;
             size_t count_answers;
+            // executor running the plan or batch fetch of the session
+            std::size_t executor{0};
+        };
+
+        // plan or command waiting for the entries it has to follow
+        struct pending_plan_t {
+            components::session::session_id_t session;
+            components::logical_plan::node_ptr logical_plan;
+            components::logical_plan::storage_parameters parameters;
+            context_storage_t context_storage;
+            components::catalog::used_format_t used_format;
+            // executor of the collection, all_executors for an entry reading collections of several executors
+            std::size_t executor;
+            // waits until no plan runs on its executor, an entry of all executors always does
+            bool exclusive;
+            // ddl, size, checkpoint and cursor requests are run by the storage itself instead of an executor
+            std::function<void()> command{};
         };
 
         struct load_buffer_t {
@@ -35,6 +57,10 @@ namespace services {
         using collection_storage_t =
             core::pmr::btree::btree_t<collection_full_name_t, std::unique_ptr<collection::context_collection_t>>;
         using session_storage_t = core::pmr::btree::btree_t<components::session::session_id_t, session_t>;
+        using stream_storage_t = core::pmr::btree::btree_t<components::session::session_id_t, collection_full_name_t>;
+        using pending_plans_t = std::pmr::deque<pending_plan_t>;
+
+        static constexpr std::size_t all_executors = std::numeric_limits<std::size_t>::max();
 
     public:
         using address_pack = std::tuple<actor_zeta::address_t, actor_zeta::address_t>;
@@ -44,7 +70,10 @@ namespace services {
             manager_disk = 1
         };
 
-        memory_storage_t(std::pmr::memory_resource* resource, actor_zeta::scheduler_raw scheduler, log_t& log);
+        memory_storage_t(std::pmr::memory_resource* resource,
+                         actor_zeta::scheduler_raw scheduler,
+                         log_t& log,
+                         const configuration::config_executor& config = configuration::config_executor{});
         ~memory_storage_t();
 
         void sync(const address_pack& pack);
@@ -54,9 +83,13 @@ namespace services {
                           components::catalog::used_format_t used_format);
 
         void size(const components::session::session_id_t& session, collection_full_name_t&& name);
-        void close_cursor(const components::session::session_id_t& session,
-                          std::set<collection_full_name_t>&& collections);
+        // next batch of a streamed table result, the stream is keyed by the session of its query
+        void fetch_chunk(const components::session::session_id_t& session);
+        void close_cursor(const components::session::session_id_t& session);
         void load(const components::session::session_id_t& session, const disk::result_load_t& result);
+        // writes all table collections to the checkpoint file and reports `wal_id` back to `dispatcher`,
+        // the dispatcher sends it when every plan before it is in the wal up to `wal_id`
+        void checkpoint(const actor_zeta::address_t& dispatcher, services::wal::id_t wal_id);
 
         actor_zeta::scheduler_abstract_t* make_scheduler() noexcept;
         auto make_type() const noexcept -> const char* const;
@@ -67,25 +100,42 @@ namespace services {
         database_storage_t databases_;
         collection_storage_t collections_;
         log_t log_;
+        // shared by the scans and aggregations of all collections, every executor runs one plan at a time
+        core::thread_pool_t scan_pool_;
 
         // Behaviors
         actor_zeta::behavior_t sync_;
         actor_zeta::behavior_t load_;
+        actor_zeta::behavior_t checkpoint_;
         actor_zeta::behavior_t size_;
         actor_zeta::behavior_t create_documents_finish_;
         actor_zeta::behavior_t execute_plan_;
         actor_zeta::behavior_t execute_plan_finish_;
         actor_zeta::behavior_t execute_plan_delete_finish_;
+        actor_zeta::behavior_t fetch_chunk_;
+        actor_zeta::behavior_t fetch_chunk_finish_;
+        actor_zeta::behavior_t close_cursor_;
 
         actor_zeta::address_t manager_dispatcher_{actor_zeta::address_t::empty_address()};
         actor_zeta::address_t manager_disk_{actor_zeta::address_t::empty_address()};
-        actor_zeta::address_t executor_address_{actor_zeta::address_t::empty_address()};
 
         session_storage_t sessions_;
+        // results with batches left in the executor
+        stream_storage_t streams_;
         std::unique_ptr<load_buffer_t> load_buffer_;
+        // checkpoint file of the disk agent, set on load
+        components::table::storage::single_file_block_manager_t* tables_{nullptr};
         spin_lock lock_;
-        collection::executor::executor_ptr executor_{nullptr,
-                                                     actor_zeta::pmr::deleter_t(std::pmr::null_memory_resource())};
+        // a collection is served by the executor of its name hash, so collections of different executors
+        // run in parallel and plans of a collection keep their order
+        std::pmr::vector<collection::executor::executor_ptr> executors_;
+        std::pmr::vector<actor_zeta::address_t> executor_addresses_;
+        // plans and batch fetches sent to the executors and not finished yet, in total and per executor
+        std::size_t running_plans_{0};
+        std::pmr::vector<std::size_t> executor_plans_;
+        // a plan reading collections of several executors runs alone, the plans after it wait in order
+        bool exclusive_plan_running_{false};
+        pending_plans_t pending_plans_;
 
     private:
         void enqueue_impl(actor_zeta::message_ptr msg, actor_zeta::execution_unit* unit) final;
@@ -112,7 +162,42 @@ namespace services {
                                    components::cursor::cursor_t_ptr cursor,
                                    components::base::operators::operator_write_data_t::updated_types_map_t updates);
 
+        void fetch_chunk_finish(const components::session::session_id_t& session,
+                                components::cursor::cursor_t_ptr cursor);
+
         void create_documents_finish(const components::session::session_id_t& session);
+
+        void size_impl(const components::session::session_id_t& session,
+                       const collection_full_name_t& name,
+                       const actor_zeta::address_t& sender);
+        void fetch_chunk_impl(const components::session::session_id_t& session, const actor_zeta::address_t& sender);
+        void close_cursor_impl(const components::session::session_id_t& session);
+        void checkpoint_impl(const actor_zeta::address_t& dispatcher, services::wal::id_t wal_id);
+        void create_database_impl(const components::session::session_id_t& session,
+                                  const components::logical_plan::node_ptr& logical_plan,
+                                  const actor_zeta::address_t& sender);
+        void drop_database_impl(const components::session::session_id_t& session,
+                                const components::logical_plan::node_ptr& logical_plan,
+                                const actor_zeta::address_t& sender);
+        void create_collection_impl(const components::session::session_id_t& session,
+                                    const components::logical_plan::node_ptr& logical_plan,
+                                    const actor_zeta::address_t& sender);
+        void drop_collection_impl(const components::session::session_id_t& session,
+                                  const components::logical_plan::node_ptr& logical_plan,
+                                  const actor_zeta::address_t& sender);
+
+        std::size_t executor_index_(const collection_full_name_t& name) const;
+        // executor of the stream collection, a closed stream is answered at once on any of them
+        std::size_t stream_executor_(const components::session::session_id_t& session) const;
+        // runs the command after the entries of its executor queued before it, an exclusive one also waits for the
+        // plans running on its executor
+        void schedule_(std::size_t executor, bool exclusive, std::function<void()> command);
+        // collections are looked up on sending, a plan of a collection dropped while it was pending gets an error
+        void send_plan_(pending_plan_t&& plan);
+        void finish_plan_(std::size_t executor);
+        // starts queued entries in order: an entry follows the waiting ones of its executor, an entry of all
+        // executors follows every waiting one and the ones after it follow it
+        void run_pending_();
     };
 
 } // namespace services
@@ -10,7 +10,9 @@ namespace services::memory_storage {
         execute_plan_finish,
         execute_plan_delete_finish,
         load,
-        load_finish
+        load_finish,
+        checkpoint,
+        checkpoint_finish
     };
 
     constexpr auto handler_id(route type) { return handler_id(group_id_t::memory_storage, type); }
@@ -5,6 +5,7 @@
 
 #include <absl/crc/crc32c.h>
 #include <chrono>
+#include <limits>
 #include <msgpack.hpp>
 #include <unistd.h>
 
@@ -20,7 +21,9 @@ namespace services::wal {
     }
 
     void append_size(buffer_t& storage, size_tt size) {
-        storage.push_back((buffer_element_t((size >> 8 & 0xff))));
+        storage.push_back(buffer_element_t(size >> 24 & 0xff));
+        storage.push_back(buffer_element_t(size >> 16 & 0xff));
+        storage.push_back(buffer_element_t(size >> 8 & 0xff));
         storage.push_back(buffer_element_t(size & 0xff));
     }
 
@@ -45,12 +48,17 @@ namespace services::wal {
 
     size_tt read_size_impl(char* input, int index_start) {
         size_tt size_tmp = 0;
-        size_tmp = 0xff00 & (size_tt(input[index_start] << 8));
-        size_tmp |= 0x00ff & (size_tt(input[index_start + 1]));
+        size_tmp = 0xff000000 & (size_tt(uint8_t(input[index_start])) << 24);
+        size_tmp |= 0x00ff0000 & (size_tt(uint8_t(input[index_start + 1])) << 16);
+        size_tmp |= 0x0000ff00 & (size_tt(uint8_t(input[index_start + 2])) << 8);
+        size_tmp |= 0x000000ff & (size_tt(uint8_t(input[index_start + 3])));
         return size_tmp;
     }
 
     crc32_t pack(buffer_t& storage, char* input, size_t data_size) {
+        if (data_size > std::numeric_limits<size_tt>::max()) {
+            throw std::length_error("wal: record of " + std::to_string(data_size) + " bytes is too large");
+        }
         auto last_crc32_ = absl::ComputeCrc32c({input, data_size});
         append_size(storage, size_tt(data_size));
         append_payload(storage, input, data_size);
@@ -12,7 +12,8 @@ namespace services::wal {
     using buffer_t = std::pmr::string;
     using components::logical_plan::node_type;
 
-    using size_tt = std::uint16_t;
+    // records of a data chunk easily exceed 64KB, so the size of a record takes 32 bits
+    using size_tt = std::uint32_t;
     using crc32_t = std::uint32_t;
 
     struct wal_entry_t final {
@@ -27,6 +28,7 @@ namespace services::wal {
     crc32_t pack(buffer_t& storage, char* data, size_t size);
     buffer_t read_payload(buffer_t& input, int index_start, int index_stop);
     crc32_t read_crc32(buffer_t& input, int index_start);
+    void append_size(buffer_t& storage, size_tt size);
     size_tt read_size_impl(buffer_t& input, int index_start);
 
     crc32_t pack(buffer_t& storage,
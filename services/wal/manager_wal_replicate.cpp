@@ -66,7 +66,11 @@ namespace services::wal {
         , create_index_(actor_zeta::make_behavior(resource(),
                                                   handler_id(route::create_index),
                                                   this,
-                                                  &manager_wal_replicate_t::create_index)) {
+                                                  &manager_wal_replicate_t::create_index))
+        , truncate_(actor_zeta::make_behavior(resource(),
+                                              handler_id(route::truncate),
+                                              this,
+                                              &manager_wal_replicate_t::truncate)) {
         trace(log_, "manager_wal_replicate_t start thread pool");
     }
 
@@ -141,6 +145,10 @@ namespace services::wal {
                     create_index_(msg);
                     break;
                 }
+                case handler_id(route::truncate): {
+                    truncate_(msg);
+                    break;
+                }
             }
         });
     }
@@ -322,6 +330,11 @@ namespace services::wal {
                          std::move(data));
     }
 
+    void manager_wal_replicate_t::truncate(services::wal::id_t wal_id) {
+        trace(log_, "manager_wal_replicate_t::truncate, id: {}", wal_id);
+        actor_zeta::send(dispatchers_[0]->address(), address(), handler_id(route::truncate), wal_id);
+    }
+
     manager_wal_replicate_empty_t::manager_wal_replicate_empty_t(std::pmr::memory_resource* mr,
                                                                  actor_zeta::scheduler_raw scheduler,
                                                                  log_t& log)
@@ -366,6 +379,7 @@ namespace services::wal {
                     break;
                 }
                 case handler_id(route::create):
+                case handler_id(route::truncate):
                 case core::handler_id(core::route::sync): {
                     // Do nothing
                     break;
@@ -67,6 +67,7 @@ namespace services::wal {
                          components::logical_plan::node_update_ptr data,
                          components::logical_plan::parameter_node_ptr params);
         void create_index(const session_id_t& session, components::logical_plan::node_create_index_ptr data);
+        void truncate(services::wal::id_t wal_id);
 
     private:
         auto enqueue_impl(actor_zeta::message_ptr msg, actor_zeta::execution_unit*) -> void final;
@@ -87,6 +88,7 @@ namespace services::wal {
         actor_zeta::behavior_t update_many_;
         actor_zeta::behavior_t core_sync_;
         actor_zeta::behavior_t create_index_;
+        actor_zeta::behavior_t truncate_;
 
         actor_zeta::address_t manager_disk_ = actor_zeta::address_t::empty_address();
         actor_zeta::address_t manager_dispatcher_ = actor_zeta::address_t::empty_address();
@@ -24,6 +24,11 @@ namespace services::wal {
         create_index,
 
         success,
+        // the record is written but could not be synced, it may be lost on a crash
+        error,
+
+        truncate,
+        flush,
     };
 
     constexpr auto handler_id(route type) { return handler_id(group_id_t::wal, type); }
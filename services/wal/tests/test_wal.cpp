@@ -37,11 +37,13 @@ void test_insert_one(wal_replicate_t* wal, std::pmr::memory_resource* resource)
 }
 
 struct test_wal {
-    test_wal(const std::filesystem::path& path, std::pmr::memory_resource* resource)
+    test_wal(const std::filesystem::path& path,
+             std::pmr::memory_resource* resource,
+             const configuration::config_wal& base_config = configuration::config_wal())
         : log(initialization_logger("python", "/tmp/docker_logs/"))
         , scheduler(new core::non_thread_scheduler::scheduler_test_t(1, 1))
-        , config([path, this]() {
-            configuration::config_wal config_wal;
+        , config([path, base_config, this]() {
+            configuration::config_wal config_wal = base_config;
             log.set_level(log_t::level::trace);
             std::filesystem::remove_all(path);
             std::filesystem::create_directories(path);
@@ -73,8 +75,10 @@ struct test_wal {
     std::unique_ptr<wal_replicate_t, actor_zeta::pmr::deleter_t> wal;
 };
 
-test_wal create_test_wal(const std::filesystem::path& path, std::pmr::memory_resource* resource) {
-    return {path, resource};
+test_wal create_test_wal(const std::filesystem::path& path,
+                         std::pmr::memory_resource* resource,
+                         const configuration::config_wal& config = configuration::config_wal()) {
+    return {path, resource, config};
 }
 
 TEST_CASE("insert one test") {
@@ -188,6 +192,52 @@ TEST_CASE("insert many test") {
     }
 }
 
+TEST_CASE("insert chunk test") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    auto test_wal = create_test_wal("/tmp/wal/insert_chunk", &resource);
+
+    // the record is far larger than 64KB
+    constexpr uint64_t count_rows = 10000;
+    std::pmr::vector<components::types::complex_logical_type> types(&resource);
+    types.emplace_back(components::types::logical_type::BIGINT, "count");
+    types.emplace_back(components::types::logical_type::STRING_LITERAL, "countStr");
+    components::vector::data_chunk_t chunk(&resource, types, count_rows);
+    chunk.set_cardinality(count_rows);
+    for (uint64_t num = 0; num < count_rows; ++num) {
+        chunk.set_value(0, num, components::types::logical_value_t{int64_t(num)});
+        if (num % 10 == 0) {
+            chunk.data[1].validity().set_invalid(num);
+        } else {
+            chunk.set_value(1, num, components::types::logical_value_t{std::to_string(num)});
+        }
+    }
+    auto data =
+        components::logical_plan::make_node_insert(&resource, {database_name, collection_name}, std::move(chunk));
+    auto session = components::session::session_id_t();
+    auto address = actor_zeta::base::address_t::address_t::empty_address();
+    test_wal.wal->insert_many(session, address, data);
+    test_wal.scheduler->run();
+
+    REQUIRE(test_wal.wal->test_read_size(0) > std::numeric_limits<uint16_t>::max());
+    auto record = test_wal.wal->test_read_record(0);
+    REQUIRE(record.data);
+    REQUIRE(record.data->type() == node_type::insert_t);
+    const auto& node = reinterpret_cast<const node_data_ptr&>(record.data->children().front());
+    REQUIRE(node->uses_data_chunk());
+    const auto& result = node->data_chunk();
+    REQUIRE(result.size() == count_rows);
+    REQUIRE(result.column_count() == 2);
+    REQUIRE(result.data[1].type().alias() == "countStr");
+    for (uint64_t num = 0; num < count_rows; ++num) {
+        REQUIRE(result.value(0, num).value<int64_t>() == int64_t(num));
+        if (num % 10 == 0) {
+            REQUIRE(result.data[1].is_null(num));
+        } else {
+            REQUIRE(result.value(1, num).value<std::string_view>() == std::to_string(num));
+        }
+    }
+}
+
 TEST_CASE("delete one test") {
     auto resource = std::pmr::synchronized_pool_resource();
     auto test_wal = create_test_wal("/tmp/wal/delete_one", &resource);
@@ -416,3 +466,100 @@ TEST_CASE("test read record") {
     }
     REQUIRE(test_wal.wal->test_read_record(index).data == nullptr);
 }
+
+TEST_CASE("group commit test") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    configuration::config_wal config;
+    config.group_commit = true;
+    config.durability = configuration::wal_durability::data_sync;
+
+    INFO("records are written by flush") {
+        auto test_wal = create_test_wal("/tmp/wal/group_commit", &resource, config);
+        test_insert_one(test_wal.wal.get(), &resource);
+        REQUIRE(test_wal.wal->test_read_id(0) == services::wal::id_t(0));
+
+        test_wal.wal->flush();
+        test_wal.scheduler->run();
+        std::size_t index = 0;
+        for (int num = 1; num <= 5; ++num) {
+            REQUIRE(test_wal.wal->test_read_id(index) == services::wal::id_t(num));
+            index = test_wal.wal->test_next_record(index);
+        }
+        REQUIRE(test_wal.wal->test_read_id(index) == services::wal::id_t(0));
+    }
+
+    INFO("group is written once no more records arrive") {
+        config.group_commit_window_us = 10'000'000;
+        auto test_wal = create_test_wal("/tmp/wal/group_commit_window", &resource, config);
+        auto start = std::chrono::steady_clock::now();
+        test_insert_one(test_wal.wal.get(), &resource);
+        REQUIRE(test_wal.wal->test_read_id(0) == services::wal::id_t(0));
+
+        test_wal.scheduler->run();
+        // the window is not waited out when the mailbox is drained
+        REQUIRE(std::chrono::steady_clock::now() - start < 10s);
+        std::size_t index = 0;
+        for (int num = 1; num <= 5; ++num) {
+            REQUIRE(test_wal.wal->test_read_id(index) == services::wal::id_t(num));
+            index = test_wal.wal->test_next_record(index);
+        }
+        REQUIRE(test_wal.wal->test_read_id(index) == services::wal::id_t(0));
+        config.group_commit_window_us = 0;
+    }
+
+    INFO("full group is written at once") {
+        config.group_commit_max_bytes = 1;
+        auto test_wal = create_test_wal("/tmp/wal/group_commit_bytes", &resource, config);
+        test_insert_one(test_wal.wal.get(), &resource);
+        std::size_t index = 0;
+        for (int num = 1; num <= 5; ++num) {
+            REQUIRE(test_wal.wal->test_read_id(index) == services::wal::id_t(num));
+            index = test_wal.wal->test_next_record(index);
+        }
+    }
+}
+
+TEST_CASE("segments test") {
+    auto resource = std::pmr::synchronized_pool_resource();
+    configuration::config_wal config;
+    config.segment_size = 1;
+    auto test_wal = create_test_wal("/tmp/wal/segments", &resource, config);
+    test_insert_one(test_wal.wal.get(), &resource);
+
+    auto segment_count = [&]() {
+        return std::distance(std::filesystem::directory_iterator(test_wal.config.path),
+                             std::filesystem::directory_iterator());
+    };
+    auto record_ids = [&](services::wal::id_t wal_id) {
+        std::vector<services::wal::id_t> ids;
+        for (const auto& record : test_wal.wal->test_read_records(wal_id)) {
+            ids.push_back(record.id);
+        }
+        return ids;
+    };
+
+    INFO("every record gets a segment") {
+        REQUIRE(segment_count() == 5);
+        REQUIRE(record_ids(1) == std::vector<services::wal::id_t>{1, 2, 3, 4, 5});
+        REQUIRE(record_ids(3) == std::vector<services::wal::id_t>{3, 4, 5});
+        REQUIRE(record_ids(6).empty());
+    }
+
+    INFO("covered segments are removed") {
+        test_wal.wal->truncate(services::wal::id_t(3));
+        REQUIRE(segment_count() == 2);
+        REQUIRE(record_ids(1) == std::vector<services::wal::id_t>{4, 5});
+    }
+
+    INFO("restart continues the last segment") {
+        test_wal.wal.reset();
+        auto* buffer = test_wal.manager->resource()->allocate(sizeof(wal_replicate_t), alignof(wal_replicate_t));
+        auto* wal_ptr = new (buffer) wal_replicate_t(test_wal.manager.get(), test_wal.log, test_wal.config);
+        test_wal.wal = wal_replicate_ptr(wal_ptr, actor_zeta::pmr::deleter_t(test_wal.manager->resource()));
+        auto data = make_node_insert(&resource, {database_name, collection_name}, {gen_doc(6, &resource)});
+        auto session = components::session::session_id_t();
+        auto address = actor_zeta::base::address_t::address_t::empty_address();
+        test_wal.wal->insert_one(session, address, data);
+        REQUIRE(record_ids(1) == std::vector<services::wal::id_t>{4, 5, 6});
+    }
+}
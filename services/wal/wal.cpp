@@ -1,5 +1,6 @@
 #include "wal.hpp"
 #include <absl/crc/crc32c.h>
+#include <algorithm>
 #include <unistd.h>
 #include <utility>
 
@@ -21,6 +22,11 @@
 namespace services::wal {
 
     constexpr static auto wal_name = ".wal";
+    constexpr static auto segment_prefix = "segment_";
+    constexpr static char segment_magic[] = {'O', 'T', 'B', 'X', 'W', 'A', 'L', '2'};
+    // records of the first format had 16 bit sizes, such segments are converted on open
+    constexpr static char segment_magic_v1[] = {'O', 'T', 'B', 'X', 'W', 'A', 'L', '1'};
+    constexpr static std::size_t segment_header_size = sizeof(segment_magic) + sizeof(services::wal::id_t);
     using core::filesystem::file_flags;
     using core::filesystem::file_lock_type;
 
@@ -31,6 +37,54 @@ namespace services::wal {
 
     std::size_t next_index(std::size_t index, size_tt size) { return index + size + sizeof(size_tt) + sizeof(crc32_t); }
 
+    std::filesystem::path segment_path(const std::filesystem::path& directory, services::wal::id_t first_id) {
+        // zero padded, so the names sort as the ids do
+        auto id = std::to_string(first_id);
+        return directory / (segment_prefix + std::string(20 - id.size(), '0') + id + wal_name);
+    }
+
+    void write_segment_header(core::filesystem::file_handle_t& file, services::wal::id_t first_id) {
+        buffer_t header(segment_magic, sizeof(segment_magic));
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            header.push_back(char(first_id >> shift & 0xff));
+        }
+        file.write(header.data(), header.size(), 0);
+    }
+
+    bool read_segment_header(core::filesystem::file_handle_t& file,
+                             services::wal::id_t& first_id,
+                             const char (&magic)[sizeof(segment_magic)] = segment_magic) {
+        buffer_t header(segment_header_size, '\0');
+        if (file.file_size() < segment_header_size || !file.read(header.data(), header.size(), 0) ||
+            !std::equal(std::begin(magic), std::end(magic), header.begin())) {
+            return false;
+        }
+        first_id = 0;
+        for (auto i = sizeof(segment_magic); i < segment_header_size; i++) {
+            first_id = first_id << 8 | uint8_t(header[i]);
+        }
+        return true;
+    }
+
+    buffer_t widen_record_sizes(const buffer_t& data) {
+        constexpr std::size_t size_v1 = sizeof(std::uint16_t);
+        buffer_t result(data.get_allocator());
+        result.reserve(data.size() + data.size() / 8);
+        std::size_t index = 0;
+        while (index + size_v1 <= data.size()) {
+            auto size = size_tt(uint8_t(data[index])) << 8 | uint8_t(data[index + 1]);
+            auto finish = index + size_v1 + size + sizeof(crc32_t);
+            if (size == 0 || finish > data.size()) {
+                break;
+            }
+            // the crc covers the payload only, it stays the same
+            append_size(result, size);
+            result.append(data, index + size_v1, size + sizeof(crc32_t));
+            index = finish;
+        }
+        return result;
+    }
+
     wal_replicate_t::wal_replicate_t(manager_wal_replicate_t* manager, log_t& log, configuration::config_wal config)
         : actor_zeta::basic_actor<wal_replicate_t>(manager)
         , log_(log.clone())
@@ -74,15 +128,13 @@ namespace services::wal {
         , create_index_(actor_zeta::make_behavior(resource(),
                                                   handler_id(route::create_index),
                                                   this,
-                                                  &wal_replicate_t::create_index)) {
+                                                  &wal_replicate_t::create_index))
+        , truncate_(
+              actor_zeta::make_behavior(resource(), handler_id(route::truncate), this, &wal_replicate_t::truncate))
+        , flush_(actor_zeta::make_behavior(resource(), handler_id(route::flush), this, &wal_replicate_t::flush)) {
         if (config_.sync_to_disk) {
             std::filesystem::create_directories(config_.path);
-            file_ = open_file(fs_,
-                              config_.path / wal_name,
-                              file_flags::WRITE | file_flags::READ | file_flags::FILE_CREATE,
-                              file_lock_type::NO_LOCK);
-            file_->seek(file_->file_size());
-            init_id();
+            open_segments();
         }
     }
 
@@ -137,42 +189,139 @@ namespace services::wal {
                     create_index_(msg);
                     break;
                 }
+                case handler_id(route::truncate): {
+                    truncate_(msg);
+                    break;
+                }
+                case handler_id(route::flush): {
+                    flush_(msg);
+                    break;
+                }
             }
         });
     }
 
     auto wal_replicate_t::make_type() const noexcept -> const char* const { return "wal"; }
 
-    void wal_replicate_t::send_success(const session_id_t& session, address_t& sender) {
+    void wal_replicate_t::send_success(const session_id_t& session, address_t& sender, services::wal::id_t id) {
         if (sender) {
             trace(log_, "wal_replicate_t::send_success session {}", session.data());
-            actor_zeta::send(sender, address(), handler_id(route::success), session, services::wal::id_t(id_));
+            actor_zeta::send(sender, address(), handler_id(route::success), session, id);
         }
     }
 
-    void wal_replicate_t::write_buffer(buffer_t& buffer) { file_->write(buffer.data(), buffer.size()); }
+    void wal_replicate_t::send_error(const session_id_t& session, address_t& sender, services::wal::id_t id) {
+        if (sender) {
+            trace(log_, "wal_replicate_t::send_error session {}", session.data());
+            actor_zeta::send(sender, address(), handler_id(route::error), session, id);
+        }
+    }
+
+    void wal_replicate_t::commit(const session_id_t& session, address_t& sender) {
+        if (pending_.empty()) {
+            group_started_ = std::chrono::steady_clock::now();
+        }
+        pending_.push_back({session, sender, services::wal::id_t(id_)});
+        if (!config_.group_commit || commit_buffer_.size() >= config_.group_commit_max_bytes) {
+            write_pending();
+            return;
+        }
+        if (!flush_scheduled_) {
+            // queued behind the messages already in the mailbox, their records join this group
+            flush_scheduled_ = true;
+            flush_pending_ = pending_.size();
+            actor_zeta::send(address(), address(), handler_id(route::flush));
+        }
+    }
+
+    void wal_replicate_t::flush() {
+        if (pending_.empty()) {
+            flush_scheduled_ = false;
+            return;
+        }
+        auto window = std::chrono::microseconds(config_.group_commit_window_us);
+        if (pending_.size() > flush_pending_ && commit_buffer_.size() < config_.group_commit_max_bytes &&
+            std::chrono::steady_clock::now() - group_started_ < window) {
+            // records arrived since the flush was sent, let the ones sent meanwhile into the group;
+            // without new records the mailbox is drained and the group is written instead of waiting out the window
+            flush_pending_ = pending_.size();
+            actor_zeta::send(address(), address(), handler_id(route::flush));
+            return;
+        }
+        flush_scheduled_ = false;
+        write_pending();
+    }
+
+    void wal_replicate_t::write_pending() {
+        if (pending_.empty()) {
+            return;
+        }
+        trace(log_, "wal_replicate_t::write_pending records: {}, bytes: {}", pending_.size(), commit_buffer_.size());
+        // every record of the group shares its sync
+        const bool synced = write_group();
+        for (auto& commit : pending_) {
+            if (synced) {
+                send_success(commit.session, commit.sender, commit.id);
+            } else {
+                send_error(commit.session, commit.sender, commit.id);
+            }
+        }
+        pending_.clear();
+    }
+
+    bool wal_replicate_t::write_group() {
+        // records do not span segments, a group larger than segment_size gets a segment of its own
+        if (file_ && segment_bytes_ > 0 && segment_bytes_ + commit_buffer_.size() > config_.segment_size) {
+            open_segment(pending_.front().id);
+        }
+        const bool synced = write_buffer(commit_buffer_);
+        segment_bytes_ += commit_buffer_.size();
+        commit_buffer_.clear();
+        return synced;
+    }
+
+    bool wal_replicate_t::write_buffer(buffer_t& buffer) {
+        file_->write(buffer.data(), buffer.size());
+        bool synced = true;
+        switch (config_.durability) {
+            case configuration::wal_durability::none:
+                break;
+            case configuration::wal_durability::data_sync:
+                synced = file_->data_sync();
+                break;
+            case configuration::wal_durability::full_sync:
+                synced = file_->sync();
+                break;
+        }
+        if (!synced) {
+            error(log_, "wal_replicate_t::write_buffer: can't sync {}", segments_.back().path.string());
+        }
+        return synced;
+    }
 
     void wal_replicate_t::read_buffer(buffer_t& buffer, size_t start_index, size_t size) const {
         buffer.resize(size);
-        file_->read(buffer.data(), size, uint64_t(start_index));
+        file_->read(buffer.data(), size, uint64_t(segment_header_size + start_index));
     }
 
-    wal_replicate_t::~wal_replicate_t() { trace(log_, "delete wal_replicate_t"); }
-
-    size_tt read_size_impl(buffer_t& input, int index_start) {
-        size_tt size_tmp = 0;
-        size_tmp = size_tt(0xff00 & input[size_t(index_start)] << 8);
-        size_tmp |= size_tt(0x00ff & input[size_t(index_start) + 1]);
-        return size_tmp;
+    wal_replicate_t::~wal_replicate_t() {
+        trace(log_, "delete wal_replicate_t");
+        // senders are not waited for here, unacknowledged records are still kept
+        if (file_ && !commit_buffer_.empty()) {
+            write_group();
+        }
     }
 
     static size_tt read_size_impl(const char* input, int index_start) {
         size_tt size_tmp = 0;
-        size_tmp = size_tt(0xff00 & (input[index_start] << 8));
-        size_tmp |= size_tt(0x00ff & (input[index_start + 1]));
+        for (int i = 0; i < int(sizeof(size_tt)); i++) {
+            size_tmp = size_tmp << 8 | uint8_t(input[index_start + i]);
+        }
         return size_tmp;
     }
 
+    size_tt read_size_impl(buffer_t& input, int index_start) { return read_size_impl(input.data(), index_start); }
+
     size_tt wal_replicate_t::read_size(size_t start_index) const {
         auto size_read = sizeof(size_tt);
         buffer_t buffer;
@@ -190,17 +339,9 @@ namespace services::wal {
 
     void wal_replicate_t::load(const session_id_t& session, address_t& sender, services::wal::id_t wal_id) {
         trace(log_, "wal_replicate_t::load, session: {}, id: {}", session.data(), wal_id);
-        std::size_t start_index = 0;
+        write_pending();
         next_id(wal_id);
-        std::vector<record_t> records;
-        if (find_start_record(wal_id, start_index)) {
-            std::size_t size = 0;
-            do {
-                records.emplace_back(read_record(start_index));
-                start_index = next_index(start_index, records[size].size);
-            } while (records[size++].is_valid());
-            records.erase(records.end() - 1);
-        }
+        auto records = read_records(wal_id);
         actor_zeta::send(sender, address(), handler_id(route::load_finish), session, std::move(records));
     }
 
@@ -213,7 +354,7 @@ namespace services::wal {
               session.data());
         write_data_(reinterpret_cast<const components::logical_plan::node_ptr&>(data),
                     components::logical_plan::make_parameter_node(resource()));
-        send_success(session, sender);
+        commit(session, sender);
     }
 
     void wal_replicate_t::drop_database(const session_id_t& session,
@@ -225,7 +366,7 @@ namespace services::wal {
               session.data());
         write_data_(reinterpret_cast<const components::logical_plan::node_ptr&>(data),
                     components::logical_plan::make_parameter_node(resource()));
-        send_success(session, sender);
+        commit(session, sender);
     }
 
     void wal_replicate_t::create_collection(const session_id_t& session,
@@ -238,7 +379,7 @@ namespace services::wal {
               session.data());
         write_data_(reinterpret_cast<const components::logical_plan::node_ptr&>(data),
                     components::logical_plan::make_parameter_node(resource()));
-        send_success(session, sender);
+        commit(session, sender);
     }
 
     void wal_replicate_t::drop_collection(const session_id_t& session,
@@ -251,7 +392,7 @@ namespace services::wal {
               session.data());
         write_data_(reinterpret_cast<const components::logical_plan::node_ptr&>(data),
                     components::logical_plan::make_parameter_node(resource()));
-        send_success(session, sender);
+        commit(session, sender);
     }
 
     void wal_replicate_t::insert_one(const session_id_t& session,
@@ -263,7 +404,7 @@ namespace services::wal {
               data->collection_full_name().collection,
               session.data());
         write_data_(data, components::logical_plan::make_parameter_node(resource()));
-        send_success(session, sender);
+        commit(session, sender);
     }
 
     void wal_replicate_t::insert_many(const session_id_t& session,
@@ -275,7 +416,7 @@ namespace services::wal {
               data->collection_full_name().collection,
               session.data());
         write_data_(data, components::logical_plan::make_parameter_node(resource()));
-        send_success(session, sender);
+        commit(session, sender);
     }
 
     void wal_replicate_t::delete_one(const session_id_t& session,
@@ -288,7 +429,7 @@ namespace services::wal {
               data->collection_full_name().collection,
               session.data());
         write_data_(data, std::move(params));
-        send_success(session, sender);
+        commit(session, sender);
     }
 
     void wal_replicate_t::delete_many(const session_id_t& session,
@@ -301,7 +442,7 @@ namespace services::wal {
               data->collection_full_name().collection,
               session.data());
         write_data_(data, std::move(params));
-        send_success(session, sender);
+        commit(session, sender);
     }
 
     void wal_replicate_t::update_one(const session_id_t& session,
@@ -314,7 +455,7 @@ namespace services::wal {
               data->collection_full_name().collection,
               session.data());
         write_data_(data, std::move(params));
-        send_success(session, sender);
+        commit(session, sender);
     }
 
     void wal_replicate_t::update_many(const session_id_t& session,
@@ -327,7 +468,7 @@ namespace services::wal {
               data->collection_full_name().collection,
               session.data());
         write_data_(data, std::move(params));
-        send_success(session, sender);
+        commit(session, sender);
     }
 
     void wal_replicate_t::create_index(const session_id_t& session,
@@ -339,25 +480,186 @@ namespace services::wal {
               data->collection_full_name().collection,
               session.data());
         write_data_(data, components::logical_plan::make_parameter_node(resource()));
-        send_success(session, sender);
+        commit(session, sender);
+    }
+
+    void wal_replicate_t::truncate(services::wal::id_t wal_id) {
+        trace(log_, "wal_replicate_t::truncate, id: {}", wal_id);
+        // a segment is covered by the checkpoint when the next one starts right after wal_id or earlier,
+        // the active segment is always kept: its header restores the last id after restart
+        while (segments_.size() > 1 && segments_[1].first_id <= wal_id + 1) {
+            if (!remove_file(fs_, segments_.front().path)) {
+                error(log_, "wal_replicate_t::truncate: can't remove {}", segments_.front().path.string());
+                return;
+            }
+            segments_.erase(segments_.begin());
+        }
     }
 
     template<class T>
     void wal_replicate_t::write_data_(T& data, components::logical_plan::parameter_node_ptr params) {
         next_id(id_);
-        buffer_t buffer;
-        last_crc32_ = pack(buffer, last_crc32_, id_, data, params);
-        write_buffer(buffer);
+        last_crc32_ = pack(commit_buffer_, last_crc32_, id_, data, params);
+    }
+
+    void wal_replicate_t::open_segments() {
+        convert_single_file();
+        list_files(fs_, config_.path, [this](const std::filesystem::path& name, bool is_directory) {
+            if (is_directory || name.string().rfind(segment_prefix, 0) != 0) {
+                return;
+            }
+            auto path = config_.path / name;
+            auto file = open_file(fs_, path, file_flags::READ, file_lock_type::NO_LOCK);
+            services::wal::id_t first_id = 0;
+            if (read_segment_header(*file, first_id, segment_magic_v1)) {
+                file->close();
+                convert_segment_v1(path, first_id);
+            } else if (!read_segment_header(*file, first_id)) {
+                error(log_, "wal_replicate_t::open_segments: {} is not a wal segment", path.string());
+                return;
+            }
+            segments_.push_back({first_id, path});
+        });
+        std::sort(segments_.begin(), segments_.end(), [](const segment_t& lhs, const segment_t& rhs) {
+            return lhs.first_id < rhs.first_id;
+        });
+        if (segments_.empty()) {
+            open_segment(1);
+            return;
+        }
+        file_ = open_file(fs_,
+                          segments_.back().path,
+                          file_flags::WRITE | file_flags::READ,
+                          file_lock_type::NO_LOCK);
+        init_id();
+    }
+
+    void wal_replicate_t::open_segment(services::wal::id_t first_id) {
+        trace(log_, "wal_replicate_t::open_segment, first id: {}", first_id);
+        if (file_) {
+            file_->close();
+        }
+        auto path = segment_path(config_.path, first_id);
+        file_ = open_file(fs_,
+                          path,
+                          file_flags::WRITE | file_flags::READ | file_flags::FILE_CREATE,
+                          file_lock_type::NO_LOCK);
+        write_segment_header(*file_, first_id);
+        file_->truncate(segment_header_size);
+        file_->seek(segment_header_size);
+        if (config_.durability != configuration::wal_durability::none) {
+            file_->sync();
+        }
+        segments_.push_back({first_id, path});
+        segment_bytes_ = 0;
+    }
+
+    void wal_replicate_t::convert_single_file() {
+        // wal written as a single file without a header, it becomes the first segment
+        auto path = config_.path / wal_name;
+        if (!file_exist_(path)) {
+            return;
+        }
+        auto file = open_file(fs_, path, file_flags::READ, file_lock_type::NO_LOCK);
+        buffer_t data(file->file_size(), '\0');
+        file->read(data.data(), data.size(), 0);
+        file->close();
+        data = widen_record_sizes(data);
+        auto first = read_record(data, 0);
+        if (first.is_valid() && first.data) {
+            auto segment = open_file(fs_,
+                                     segment_path(config_.path, first.id),
+                                     file_flags::WRITE | file_flags::FILE_CREATE,
+                                     file_lock_type::NO_LOCK);
+            write_segment_header(*segment, first.id);
+            segment->write(data.data(), data.size(), segment_header_size);
+            segment->sync();
+            segment->close();
+        }
+        remove_file(fs_, path);
+    }
+
+    void wal_replicate_t::convert_segment_v1(const std::filesystem::path& path, services::wal::id_t first_id) {
+        trace(log_, "wal_replicate_t::convert_segment_v1: {}", path.string());
+        auto data = widen_record_sizes(read_segment({first_id, path}));
+        // written aside and renamed, so a crash leaves either of the segments complete
+        auto converted_path = path.parent_path() / ("converted_" + path.filename().string());
+        auto converted = open_file(fs_,
+                                   converted_path,
+                                   file_flags::WRITE | file_flags::FILE_CREATE,
+                                   file_lock_type::NO_LOCK);
+        write_segment_header(*converted, first_id);
+        converted->write(data.data(), data.size(), segment_header_size);
+        converted->truncate(int64_t(segment_header_size + data.size()));
+        converted->sync();
+        converted->close();
+        move_files(fs_, converted_path, path);
+    }
+
+    buffer_t wal_replicate_t::read_segment(const segment_t& segment) {
+        // the whole segment in one sequential read, its size is bounded by config_wal::segment_size
+        auto file = open_file(fs_, segment.path, file_flags::READ, file_lock_type::NO_LOCK);
+        buffer_t data;
+        auto size = file->file_size();
+        if (size > segment_header_size) {
+            data.resize(size - segment_header_size);
+            file->read(data.data(), data.size(), segment_header_size);
+        }
+        return data;
+    }
+
+    std::vector<record_t> wal_replicate_t::read_records(services::wal::id_t wal_id) {
+        std::vector<record_t> records;
+        // segments before the last one starting at wal_id hold older records only,
+        // after truncate() the wal may start past wal_id, then it is read from the beginning
+        auto it = std::upper_bound(segments_.begin(),
+                                   segments_.end(),
+                                   wal_id,
+                                   [](services::wal::id_t id, const segment_t& segment) {
+                                       return id < segment.first_id;
+                                   });
+        if (it != segments_.begin()) {
+            --it;
+        }
+        for (; it != segments_.end(); ++it) {
+            auto data = read_segment(*it);
+            std::size_t index = 0;
+            while (true) {
+                auto record = read_record(data, index);
+                if (!record.is_valid() || !record.data) {
+                    break;
+                }
+                index = next_index(index, record.size);
+                if (record.id >= wal_id) {
+                    records.emplace_back(std::move(record));
+                }
+            }
+        }
+        return records;
     }
 
     void wal_replicate_t::init_id() {
-        std::size_t start_index = 0;
-        auto id = read_id(start_index);
-        while (id > 0) {
-            id_ = id;
-            start_index = next_index(start_index, read_size(start_index));
-            id = read_id(start_index);
+        id_ = segments_.back().first_id - 1;
+        auto data = read_segment(segments_.back());
+        std::size_t index = 0;
+        while (index + sizeof(size_tt) <= data.size()) {
+            auto size = read_size_impl(data.data(), int(index));
+            auto finish = next_index(index, size);
+            if (size == 0 || finish > data.size()) {
+                break;
+            }
+            buffer_t output(data.begin() + std::ptrdiff_t(index + sizeof(size_tt)),
+                            data.begin() + std::ptrdiff_t(finish));
+            if (read_crc32(output, size) != static_cast<uint32_t>(absl::ComputeCrc32c({output.data(), size}))) {
+                break;
+            }
+            id_ = unpack_wal_id(output);
+            index = finish;
         }
+        // a torn record at the tail is cut off, new records follow the last complete one
+        segment_bytes_ = index;
+        file_->truncate(int64_t(segment_header_size + index));
+        file_->seek(segment_header_size + index);
     }
 
     bool wal_replicate_t::find_start_record(services::wal::id_t wal_id, std::size_t& start_index) const {
@@ -388,6 +690,25 @@ namespace services::wal {
         return 0;
     }
 
+    static void decode_record(buffer_t& output, record_t& record) {
+        record.crc32 = read_crc32(output, record.size);
+        if (record.crc32 == static_cast<uint32_t>(absl::ComputeCrc32c({output.data(), record.size}))) {
+            components::serializer::msgpack_deserializer_t deserializer(output);
+            record.last_crc32 = deserializer.deserialize_uint64(0);
+            record.id = deserializer.deserialize_uint64(1);
+
+            deserializer.advance_array(2);
+            record.data = components::logical_plan::node_t::deserialize(&deserializer);
+            deserializer.pop_array();
+            deserializer.advance_array(3);
+            record.params = components::logical_plan::parameter_node_t::deserialize(&deserializer);
+            deserializer.pop_array();
+        } else {
+            record.data = nullptr;
+            //todo: error wal content
+        }
+    }
+
     record_t wal_replicate_t::read_record(std::size_t start_index) const {
         record_t record;
         record.size = read_size(start_index);
@@ -395,28 +716,31 @@ namespace services::wal {
             auto start = start_index + sizeof(size_tt);
             auto finish = start + record.size + sizeof(crc32_t);
             auto output = read(start, finish);
-            record.crc32 = read_crc32(output, record.size);
-            if (record.crc32 == static_cast<uint32_t>(absl::ComputeCrc32c({output.data(), record.size}))) {
-                components::serializer::msgpack_deserializer_t deserializer(output);
-                record.last_crc32 = deserializer.deserialize_uint64(0);
-                record.id = deserializer.deserialize_uint64(1);
-
-                deserializer.advance_array(2);
-                record.data = components::logical_plan::node_t::deserialize(&deserializer);
-                deserializer.pop_array();
-                deserializer.advance_array(3);
-                record.params = components::logical_plan::parameter_node_t::deserialize(&deserializer);
-                deserializer.pop_array();
-            } else {
-                record.data = nullptr;
-                //todo: error wal content
-            }
+            decode_record(output, record);
         } else {
             record.data = nullptr;
         }
         return record;
     }
 
+    record_t wal_replicate_t::read_record(buffer_t& data, std::size_t start_index) {
+        record_t record;
+        record.size = 0;
+        record.data = nullptr;
+        if (start_index + sizeof(size_tt) > data.size()) {
+            return record;
+        }
+        auto size = read_size_impl(data.data(), int(start_index));
+        if (size == 0 || next_index(start_index, size) > data.size()) {
+            return record;
+        }
+        auto start = data.begin() + std::ptrdiff_t(start_index + sizeof(size_tt));
+        buffer_t output(start, start + size + sizeof(crc32_t));
+        record.size = size;
+        decode_record(output, record);
+        return record;
+    }
+
 #ifdef DEV_MODE
     bool wal_replicate_t::test_find_start_record(services::wal::id_t wal_id, std::size_t& start_index) const {
         return find_start_record(wal_id, start_index);
@@ -435,6 +759,10 @@ namespace services::wal {
     buffer_t wal_replicate_t::test_read(size_t start_index, size_t finish_index) const {
         return read(start_index, finish_index);
     }
+
+    std::vector<record_t> wal_replicate_t::test_read_records(services::wal::id_t wal_id) {
+        return read_records(wal_id);
+    }
 #endif
 
     wal_replicate_without_disk_t::wal_replicate_without_disk_t(manager_wal_replicate_t* manager,
@@ -447,7 +775,7 @@ namespace services::wal {
         actor_zeta::send(sender, address(), handler_id(route::load_finish), session, std::move(records));
     }
 
-    void wal_replicate_without_disk_t::write_buffer(buffer_t&) {}
+    bool wal_replicate_without_disk_t::write_buffer(buffer_t&) { return true; }
 
     void wal_replicate_without_disk_t::read_buffer(buffer_t& buffer, size_t, size_t size) const {
         buffer.resize(size);
@@ -13,6 +13,8 @@
 #include "forward.hpp"
 #include "record.hpp"
 
+#include <chrono>
+
 #include <components/logical_plan/node_create_collection.hpp>
 #include <components/logical_plan/node_create_database.hpp>
 #include <components/logical_plan/node_create_index.hpp>
@@ -66,6 +68,8 @@ namespace services::wal {
         void create_index(const session_id_t& session,
                           address_t& sender,
                           components::logical_plan::node_create_index_ptr data);
+        void truncate(services::wal::id_t wal_id);
+        void flush();
         ~wal_replicate_t() override;
 
         auto make_type() const noexcept -> const char* const;
@@ -84,10 +88,37 @@ namespace services::wal {
         actor_zeta::behavior_t update_one_;
         actor_zeta::behavior_t update_many_;
         actor_zeta::behavior_t create_index_;
-
-        void send_success(const session_id_t& session, address_t& sender);
-
-        virtual void write_buffer(buffer_t& buffer);
+        actor_zeta::behavior_t truncate_;
+        actor_zeta::behavior_t flush_;
+
+        // record packed into commit_buffer_, its session gets success once the record is durable
+        struct pending_commit_t {
+            session_id_t session;
+            address_t sender;
+            services::wal::id_t id;
+        };
+
+        // a file of the wal, records of a segment follow a header holding the id of its first record
+        struct segment_t {
+            services::wal::id_t first_id;
+            std::filesystem::path path;
+        };
+
+        void send_success(const session_id_t& session, address_t& sender, services::wal::id_t id);
+        void send_error(const session_id_t& session, address_t& sender, services::wal::id_t id);
+        void commit(const session_id_t& session, address_t& sender);
+        void write_pending();
+        // false if the group could not be synced
+        bool write_group();
+
+        void open_segments();
+        void open_segment(services::wal::id_t first_id);
+        void convert_single_file();
+        void convert_segment_v1(const std::filesystem::path& path, services::wal::id_t first_id);
+        buffer_t read_segment(const segment_t& segment);
+        std::vector<record_t> read_records(services::wal::id_t wal_id);
+
+        virtual bool write_buffer(buffer_t& buffer);
         virtual void read_buffer(buffer_t& buffer, size_t start_index, size_t size) const;
 
         template<class T>
@@ -97,6 +128,7 @@ namespace services::wal {
         bool find_start_record(services::wal::id_t wal_id, std::size_t& start_index) const;
         services::wal::id_t read_id(std::size_t start_index) const;
         record_t read_record(std::size_t start_index) const;
+        static record_t read_record(buffer_t& data, std::size_t start_index);
         size_tt read_size(size_t start_index) const;
         buffer_t read(size_t start_index, size_t finish_index) const;
 
@@ -105,7 +137,16 @@ namespace services::wal {
         atomic_id_t id_{0};
         crc32_t last_crc32_{0};
         core::filesystem::local_file_system_t fs_;
+        std::vector<segment_t> segments_;
+        // active segment, the last one of segments_
         file_ptr file_;
+        std::uint64_t segment_bytes_{0};
+        buffer_t commit_buffer_;
+        std::vector<pending_commit_t> pending_;
+        std::chrono::steady_clock::time_point group_started_;
+        bool flush_scheduled_{false};
+        // records pending when the flush was sent, more of them at its arrival means the mailbox was not drained
+        size_t flush_pending_{0};
 
 #ifdef DEV_MODE
     public:
@@ -115,6 +156,7 @@ namespace services::wal {
         record_t test_read_record(std::size_t start_index) const;
         size_tt test_read_size(size_t start_index) const;
         buffer_t test_read(size_t start_index, size_t finish_index) const;
+        std::vector<record_t> test_read_records(services::wal::id_t wal_id);
 #endif
     };
 
@@ -127,7 +169,7 @@ namespace services::wal {
         void load(const session_id_t& session, address_t& sender, services::wal::id_t wal_id);
 
     private:
-        void write_buffer(buffer_t&) final;
+        bool write_buffer(buffer_t&) final;
         void read_buffer(buffer_t& buffer, size_t start_index, size_t size) const final;
     };
 